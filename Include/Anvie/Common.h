@@ -36,6 +36,9 @@
 #include <stdio.h>
 #include <stdlib.h>
 
+/* crossgui-utils */
+#include <Anvie/CrossGui/Utils/Allocator.h>
+
 /********************************** CONVINIENT WRAPPER MACROS *************************************/
 
 
@@ -43,12 +46,22 @@
 #define DESTRUCTOR               __attribute__ ((destructor))
 #define FORCE_INLINE             __attribute__ ((always_inline))
 #define UNUSED(x)                ((void)(x))
-#define NEW(type)                (type *)calloc (1, sizeof (type))
-#define ALLOCATE(type, n)        (type *)calloc (n, sizeof (type))
-#define REALLOCATE(ptr, type, n) (type *)realloc (ptr, n * sizeof (type));
-#define FREE(x)                  free ((void *)(x))
 #define PACKED                   __attribute__ ((packed))
 
+/**
+ * Heap allocations go through the tracking allocator (see Allocator.h).
+ * A source file can account its allocations to a specific subsystem by
+ * defining @c ALLOCATOR_TAG before including any header.
+ * */
+#ifndef ALLOCATOR_TAG
+#    define ALLOCATOR_TAG ALLOCATOR_TAG_GENERAL
+#endif
+
+#define NEW(type)                (type *)allocator_calloc (1, sizeof (type), ALLOCATOR_TAG)
+#define ALLOCATE(type, n)        (type *)allocator_calloc (n, sizeof (type), ALLOCATOR_TAG)
+#define REALLOCATE(ptr, type, n) (type *)allocator_realloc (ptr, (n) * sizeof (type), ALLOCATOR_TAG)
+#define FREE(x)                  allocator_free ((void *)(x))
+
 #define ALIGN_UP(x, y) (x + (y - (x % y)))
 #define ALIGN_DOWN(x, y) (x - (x % y)))
 
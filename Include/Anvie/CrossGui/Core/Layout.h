@@ -0,0 +1,152 @@
+/**
+ * @file Layout.h
+ * @date Sun, 18th October 2026
+ * @author Siddharth Mishra (admin@brightprogrammer.in)
+ * @copyright Copyright 2024 Siddharth Mishra
+ * @copyright Copyright 2024 Anvie Labs
+ *
+ * Copyright 2024 Siddharth Mishra, Anvie Labs
+ * 
+ * Redistribution and use in source and binary forms, with or without modification, are permitted 
+ * provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+ *    and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions
+ *    and the following disclaimer in the documentation and/or other materials provided with the
+ *    distribution.
+ * 
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse
+ *    or promote products derived from this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND 
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * */
+
+#ifndef ANVIE_CROSSGUI_CORE_LAYOUT_H
+#define ANVIE_CROSSGUI_CORE_LAYOUT_H
+
+#include <Anvie/Types.h>
+
+/* crossgui-utils */
+#include <Anvie/CrossGui/Utils/JobSystem.h>
+#include <Anvie/CrossGui/Utils/Maths.h>
+
+typedef struct XuiWidgetTree XuiWidgetTree;
+
+/**
+ * @b Identifies a widget in it's tree. Stays valid until widget is destroyed.
+ * */
+typedef Uint32 XuiWidgetId;
+
+/**
+ * @b Number of measurements remembered by each widget.
+ *
+ * A widget is usually measured once by it's parent to find how much space it
+ * wants, and once more with the size it was actually given.
+ * */
+#define XUI_LAYOUT_MEASURE_CACHE_SIZE 2
+
+/**
+ * @b How children of a widget are placed.
+ * */
+typedef enum XuiLayoutDirection {
+    XUI_LAYOUT_DIRECTION_NONE   = 0, /**< @b Children are placed by hand, with their bounds. */
+    XUI_LAYOUT_DIRECTION_ROW    = 1, /**< @b Children are placed left to right. */
+    XUI_LAYOUT_DIRECTION_COLUMN = 2, /**< @b Children are placed top to bottom. */
+    XUI_LAYOUT_DIRECTION_MAX
+} XuiLayoutDirection;
+
+/**
+ * @b How children are distributed along direction of their parent, when they
+ * don't fill it.
+ * */
+typedef enum XuiLayoutJustify {
+    XUI_LAYOUT_JUSTIFY_START         = 0,
+    XUI_LAYOUT_JUSTIFY_CENTER        = 1,
+    XUI_LAYOUT_JUSTIFY_END           = 2,
+    XUI_LAYOUT_JUSTIFY_SPACE_BETWEEN = 3, /**< @b Leftover space is put between children. */
+    XUI_LAYOUT_JUSTIFY_MAX
+} XuiLayoutJustify;
+
+/**
+ * @b How children are placed across direction of their parent.
+ * */
+typedef enum XuiLayoutAlign {
+    XUI_LAYOUT_ALIGN_STRETCH = 0, /**< @b Children without a fixed size fill their parent. */
+    XUI_LAYOUT_ALIGN_START   = 1,
+    XUI_LAYOUT_ALIGN_CENTER  = 2,
+    XUI_LAYOUT_ALIGN_END     = 3,
+    XUI_LAYOUT_ALIGN_MAX
+} XuiLayoutAlign;
+
+/**
+ * @b Layout properties of a widget, modeled after CSS flexbox.
+ *
+ * Edges are stored as (left, top, right, bottom) in (x, y, z, w). A zero
+ * filled struct is a widget sized by it's content, that places it's children
+ * by hand, and neither grows nor shrinks.
+ * */
+typedef struct XuiWidgetLayout {
+    Vec4f   padding;   /**< @b Space between bounds of widget and it's children. */
+    Vec4f   margin;    /**< @b Space around bounds of widget, inside it's parent. */
+    Vec2f   size;      /**< @b Fixed width and height, zero to size from content. */
+    Float32 grow;      /**< @b Share of free space of parent given to this widget. */
+    Float32 shrink;    /**< @b Share of overflow of parent taken from this widget. */
+    Float32 gap;       /**< @b Space between children, along direction. */
+    Uint32  direction; /**< @b One of @c XuiLayoutDirection. */
+    Uint32  justify;   /**< @b One of @c XuiLayoutJustify. */
+    Uint32  align;     /**< @b One of @c XuiLayoutAlign. */
+} XuiWidgetLayout;
+
+/**
+ * @b Measure content of a widget, like a label measuring it's text.
+ *
+ * Must not change the tree it's called for.
+ *
+ * @param tree
+ * @param id Widget being measured.
+ * @param available Space available for content, @c INFINITY on an axis without a limit.
+ * @param data User data given when callback was set.
+ *
+ * @return Width and height of content, without padding.
+ * */
+typedef Vec2f (*XuiWidgetMeasure) (
+    XuiWidgetTree *tree,
+    XuiWidgetId    id,
+    Vec2f          available,
+    void          *data
+);
+
+/**
+ * @b Results of layout remembered by a widget, until it or a descendant changes.
+ * */
+typedef struct XuiLayoutCache {
+    Vec2f  available[XUI_LAYOUT_MEASURE_CACHE_SIZE]; /**< @b Space widget was measured in. */
+    Vec2f  measured[XUI_LAYOUT_MEASURE_CACHE_SIZE];  /**< @b Size measured in that space. */
+    Uint32 count;                                    /**< @b Number of valid measurements. */
+    Uint32 next;                                     /**< @b Measurement replaced next. */
+    Vec2f  size;     /**< @b Size children were laid out in last time. */
+    Bool   is_dirty; /**< @b Widget or a descendant changed since last layout. */
+} XuiLayoutCache;
+
+XuiWidgetTree *xui_widget_tree_layout (XuiWidgetTree *tree, Vec2f size);
+XuiWidgetTree *
+    xui_widget_tree_layout_parallel (XuiWidgetTree *tree, Vec2f size, JobSystem *job_system);
+XuiWidgetTree *xui_widget_set_layout (XuiWidgetTree *tree, XuiWidgetId id, XuiWidgetLayout *layout);
+XuiWidgetTree *xui_widget_set_measure (
+    XuiWidgetTree   *tree,
+    XuiWidgetId      id,
+    XuiWidgetMeasure measure,
+    void            *data
+);
+XuiWidgetTree *xui_widget_invalidate_layout (XuiWidgetTree *tree, XuiWidgetId id);
+
+#endif // ANVIE_CROSSGUI_CORE_LAYOUT_H
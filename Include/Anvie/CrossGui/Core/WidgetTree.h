@@ -0,0 +1,186 @@
+/**
+ * @file WidgetTree.h
+ * @date Sun, 18th October 2026
+ * @author Siddharth Mishra (admin@brightprogrammer.in)
+ * @copyright Copyright 2024 Siddharth Mishra
+ * @copyright Copyright 2024 Anvie Labs
+ *
+ * Copyright 2024 Siddharth Mishra, Anvie Labs
+ * 
+ * Redistribution and use in source and binary forms, with or without modification, are permitted 
+ * provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+ *    and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions
+ *    and the following disclaimer in the documentation and/or other materials provided with the
+ *    distribution.
+ * 
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse
+ *    or promote products derived from this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND 
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * */
+
+#ifndef ANVIE_CROSSGUI_CORE_WIDGET_TREE_H
+#define ANVIE_CROSSGUI_CORE_WIDGET_TREE_H
+
+#include <Anvie/Types.h>
+
+/* crossgui-graphics-api */
+#include <Anvie/CrossGui/Plugin/Graphics/Graphics.h>
+
+/* crossgui-utils */
+#include <Anvie/CrossGui/Utils/AabbTree.h>
+#include <Anvie/CrossGui/Utils/Maths.h>
+#include <Anvie/CrossGui/Utils/Vector.h>
+
+/* crossgui-core */
+#include <Anvie/CrossGui/Core/Layout.h>
+
+/**
+ * @b Widget ID that never refers to a widget.
+ * */
+#define XUI_WIDGET_NONE 0
+
+/**
+ * @b Maximum depth of a widget in tree. Depth is used to draw children over
+ * their parents, so it's mapped to a fixed range of Z values.
+ * */
+#define XUI_WIDGET_DEPTH_MAX 1024
+
+/**
+ * @b Boxes of widgets are enlarged by this much in spatial index, so widgets
+ * moving or growing by less than this are not reinserted.
+ * */
+#define XUI_WIDGET_SPATIAL_MARGIN 4.f
+
+/**
+ * @b What a widget draws.
+ * */
+typedef enum XuiWidgetKind {
+    XUI_WIDGET_KIND_CONTAINER = 0, /**< @b Draws nothing, only groups it's children. */
+    XUI_WIDGET_KIND_MESH      = 1, /**< @b Draws a mesh, stretched over it's bounds. */
+    XUI_WIDGET_KIND_PRIMITIVE = 2, /**< @b Draws an analytic primitive filling it's bounds. */
+    XUI_WIDGET_KIND_MAX
+} XuiWidgetKind;
+
+/**
+ * @b Reasons a widget needs to be visited in next update.
+ * */
+typedef enum XuiWidgetDirtyMask {
+    XUI_WIDGET_DIRTY_STYLE      = 1 << 0, /**< @b What widget draws changed. */
+    XUI_WIDGET_DIRTY_SUBTREE    = 1 << 1, /**< @b Bounds or visibility changed, descendants too. */
+    XUI_WIDGET_DIRTY_DESCENDANT = 1 << 2, /**< @b Some descendant is dirty. */
+} XuiWidgetDirtyMask;
+
+/**
+ * @b Appearance of a widget. Border and corner radii are used by primitives only.
+ * */
+typedef struct XuiWidgetStyle {
+    Vec4f   color;        /**< @b Fill color. */
+    Vec4f   border_color; /**< @b Color of border. */
+    Vec4f   corner_radii; /**< @b Same as in @c XuiPrimitive2D. */
+    Float32 border_width; /**< @b Width of border, drawn inside bounds. */
+} XuiWidgetStyle;
+
+/**
+ * @b Node of a retained widget tree.
+ *
+ * Fields must only be changed through @c xui_widget_set_* methods, so that
+ * change is noticed by next update.
+ * */
+typedef struct XuiWidget {
+    Vec2f          position;   /**< @b Top left corner, relative to top left corner of parent. */
+    Vec2f          size;       /**< @b Width and height, in logical units. */
+    XuiWidgetStyle style;      /**< @b Appearance of widget. */
+    Uint32         kind;       /**< @b One of @c XuiWidgetKind. */
+    Uint32         shape;      /**< @b Mesh type of meshes, @c XuiPrimitiveType2D of primitives. */
+    Bool           is_visible; /**< @b Hidden widgets hide their descendants too. */
+
+    XuiWidgetLayout  layout;       /**< @b How widget is sized, and it's children placed. */
+    XuiWidgetMeasure measure;      /**< @b Measures content of widget, may be @c Null. */
+    void            *measure_data; /**< @b Passed to @c measure. */
+
+    XuiWidgetId parent;       /**< @b @c XUI_WIDGET_NONE for root. */
+    XuiWidgetId first_child;  /**< @b Children are drawn and kept in order they're created. */
+    XuiWidgetId last_child;   /**< @b Last child, where new children are appended. */
+    XuiWidgetId prev_sibling; /**< @b Previous child of same parent. */
+    XuiWidgetId next_sibling; /**< @b Next child of same parent. */
+    Uint32      depth;        /**< @b Number of ancestors. */
+
+    Vec2f     world_position; /**< @b Top left corner in logical units, computed by update. */
+    Vec2f     world_size;     /**< @b Size as of last update, what is drawn and hit tested. */
+    Bool      is_drawn;       /**< @b Widget and all it's ancestors are visible. */
+    Uint32    dirty;          /**< @b @c XuiWidgetDirtyMask of changes since last update. */
+    XuiSlot2D slot;           /**< @b Persistent draw slot, zero until widget draws something. */
+    Uint32    proxy;          /**< @b Box in spatial index, @c AABB_TREE_NULL if not drawn. */
+    Bool      is_used;        /**< @b False if entry is free for reuse. */
+
+    XuiLayoutCache layout_cache; /**< @b Measurements reused by next layout. */
+} XuiWidget;
+
+NEW_HEAP_VECTOR_STRUCT (XuiWidget, XuiWidgetVector);
+NEW_HEAP_VECTOR_STRUCT (XuiWidgetId, XuiWidgetIdVector);
+NEW_HEAP_VECTOR_STRUCT (Uint64, XuiWidgetKeyVector);
+
+/**
+ * @b Retained tree of widgets, drawn through persistent slots of a graphics plugin.
+ *
+ * Each widget that draws something owns a slot, which plugin keeps drawing
+ * every frame. Changing a widget marks it dirty, and marks all it's ancestors
+ * as having a dirty descendant, stopping at first ancestor already marked.
+ * Dirty widgets are also remembered in a list, so an update visits only them
+ * (and descendants of moved ones) and emits only their slots. A frame where
+ * nothing changed costs nothing, no matter how many widgets there are.
+ *
+ * Layout works the same way, in it's own pass: a changed layout input marks
+ * widget and it's ancestors for layout, and clears their cached measurements.
+ * Layout skips every subtree that is not marked and is given same size as
+ * last time.
+ *
+ * Update also keeps a spatial index of world bounds of drawn widgets in sync,
+ * so widgets under a point or inside a rectangle are found without scanning
+ * all widgets.
+ *
+ * Widgets are stored in a single vector, so pointers returned by
+ * @c xui_widget_get are invalidated by @c xui_widget_create.
+ * */
+typedef struct XuiWidgetTree {
+    XuiWidgetVector      widgets;      /**< @b Widget with ID @c i is at index @c i - 1. */
+    XuiWidgetIdVector    free_widgets; /**< @b IDs of destroyed widgets, for reuse. */
+    XuiWidgetKeyVector   dirty;        /**< @b Depth (high 32 bits) and ID of dirty widgets. */
+    XuiWidgetKeyVector   hits;         /**< @b Depth and ID of widgets found by last query. */
+    AabbTree             spatial;      /**< @b World bounds of drawn widgets, for hit testing. */
+    XuiWidgetId          root;         /**< @b Container holding all other widgets. */
+    XuiGraphicsPlugin   *gplug;        /**< @b Plugin slots are created in. */
+    XuiGraphicsContext  *gctx;         /**< @b Graphics context slots are drawn in. */
+    Uint64               visited;      /**< @b Widgets visited by last update. */
+    Uint64               emitted;      /**< @b Slots updated by last update. */
+    Uint64               laid_out;     /**< @b Widgets whose children were placed by last layout. */
+    Uint64               measured;     /**< @b Measurements not found in cache by last layout. */
+} XuiWidgetTree;
+
+XuiWidgetTree *
+    xui_widget_tree_init (XuiWidgetTree *tree, XuiGraphicsPlugin *gplug, XuiGraphicsContext *gctx);
+XuiWidgetTree *xui_widget_tree_deinit (XuiWidgetTree *tree);
+XuiWidgetTree *xui_widget_tree_update (XuiWidgetTree *tree);
+XuiWidgetId    xui_widget_create (XuiWidgetTree *tree, XuiWidgetId parent);
+XuiWidgetTree *xui_widget_destroy (XuiWidgetTree *tree, XuiWidgetId id);
+XuiWidget     *xui_widget_get (XuiWidgetTree *tree, XuiWidgetId id);
+XuiWidgetTree *
+    xui_widget_set_bounds (XuiWidgetTree *tree, XuiWidgetId id, Vec2f position, Vec2f size);
+XuiWidgetTree *xui_widget_set_style (XuiWidgetTree *tree, XuiWidgetId id, XuiWidgetStyle *style);
+XuiWidgetTree *
+    xui_widget_set_shape (XuiWidgetTree *tree, XuiWidgetId id, Uint32 kind, Uint32 shape);
+XuiWidgetTree *xui_widget_set_visible (XuiWidgetTree *tree, XuiWidgetId id, Bool is_visible);
+
+#endif // ANVIE_CROSSGUI_CORE_WIDGET_TREE_H
@@ -35,7 +35,13 @@
 
 #include "Api/Common.h"
 #include "Api/Graphics.h"
+#include "Api/Line2D.h"
 #include "Api/Mesh2D.h"
+#include "Api/Primitive2D.h"
 #include "Api/GraphicsContext.h"
+#include "Api/Profiler.h"
+#include "Api/Slot2D.h"
+#include "Api/Stats.h"
+#include "Api/Text2D.h"
 
 #endif // ANVIE_CROSSGUI_PLUGIN_GRAPHICS_API_H
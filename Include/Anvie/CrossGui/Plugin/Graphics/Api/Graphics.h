@@ -33,18 +33,32 @@
 #ifndef ANVIE_CROSSGUI_PLUGIN_GRAPHICS_API_GRAPHICS_H
 #define ANVIE_CROSSGUI_PLUGIN_GRAPHICS_API_GRAPHICS_H
 
+#include <Anvie/Types.h>
+
 #include "Common.h"
 
 /* fwd declarations */
 typedef struct XuiGraphicsContext XuiGraphicsContext;
 typedef struct XwWindow           XwWindow;
 typedef struct XuiMeshInstance2D  XuiMeshInstance2D;
+typedef struct XuiView2D          XuiView2D;
+typedef struct XuiPrimitive2D     XuiPrimitive2D;
+typedef struct XuiLineSegment2D   XuiLineSegment2D;
+typedef struct XuiPolyline2D      XuiPolyline2D;
+typedef struct XuiText2D          XuiText2D;
+typedef struct JobSystem          JobSystem;
 
 /**
  * @b Plugin must render given 2D mesh.
  *
  * This is a per-vertex draw call.  
  *
+ * Can be called from several threads at once, on same graphics context,
+ * without any lock. Instances drawn by each thread are kept apart, and are
+ * merged on @c XuiGraphicsDisplay, in order of keys given to
+ * @c XuiGraphicsSetDrawOrder2D. Mesh type is checked only then, so an invalid
+ * mesh type makes display return @c XUI_RENDER_STATUS_ERR.
+ *
  * @param graphics_context The @c XuiGraphicsContext object created for @x xwin.
  * @param xwin @c XwWindow object used to create @c graphics context.
  * @param vertices Array of 2D vertices.
@@ -58,6 +72,141 @@ typedef XuiRenderStatus (*XuiGraphicsDraw2D) (
     XuiMeshInstance2D  *mesh_instance
 );
 
+/**
+ * @b Plugin must render given analytic 2D primitive.
+ *
+ * Primitive does not need any uploaded mesh and is drawn as a single quad,
+ * with shape evaluated per pixel. See @c XuiPrimitive2D.
+ *
+ * Like @c XuiGraphicsDraw2D, can be called from several threads at once.
+ *
+ * @param graphics_context
+ * @param primitive Primitive to be drawn.
+ *
+ * @return @c XUI_RENDER_STATUS_OK on success.
+ * @return @c XUI_RENDER_STATUS_ERR otherwise.
+ * */
+typedef XuiRenderStatus (*XuiGraphicsDrawPrimitive2D) (
+    XuiGraphicsContext *graphics_context,
+    XuiPrimitive2D     *primitive
+);
+
+/**
+ * @b Set ordering key of mesh instances and primitives drawn next by calling
+ * thread, on given graphics context.
+ *
+ * Threads can build parts of a frame in parallel, each drawing with a key of
+ * it's own (eg: index of pane it draws). On @c XuiGraphicsDisplay, instances
+ * are added to batches in increasing order of their keys, and instances with
+ * same key in order they were drawn, so frame is same no matter which thread
+ * finished first. All threads must be done drawing before display is called.
+ *
+ * Key of a thread stays same until changed, and is zero at first.
+ *
+ * @param graphics_context
+ * @param order Ordering key.
+ *
+ * @return @c True on success.
+ * @return @c False otherwise.
+ * */
+typedef Bool (*XuiGraphicsSetDrawOrder2D) (XuiGraphicsContext *graphics_context, Uint32 order);
+
+/**
+ * @b Enable or disable sorting of mesh instances and primitives drawn since
+ * previous @c XuiGraphicsDisplay, before they're added to batches.
+ *
+ * When enabled, opaque instances are added front to back and translucent ones
+ * back to front, grouped by mesh, so batches are built in a single pass over
+ * sorted instances. Instances at same depth keep order of their ordering keys
+ * (see @c XuiGraphicsSetDrawOrder2D). Sorting is disabled at first.
+ *
+ * @param graphics_context
+ * @param is_enabled
+ *
+ * @return @c True on success.
+ * @return @c False otherwise.
+ * */
+typedef Bool (*XuiGraphicsSetInstanceSort2D) (
+    XuiGraphicsContext *graphics_context,
+    Bool                is_enabled
+);
+
+/**
+ * @b Plugin must render given thick line segment.
+ *
+ * @param graphics_context
+ * @param line Line segment to be drawn.
+ *
+ * @return @c XUI_RENDER_STATUS_OK on success.
+ * @return @c XUI_RENDER_STATUS_ERR otherwise.
+ * */
+typedef XuiRenderStatus (*XuiGraphicsDrawLine2D) (
+    XuiGraphicsContext *graphics_context,
+    XuiLineSegment2D   *line
+);
+
+/**
+ * @b Plugin must render given polyline.
+ *
+ * Points are copied by plugin, so user code can reuse them after the call.
+ *
+ * @param graphics_context
+ * @param polyline Polyline to be drawn.
+ *
+ * @return @c XUI_RENDER_STATUS_OK on success.
+ * @return @c XUI_RENDER_STATUS_ERR otherwise.
+ * */
+typedef XuiRenderStatus (*XuiGraphicsDrawPolyline2D) (
+    XuiGraphicsContext *graphics_context,
+    XuiPolyline2D      *polyline
+);
+
+/**
+ * @b Plugin must render given text.
+ *
+ * Text is copied by plugin, so user code can reuse it after the call.
+ *
+ * @param graphics_context
+ * @param text Text to be drawn.
+ *
+ * @return @c XUI_RENDER_STATUS_OK on success.
+ * @return @c XUI_RENDER_STATUS_ERR otherwise.
+ * */
+typedef XuiRenderStatus (*XuiGraphicsDrawText2D) (
+    XuiGraphicsContext *graphics_context,
+    XuiText2D          *text
+);
+
+/**
+ * @b Plugin must load distance field glyphs saved by @c XuiGraphicsSdfCacheSave.
+ *
+ * Generating distance fields is much slower than rasterizing bitmaps, so
+ * an application can save them on exit, and load them on next start, to
+ * draw text in @c XUI_TEXT_RENDER_MODE_SDF without generating them again.
+ * Cached glyphs are identified by contents of font file, not by font ID.
+ *
+ * Must be called before any text is drawn in @c XUI_TEXT_RENDER_MODE_SDF
+ * for next @c XuiGraphicsDisplay.
+ *
+ * @param graphics_context
+ * @param path Path of cache file.
+ *
+ * @return @c True on success.
+ * @return @c False otherwise, and glyphs already cached stay as they are.
+ * */
+typedef Bool (*XuiGraphicsSdfCacheLoad) (XuiGraphicsContext *graphics_context, CString path);
+
+/**
+ * @b Plugin must save all distance field glyphs currently cached to given file.
+ *
+ * @param graphics_context
+ * @param path Path of cache file, overwritten if it exists.
+ *
+ * @return @c True on success.
+ * @return @c False otherwise.
+ * */
+typedef Bool (*XuiGraphicsSdfCacheSave) (XuiGraphicsContext *graphics_context, CString path);
+
 typedef XuiRenderStatus (*XuiGraphicsDisplay) (
     XuiGraphicsContext *graphics_context,
     XwWindow           *xwin
@@ -74,4 +223,74 @@ typedef XuiRenderStatus (*XuiGraphicsDisplay) (
  * */
 typedef XuiRenderStatus (*XuiGraphicsClear) (XuiGraphicsContext *graphics_context, XwWindow *xwin);
 
+/**
+ * @b Remove all mesh instances, primitives, lines, polylines and text drawn on
+ * given graphics context so far, so next frame can be drawn from scratch.
+ *
+ * Everything drawn stays on screen in every frame until this is called.
+ * Persistent slots are not affected. Glyphs of removed text can be evicted
+ * from glyph atlas afterwards, to make space for glyphs of new text. All
+ * threads must be done drawing before this is called.
+ *
+ * @param graphics_context
+ *
+ * @return @c True on success.
+ * @return @c False otherwise.
+ * */
+typedef Bool (*XuiGraphicsReset2D) (XuiGraphicsContext *graphics_context);
+
+/**
+ * @b Allocate transient memory for the frame currently being built.
+ *
+ * Memory returned by this method stays valid until the next call to
+ * @c XuiGraphicsDisplay on the same @c XuiGraphicsContext returns. After that
+ * it is recycled by the plugin, without any need to free it.
+ *
+ * @param graphics_context
+ * @param size Number of bytes to allocate.
+ * @param alignment Required alignment, must be a power of two no larger than
+ *        @c alignof(max_align_t), larger ones are rejected. Zero means
+ *        default alignment, which is @c alignof(max_align_t).
+ *
+ * @return Pointer to uninitialized memory on success.
+ * @return @c Null otherwise.
+ * */
+typedef void *(*XuiGraphicsFrameScratchAlloc) (
+    XuiGraphicsContext *graphics_context,
+    Size                size,
+    Size                alignment
+);
+
+/**
+ * @b Set view used to map coordinates of 2D mesh instances to the window.
+ *
+ * View is applied to all instances drawn in next @c XuiGraphicsDisplay call,
+ * as a single push constant, so it can be changed every frame for free.
+ * Until a view is set, instance coordinates are taken as normalized device
+ * coordinates with Y axis pointing up.
+ *
+ * @param graphics_context
+ * @param view View to use. @c Null goes back to normalized device coordinates.
+ *
+ * @return @c True on success.
+ * @return @c False otherwise.
+ * */
+typedef Bool (*XuiGraphicsSetView2D) (XuiGraphicsContext *graphics_context, XuiView2D *view);
+
+/**
+ * @b Share application's job system with plugin, so plugin spreads it's work
+ * (eg: generating distance field glyphs) over same threads as everything
+ * else, instead of starting threads of it's own.
+ *
+ * Plugin submits jobs only from calls made on thread that created job
+ * system. Until a job system is set, plugin does all of it's work on calling
+ * thread. Must be set back to @c Null before job system is destroyed.
+ *
+ * @param jobs Job system to use, or @c Null to stop using one.
+ *
+ * @return @c True on success.
+ * @return @c False otherwise.
+ * */
+typedef Bool (*XuiGraphicsSetJobSystem) (JobSystem *jobs);
+
 #endif // ANVIE_CROSSGUI_PLUGIN_GRAPHICS_API_GRAPHICS_H
@@ -81,4 +81,41 @@ typedef void (*XuiGraphicsContextDestroy) (XuiGraphicsContext *gctx);
  * */
 typedef Bool (*XuiGraphicsContextResize) (XuiGraphicsContext *graphics_context, XwWindow *xwin);
 
+/**
+ * @b Draw frames of graphics context on a thread owned by plugin (opt-in).
+ *
+ * After this, draw and slot calls are only recorded, and display hands
+ * them over to render thread without waiting for GPU. If render thread is
+ * still busy with previous frame, recorded calls are kept and handed over
+ * with next display, so nothing drawn is ever lost. Display then returns
+ * status of frames drawn since previous display, so an error is reported
+ * one or more displays after call that caused it.
+ *
+ * Graphics context must only be used from calling thread until render
+ * thread is stopped. Memory from @c XuiGraphicsFrameScratchAlloc stays
+ * valid until next display returns, just like without a render thread.
+ *
+ * @param graphics_context
+ * @param xwin Window associated with this graphics context.
+ *
+ * @return @c True on success.
+ * @return @c False otherwise.
+ * */
+typedef Bool (*XuiGraphicsContextStartRenderThread) (
+    XuiGraphicsContext *graphics_context,
+    XwWindow           *xwin
+);
+
+/**
+ * @b Stop render thread started by @c XuiGraphicsContextStartRenderThread,
+ * after it draws last frame handed over to it. Destroying a graphics context
+ * stops it's render thread as well.
+ *
+ * @param graphics_context
+ *
+ * @return @c True on success.
+ * @return @c False otherwise.
+ * */
+typedef Bool (*XuiGraphicsContextStopRenderThread) (XuiGraphicsContext *graphics_context);
+
 #endif // ANVIE_CROSSGUI_PLUGIN_GRAPHICS_API_GRAPHICS_CONTEXT_H
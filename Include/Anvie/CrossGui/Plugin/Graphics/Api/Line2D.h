@@ -0,0 +1,100 @@
+/**
+ * @file Line2D.h
+ * @date Sun, 18th October 2026
+ * @author Siddharth Mishra (admin@brightprogrammer.in)
+ * @copyright Copyright 2024 Siddharth Mishra
+ * @copyright Copyright 2024 Anvie Labs
+ *
+ * Copyright 2024 Siddharth Mishra, Anvie Labs
+ * 
+ * Redistribution and use in source and binary forms, with or without modification, are permitted 
+ * provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+ *    and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions
+ *    and the following disclaimer in the documentation and/or other materials provided with the
+ *    distribution.
+ * 
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse
+ *    or promote products derived from this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND 
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * */
+
+#ifndef ANVIE_CROSSGUI_PLUGIN_GRAPHICS_API_LINE2D_H
+#define ANVIE_CROSSGUI_PLUGIN_GRAPHICS_API_LINE2D_H
+
+#include <Anvie/Types.h>
+
+/* crossgui */
+#include <Anvie/CrossGui/Utils/Maths.h>
+
+/**
+ * @b How open ends of lines are drawn.
+ * Values must match the ones used in line.glsl.
+ * */
+typedef enum XuiLineCap2D {
+    XUI_LINE_CAP_2D_BUTT   = 0, /**< @b Line ends exactly at end point. */
+    XUI_LINE_CAP_2D_SQUARE = 1, /**< @b Line extends half width beyond end point. */
+    XUI_LINE_CAP_2D_ROUND  = 2, /**< @b Half disc centered at end point. */
+    XUI_LINE_CAP_2D_MAX
+} XuiLineCap2D;
+
+/**
+ * @b How consecutive segments of a polyline are connected.
+ * Values must match the ones used in line.glsl.
+ * */
+typedef enum XuiLineJoin2D {
+    XUI_LINE_JOIN_2D_MITER = 0, /**< @b Sharp corner, falls back to bevel for very sharp turns. */
+    XUI_LINE_JOIN_2D_BEVEL = 1, /**< @b Corner cut flat. */
+    XUI_LINE_JOIN_2D_ROUND = 2, /**< @b Rounded corner. */
+    XUI_LINE_JOIN_2D_MAX
+} XuiLineJoin2D;
+
+/**
+ * @b A single independent thick line segment.
+ *
+ * Plugin expands each segment to a quad in vertex shader and computes coverage
+ * of the line analytically, so lines of any width and orientation are
+ * anti-aliased. Lines thinner than a pixel are drawn one pixel wide and faded
+ * instead, so they never disappear. Points are in same coordinate space as
+ * mesh instances (see @c XuiView2D).
+ * */
+typedef struct XuiLineSegment2D {
+    Vec4f   color; /**< @b Color of line. */
+    Vec2f   p0;    /**< @b Start point. */
+    Vec2f   p1;    /**< @b End point. */
+    Float32 width; /**< @b Width of line. */
+    Float32 depth; /**< @b Depth of line, same as Z in mesh instance position. */
+    Uint32  cap;   /**< @b One of @c XuiLineCap2D, used on both ends. */
+} XuiLineSegment2D;
+
+/**
+ * @b A connected strip of thick line segments, sharing same style.
+ *
+ * Only points are copied to GPU (8 bytes per point), and style is sent once
+ * per polyline, so long polylines (plots, charts, paths) are much cheaper than
+ * drawing a @c XuiLineSegment2D per segment. Consecutive segments are joined
+ * using @c join without overlapping, so translucent polylines don't have
+ * darker spots at joins.
+ * */
+typedef struct XuiPolyline2D {
+    Vec2f  *points;      /**< @b Array of points. Copied by plugin in draw call. */
+    Uint32  point_count; /**< @b Number of points. Must be at least 2. */
+    Float32 width;       /**< @b Width of line. */
+    Float32 depth;       /**< @b Depth of line, same as Z in mesh instance position. */
+    Uint32  cap;         /**< @b One of @c XuiLineCap2D, used on first and last point. */
+    Uint32  join;        /**< @b One of @c XuiLineJoin2D. */
+    Vec4f   color;       /**< @b Color of line. */
+} XuiPolyline2D;
+
+#endif // ANVIE_CROSSGUI_PLUGIN_GRAPHICS_API_LINE2D_H
@@ -54,14 +54,41 @@ typedef struct XuiMesh2D {
 /**
  * @b Stores metadata about instance of selected mesh.
  * instance : mesh :: muscle : skeleton. 
+ *
+ * Each mesh vertex @c v is placed at :
+ *
+ *     position.xy + rotate (rotation) * shear (skew) * (scale * (v - pivot))
+ *
+ * so any 2D affine transform can be expressed per instance, and rotating or
+ * skewing a mesh (spinners, dial needles, etc...) only updates instance data
+ * instead of uploading a new mesh. Zero rotation, skew and pivot is same as
+ * plain scale and translation, so zero initialized fields can be left out.
  * */
 typedef struct XuiMeshInstance2D {
     Uint32  type;     /**< @b Selected mesh. */
     Vec2f   scale;    /**< @b Scale factor of mesh instance. */
     Vec3f   position; /**< @b Position of mesh instance. */
+    Float32 rotation; /**< @b Rotation in radians around @c pivot, from +X towards +Y axis. */
     Vec4f   color;    /**< @b Color of mesh instance. */
+    Vec2f   skew;     /**< @b Shear factors : x += skew.x * y, then y += skew.y * x. */
+    Vec2f   pivot;    /**< @b Point in mesh space that lands on @c position. */
 } XuiMeshInstance2D;
 
+/**
+ * @b Describes how coordinates of 2D mesh instances are mapped to the window.
+ *
+ * Instance coordinates are in logical units, with origin at top left corner
+ * of window and Y axis pointing down. A point @c p lands on physical pixel
+ * @c (p - origin) * zoom * dpi_scale. Mapping from pixels to clip space is
+ * done by plugin, so user code does not need to know size of the surface, and
+ * resizing, panning or zooming does not require updating any instance.
+ * */
+typedef struct XuiView2D {
+    Vec2f   origin;    /**< @b Logical point shown at top left corner of window (pan). */
+    Float32 zoom;      /**< @b Magnification factor. Zero is same as one. */
+    Float32 dpi_scale; /**< @b Physical pixels per logical unit. Zero is same as one. */
+} XuiView2D;
+
 typedef Bool (*XuiMeshUpload2D) (XuiMesh2D *mesh);
 
 #endif // ANVIE_CROSSGUI_PLUGIN_GRAPHICS_API_MESH2D_H
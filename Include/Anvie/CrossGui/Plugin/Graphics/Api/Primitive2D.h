@@ -0,0 +1,81 @@
+/**
+ * @file Primitive2D.h
+ * @date Sun, 18th October 2026
+ * @author Siddharth Mishra (admin@brightprogrammer.in)
+ * @copyright Copyright 2024 Siddharth Mishra
+ * @copyright Copyright 2024 Anvie Labs
+ *
+ * Copyright 2024 Siddharth Mishra, Anvie Labs
+ * 
+ * Redistribution and use in source and binary forms, with or without modification, are permitted 
+ * provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+ *    and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions
+ *    and the following disclaimer in the documentation and/or other materials provided with the
+ *    distribution.
+ * 
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse
+ *    or promote products derived from this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND 
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * */
+
+#ifndef ANVIE_CROSSGUI_PLUGIN_GRAPHICS_API_PRIMITIVE2D_H
+#define ANVIE_CROSSGUI_PLUGIN_GRAPHICS_API_PRIMITIVE2D_H
+
+#include <Anvie/Types.h>
+
+/* crossgui */
+#include <Anvie/CrossGui/Utils/Maths.h>
+
+/**
+ * @b Shapes that can be drawn as analytic 2D primitives.
+ * Values must match the ones used in primitive.frag.
+ * */
+typedef enum XuiPrimitiveType2D {
+    XUI_PRIMITIVE_TYPE_2D_ROUNDED_RECT = 0, /**< @b Rectangle with per-corner radii. */
+    XUI_PRIMITIVE_TYPE_2D_ELLIPSE      = 1, /**< @b Ellipse, or circle if half size is uniform. */
+    XUI_PRIMITIVE_TYPE_2D_MAX
+} XuiPrimitiveType2D;
+
+/**
+ * @b Instance of an analytic 2D primitive.
+ *
+ * Unlike @c XuiMeshInstance2D, no mesh is needed to draw a primitive. Plugin
+ * draws a single quad per instance and evaluates the signed distance field of
+ * the shape in fragment shader, so edges and corners are resolution independent
+ * and anti-aliased, no matter how much the primitive is scaled or zoomed.
+ *
+ * Primitive is centered at @c position and rotated around it. Fields are in
+ * same coordinate space as mesh instances (see @c XuiView2D). Corner radii are
+ * clamped to the half size, so a rounded rect with large radii turns into a
+ * pill. Zero @c border_width draws a fill only, and a transparent
+ * @c fill_color with a border draws an outline only.
+ * */
+typedef struct XuiPrimitive2D {
+    Vec3f   position;     /**< @b Center of primitive. Z is depth like in mesh instances. */
+    Uint32  type;         /**< @b One of @c XuiPrimitiveType2D. */
+    Vec2f   half_size;    /**< @b Half of width and height (radii for ellipse). */
+    Float32 rotation;     /**< @b Rotation in radians around center, from +X towards +Y axis. */
+    Float32 border_width; /**< @b Width of border, drawn inside the shape edge. */
+
+    /**
+     * @b Corner radii of rounded rect in order top-left, top-right, bottom-right
+     * and bottom-left, where top is towards -Y. Ignored for ellipse.
+     * */
+    Vec4f corner_radii;
+    Vec4f fill_color;   /**< @b Color of inside of primitive. */
+    Vec4f border_color; /**< @b Color of border. */
+} XuiPrimitive2D;
+
+#endif // ANVIE_CROSSGUI_PLUGIN_GRAPHICS_API_PRIMITIVE2D_H
@@ -0,0 +1,54 @@
+/**
+ * @file Profiler.h
+ * @date Sun, 18th October 2026
+ * @author Siddharth Mishra (admin@brightprogrammer.in)
+ * @copyright Copyright 2024 Siddharth Mishra
+ * @copyright Copyright 2024 Anvie Labs
+ *
+ * Copyright 2024 Siddharth Mishra, Anvie Labs
+ * 
+ * Redistribution and use in source and binary forms, with or without modification, are permitted 
+ * provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+ *    and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions
+ *    and the following disclaimer in the documentation and/or other materials provided with the
+ *    distribution.
+ * 
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse
+ *    or promote products derived from this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND 
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * */
+
+#ifndef ANVIE_CROSSGUI_PLUGIN_GRAPHICS_API_PROFILER_H
+#define ANVIE_CROSSGUI_PLUGIN_GRAPHICS_API_PROFILER_H
+
+#include <Anvie/Types.h>
+
+/**
+ * @b Dump CPU profiling zones recorded by the plugin (and any other code sharing
+ * the crossgui-utils profiler) as Chrome trace / Perfetto JSON.
+ *
+ * Zones are recorded only when the plugin is built with @c CROSSGUI_PROFILER enabled.
+ * Otherwise the generated trace will contain no events.
+ *
+ * @param file_path Path of JSON file to write the trace to.
+ * @param window_ns Capture window : only zones that ended within last @c window_ns
+ *        nanoseconds are dumped. Zero dumps everything that's still recorded.
+ *
+ * @return @c True on success.
+ * @return @c False otherwise.
+ * */
+typedef Bool (*XuiGraphicsProfilerDump) (CString file_path, Uint64 window_ns);
+
+#endif // ANVIE_CROSSGUI_PLUGIN_GRAPHICS_API_PROFILER_H
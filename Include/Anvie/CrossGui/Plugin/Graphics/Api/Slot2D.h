@@ -0,0 +1,114 @@
+/**
+ * @file Slot2D.h
+ * @date Sun, 18th October 2026
+ * @author Siddharth Mishra (admin@brightprogrammer.in)
+ * @copyright Copyright 2024 Siddharth Mishra
+ * @copyright Copyright 2024 Anvie Labs
+ *
+ * Copyright 2024 Siddharth Mishra, Anvie Labs
+ * 
+ * Redistribution and use in source and binary forms, with or without modification, are permitted 
+ * provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+ *    and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions
+ *    and the following disclaimer in the documentation and/or other materials provided with the
+ *    distribution.
+ * 
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse
+ *    or promote products derived from this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND 
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * */
+
+#ifndef ANVIE_CROSSGUI_PLUGIN_GRAPHICS_API_SLOT2D_H
+#define ANVIE_CROSSGUI_PLUGIN_GRAPHICS_API_SLOT2D_H
+
+#include <Anvie/Types.h>
+
+/* crossgui-graphics-api */
+#include "Mesh2D.h"
+#include "Primitive2D.h"
+
+/* fwd declarations */
+typedef struct XuiGraphicsContext XuiGraphicsContext;
+
+/**
+ * @b Handle of a persistent draw slot. Zero is never a valid slot.
+ * */
+typedef Uint32 XuiSlot2D;
+
+/**
+ * @b What a slot draws.
+ * */
+typedef enum XuiSlotType2D {
+    XUI_SLOT_TYPE_2D_NONE      = 0, /**< @b Slot draws nothing. */
+    XUI_SLOT_TYPE_2D_MESH      = 1, /**< @b Slot draws a mesh instance. */
+    XUI_SLOT_TYPE_2D_PRIMITIVE = 2, /**< @b Slot draws an analytic primitive. */
+    XUI_SLOT_TYPE_2D_MAX
+} XuiSlotType2D;
+
+/**
+ * @b Content of a persistent draw slot.
+ * */
+typedef struct XuiSlotContent2D {
+    Uint32 type; /**< @b One of @c XuiSlotType2D, selects member of union. */
+
+    union {
+        XuiMeshInstance2D mesh;
+        XuiPrimitive2D    primitive;
+    };
+} XuiSlotContent2D;
+
+/**
+ * @b Plugin must create a new persistent draw slot.
+ *
+ * Unlike instances given to draw methods, content of a slot is kept by plugin
+ * and drawn in every @c XuiGraphicsDisplay, until slot is updated or destroyed.
+ * Only slots updated since last display are uploaded again, so retained user
+ * interfaces pay only for what changed between frames. New slot draws nothing.
+ *
+ * @param graphics_context
+ *
+ * @return Handle of new slot on success.
+ * @return Zero otherwise.
+ * */
+typedef XuiSlot2D (*XuiGraphicsSlotCreate2D) (XuiGraphicsContext *graphics_context);
+
+/**
+ * @b Plugin must replace content of given slot.
+ *
+ * @param graphics_context
+ * @param slot Slot created by @c XuiGraphicsSlotCreate2D.
+ * @param content Content to be drawn from now on, copied by plugin.
+ *
+ * @return @c True on success.
+ * @return @c False otherwise, and slot keeps it's previous content.
+ * */
+typedef Bool (*XuiGraphicsSlotUpdate2D) (
+    XuiGraphicsContext *graphics_context,
+    XuiSlot2D           slot,
+    XuiSlotContent2D   *content
+);
+
+/**
+ * @b Plugin must stop drawing given slot, and free it for reuse.
+ *
+ * @param graphics_context
+ * @param slot Slot created by @c XuiGraphicsSlotCreate2D.
+ *
+ * @return @c True on success.
+ * @return @c False otherwise.
+ * */
+typedef Bool (*XuiGraphicsSlotDestroy2D) (XuiGraphicsContext *graphics_context, XuiSlot2D slot);
+
+#endif // ANVIE_CROSSGUI_PLUGIN_GRAPHICS_API_SLOT2D_H
@@ -0,0 +1,93 @@
+/**
+ * @file Stats.h
+ * @date Sun, 18th October 2026
+ * @author Siddharth Mishra (admin@brightprogrammer.in)
+ * @copyright Copyright 2024 Siddharth Mishra
+ * @copyright Copyright 2024 Anvie Labs
+ *
+ * Copyright 2024 Siddharth Mishra, Anvie Labs
+ * 
+ * Redistribution and use in source and binary forms, with or without modification, are permitted 
+ * provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+ *    and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions
+ *    and the following disclaimer in the documentation and/or other materials provided with the
+ *    distribution.
+ * 
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse
+ *    or promote products derived from this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND 
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * */
+
+#ifndef ANVIE_CROSSGUI_PLUGIN_GRAPHICS_API_STATS_H
+#define ANVIE_CROSSGUI_PLUGIN_GRAPHICS_API_STATS_H
+
+#include <Anvie/Types.h>
+
+/* fwd declarations */
+typedef struct XuiGraphicsContext XuiGraphicsContext;
+
+/**
+ * @b Counters filled by the plugin for a single displayed frame.
+ *
+ * A frame spans from the end of one display call to the end of the next one, so
+ * work done by draw calls issued in between is accounted to the frame that displays it.
+ * */
+typedef struct XuiRenderFrameStats {
+    Uint64 draw_calls;         /**< @b Number of draw commands recorded. */
+    Uint64 batches;            /**< @b Number of non-empty batches drawn. */
+    Uint64 instances;          /**< @b Number of mesh instances drawn. */
+    Uint64 bytes_uploaded;     /**< @b Bytes memcpy'd from host to device memory. */
+    Uint64 device_allocations; /**< @b Number of device memory allocations made. */
+    Uint64 swapchain_reinits;  /**< @b Number of times swapchain was recreated. */
+    Uint64 fence_wait_ns;      /**< @b Time CPU spent blocked on render fences. */
+    Uint64 continue_count;     /**< @b Times @c XUI_RENDER_STATUS_CONTINUE was returned. */
+    Uint64 glyphs_rasterized;  /**< @b Glyphs rendered by font rasterizer, missing in atlas. */
+    Uint64 text_layouts;       /**< @b Text runs laid out, missing in text layout cache. */
+    Uint64 text_layout_bytes;  /**< @b Memory taken by text layout cache after eviction. */
+} XuiRenderFrameStats;
+
+/**
+ * @b Statistics maintained by each graphics context.
+ *
+ * @c min and @c max are computed per field, independently of each other, over all
+ * frames since creation of graphics context or since last reset.
+ * */
+typedef struct XuiRenderStats {
+    Uint64              frame_count; /**< @b Number of frames accounted in stats. */
+    XuiRenderFrameStats last_frame;  /**< @b Stats of most recently displayed frame. */
+    XuiRenderFrameStats total;       /**< @b Running totals over all frames. */
+    XuiRenderFrameStats min;         /**< @b Per-field minimum over all frames. */
+    XuiRenderFrameStats max;         /**< @b Per-field maximum over all frames. */
+} XuiRenderStats;
+
+/**
+ * @b Get a copy of rendering statistics of given graphics context.
+ *
+ * @param graphics_context
+ * @param stats Where the statistics will be copied to.
+ *
+ * @return @c True on success.
+ * @return @c False otherwise.
+ * */
+typedef Bool (*XuiGraphicsGetStats) (XuiGraphicsContext *graphics_context, XuiRenderStats *stats);
+
+/**
+ * @b Reset rendering statistics of given graphics context.
+ *
+ * @param graphics_context
+ * */
+typedef void (*XuiGraphicsResetStats) (XuiGraphicsContext *graphics_context);
+
+#endif // ANVIE_CROSSGUI_PLUGIN_GRAPHICS_API_STATS_H
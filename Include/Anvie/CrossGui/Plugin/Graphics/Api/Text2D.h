@@ -0,0 +1,101 @@
+/**
+ * @file Text2D.h
+ * @date Sun, 18th October 2026
+ * @author Siddharth Mishra (admin@brightprogrammer.in)
+ * @copyright Copyright 2024 Siddharth Mishra
+ * @copyright Copyright 2024 Anvie Labs
+ *
+ * Copyright 2024 Siddharth Mishra, Anvie Labs
+ * 
+ * Redistribution and use in source and binary forms, with or without modification, are permitted 
+ * provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+ *    and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions
+ *    and the following disclaimer in the documentation and/or other materials provided with the
+ *    distribution.
+ * 
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse
+ *    or promote products derived from this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND 
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * */
+
+#ifndef ANVIE_CROSSGUI_PLUGIN_GRAPHICS_API_TEXT2D_H
+#define ANVIE_CROSSGUI_PLUGIN_GRAPHICS_API_TEXT2D_H
+
+#include <Anvie/Types.h>
+
+/* crossgui */
+#include <Anvie/CrossGui/Utils/Maths.h>
+
+/**
+ * @b How glyphs of a text run are rasterized and drawn.
+ * */
+typedef enum XuiTextRenderMode {
+    /**
+     * @b Coverage bitmaps rasterized at the size text covers on screen. Best
+     * quality at small sizes, but each new size (eg: while zooming) rasterizes
+     * glyphs again.
+     * */
+    XUI_TEXT_RENDER_MODE_BITMAP = 0,
+
+    /**
+     * @b Signed distance fields generated once at a fixed size, and used for
+     * every size, with edges reconstructed per pixel. Best suited for text
+     * that is scaled or zoomed, and for large text.
+     * */
+    XUI_TEXT_RENDER_MODE_SDF,
+} XuiTextRenderMode;
+
+/**
+ * @b A run of text drawn with a single font, size and color.
+ *
+ * Text is laid out on a single baseline starting at @c position, with a new
+ * line started after each line terminator (eg: @c '\n'), and at last line
+ * break opportunity (eg: after a space) before a word that would cross
+ * @c max_width, if it's set. Glyphs are rasterized by the plugin at the
+ * size they cover on screen (see @c XuiView2D) or as distance fields (see
+ * @c XuiTextRenderMode), cached in a glyph atlas and drawn as textured quads,
+ * so drawing same text again costs no rasterization. Layouts are cached too,
+ * so text that does not change between frames is laid out only once.
+ *
+ * Coordinates are in same space as mesh instances with Y axis pointing down,
+ * so text is meant to be drawn with a view set.
+ * */
+typedef struct XuiText2D {
+    CString text;      /**< @b UTF-8 encoded text. Copied by plugin. */
+    Uint32  length;    /**< @b Length of @c text in bytes. Zero if @c text is NUL terminated. */
+    Uint32  font;      /**< @b ID of font given to @c XuiFontLoad. */
+    Float32 size;      /**< @b Font size (height of em square) in logical units. */
+    Vec3f   position;  /**< @b Left end of baseline of first line, Z is depth. */
+    Vec4f   color;     /**< @b Color of text. */
+    Float32 max_width; /**< @b Width lines are wrapped at, in logical units. Zero to not wrap. */
+
+    XuiTextRenderMode mode; /**< @b Bitmap (default) or distance field glyphs. */
+} XuiText2D;
+
+/**
+ * @b Plugin must load font from given file and make it available as @p font.
+ *
+ * Like mesh types, font IDs are assigned by user code, and loaded fonts stay
+ * available as long as the plugin is loaded.
+ *
+ * @param font A unique ID for this font.
+ * @param path Path of font file (TrueType, OpenType, etc...).
+ *
+ * @return @c True on success.
+ * @return @c False otherwise.
+ * */
+typedef Bool (*XuiFontLoad) (Uint32 font, CString path);
+
+#endif // ANVIE_CROSSGUI_PLUGIN_GRAPHICS_API_TEXT2D_H
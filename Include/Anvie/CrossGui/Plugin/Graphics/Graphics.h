@@ -44,13 +44,43 @@ typedef struct XuiGraphicsPlugin {
     XuiGraphicsContextDestroy context_destroy;
     XuiGraphicsContextResize  context_resize;
 
+    XuiGraphicsContextStartRenderThread context_start_render_thread;
+    XuiGraphicsContextStopRenderThread  context_stop_render_thread;
+
     /* mesh 2d methods */
     XuiMeshUpload2D mesh_upload_2d;
 
+    /* font methods */
+    XuiFontLoad             font_load;
+    XuiGraphicsSdfCacheLoad sdf_cache_load;
+    XuiGraphicsSdfCacheSave sdf_cache_save;
+
     /* drawing methods */
-    XuiGraphicsDraw2D draw_2d;
-    XuiGraphicsDisplay display;
-    XuiGraphicsClear  clear;
+    XuiGraphicsDraw2D            draw_2d;
+    XuiGraphicsDrawPrimitive2D   draw_primitive_2d;
+    XuiGraphicsSetDrawOrder2D    set_draw_order_2d;
+    XuiGraphicsSetInstanceSort2D set_instance_sort_2d;
+    XuiGraphicsDrawLine2D        draw_line_2d;
+    XuiGraphicsDrawPolyline2D    draw_polyline_2d;
+    XuiGraphicsDrawText2D        draw_text_2d;
+    XuiGraphicsDisplay           display;
+    XuiGraphicsClear             clear;
+    XuiGraphicsReset2D           reset_2d;
+    XuiGraphicsFrameScratchAlloc frame_scratch_alloc;
+    XuiGraphicsSetView2D         set_view_2d;
+
+    /* persistent slot methods */
+    XuiGraphicsSlotCreate2D  slot_create_2d;
+    XuiGraphicsSlotUpdate2D  slot_update_2d;
+    XuiGraphicsSlotDestroy2D slot_destroy_2d;
+
+    /* job system methods */
+    XuiGraphicsSetJobSystem set_job_system;
+
+    /* profiling methods */
+    XuiGraphicsProfilerDump profiler_dump;
+    XuiGraphicsGetStats     get_stats;
+    XuiGraphicsResetStats   reset_stats;
 } XuiGraphicsPlugin;
 
 #endif // ANVIE_CROSSGUI_PLUGIN_GRAPHICS_GRAPHICS_H
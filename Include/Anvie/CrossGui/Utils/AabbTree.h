@@ -0,0 +1,108 @@
+/**
+ * @file AabbTree.h
+ * @date Sun, 18th October 2026
+ * @author Siddharth Mishra (admin@brightprogrammer.in)
+ * @copyright Copyright 2024 Siddharth Mishra
+ * @copyright Copyright 2024 Anvie Labs
+ *
+ * Copyright 2024 Siddharth Mishra, Anvie Labs
+ * 
+ * Redistribution and use in source and binary forms, with or without modification, are permitted 
+ * provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+ *    and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions
+ *    and the following disclaimer in the documentation and/or other materials provided with the
+ *    distribution.
+ * 
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse
+ *    or promote products derived from this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND 
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * */
+
+#ifndef ANVIE_CROSSGUI_UTILS_AABB_TREE_H
+#define ANVIE_CROSSGUI_UTILS_AABB_TREE_H
+
+#include <Anvie/Types.h>
+
+/* crossgui-utils */
+#include <Anvie/CrossGui/Utils/Maths.h>
+#include <Anvie/CrossGui/Utils/Vector.h>
+
+/**
+ * @b Index of no node, returned instead of a proxy on failure.
+ * */
+#define AABB_TREE_NULL ((Uint32)-1)
+
+/**
+ * @b Maximum height of a tree. Rotations keep trees close to balanced, so
+ * this is never reached, even with billions of boxes.
+ * */
+#define AABB_TREE_HEIGHT_MAX 128
+
+/**
+ * @b Called for each box overlapping a query.
+ *
+ * @param data Data given when box was inserted.
+ * @param user User data given to query.
+ *
+ * @return @c True to continue query.
+ * @return @c False to stop it.
+ * */
+typedef Bool (*AabbTreeQueryFn) (Uint64 data, void *user);
+
+/**
+ * @b Node of an AABB tree. Leaves hold boxes inserted by user, and each
+ * internal node holds union of boxes of it's two children.
+ * */
+typedef struct AabbTreeNode {
+    Vec2f  min;         /**< @b Top left corner of box, enlarged by margin for leaves. */
+    Vec2f  max;         /**< @b Bottom right corner of box, enlarged by margin for leaves. */
+    Uint64 data;        /**< @b User data of leaves. */
+    Uint32 parent;      /**< @b Parent node, or next free node of free nodes. */
+    Uint32 children[2]; /**< @b Both @c AABB_TREE_NULL for leaves. */
+    Int32  height;      /**< @b Zero for leaves, -1 for free nodes. */
+} AabbTreeNode;
+
+NEW_HEAP_VECTOR_STRUCT (AabbTreeNode, AabbTreeNodeVector);
+
+/**
+ * @b Dynamic bounding volume hierarchy of axis aligned boxes.
+ *
+ * Boxes are inserted next to the node whose box grows least by including
+ * them, and tree is rebalanced with rotations on the way back up, so both
+ * insertion and queries cost O(log n). Boxes are enlarged by a margin when
+ * stored, so boxes moving or growing a little don't have to be reinserted.
+ * Queries report every box whose enlarged box overlaps queried area, so
+ * users should test exact boxes themselves.
+ *
+ * Proxies returned by insertion are indices of leaf nodes, and stay valid
+ * until removed.
+ * */
+typedef struct AabbTree {
+    AabbTreeNodeVector nodes;      /**< @b All nodes, including free ones. */
+    Uint32             root;       /**< @b @c AABB_TREE_NULL if tree is empty. */
+    Uint32             free_nodes; /**< @b First free node, @c AABB_TREE_NULL if there's none. */
+    Uint32             leaf_count; /**< @b Number of boxes in tree. */
+    Float32            margin;     /**< @b Boxes are enlarged by this much on each side. */
+} AabbTree;
+
+AabbTree *aabb_tree_init (AabbTree *tree, Float32 margin);
+AabbTree *aabb_tree_deinit (AabbTree *tree);
+Uint32    aabb_tree_insert (AabbTree *tree, Vec2f min, Vec2f max, Uint64 data);
+AabbTree *aabb_tree_remove (AabbTree *tree, Uint32 proxy);
+AabbTree *aabb_tree_move (AabbTree *tree, Uint32 proxy, Vec2f min, Vec2f max);
+AabbTree *aabb_tree_query (AabbTree *tree, Vec2f min, Vec2f max, AabbTreeQueryFn fn, void *user);
+Int32     aabb_tree_get_height (AabbTree *tree);
+
+#endif // ANVIE_CROSSGUI_UTILS_AABB_TREE_H
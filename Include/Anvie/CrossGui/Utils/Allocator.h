@@ -0,0 +1,95 @@
+/**
+ * @file Allocator.h
+ * @date Sun, 18th October 2026
+ * @author Siddharth Mishra (admin@brightprogrammer.in)
+ * @copyright Copyright 2024 Siddharth Mishra
+ * @copyright Copyright 2024 Anvie Labs
+ *
+ * Copyright 2024 Siddharth Mishra, Anvie Labs
+ * 
+ * Redistribution and use in source and binary forms, with or without modification, are permitted 
+ * provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+ *    and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions
+ *    and the following disclaimer in the documentation and/or other materials provided with the
+ *    distribution.
+ * 
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse
+ *    or promote products derived from this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND 
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * */
+
+#ifndef ANVIE_CROSSGUI_UTILS_ALLOCATOR_H
+#define ANVIE_CROSSGUI_UTILS_ALLOCATOR_H
+
+#include <Anvie/Types.h>
+
+/**
+ * @b Subsystem an allocation is accounted to.
+ *
+ * Every heap allocation made through @c NEW, @c ALLOCATE, @c REALLOCATE and vectors
+ * carries a tag. A source file selects the tag of its allocations by defining
+ * @c ALLOCATOR_TAG before including any header, otherwise @c ALLOCATOR_TAG_GENERAL is used.
+ * */
+typedef enum AllocatorTag {
+    ALLOCATOR_TAG_GENERAL = 0,  /**< @b Anything not accounted elsewhere. */
+    ALLOCATOR_TAG_MESH_MANAGER, /**< @b Mesh data owned by mesh manager. */
+    ALLOCATOR_TAG_BATCHES,      /**< @b Batches of mesh instances owned by renderer. */
+    ALLOCATOR_TAG_SWAPCHAIN,    /**< @b Swapchain images and reinit handlers. */
+    ALLOCATOR_TAG_PLUGIN,       /**< @b Plugin global state, contexts, pipelines, etc... */
+    ALLOCATOR_TAG_FRAME_ARENA,  /**< @b Blocks backing per-frame transient memory. */
+    ALLOCATOR_TAG_PLOT,         /**< @b Samples and level of detail pyramids of plots. */
+    ALLOCATOR_TAG_GLYPH_ATLAS,  /**< @b Glyph atlas pixels and cached glyphs. */
+    ALLOCATOR_TAG_TEXT_LAYOUT,  /**< @b Cached text layouts. */
+    ALLOCATOR_TAG_WIDGETS,      /**< @b Widgets of retained widget trees. */
+    ALLOCATOR_TAG_SPATIAL,      /**< @b Nodes of spatial indices, used for hit testing. */
+    ALLOCATOR_TAG_MAX
+} AllocatorTag;
+
+/**
+ * @b Backend that actually provides memory. Defaults to libc malloc/realloc/free.
+ *
+ * The backend does not need to zero memory or keep track of sizes, that is done
+ * by the tracking layer on top of it. This makes it easy to plug in something like
+ * jemalloc arenas (mallocx/rallocx/dallocx with @c MALLOCX_ARENA in @c user_data).
+ * */
+typedef struct AllocatorBackend {
+    void *(*allocate) (void *user_data, Size size);
+    void *(*reallocate) (void *user_data, void *ptr, Size size);
+    void (*free) (void *user_data, void *ptr);
+    void *user_data;
+} AllocatorBackend;
+
+/**
+ * @b Allocation statistics of a single tag.
+ * */
+typedef struct AllocatorStats {
+    Uint64 live_bytes;       /**< @b Bytes currently allocated. */
+    Uint64 peak_bytes;       /**< @b Maximum value @c live_bytes ever reached. */
+    Uint64 live_allocations; /**< @b Allocations not freed yet. */
+    Uint64 allocation_count; /**< @b Total number of allocations ever made. */
+} AllocatorStats;
+
+void *allocator_alloc (Size size, AllocatorTag tag);
+void *allocator_calloc (Size count, Size size, AllocatorTag tag);
+void *allocator_realloc (void *ptr, Size size, AllocatorTag tag);
+void  allocator_free (void *ptr);
+
+Bool    allocator_set_backend (const AllocatorBackend *backend);
+Bool    allocator_get_stats (AllocatorTag tag, AllocatorStats *stats);
+CString allocator_tag_name (AllocatorTag tag);
+void    allocator_set_leak_report (Bool enable);
+Bool    allocator_report_leaks();
+
+#endif // ANVIE_CROSSGUI_UTILS_ALLOCATOR_H
@@ -0,0 +1,68 @@
+/**
+ * @file Arena.h
+ * @date Sun, 18th October 2026
+ * @author Siddharth Mishra (admin@brightprogrammer.in)
+ * @copyright Copyright 2024 Siddharth Mishra
+ * @copyright Copyright 2024 Anvie Labs
+ *
+ * Copyright 2024 Siddharth Mishra, Anvie Labs
+ * 
+ * Redistribution and use in source and binary forms, with or without modification, are permitted 
+ * provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+ *    and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions
+ *    and the following disclaimer in the documentation and/or other materials provided with the
+ *    distribution.
+ * 
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse
+ *    or promote products derived from this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND 
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * */
+
+#ifndef ANVIE_CROSSGUI_UTILS_ARENA_H
+#define ANVIE_CROSSGUI_UTILS_ARENA_H
+
+#include <Anvie/Types.h>
+
+/* crossgui-utils */
+#include <Anvie/CrossGui/Utils/Allocator.h>
+
+typedef struct ArenaBlock ArenaBlock;
+
+/**
+ * @b Linear (bump) allocator for transient data.
+ *
+ * Memory is handed out from large blocks and is never freed individually,
+ * instead the whole arena is reset at once. On reset, an arena that needed more
+ * than one block is coalesced into a single block big enough to hold everything
+ * allocated since last reset, so once the arena has seen its peak usage, it stops
+ * making heap allocations altogether.
+ * */
+typedef struct Arena {
+    ArenaBlock  *blocks;     /**< @b Block list, block currently allocated from comes first. */
+    Size         block_size; /**< @b Minimum size of a new block. */
+    Size         used;       /**< @b Bytes handed out since last reset (including padding). */
+    Size         peak;       /**< @b Maximum value of @c used ever seen. */
+    AllocatorTag tag;        /**< @b Tag block allocations are accounted to. */
+} Arena;
+
+Arena *arena_init (Arena *arena, Size block_size, AllocatorTag tag);
+Arena *arena_deinit (Arena *arena);
+void  *arena_alloc (Arena *arena, Size size, Size alignment);
+Arena *arena_reset (Arena *arena);
+
+#define ARENA_ALLOCATE(arena, type, n)                                                             \
+    (type *)arena_alloc (arena, sizeof (type) * (n), _Alignof (type))
+
+#endif // ANVIE_CROSSGUI_UTILS_ARENA_H
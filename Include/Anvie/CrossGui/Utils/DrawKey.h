@@ -0,0 +1,74 @@
+/**
+ * @file DrawKey.h
+ * @date Sun, 18th October 2026
+ * @author Siddharth Mishra (admin@brightprogrammer.in)
+ * @copyright Copyright 2024 Siddharth Mishra
+ * @copyright Copyright 2024 Anvie Labs
+ *
+ * Copyright 2024 Siddharth Mishra, Anvie Labs
+ * 
+ * Redistribution and use in source and binary forms, with or without modification, are permitted 
+ * provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+ *    and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions
+ *    and the following disclaimer in the documentation and/or other materials provided with the
+ *    distribution.
+ * 
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse
+ *    or promote products derived from this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND 
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * */
+
+#ifndef ANVIE_CROSSGUI_UTILS_DRAW_KEY_H
+#define ANVIE_CROSSGUI_UTILS_DRAW_KEY_H
+
+#include <Anvie/Types.h>
+
+/**
+ * @b Bits of a draw key, most significant first : pass, pipeline, mesh type
+ * and depth. Sorting draw keys sorts instances in order they must be drawn.
+ * */
+#define DRAW_KEY_PASS_SHIFT      56
+#define DRAW_KEY_PIPELINE_SHIFT  48
+#define DRAW_KEY_MESH_TYPE_SHIFT 24
+#define DRAW_KEY_DEPTH_BITS      24
+#define DRAW_KEY_MESH_TYPE_MASK  0xffffffull
+#define DRAW_KEY_DEPTH_MAX       ((1u << DRAW_KEY_DEPTH_BITS) - 1)
+
+/**
+ * @b Passes instances are drawn in. All opaque instances are drawn before
+ * blended ones, so that blended instances blend over everything behind them,
+ * instead of hiding it from depth test.
+ * */
+typedef enum DrawPass {
+    DRAW_PASS_OPAQUE  = 0,
+    DRAW_PASS_BLENDED = 1,
+} DrawPass;
+
+Uint64 draw_key_pack_2d (DrawPass pass, Bool is_primitive, Uint32 mesh_type, Float32 depth);
+Size   draw_key_find_batch (const Uint64 *batch_keys, Size count, Uint64 batch_key);
+
+/**
+ * @b Key of batch an instance with given draw key goes to. Instances of a
+ * batch differ only in depth, so they're drawn with a single draw call.
+ * */
+static inline Uint64 draw_key_batch (Uint64 key) {
+    return key & ~(Uint64)DRAW_KEY_DEPTH_MAX;
+}
+
+static inline DrawPass draw_key_pass (Uint64 key) {
+    return (DrawPass)((key >> DRAW_KEY_PASS_SHIFT) & 1);
+}
+
+#endif // ANVIE_CROSSGUI_UTILS_DRAW_KEY_H
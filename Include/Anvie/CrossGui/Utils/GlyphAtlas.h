@@ -0,0 +1,178 @@
+/**
+ * @file GlyphAtlas.h
+ * @date Sun, 18th October 2026
+ * @author Siddharth Mishra (admin@brightprogrammer.in)
+ * @copyright Copyright 2024 Siddharth Mishra
+ * @copyright Copyright 2024 Anvie Labs
+ *
+ * Copyright 2024 Siddharth Mishra, Anvie Labs
+ * 
+ * Redistribution and use in source and binary forms, with or without modification, are permitted 
+ * provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+ *    and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions
+ *    and the following disclaimer in the documentation and/or other materials provided with the
+ *    distribution.
+ * 
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse
+ *    or promote products derived from this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND 
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * */
+
+#ifndef ANVIE_CROSSGUI_UTILS_GLYPH_ATLAS_H
+#define ANVIE_CROSSGUI_UTILS_GLYPH_ATLAS_H
+
+#include <Anvie/Types.h>
+
+/* crossgui-utils */
+#include <Anvie/CrossGui/Utils/Vector.h>
+
+/**
+ * @b Maximum number of pages an atlas can be split into.
+ * */
+#define GLYPH_ATLAS_PAGE_MAX 16
+
+/**
+ * @b Set of pages of an atlas, bit @c p set if page @c p is in set.
+ * */
+typedef Uint32 GlyphAtlasPageMask;
+
+_Static_assert (
+    GLYPH_ATLAS_PAGE_MAX <= sizeof (GlyphAtlasPageMask) * 8,
+    "Page mask must have a bit for each page"
+);
+
+/**
+ * @b Once this many dirty rectangles are pending, they're merged into their bounding box.
+ * */
+#define GLYPH_ATLAS_DIRTY_RECT_MAX 64
+
+/**
+ * @b Empty border left around each glyph, so bilinear sampling never picks up a neighbour.
+ * */
+#define GLYPH_ATLAS_PADDING 1
+
+/**
+ * @b Page of blank glyphs, which take no space in atlas and are never evicted.
+ * */
+#define GLYPH_ATLAS_PAGE_NONE ((Uint32)-1)
+
+/**
+ * @b Identifies a rasterized glyph.
+ * */
+typedef struct GlyphKey {
+    Uint32 font;  /**< @b Identifies font, eg: ID assigned by user code or hash of font file. */
+    Uint32 glyph; /**< @b Glyph index in font (not a codepoint). */
+    Uint32 size;  /**< @b Size in pixels glyph was rasterized at. */
+} GlyphKey;
+
+/**
+ * @b A rectangle of atlas pixels.
+ * */
+typedef struct GlyphAtlasRect {
+    Uint16 x, y;
+    Uint16 width, height;
+} GlyphAtlasRect;
+
+/**
+ * @b A glyph cached in atlas.
+ *
+ * Metrics are not used by the atlas, and are stored here by whoever rasterized
+ * the glyph, so that a cache hit does not need to touch the font at all.
+ * */
+typedef struct GlyphAtlasEntry {
+    GlyphKey       key;
+    GlyphAtlasRect rect;      /**< @b Glyph bitmap in atlas, without padding. Empty for blanks. */
+    Float32        bearing_x; /**< @b Offset from pen position to left edge of bitmap. */
+    Float32        bearing_y; /**< @b Offset from baseline up to top edge of bitmap. */
+    Float32        advance;   /**< @b Horizontal advance of pen after this glyph. */
+    Uint32         page;      /**< @b Page of bitmap, @c GLYPH_ATLAS_PAGE_NONE for blanks. */
+    Uint64         last_used; /**< @b Frame this glyph was last used in. */
+    Bool           is_used;   /**< @b False if entry is free for reuse. */
+} GlyphAtlasEntry;
+
+/**
+ * @b Node of skyline, the top edge of packed area, in left to right order.
+ * */
+typedef struct GlyphAtlasSkylineNode {
+    Uint16 x, y, width;
+} GlyphAtlasSkylineNode;
+
+NEW_HEAP_VECTOR_STRUCT (GlyphAtlasSkylineNode, GlyphAtlasSkyline);
+NEW_HEAP_VECTOR_STRUCT (GlyphAtlasEntry, GlyphAtlasEntryVector);
+NEW_HEAP_VECTOR_STRUCT (Uint32, GlyphAtlasIndexVector);
+NEW_HEAP_VECTOR_STRUCT (GlyphAtlasRect, GlyphAtlasRectVector);
+
+/**
+ * @b Horizontal band of atlas, packed and evicted as a whole.
+ * */
+typedef struct GlyphAtlasPage {
+    GlyphAtlasSkyline skyline;     /**< @b Packed area of page, relative to top of page. */
+    Uint32            glyph_count; /**< @b Number of glyphs packed in this page. */
+    Uint64            last_used;   /**< @b Last frame any glyph of this page was used in. */
+} GlyphAtlasPage;
+
+/**
+ * @b CPU side of a glyph cache, an 8 bit coverage atlas with glyphs keyed by
+ * (font, glyph, size), independent of how glyphs are rasterized or uploaded.
+ *
+ * Atlas is split into horizontal pages, each packed with a skyline bottom-left
+ * packer. When a glyph does not fit anywhere, least recently used page is
+ * evicted as a whole, which keeps packing simple and tight, while glyphs in
+ * use keep their place. Pages used in current frame (since last call to
+ * @c glyph_atlas_begin_frame) are never evicted, because instances recorded
+ * in this frame refer to them. Instances recorded in earlier frames and still
+ * drawn keep their pages with @c glyph_atlas_keep_pages.
+ *
+ * Every change to pixels is recorded as a dirty rectangle, so that only those
+ * parts of the atlas need to be uploaded to the GPU. Uploader must call
+ * @c glyph_atlas_clear_dirty_rects after uploading them.
+ * */
+typedef struct GlyphAtlas {
+    Uint32 width;       /**< @b Width of atlas in pixels. */
+    Uint32 height;      /**< @b Height of atlas in pixels. */
+    Uint32 page_height; /**< @b Height of each page in pixels. */
+    Uint32 page_count;  /**< @b Number of pages. */
+    Uint8 *pixels;      /**< @b Coverage values, tightly packed rows of @c width bytes. */
+
+    GlyphAtlasPage        pages[GLYPH_ATLAS_PAGE_MAX];
+    GlyphAtlasEntryVector entries;      /**< @b Cached glyphs, including free entries. */
+    GlyphAtlasIndexVector free_entries; /**< @b Indices of free entries in @c entries. */
+    Uint32               *slots;        /**< @b Hash table of entry index + 1, zero if empty. */
+    Uint32                slot_count;   /**< @b Capacity of hash table, a power of two. */
+    Uint32                glyph_count;  /**< @b Number of entries in use. */
+
+    GlyphAtlasRectVector dirty_rects; /**< @b Parts of @c pixels changed since last upload. */
+    Uint64               frame;       /**< @b Current frame number. */
+    Uint64               evictions;   /**< @b Number of pages evicted so far. */
+} GlyphAtlas;
+
+GlyphAtlas      *glyph_atlas_init (GlyphAtlas *atlas, Uint32 width, Uint32 height, Uint32 pages);
+GlyphAtlas      *glyph_atlas_deinit (GlyphAtlas *atlas);
+GlyphAtlas      *glyph_atlas_begin_frame (GlyphAtlas *atlas);
+GlyphAtlas      *glyph_atlas_keep_pages (GlyphAtlas *atlas, GlyphAtlasPageMask pages);
+GlyphAtlasEntry *glyph_atlas_find (GlyphAtlas *atlas, GlyphKey *key);
+GlyphAtlasEntry *glyph_atlas_insert (
+    GlyphAtlas *atlas,
+    GlyphKey   *key,
+    Uint32      width,
+    Uint32      height,
+    Uint8      *bitmap,
+    Int32       pitch
+);
+GlyphAtlas *glyph_atlas_clear_dirty_rects (GlyphAtlas *atlas);
+GlyphAtlas *glyph_atlas_save (GlyphAtlas *atlas, CString path);
+GlyphAtlas *glyph_atlas_load (GlyphAtlas *atlas, CString path);
+
+#endif // ANVIE_CROSSGUI_UTILS_GLYPH_ATLAS_H
@@ -0,0 +1,155 @@
+/**
+ * @file JobSystem.h
+ * @date Sun, 18th October 2026
+ * @author Siddharth Mishra (admin@brightprogrammer.in)
+ * @copyright Copyright 2024 Siddharth Mishra
+ * @copyright Copyright 2024 Anvie Labs
+ *
+ * Copyright 2024 Siddharth Mishra, Anvie Labs
+ * 
+ * Redistribution and use in source and binary forms, with or without modification, are permitted 
+ * provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+ *    and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions
+ *    and the following disclaimer in the documentation and/or other materials provided with the
+ *    distribution.
+ * 
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse
+ *    or promote products derived from this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND 
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * */
+
+#ifndef ANVIE_CROSSGUI_UTILS_JOB_SYSTEM_H
+#define ANVIE_CROSSGUI_UTILS_JOB_SYSTEM_H
+
+#include <Anvie/Types.h>
+
+/* libc */
+#include <pthread.h>
+#include <stdatomic.h>
+
+/**
+ * @b Number of jobs each worker can hold, must be a power of two. A job
+ * submitted to a full worker is run right away on submitting thread.
+ * */
+#define JOB_SYSTEM_DEQUE_CAPACITY 4096
+
+/**
+ * @b Number of jobs injection queue can hold, must be a power of two. A job
+ * submitted from outside of job system while it's full is run right away on
+ * submitting thread.
+ * */
+#define JOB_SYSTEM_INJECT_CAPACITY 4096
+
+/**
+ * @b Maximum number of threads, including thread that created job system.
+ * */
+#define JOB_SYSTEM_THREAD_MAX 64
+
+#define JOB_SYSTEM_CACHE_LINE 64
+
+typedef void (*JobFn) (void *data);
+
+/**
+ * @b Number of jobs not completed yet, out of those submitted with it.
+ *
+ * Zero initialize before first use. A counter can be reused for next set of
+ * jobs after it's waited on.
+ * */
+typedef struct JobCounter {
+    _Atomic (Uint64) value;
+} JobCounter;
+
+/**
+ * @b Job stored in a slot of a worker deque. Fields are atomic, because a
+ * thief may read a slot that owner is writing, only to discard what it read.
+ * */
+typedef struct JobSlot {
+    _Atomic (JobFn)        fn;
+    _Atomic (void *)       data;
+    _Atomic (JobCounter *) counter;
+} JobSlot;
+
+/**
+ * @b Chase-Lev deque of jobs. Owner pushes and pops at bottom, other
+ * threads steal from top. Indices are on separate cache lines, so thieves
+ * don't slow down owner.
+ * */
+typedef struct JobDeque {
+    _Atomic (Int64) top;
+    Uint8           top_padding[JOB_SYSTEM_CACHE_LINE - sizeof (Int64)];
+    _Atomic (Int64) bottom;
+    Uint8           bottom_padding[JOB_SYSTEM_CACHE_LINE - sizeof (Int64)];
+    JobSlot        *jobs; /**< @b @c JOB_SYSTEM_DEQUE_CAPACITY slots, used as a ring. */
+} JobDeque;
+
+typedef struct JobSystem JobSystem;
+
+typedef struct JobWorker {
+    JobDeque   deque;
+    JobSystem *system;
+    pthread_t  thread;
+    Uint32     index;  /**< @b Zero for thread that created job system. */
+    Uint64     random; /**< @b State of generator picking victims to steal from. */
+} JobWorker;
+
+/**
+ * @b Work stealing job scheduler, shared by everything that needs more than one thread.
+ *
+ * Each thread has it's own deque of jobs. Submitted jobs go to deque of
+ * submitting thread, and idle threads steal from others, so jobs submitted
+ * from a single thread still spread over all threads, and jobs submitted by
+ * jobs stay on same thread unless another one is idle.
+ *
+ * Jobs are submitted with a counter and waiting on a counter returns after
+ * all jobs submitted with it complete. A job can submit more jobs and wait on
+ * them, which is how a job depends on others. Waiting thread runs jobs while
+ * it waits. Thread that created job system takes part only if it's created
+ * with @c is_main_participating, otherwise it just blocks in wait, which keeps
+ * it free of unrelated jobs.
+ *
+ * Any other thread (eg: a render thread) can submit and wait too. It's jobs
+ * go to an injection queue, guarded by a lock, which workers take jobs from
+ * when their own deque is empty, and it blocks while it waits.
+ * */
+struct JobSystem {
+    JobWorker *workers;      /**< @b Worker zero is thread that created job system. */
+    Uint32     worker_count; /**< @b Number of threads requested, plus one. */
+    Uint32     thread_count; /**< @b Number of threads started. */
+    pthread_t  owner;        /**< @b Thread that created job system. */
+    Bool       is_main_participating;
+
+    pthread_mutex_t mutex;
+    pthread_cond_t  job_available; /**< @b Signalled when jobs are submitted or system stops. */
+    pthread_cond_t  jobs_done;     /**< @b Signalled when a counter reaches zero while blocked. */
+
+    pthread_mutex_t  inject_mutex;  /**< @b Held while injection queue is used. */
+    JobSlot         *injected_jobs; /**< @b Ring of jobs submitted from outside of job system. */
+    Uint64           inject_head;   /**< @b Index of oldest injected job. */
+    Uint64           inject_tail;   /**< @b Index next injected job goes to. */
+    _Atomic (Uint64) injected;      /**< @b Jobs in injection queue, polled without lock. */
+
+    _Atomic (Uint64) queued;   /**< @b Jobs in all queues, used to put idle workers to sleep. */
+    _Atomic (Uint32) sleeping; /**< @b Workers waiting for @c job_available. */
+    _Atomic (Uint32) blocked;  /**< @b Threads blocked in wait, until @c jobs_done. */
+    _Atomic (Bool)   is_stopping;
+    JobCounter       pending; /**< @b All jobs not completed yet. */
+};
+
+JobSystem *job_system_init (JobSystem *jobs, Uint32 thread_count, Bool is_main_participating);
+JobSystem *job_system_deinit (JobSystem *jobs);
+JobSystem *job_system_submit (JobSystem *jobs, JobFn fn, void *data, JobCounter *counter);
+JobSystem *job_system_wait (JobSystem *jobs, JobCounter *counter);
+
+#endif // ANVIE_CROSSGUI_UTILS_JOB_SYSTEM_H
@@ -35,13 +35,15 @@
 
 #include <Anvie/Types.h>
 
-#if 0
-#    define __MATH_TYPE_ALIGN__(N) __attribute__ ((aligned (N)))
-#else
-#    define __MATH_TYPE_ALIGN__(N)
-#endif
+#define __MATH_TYPE_ALIGN__(N) __attribute__ ((aligned (N)))
 
-typedef union __MATH_TYPE_ALIGN__ (8) Vec2f {
+/* NOTE:
+ * Only Vec4f (and hence Mat4f) is over-aligned. Vec2f and Vec3f are embedded at
+ * 4 byte offsets inside Vec3f and Vec4f (eg: Vec3f::yz, Vec4f::yzw), and Mat3f
+ * aliases it's columns with a packed Float32[3][3], so aligning those would
+ * change their layout. */
+
+typedef union Vec2f {
 #define GEN_VEC2F(nx, ny)                                                                          \
     struct {                                                                                       \
         Float32 nx, ny;                                                                            \
@@ -63,7 +65,7 @@ Vec2f  *vec2f_mul_f32 (Vec2f *res, Vec2f *vec, Float32 scalar);
 Float32 vec2f_dot (Vec2f *vec1, Vec2f *vec2);
 Float32 vec2f_norm (Vec2f *vec);
 
-typedef union __MATH_TYPE_ALIGN__ (16) Vec3f {
+typedef union Vec3f {
 #define GEN_VEC3F(nx, ny, nz)                                                                      \
     struct {                                                                                       \
         Float32 nx, ny, nz;                                                                        \
@@ -102,17 +104,17 @@ typedef union __MATH_TYPE_ALIGN__ (16) Vec4f {
     };                                                                                             \
                                                                                                    \
     struct {                                                                                       \
-        Vec3f   nx##ny;                                                                            \
-        Float32 _ignore2_##nz##nw;                                                                 \
+        Vec2f   nx##ny;                                                                            \
+        Float32 _ignore2_##nz##nw[2];                                                              \
     };                                                                                             \
     struct {                                                                                       \
         Float32 _ignore2_##nx;                                                                     \
-        Vec3f   ny##nz;                                                                            \
+        Vec2f   ny##nz;                                                                            \
         Float32 _ignore2_##nw;                                                                     \
     };                                                                                             \
     struct {                                                                                       \
-        Float32 _ignore2_##nx##ny;                                                                 \
-        Vec3f   nz##nw;                                                                            \
+        Float32 _ignore2_##nx##ny[2];                                                              \
+        Vec2f   nz##nw;                                                                            \
     };                                                                                             \
                                                                                                    \
     struct {                                                                                       \
@@ -181,6 +183,37 @@ Vec4f  *mat4f_mul_vec (Vec4f *res, Mat4f *mat, Vec4f *vec);
 Mat4f  *mat4f_mul_f32 (Mat4f *res, Mat4f *mat, Float32 scale);
 Float32 mat4f_det (Mat4f *mat);
 
+/**
+ * @b Axis aligned bounding box in 2D.
+ *
+ * A box with @c min greater than @c max on any axis is empty.
+ * */
+typedef struct __MATH_TYPE_ALIGN__ (16) Aabb2f {
+    Vec2f min;
+    Vec2f max;
+} Aabb2f;
+
+/**
+ * @b Instruction sets batch math kernels can be run with.
+ * */
+typedef enum MathsIsa {
+    MATHS_ISA_SCALAR = 0,
+    MATHS_ISA_SSE2,
+    MATHS_ISA_AVX2,
+    MATHS_ISA_NEON,
+    MATHS_ISA_MAX
+} MathsIsa;
+
+/* batch kernels : all arrays must hold at least `count` entries, `res` can alias input array */
+Vec2f  *vec2f_transform_batch (Vec2f *res, Mat3f *mat, Vec2f *vecs, Size count);
+Vec4f  *vec4f_transform_batch (Vec4f *res, Mat4f *mat, Vec4f *vecs, Size count);
+Aabb2f *aabb2f_union_batch (Aabb2f *res, Aabb2f *boxes, Size count);
+Aabb2f *aabb2f_intersect_batch (Aabb2f *res, Aabb2f *boxes, Aabb2f *clip, Size count);
+
+MathsIsa maths_get_isa();
+Bool     maths_set_isa (MathsIsa isa);
+CString  maths_isa_name (MathsIsa isa);
+
 #undef __MATH_TYPE_ALIGN__
 
 #endif // ANVIE_CROSSGUI_MATHS_H
@@ -0,0 +1,382 @@
+/**
+ * @file MathsInline.h
+ * @date Sun, 18th October 2026
+ * @author Siddharth Mishra (admin@brightprogrammer.in)
+ * @copyright Copyright 2024 Siddharth Mishra
+ * @copyright Copyright 2024 Anvie Labs
+ *
+ * Copyright 2024 Siddharth Mishra, Anvie Labs
+ * 
+ * Redistribution and use in source and binary forms, with or without modification, are permitted 
+ * provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+ *    and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions
+ *    and the following disclaimer in the documentation and/or other materials provided with the
+ *    distribution.
+ * 
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse
+ *    or promote products derived from this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND 
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * */
+
+/**
+ * @b Header-only, value-semantics variant of the API in Maths.h
+ *
+ * Functions here take and return vectors and matrices by value, and do not
+ * validate their arguments, so the compiler can inline them into hot loops
+ * (layout, transforms, etc...) and keep everything in registers. The checked,
+ * pointer based functions in Maths.h remain the public ABI of xui_utils.
+ *
+ * Invert and normalize methods don't check for division by zero. Results are
+ * non-finite if given matrix is singular or vector has zero norm.
+ * */
+
+#ifndef ANVIE_CROSSGUI_MATHS_INLINE_H
+#define ANVIE_CROSSGUI_MATHS_INLINE_H
+
+#include <Anvie/CrossGui/Utils/Maths.h>
+#include <Anvie/Types.h>
+
+/* libm */
+#include <math.h>
+
+/**************************************************************************************************/
+/********************************************* VEC 2F *********************************************/
+/**************************************************************************************************/
+
+static inline Vec2f vec2f_add_inline (Vec2f a, Vec2f b) {
+    return (Vec2f) {.x = a.x + b.x, .y = a.y + b.y};
+}
+
+static inline Vec2f vec2f_sub_inline (Vec2f a, Vec2f b) {
+    return (Vec2f) {.x = a.x - b.x, .y = a.y - b.y};
+}
+
+static inline Vec2f vec2f_mul_f32_inline (Vec2f v, Float32 s) {
+    return (Vec2f) {.x = v.x * s, .y = v.y * s};
+}
+
+static inline Float32 vec2f_dot_inline (Vec2f a, Vec2f b) {
+    return a.x * b.x + a.y * b.y;
+}
+
+static inline Float32 vec2f_norm_inline (Vec2f v) {
+    return sqrtf (vec2f_dot_inline (v, v));
+}
+
+static inline Vec2f vec2f_normalize_inline (Vec2f v) {
+    Float32 norm = vec2f_norm_inline (v);
+    return (Vec2f) {.x = v.x / norm, .y = v.y / norm};
+}
+
+/**************************************************************************************************/
+/********************************************* VEC 3F *********************************************/
+/**************************************************************************************************/
+
+static inline Vec3f vec3f_add_inline (Vec3f a, Vec3f b) {
+    return (Vec3f) {.x = a.x + b.x, .y = a.y + b.y, .z = a.z + b.z};
+}
+
+static inline Vec3f vec3f_sub_inline (Vec3f a, Vec3f b) {
+    return (Vec3f) {.x = a.x - b.x, .y = a.y - b.y, .z = a.z - b.z};
+}
+
+static inline Vec3f vec3f_mul_f32_inline (Vec3f v, Float32 s) {
+    return (Vec3f) {.x = v.x * s, .y = v.y * s, .z = v.z * s};
+}
+
+static inline Vec3f vec3f_cross_inline (Vec3f a, Vec3f b) {
+    return (Vec3f) {
+        .x = a.y * b.z - a.z * b.y,
+        .y = -a.x * b.z + a.z * b.x,
+        .z = a.x * b.y - a.y * b.x
+    };
+}
+
+static inline Float32 vec3f_dot_inline (Vec3f a, Vec3f b) {
+    return a.x * b.x + a.y * b.y + a.z * b.z;
+}
+
+static inline Float32 vec3f_norm_inline (Vec3f v) {
+    return sqrtf (vec3f_dot_inline (v, v));
+}
+
+static inline Vec3f vec3f_normalize_inline (Vec3f v) {
+    Float32 norm = vec3f_norm_inline (v);
+    return (Vec3f) {.x = v.x / norm, .y = v.y / norm, .z = v.z / norm};
+}
+
+/**************************************************************************************************/
+/********************************************* VEC 4F *********************************************/
+/**************************************************************************************************/
+
+static inline Vec4f vec4f_add_inline (Vec4f a, Vec4f b) {
+    return (Vec4f) {.x = a.x + b.x, .y = a.y + b.y, .z = a.z + b.z, .w = a.w + b.w};
+}
+
+static inline Vec4f vec4f_sub_inline (Vec4f a, Vec4f b) {
+    return (Vec4f) {.x = a.x - b.x, .y = a.y - b.y, .z = a.z - b.z, .w = a.w - b.w};
+}
+
+static inline Vec4f vec4f_mul_f32_inline (Vec4f v, Float32 s) {
+    return (Vec4f) {.x = v.x * s, .y = v.y * s, .z = v.z * s, .w = v.w * s};
+}
+
+static inline Float32 vec4f_dot_inline (Vec4f a, Vec4f b) {
+    return a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w;
+}
+
+static inline Float32 vec4f_norm_inline (Vec4f v) {
+    return sqrtf (vec4f_dot_inline (v, v));
+}
+
+static inline Vec4f vec4f_normalize_inline (Vec4f v) {
+    Float32 norm = vec4f_norm_inline (v);
+    return (Vec4f) {.x = v.x / norm, .y = v.y / norm, .z = v.z / norm, .w = v.w / norm};
+}
+
+/**************************************************************************************************/
+/********************************************* MAT 2F *********************************************/
+/**************************************************************************************************/
+
+/* NOTE: matrices are column major, elem[c][r] is element at row r and column c */
+
+static inline Mat2f mat2f_add_inline (Mat2f a, Mat2f b) {
+    return (Mat2f) {
+        .column = {vec2f_add_inline (a.column[0], b.column[0]),
+                   vec2f_add_inline (a.column[1], b.column[1])}
+    };
+}
+
+static inline Mat2f mat2f_sub_inline (Mat2f a, Mat2f b) {
+    return (Mat2f) {
+        .column = {vec2f_sub_inline (a.column[0], b.column[0]),
+                   vec2f_sub_inline (a.column[1], b.column[1])}
+    };
+}
+
+static inline Mat2f mat2f_mul_f32_inline (Mat2f m, Float32 s) {
+    return (Mat2f) {
+        .column = {vec2f_mul_f32_inline (m.column[0], s), vec2f_mul_f32_inline (m.column[1], s)}
+    };
+}
+
+static inline Vec2f mat2f_mul_vec_inline (Mat2f m, Vec2f v) {
+    return (Vec2f) {
+        .x = m.elem[0][0] * v.x + m.elem[1][0] * v.y,
+        .y = m.elem[0][1] * v.x + m.elem[1][1] * v.y
+    };
+}
+
+static inline Mat2f mat2f_mul_inline (Mat2f a, Mat2f b) {
+    return (Mat2f) {
+        .column = {mat2f_mul_vec_inline (a, b.column[0]), mat2f_mul_vec_inline (a, b.column[1])}
+    };
+}
+
+static inline Mat2f mat2f_transpose_inline (Mat2f m) {
+    return (Mat2f) {
+        .elem = {{m.elem[0][0], m.elem[1][0]}, {m.elem[0][1], m.elem[1][1]}}
+    };
+}
+
+static inline Float32 mat2f_det_inline (Mat2f m) {
+    return m.elem[0][0] * m.elem[1][1] - m.elem[1][0] * m.elem[0][1];
+}
+
+static inline Mat2f mat2f_invert_inline (Mat2f m) {
+    Float32 det = mat2f_det_inline (m);
+    return (Mat2f) {
+        .elem = {{m.elem[1][1] / det, -m.elem[0][1] / det},
+                 {-m.elem[1][0] / det, m.elem[0][0] / det}}
+    };
+}
+
+/**************************************************************************************************/
+/********************************************* MAT 3F *********************************************/
+/**************************************************************************************************/
+
+static inline Mat3f mat3f_add_inline (Mat3f a, Mat3f b) {
+    return (Mat3f) {
+        .column = {vec3f_add_inline (a.column[0], b.column[0]),
+                   vec3f_add_inline (a.column[1], b.column[1]),
+                   vec3f_add_inline (a.column[2], b.column[2])}
+    };
+}
+
+static inline Mat3f mat3f_sub_inline (Mat3f a, Mat3f b) {
+    return (Mat3f) {
+        .column = {vec3f_sub_inline (a.column[0], b.column[0]),
+                   vec3f_sub_inline (a.column[1], b.column[1]),
+                   vec3f_sub_inline (a.column[2], b.column[2])}
+    };
+}
+
+static inline Mat3f mat3f_mul_f32_inline (Mat3f m, Float32 s) {
+    return (Mat3f) {
+        .column = {vec3f_mul_f32_inline (m.column[0], s),
+                   vec3f_mul_f32_inline (m.column[1], s),
+                   vec3f_mul_f32_inline (m.column[2], s)}
+    };
+}
+
+static inline Vec3f mat3f_mul_vec_inline (Mat3f m, Vec3f v) {
+    return (Vec3f) {
+        .x = m.elem[0][0] * v.x + m.elem[1][0] * v.y + m.elem[2][0] * v.z,
+        .y = m.elem[0][1] * v.x + m.elem[1][1] * v.y + m.elem[2][1] * v.z,
+        .z = m.elem[0][2] * v.x + m.elem[1][2] * v.y + m.elem[2][2] * v.z
+    };
+}
+
+static inline Mat3f mat3f_mul_inline (Mat3f a, Mat3f b) {
+    return (Mat3f) {
+        .column = {mat3f_mul_vec_inline (a, b.column[0]),
+                   mat3f_mul_vec_inline (a, b.column[1]),
+                   mat3f_mul_vec_inline (a, b.column[2])}
+    };
+}
+
+static inline Mat3f mat3f_transpose_inline (Mat3f m) {
+    return (Mat3f) {
+        .elem = {{m.elem[0][0], m.elem[1][0], m.elem[2][0]},
+                 {m.elem[0][1], m.elem[1][1], m.elem[2][1]},
+                 {m.elem[0][2], m.elem[1][2], m.elem[2][2]}}
+    };
+}
+
+static inline Float32 mat3f_det_inline (Mat3f m) {
+    return vec3f_dot_inline (m.column[0], vec3f_cross_inline (m.column[1], m.column[2]));
+}
+
+static inline Mat3f mat3f_invert_inline (Mat3f m) {
+    /* rows of inverse are cross products of columns, scaled by 1/det */
+    Vec3f   r0      = vec3f_cross_inline (m.column[1], m.column[2]);
+    Vec3f   r1      = vec3f_cross_inline (m.column[2], m.column[0]);
+    Vec3f   r2      = vec3f_cross_inline (m.column[0], m.column[1]);
+    Float32 inv_det = 1.f / vec3f_dot_inline (m.column[0], r0);
+
+    return mat3f_transpose_inline ((Mat3f) {
+        .column = {vec3f_mul_f32_inline (r0, inv_det),
+                   vec3f_mul_f32_inline (r1, inv_det),
+                   vec3f_mul_f32_inline (r2, inv_det)}
+    });
+}
+
+/**************************************************************************************************/
+/********************************************* MAT 4F *********************************************/
+/**************************************************************************************************/
+
+static inline Mat4f mat4f_add_inline (Mat4f a, Mat4f b) {
+    return (Mat4f) {
+        .column = {vec4f_add_inline (a.column[0], b.column[0]),
+                   vec4f_add_inline (a.column[1], b.column[1]),
+                   vec4f_add_inline (a.column[2], b.column[2]),
+                   vec4f_add_inline (a.column[3], b.column[3])}
+    };
+}
+
+static inline Mat4f mat4f_sub_inline (Mat4f a, Mat4f b) {
+    return (Mat4f) {
+        .column = {vec4f_sub_inline (a.column[0], b.column[0]),
+                   vec4f_sub_inline (a.column[1], b.column[1]),
+                   vec4f_sub_inline (a.column[2], b.column[2]),
+                   vec4f_sub_inline (a.column[3], b.column[3])}
+    };
+}
+
+static inline Mat4f mat4f_mul_f32_inline (Mat4f m, Float32 s) {
+    return (Mat4f) {
+        .column = {vec4f_mul_f32_inline (m.column[0], s),
+                   vec4f_mul_f32_inline (m.column[1], s),
+                   vec4f_mul_f32_inline (m.column[2], s),
+                   vec4f_mul_f32_inline (m.column[3], s)}
+    };
+}
+
+static inline Vec4f mat4f_mul_vec_inline (Mat4f m, Vec4f v) {
+    return (Vec4f) {
+        .x = m.elem[0][0] * v.x + m.elem[1][0] * v.y + m.elem[2][0] * v.z + m.elem[3][0] * v.w,
+        .y = m.elem[0][1] * v.x + m.elem[1][1] * v.y + m.elem[2][1] * v.z + m.elem[3][1] * v.w,
+        .z = m.elem[0][2] * v.x + m.elem[1][2] * v.y + m.elem[2][2] * v.z + m.elem[3][2] * v.w,
+        .w = m.elem[0][3] * v.x + m.elem[1][3] * v.y + m.elem[2][3] * v.z + m.elem[3][3] * v.w
+    };
+}
+
+static inline Mat4f mat4f_mul_inline (Mat4f a, Mat4f b) {
+    return (Mat4f) {
+        .column = {mat4f_mul_vec_inline (a, b.column[0]),
+                   mat4f_mul_vec_inline (a, b.column[1]),
+                   mat4f_mul_vec_inline (a, b.column[2]),
+                   mat4f_mul_vec_inline (a, b.column[3])}
+    };
+}
+
+static inline Mat4f mat4f_transpose_inline (Mat4f m) {
+    return (Mat4f) {
+        .elem = {{m.elem[0][0], m.elem[1][0], m.elem[2][0], m.elem[3][0]},
+                 {m.elem[0][1], m.elem[1][1], m.elem[2][1], m.elem[3][1]},
+                 {m.elem[0][2], m.elem[1][2], m.elem[2][2], m.elem[3][2]},
+                 {m.elem[0][3], m.elem[1][3], m.elem[2][3], m.elem[3][3]}}
+    };
+}
+
+/* Both determinant and inverse are computed from the same 2x2 sub-determinants :
+ * C01 = c0 x c1, C23 = c2 x c3, B10 = c0 * c1.w - c1 * c0.w, B32 = c2 * c3.w - c3 * c2.w
+ * (only xyz of each column). det = C01 . B32 + C23 . B10 */
+
+static inline Float32 mat4f_det_inline (Mat4f m) {
+    Vec3f   c0 = m.column[0].xyz, c1 = m.column[1].xyz, c2 = m.column[2].xyz, c3 = m.column[3].xyz;
+    Float32 w0 = m.column[0].w, w1 = m.column[1].w, w2 = m.column[2].w, w3 = m.column[3].w;
+
+    Vec3f C01 = vec3f_cross_inline (c0, c1);
+    Vec3f C23 = vec3f_cross_inline (c2, c3);
+    Vec3f B10 = vec3f_sub_inline (vec3f_mul_f32_inline (c0, w1), vec3f_mul_f32_inline (c1, w0));
+    Vec3f B32 = vec3f_sub_inline (vec3f_mul_f32_inline (c2, w3), vec3f_mul_f32_inline (c3, w2));
+
+    return vec3f_dot_inline (C01, B32) + vec3f_dot_inline (C23, B10);
+}
+
+static inline Mat4f mat4f_invert_inline (Mat4f m) {
+    Vec3f   c0 = m.column[0].xyz, c1 = m.column[1].xyz, c2 = m.column[2].xyz, c3 = m.column[3].xyz;
+    Float32 w0 = m.column[0].w, w1 = m.column[1].w, w2 = m.column[2].w, w3 = m.column[3].w;
+
+    Vec3f C01 = vec3f_cross_inline (c0, c1);
+    Vec3f C23 = vec3f_cross_inline (c2, c3);
+    Vec3f B10 = vec3f_sub_inline (vec3f_mul_f32_inline (c0, w1), vec3f_mul_f32_inline (c1, w0));
+    Vec3f B32 = vec3f_sub_inline (vec3f_mul_f32_inline (c2, w3), vec3f_mul_f32_inline (c3, w2));
+
+    Float32 inv_det = 1.f / (vec3f_dot_inline (C01, B32) + vec3f_dot_inline (C23, B10));
+
+    C01 = vec3f_mul_f32_inline (C01, inv_det);
+    C23 = vec3f_mul_f32_inline (C23, inv_det);
+    B10 = vec3f_mul_f32_inline (B10, inv_det);
+    B32 = vec3f_mul_f32_inline (B32, inv_det);
+
+    /* rows of inverse */
+    Vec3f r0 = vec3f_add_inline (vec3f_cross_inline (c1, B32), vec3f_mul_f32_inline (C23, w1));
+    Vec3f r1 = vec3f_sub_inline (vec3f_cross_inline (B32, c0), vec3f_mul_f32_inline (C23, w0));
+    Vec3f r2 = vec3f_add_inline (vec3f_cross_inline (c3, B10), vec3f_mul_f32_inline (C01, w3));
+    Vec3f r3 = vec3f_sub_inline (vec3f_cross_inline (B10, c2), vec3f_mul_f32_inline (C01, w2));
+
+    Mat4f rows = {
+        .column = {{.xyz = r0, ._ignore_w = -vec3f_dot_inline (c1, C23)},
+                   {.xyz = r1, ._ignore_w = vec3f_dot_inline (c0, C23)},
+                   {.xyz = r2, ._ignore_w = -vec3f_dot_inline (c3, C01)},
+                   {.xyz = r3, ._ignore_w = vec3f_dot_inline (c2, C01)}}
+    };
+
+    return mat4f_transpose_inline (rows);
+}
+
+#endif // ANVIE_CROSSGUI_MATHS_INLINE_H
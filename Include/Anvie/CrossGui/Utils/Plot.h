@@ -0,0 +1,101 @@
+/**
+ * @file Plot.h
+ * @date Sun, 18th October 2026
+ * @author Siddharth Mishra (admin@brightprogrammer.in)
+ * @copyright Copyright 2024 Siddharth Mishra
+ * @copyright Copyright 2024 Anvie Labs
+ *
+ * Copyright 2024 Siddharth Mishra, Anvie Labs
+ * 
+ * Redistribution and use in source and binary forms, with or without modification, are permitted 
+ * provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+ *    and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions
+ *    and the following disclaimer in the documentation and/or other materials provided with the
+ *    distribution.
+ * 
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse
+ *    or promote products derived from this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND 
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * */
+
+#ifndef ANVIE_CROSSGUI_UTILS_PLOT_H
+#define ANVIE_CROSSGUI_UTILS_PLOT_H
+
+#include <Anvie/Types.h>
+
+/* crossgui-utils */
+#include <Anvie/CrossGui/Utils/Maths.h>
+#include <Anvie/CrossGui/Utils/Vector.h>
+
+/**
+ * @b Maximum number of level of detail levels of a plot series.
+ * Level @c k summarizes buckets of @c 2^(k+1) samples, so this is never the limit in practice.
+ * */
+#define PLOT_LOD_LEVEL_MAX 48
+
+/**
+ * @b Upper bound of number of points @c plot_series_decimate can produce.
+ * */
+#define PLOT_SERIES_DECIMATE_MAX_POINTS(pixel_width) (2 * (Size)(pixel_width) + 2)
+
+/**
+ * @b Minimum and maximum of a range of samples, in the order they occur in the range.
+ * */
+typedef struct PlotExtremes {
+    Float32 first;  /**< @b Extreme that occurs first. */
+    Float32 second; /**< @b Extreme that occurs last. */
+} PlotExtremes;
+
+NEW_HEAP_VECTOR_STRUCT (Float32, PlotSampleVector);
+NEW_HEAP_VECTOR_STRUCT (PlotExtremes, PlotExtremesVector);
+
+/**
+ * @b Uniformly sampled series of values (eg: a time series), that can be drawn
+ * at a cost proportional to the width of plot on screen, instead of number of samples.
+ *
+ * Sample @c i is at @c x_origin + i * x_step. Along with samples, a min/max
+ * level of detail pyramid is maintained, where each level stores extremes of
+ * buckets twice as large as the level below. When zoomed out, a level with
+ * about one bucket per pixel column is picked, and only extremes of each
+ * column are drawn, so a polyline of at most two points per column looks
+ * exactly like the polyline of all samples would, spikes included.
+ *
+ * Appending samples only updates the buckets they fall into, so streaming
+ * data costs @c O(1) amortized per sample and @c O(levels) per append call.
+ *
+ * Samples must not be NaN.
+ * */
+typedef struct PlotSeries {
+    Float64            x_origin;                   /**< @b X coordinate of first sample. */
+    Float64            x_step;                     /**< @b Distance between two samples. */
+    PlotSampleVector   samples;                    /**< @b All samples in order. */
+    PlotExtremesVector levels[PLOT_LOD_LEVEL_MAX]; /**< @b Level of detail pyramid. */
+    Uint32             level_count;                /**< @b Number of levels in use. */
+} PlotSeries;
+
+PlotSeries *plot_series_init (PlotSeries *series, Float64 x_origin, Float64 x_step);
+PlotSeries *plot_series_deinit (PlotSeries *series);
+PlotSeries *plot_series_append (PlotSeries *series, Float32 *samples, Size count);
+PlotSeries *plot_series_clear (PlotSeries *series);
+Size        plot_series_decimate (
+    PlotSeries *series,
+    Float64     x_begin,
+    Float64     x_end,
+    Uint32      pixel_width,
+    Vec2f      *points,
+    Size        max_points
+);
+
+#endif // ANVIE_CROSSGUI_UTILS_PLOT_H
@@ -0,0 +1,102 @@
+/**
+ * @file Profiler.h
+ * @date Sun, 18th October 2026
+ * @author Siddharth Mishra (admin@brightprogrammer.in)
+ * @copyright Copyright 2024 Siddharth Mishra
+ * @copyright Copyright 2024 Anvie Labs
+ *
+ * Copyright 2024 Siddharth Mishra, Anvie Labs
+ * 
+ * Redistribution and use in source and binary forms, with or without modification, are permitted 
+ * provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+ *    and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions
+ *    and the following disclaimer in the documentation and/or other materials provided with the
+ *    distribution.
+ * 
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse
+ *    or promote products derived from this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND 
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * */
+
+#ifndef ANVIE_CROSSGUI_UTILS_PROFILER_H
+#define ANVIE_CROSSGUI_UTILS_PROFILER_H
+
+#include <Anvie/Types.h>
+
+/**
+ * @b Zone categories. Chrome trace viewer and Perfetto let us filter by these,
+ * which is how time spent blocked on the GPU/presentation engine is told apart
+ * from time spent doing actual work on the CPU.
+ * */
+#define PROFILER_CATEGORY_CPU  "cpu"
+#define PROFILER_CATEGORY_WAIT "wait"
+
+/**
+ * @b A profiling zone that is currently open.
+ *
+ * Zones are recorded into the ring buffer of calling thread only when
+ * they're closed, so an open zone lives entirely on the stack.
+ * */
+typedef struct ProfilerZone {
+    CString name;     /**< @b Must have static storage duration (string literals). */
+    CString category; /**< @b One of @c PROFILER_CATEGORY_* or any other static string. */
+    Uint64  begin_ns; /**< @b Timestamp when zone was opened. */
+} ProfilerZone;
+
+Uint64       profiler_now_ns();
+ProfilerZone profiler_zone_begin (CString name, CString category);
+void         profiler_zone_end (ProfilerZone *zone);
+void         profiler_frame_mark (CString name);
+void         profiler_set_thread_name (CString name);
+Bool         profiler_dump_chrome_trace (CString file_path, Uint64 window_ns);
+
+/**
+ * Profiling zones are compiled out completely unless @c CROSSGUI_PROFILER_ENABLED
+ * is defined (see @c CROSSGUI_PROFILER option in CMakeLists.txt). The profiler API
+ * itself is always available, so that the plugin ABI does not change between builds.
+ * */
+#ifdef CROSSGUI_PROFILER_ENABLED
+
+#    define PROFILER_CONCAT_IMPL(a, b) a##b
+#    define PROFILER_CONCAT(a, b)      PROFILER_CONCAT_IMPL (a, b)
+
+/**
+ * @b Open a zone that is automatically closed when the enclosing scope exits,
+ * including early returns through @c RETURN_VALUE_IF and friends.
+ *
+ * @param name Name of zone. Must be a string literal.
+ * @param category Category of zone. Must be a string literal.
+ * */
+#    define PROFILE_ZONE_CATEGORY(name, category)                                                 \
+        ProfilerZone PROFILER_CONCAT (profiler_zone_, __LINE__)                                    \
+            __attribute__ ((cleanup (profiler_zone_end), unused)) =                                \
+                profiler_zone_begin (name, category)
+
+#    define PROFILE_ZONE(name)          PROFILE_ZONE_CATEGORY (name, PROFILER_CATEGORY_CPU)
+#    define PROFILE_WAIT_ZONE(name)     PROFILE_ZONE_CATEGORY (name, PROFILER_CATEGORY_WAIT)
+#    define PROFILE_FRAME_MARK(name)    profiler_frame_mark (name)
+#    define PROFILE_THREAD_NAME(name)   profiler_set_thread_name (name)
+
+#else
+
+#    define PROFILE_ZONE_CATEGORY(name, category)
+#    define PROFILE_ZONE(name)
+#    define PROFILE_WAIT_ZONE(name)
+#    define PROFILE_FRAME_MARK(name)
+#    define PROFILE_THREAD_NAME(name)
+
+#endif // CROSSGUI_PROFILER_ENABLED
+
+#endif // ANVIE_CROSSGUI_UTILS_PROFILER_H
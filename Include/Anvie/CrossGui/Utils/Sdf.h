@@ -0,0 +1,64 @@
+/**
+ * @file Sdf.h
+ * @date Sun, 18th October 2026
+ * @author Siddharth Mishra (admin@brightprogrammer.in)
+ * @copyright Copyright 2024 Siddharth Mishra
+ * @copyright Copyright 2024 Anvie Labs
+ *
+ * Copyright 2024 Siddharth Mishra, Anvie Labs
+ * 
+ * Redistribution and use in source and binary forms, with or without modification, are permitted 
+ * provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+ *    and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions
+ *    and the following disclaimer in the documentation and/or other materials provided with the
+ *    distribution.
+ * 
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse
+ *    or promote products derived from this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND 
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * */
+
+#ifndef ANVIE_CROSSGUI_UTILS_SDF_H
+#define ANVIE_CROSSGUI_UTILS_SDF_H
+
+#include <Anvie/Types.h>
+
+/**
+ * @b Size of signed distance field generated from a bitmap of given size.
+ *
+ * @param size Width or height of source bitmap.
+ * @param downscale Number of source pixels per field pixel, along each axis.
+ * @param padding Field pixels added on each side, so that outside distances fit.
+ *
+ * @return Width or height of field in pixels.
+ * */
+static inline Uint32 sdf_size (Uint32 size, Uint32 downscale, Uint32 padding) {
+    return (size + downscale - 1) / downscale + 2 * padding;
+}
+
+Uint8 *sdf_generate (
+    Uint8       *sdf,
+    Uint32       sdf_width,
+    Uint32       sdf_height,
+    const Uint8 *coverage,
+    Uint32       width,
+    Uint32       height,
+    Int32        pitch,
+    Uint32       downscale,
+    Uint32       padding,
+    Float32      spread
+);
+
+#endif // ANVIE_CROSSGUI_UTILS_SDF_H
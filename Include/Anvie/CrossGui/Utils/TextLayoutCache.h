@@ -0,0 +1,125 @@
+/**
+ * @file TextLayoutCache.h
+ * @date Sun, 18th October 2026
+ * @author Siddharth Mishra (admin@brightprogrammer.in)
+ * @copyright Copyright 2024 Siddharth Mishra
+ * @copyright Copyright 2024 Anvie Labs
+ *
+ * Copyright 2024 Siddharth Mishra, Anvie Labs
+ * 
+ * Redistribution and use in source and binary forms, with or without modification, are permitted 
+ * provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+ *    and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions
+ *    and the following disclaimer in the documentation and/or other materials provided with the
+ *    distribution.
+ * 
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse
+ *    or promote products derived from this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND 
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * */
+
+#ifndef ANVIE_CROSSGUI_UTILS_TEXT_LAYOUT_CACHE_H
+#define ANVIE_CROSSGUI_UTILS_TEXT_LAYOUT_CACHE_H
+
+#include <Anvie/Types.h>
+
+/* crossgui-utils */
+#include <Anvie/CrossGui/Utils/Vector.h>
+
+/**
+ * @b Identifies a laid out run of text.
+ *
+ * Everything that changes positions of glyphs must be a part of key. Sizes
+ * are in whatever units layout is done in, and are compared exactly.
+ * */
+typedef struct TextLayoutKey {
+    const Char *text;      /**< @b UTF-8 encoded text, not necessarily NUL terminated. */
+    Uint32      length;    /**< @b Length of @c text in bytes. */
+    Uint32      font;      /**< @b Font text is laid out with. */
+    Float32     size;      /**< @b Font size text is laid out at. */
+    Float32     max_width; /**< @b Width lines are wrapped at, zero if not wrapped. */
+    Uint32      flags;     /**< @b Any other layout options, opaque to cache. */
+} TextLayoutKey;
+
+/**
+ * @b A glyph placed by layout.
+ * */
+typedef struct TextLayoutGlyph {
+    Uint32  glyph; /**< @b Glyph index in font. */
+    Float32 x;     /**< @b Pen position on baseline, relative to start of first line. */
+    Float32 y;     /**< @b Baseline, relative to baseline of first line, going down. */
+} TextLayoutGlyph;
+
+/**
+ * @b A cached layout, glyphs of a text run with their positions.
+ * */
+typedef struct TextLayout {
+    Uint32           hash;        /**< @b Hash of key. */
+    Char            *text;        /**< @b Copy of text of key. */
+    Uint32           length;
+    Uint32           font;
+    Float32          size;
+    Float32          max_width;
+    Uint32           flags;
+    TextLayoutGlyph *glyphs;      /**< @b Positioned glyphs, in text order. */
+    Uint32           glyph_count; /**< @b Number of glyphs. */
+    Float32          width;       /**< @b Width of widest line. */
+    Float32          height;      /**< @b Distance from first to last baseline. */
+    Uint64           last_used;   /**< @b Generation layout was last used in. */
+    Size             bytes;       /**< @b Memory taken by this layout, accounted to budget. */
+    Bool             is_used;     /**< @b False if entry is free for reuse. */
+} TextLayout;
+
+NEW_HEAP_VECTOR_STRUCT (TextLayout, TextLayoutVector);
+NEW_HEAP_VECTOR_STRUCT (Uint32, TextLayoutIndexVector);
+
+/**
+ * @b Cache of text layouts, so that text which does not change between frames
+ * is shaped and broken into lines only once.
+ *
+ * Layouts are looked up by a hash of their key (text, font, size, wrap width
+ * and flags) in an open addressing hash table. Every lookup marks a layout as
+ * used in current generation. When memory taken by layouts goes over budget,
+ * @c text_layout_cache_begin_frame evicts layouts used in oldest generations
+ * first, until cache fits in budget again. Layouts used in current generation
+ * are never evicted.
+ * */
+typedef struct TextLayoutCache {
+    TextLayoutVector      layouts;      /**< @b Cached layouts, including free entries. */
+    TextLayoutIndexVector free_layouts; /**< @b Indices of free entries in @c layouts. */
+    Uint32               *slots;        /**< @b Hash table of layout index + 1, zero if empty. */
+    Uint32                slot_count;   /**< @b Capacity of hash table, a power of two. */
+    Uint32                layout_count; /**< @b Number of layouts in use. */
+
+    Size   budget;     /**< @b Memory layouts may take, checked once per frame. */
+    Size   bytes;      /**< @b Memory taken by layouts in use. */
+    Uint64 generation; /**< @b Current generation, advanced once per frame. */
+    Uint64 hits;       /**< @b Lookups that found a layout. */
+    Uint64 misses;     /**< @b Lookups that did not. */
+    Uint64 evictions;  /**< @b Layouts evicted so far. */
+} TextLayoutCache;
+
+TextLayoutCache *text_layout_cache_init (TextLayoutCache *cache, Size budget);
+TextLayoutCache *text_layout_cache_deinit (TextLayoutCache *cache);
+TextLayoutCache *text_layout_cache_begin_frame (TextLayoutCache *cache);
+TextLayout      *text_layout_cache_find (TextLayoutCache *cache, TextLayoutKey *key);
+TextLayout      *text_layout_cache_insert (
+    TextLayoutCache *cache,
+    TextLayoutKey   *key,
+    TextLayoutGlyph *glyphs,
+    Uint32           glyph_count
+);
+
+#endif // ANVIE_CROSSGUI_UTILS_TEXT_LAYOUT_CACHE_H
@@ -0,0 +1,95 @@
+/**
+ * @file Unicode.h
+ * @date Sun, 18th October 2026
+ * @author Siddharth Mishra (admin@brightprogrammer.in)
+ * @copyright Copyright 2024 Siddharth Mishra
+ * @copyright Copyright 2024 Anvie Labs
+ *
+ * Copyright 2024 Siddharth Mishra, Anvie Labs
+ * 
+ * Redistribution and use in source and binary forms, with or without modification, are permitted 
+ * provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+ *    and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions
+ *    and the following disclaimer in the documentation and/or other materials provided with the
+ *    distribution.
+ * 
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse
+ *    or promote products derived from this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND 
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * */
+
+#ifndef ANVIE_CROSSGUI_UTILS_UNICODE_H
+#define ANVIE_CROSSGUI_UTILS_UNICODE_H
+
+#include <Anvie/Types.h>
+
+/* crossgui-utils */
+#include <Anvie/CrossGui/Utils/Maths.h>
+
+/**
+ * @b Line breaking classes of UAX #14 (Unicode Line Breaking Algorithm).
+ *
+ * Classes up to @c LINE_BREAK_CLASS_WJ are resolved by a pair table, rest are
+ * resolved by explicit rules. Classes not listed here are mapped to nearest
+ * listed class (eg: CP to CL, HL and SA to AL, H2 and H3 to ID, NL to BK).
+ * */
+typedef enum LineBreakClass {
+    LINE_BREAK_CLASS_OP = 0, /**< @b Opening punctuation. */
+    LINE_BREAK_CLASS_CL,     /**< @b Closing punctuation. */
+    LINE_BREAK_CLASS_QU,     /**< @b Ambiguous quotation. */
+    LINE_BREAK_CLASS_GL,     /**< @b Non-breaking ("glue"). */
+    LINE_BREAK_CLASS_NS,     /**< @b Nonstarters. */
+    LINE_BREAK_CLASS_EX,     /**< @b Exclamation and interrogation. */
+    LINE_BREAK_CLASS_SY,     /**< @b Symbols allowing break after. */
+    LINE_BREAK_CLASS_IS,     /**< @b Infix numeric separators. */
+    LINE_BREAK_CLASS_PR,     /**< @b Prefix numeric. */
+    LINE_BREAK_CLASS_PO,     /**< @b Postfix numeric. */
+    LINE_BREAK_CLASS_NU,     /**< @b Numeric. */
+    LINE_BREAK_CLASS_AL,     /**< @b Alphabetic, and anything not classified otherwise. */
+    LINE_BREAK_CLASS_ID,     /**< @b Ideographic. */
+    LINE_BREAK_CLASS_IN,     /**< @b Inseparable. */
+    LINE_BREAK_CLASS_HY,     /**< @b Hyphen. */
+    LINE_BREAK_CLASS_BA,     /**< @b Break after. */
+    LINE_BREAK_CLASS_BB,     /**< @b Break before. */
+    LINE_BREAK_CLASS_B2,     /**< @b Break opportunity before and after. */
+    LINE_BREAK_CLASS_ZW,     /**< @b Zero width space. */
+    LINE_BREAK_CLASS_WJ,     /**< @b Word joiner. */
+    LINE_BREAK_CLASS_CM,     /**< @b Combining marks. */
+    LINE_BREAK_CLASS_SP,     /**< @b Space. */
+    LINE_BREAK_CLASS_BK,     /**< @b Mandatory break. */
+    LINE_BREAK_CLASS_CR,     /**< @b Carriage return. */
+    LINE_BREAK_CLASS_LF,     /**< @b Line feed. */
+    LINE_BREAK_CLASS_MAX
+} LineBreakClass;
+
+/**
+ * @b Break opportunity after a character.
+ * */
+typedef enum LineBreak {
+    LINE_BREAK_NONE = 0,  /**< @b Line must not be broken here. */
+    LINE_BREAK_ALLOWED,   /**< @b Line can be broken here, if it's too long. */
+    LINE_BREAK_MANDATORY, /**< @b Line must be broken here (eg: after a newline). */
+} LineBreak;
+
+Bool utf8_validate (const Char *text, Size length);
+Size utf8_decode (Uint32 *codepoints, const Char *text, Size length);
+
+LineBreakClass line_break_class (Uint32 codepoint);
+Uint8         *line_break_find (Uint8 *breaks, const Uint32 *codepoints, Size count);
+
+MathsIsa unicode_get_isa();
+Bool     unicode_set_isa (MathsIsa isa);
+
+#endif // ANVIE_CROSSGUI_UTILS_UNICODE_H
@@ -9,53 +9,278 @@
 #ifndef ANVIE_CROSSGUI_UTILS_VECTOR_H
 #define ANVIE_CROSSGUI_UTILS_VECTOR_H
 
+#include <Anvie/Common.h>
 #include <Anvie/Types.h>
 
+/* crossgui-utils */
+#include <Anvie/CrossGui/Utils/Allocator.h>
+
+/* libc */
+#include <memory.h>
+
 /* This can be used for memory management of vector data types.
  * Any type is of vector type if it requires dynamic allocation
  * for storage of multiple objects of same type in a contiguous
  * memory region.
  */
 
-void *vector_create (Size entry_size, Size entry_count, Size *capacity);
-void  vector_destroy (void *vec);
-void *vector_resize (
-    void *vec,
-    Size  entry_size,
-    Size  old_count,
-    Size  new_count,
-    Size  old_capacity,
-    Size *new_capacity
+Size vector_grow_capacity (Size capacity, Size required);
+Bool vector_reserve (
+    void       **heap,
+    Size        *capacity,
+    Size         count,
+    void        *inline_data,
+    Size         inline_capacity,
+    Size         entry_size,
+    Size         required,
+    AllocatorTag tag
 );
+Bool vector_shrink_to_fit (
+    void       **heap,
+    Size        *capacity,
+    Size         count,
+    void        *inline_data,
+    Size         inline_capacity,
+    Size         entry_size,
+    AllocatorTag tag
+);
+
+/**
+ * @b Declare a vector type @c vname storing entries of type @c tname.
+ *
+ * First @c inline_capacity entries are stored inside the vector object itself,
+ * and heap memory is allocated only when the vector grows beyond that. Entries
+ * are never accessed through a cached pointer to inline storage, so vector objects
+ * can be freely moved around (memcpy, realloc of containing arrays, etc...).
+ *
+ * A zero initialized vector object is a valid empty vector.
+ *
+ * @param tname Type of each entry.
+ * @param vname Name of vector type to be declared.
+ * @param inline_capacity Number of entries stored inline. Must be non-zero, use
+ *        @c NEW_HEAP_VECTOR_STRUCT for vectors without inline storage.
+ * */
+#define NEW_VECTOR_STRUCT(tname, vname, inline_capacity)                                           \
+    struct vname {                                                                                 \
+        Size   count;                         /**< @b Number of entries in use. */                 \
+        Size   capacity;                      /**< @b Entries that fit before next growth. */      \
+        tname *heap;                          /**< @b @c Null while inline storage is in use. */   \
+        tname  inline_data[inline_capacity];                                                       \
+    };                                                                                             \
+                                                                                                   \
+    _Static_assert (                                                                               \
+        (inline_capacity) > 0,                                                                     \
+        "Use NEW_HEAP_VECTOR_STRUCT to declare " #vname " without inline storage"                  \
+    );                                                                                             \
+                                                                                                   \
+    static inline tname *vname##_inline_data (struct vname *vec) {                                 \
+        return vec->inline_data;                                                                   \
+    }                                                                                              \
+                                                                                                   \
+    static inline Size vname##_inline_capacity() {                                                 \
+        return inline_capacity;                                                                    \
+    }                                                                                              \
+                                                                                                   \
+    typedef struct vname vname
+
+/**
+ * @b Declare a vector type @c vname storing entries of type @c tname, with all
+ * entries stored on heap. Heap memory is allocated on first insertion.
+ *
+ * A zero initialized vector object is a valid empty vector.
+ *
+ * @param tname Type of each entry.
+ * @param vname Name of vector type to be declared.
+ * */
+#define NEW_HEAP_VECTOR_STRUCT(tname, vname)                                                       \
+    struct vname {                                                                                 \
+        Size   count;    /**< @b Number of entries in use. */                                      \
+        Size   capacity; /**< @b Entries that fit before next growth. */                           \
+        tname *heap;     /**< @b @c Null until first allocation. */                                \
+    };                                                                                             \
+                                                                                                   \
+    static inline tname *vname##_inline_data (struct vname *vec) {                                 \
+        (void)vec;                                                                                 \
+        return Null;                                                                               \
+    }                                                                                              \
+                                                                                                   \
+    static inline Size vname##_inline_capacity() {                                                 \
+        return 0;                                                                                  \
+    }                                                                                              \
+                                                                                                   \
+    typedef struct vname vname
 
 /**
  * @b Use this to define interface/wrapper methods to interact with
- * type-specific vectors.
+ * type-specific vectors declared using @c NEW_VECTOR_STRUCT or
+ * @c NEW_HEAP_VECTOR_STRUCT.
+ *
+ * Vector memory is accounted to @c ALLOCATOR_TAG of the source file
+ * where the wrappers are generated.
+ *
+ * Growth is geometric, and only the slow path (when vector is full) calls
+ * into @c vector_reserve. Newly reserved memory is never zeroed, only entries
+ * explicitly requested to be zeroed are.
+ *
+ * @param tname Type of each entry.
+ * @param vname Vector type declared using @c NEW_VECTOR_STRUCT or @c NEW_HEAP_VECTOR_STRUCT.
+ * @param prefix Prefix of generated method names.
  * */
-#define NEW_VECTOR_TYPE(tname, prefix)                                                             \
-    static inline tname *prefix##_vector_create (Size entry_count, Size *capacity) {               \
-        return vector_create (sizeof (tname), entry_count, capacity);                              \
-    }                                                                                              \
-                                                                                                   \
-    static inline void prefix##_vector_destroy (tname *vec) {                                      \
-        return vector_destroy ((void *)vec);                                                       \
-    }                                                                                              \
-                                                                                                   \
-    static inline tname *prefix##_vector_resize (                                                  \
-        tname *vec,                                                                                \
-        Size   from_count,                                                                         \
-        Size   to_count,                                                                           \
-        Size   from_capacity,                                                                      \
-        Size  *to_capacity                                                                         \
-    ) {                                                                                            \
-        return vector_resize (                                                                     \
-            vec,                                                                                   \
-            sizeof (tname),                                                                        \
-            from_count,                                                                            \
-            to_count,                                                                              \
-            from_capacity,                                                                         \
-            to_capacity                                                                            \
+#define NEW_VECTOR_TYPE(tname, vname, prefix)                                                      \
+    static inline tname *prefix##_vector_data (vname *vec) {                                       \
+        return vec->heap ? vec->heap : vname##_inline_data (vec);                                  \
+    }                                                                                              \
+                                                                                                   \
+    static inline tname *prefix##_vector_at (vname *vec, Size index) {                             \
+        RETURN_VALUE_IF (index >= vec->count, Null, "Vector index out of bounds\n");               \
+        return prefix##_vector_data (vec) + index;                                                 \
+    }                                                                                              \
+                                                                                                   \
+    static inline vname *prefix##_vector_reserve (vname *vec, Size capacity) {                     \
+        RETURN_VALUE_IF (!vec, Null, ERR_INVALID_ARGUMENTS);                                       \
+                                                                                                   \
+        void *heap = vec->heap;                                                                    \
+        RETURN_VALUE_IF (                                                                          \
+            !vector_reserve (                                                                      \
+                &heap,                                                                             \
+                &vec->capacity,                                                                    \
+                vec->count,                                                                        \
+                vname##_inline_data (vec),                                                         \
+                vname##_inline_capacity(),                                                         \
+                sizeof (tname),                                                                    \
+                capacity,                                                                          \
+                ALLOCATOR_TAG                                                                      \
+            ),                                                                                     \
+            Null,                                                                                  \
+            "Failed to reserve vector memory\n"                                                    \
         );                                                                                         \
+        vec->heap = heap;                                                                          \
+                                                                                                   \
+        return vec;                                                                                \
+    }                                                                                              \
+                                                                                                   \
+    static inline vname *prefix##_vector_grow (vname *vec, Size required) {                        \
+        Size capacity = MAX (vec->capacity, vname##_inline_capacity());                            \
+        return prefix##_vector_reserve (vec, vector_grow_capacity (capacity, required));           \
+    }                                                                                              \
+                                                                                                   \
+    static inline vname *prefix##_vector_init (vname *vec, Size capacity) {                        \
+        RETURN_VALUE_IF (!vec, Null, ERR_INVALID_ARGUMENTS);                                       \
+                                                                                                   \
+        vec->count    = 0;                                                                         \
+        vec->capacity = 0;                                                                         \
+        vec->heap     = Null;                                                                      \
+                                                                                                   \
+        return prefix##_vector_reserve (vec, capacity);                                            \
+    }                                                                                              \
+                                                                                                   \
+    static inline vname *prefix##_vector_deinit (vname *vec) {                                     \
+        RETURN_VALUE_IF (!vec, Null, ERR_INVALID_ARGUMENTS);                                       \
+                                                                                                   \
+        if (vec->heap) {                                                                           \
+            allocator_free (vec->heap);                                                            \
+        }                                                                                          \
+                                                                                                   \
+        vec->count    = 0;                                                                         \
+        vec->capacity = 0;                                                                         \
+        vec->heap     = Null;                                                                      \
+                                                                                                   \
+        return vec;                                                                                \
+    }                                                                                              \
+                                                                                                   \
+    static inline vname *prefix##_vector_resize (vname *vec, Size count, Bool zero_new) {          \
+        RETURN_VALUE_IF (!vec, Null, ERR_INVALID_ARGUMENTS);                                       \
+                                                                                                   \
+        if (count > vec->capacity) {                                                               \
+            RETURN_VALUE_IF (                                                                      \
+                !prefix##_vector_grow (vec, count),                                                \
+                Null,                                                                              \
+                "Failed to resize vector\n"                                                        \
+            );                                                                                     \
+        }                                                                                          \
+                                                                                                   \
+        if (zero_new && count > vec->count) {                                                      \
+            memset (                                                                               \
+                prefix##_vector_data (vec) + vec->count,                                           \
+                0,                                                                                 \
+                sizeof (tname) * (count - vec->count)                                              \
+            );                                                                                     \
+        }                                                                                          \
+                                                                                                   \
+        vec->count = count;                                                                        \
+                                                                                                   \
+        return vec;                                                                                \
+    }                                                                                              \
+                                                                                                   \
+    static inline tname *prefix##_vector_push (vname *vec, tname *entry) {                         \
+        RETURN_VALUE_IF (!vec, Null, ERR_INVALID_ARGUMENTS);                                       \
+                                                                                                   \
+        if (vec->count >= vec->capacity) {                                                         \
+            RETURN_VALUE_IF (                                                                      \
+                !prefix##_vector_grow (vec, vec->count + 1),                                       \
+                Null,                                                                              \
+                "Failed to grow vector\n"                                                          \
+            );                                                                                     \
+        }                                                                                          \
+                                                                                                   \
+        tname *slot = prefix##_vector_data (vec) + vec->count++;                                   \
+        if (entry) {                                                                               \
+            *slot = *entry;                                                                        \
+        } else {                                                                                   \
+            memset (slot, 0, sizeof (tname));                                                      \
+        }                                                                                          \
+                                                                                                   \
+        return slot;                                                                               \
+    }                                                                                              \
+                                                                                                   \
+    static inline vname *prefix##_vector_append (vname *vec, tname *entries, Size entry_count) {   \
+        RETURN_VALUE_IF (!vec || (!entries && entry_count), Null, ERR_INVALID_ARGUMENTS);          \
+                                                                                                   \
+        if (!entry_count) {                                                                        \
+            return vec;                                                                            \
+        }                                                                                          \
+                                                                                                   \
+        Size required = vec->count + entry_count;                                                  \
+        if (required > vec->capacity) {                                                            \
+            RETURN_VALUE_IF (                                                                      \
+                !prefix##_vector_grow (vec, required),                                             \
+                Null,                                                                              \
+                "Failed to grow vector\n"                                                          \
+            );                                                                                     \
+        }                                                                                          \
+                                                                                                   \
+        memcpy (prefix##_vector_data (vec) + vec->count, entries, sizeof (tname) * entry_count);   \
+        vec->count = required;                                                                     \
+                                                                                                   \
+        return vec;                                                                                \
+    }                                                                                              \
+                                                                                                   \
+    static inline vname *prefix##_vector_clear (vname *vec) {                                      \
+        RETURN_VALUE_IF (!vec, Null, ERR_INVALID_ARGUMENTS);                                       \
+        vec->count = 0;                                                                            \
+        return vec;                                                                                \
+    }                                                                                              \
+                                                                                                   \
+    static inline vname *prefix##_vector_shrink_to_fit (vname *vec) {                              \
+        RETURN_VALUE_IF (!vec, Null, ERR_INVALID_ARGUMENTS);                                       \
+                                                                                                   \
+        void *heap = vec->heap;                                                                    \
+        RETURN_VALUE_IF (                                                                          \
+            !vector_shrink_to_fit (                                                                \
+                &heap,                                                                             \
+                &vec->capacity,                                                                    \
+                vec->count,                                                                        \
+                vname##_inline_data (vec),                                                         \
+                vname##_inline_capacity(),                                                         \
+                sizeof (tname),                                                                    \
+                ALLOCATOR_TAG                                                                      \
+            ),                                                                                     \
+            Null,                                                                                  \
+            "Failed to shrink vector\n"                                                            \
+        );                                                                                         \
+        vec->heap = heap;                                                                          \
+                                                                                                   \
+        return vec;                                                                                \
     }
 
 #endif // CROSSGUI_UTILS_VECTOR_H
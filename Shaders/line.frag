@@ -0,0 +1,102 @@
+#version 450
+
+/* must match XuiLineCap2D and XuiLineJoin2D */
+#define LINE_CAP_BUTT    0u
+#define LINE_CAP_SQUARE  1u
+#define LINE_CAP_ROUND   2u
+#define LINE_JOIN_MITER  0u
+#define LINE_JOIN_BEVEL  1u
+#define LINE_JOIN_ROUND  2u
+
+/* must match line.glsl */
+#define LINE_MITER_LIMIT 4.0f
+
+layout (location = 0) in vec2       in_pos;
+layout (location = 1) flat in vec4  in_ends;
+layout (location = 2) flat in vec4  in_neighbours;
+layout (location = 3) flat in vec4  in_color;
+layout (location = 4) flat in float in_half_width;
+layout (location = 5) flat in uvec2 in_cap_join;
+
+layout (location = 0) out vec4 out_color;
+
+/*
+ * Signed distance to the part of line owned by this segment near one of it's ends.
+ *
+ * p          : Fragment position.
+ * end        : End point of segment.
+ * out_dir    : Unit direction pointing out of the segment at this end.
+ * neighbour  : Neighbouring point across the end, same as end if there's none.
+ * d_strip    : Signed distance to infinite strip of line around the segment.
+ *
+ * At a joint, segment only owns the half plane on it's side of the bisector of
+ * the joint, so neighbouring segments never overlap and translucent polylines
+ * are blended exactly once everywhere.
+ * */
+float sd_line_end (vec2 p, vec2 end, vec2 out_dir, vec2 neighbour, float d_strip, float hw) {
+    vec2  rel    = p - end;
+    float beyond = dot (rel, out_dir);
+
+    bool has_joint = neighbour != end;
+    vec2 adj       = has_joint ? normalize (neighbour - end) : -out_dir;
+    vec2 bisector  = out_dir + adj;
+
+    /* open end, or line folds back on itself, so joint is capped */
+    if (!has_joint || dot (bisector, bisector) < 1e-8f) {
+        uint cap = has_joint ? LINE_CAP_ROUND : in_cap_join.x;
+        if (cap == LINE_CAP_ROUND) {
+            return beyond > 0.0f ? length (rel) - hw : d_strip;
+        }
+        return max (d_strip, cap == LINE_CAP_SQUARE ? beyond - hw : beyond);
+    }
+
+    float own_side = dot (rel, normalize (bisector));
+
+    uint join = in_cap_join.y;
+    if (join == LINE_JOIN_ROUND) {
+        return max (own_side, beyond > 0.0f ? length (rel) - hw : d_strip);
+    }
+
+    /* miter direction points to outer corner, along the bisector */
+    vec2 miter = out_dir - adj;
+    if (dot (miter, miter) < 1e-8f) {
+        return max (d_strip, own_side); /* straight continuation */
+    }
+    miter = normalize (miter);
+
+    float outer = dot (rel, miter);
+
+    /* cosine of angle between miter direction and segment normal */
+    float c      = abs (dot (miter, vec2 (-out_dir.y, out_dir.x)));
+    float cut_at = (join == LINE_JOIN_MITER && c * LINE_MITER_LIMIT >= 1.0f) ? hw / c : hw * c;
+
+    return max (max (d_strip, own_side), outer - cut_at);
+}
+
+void main() {
+    vec2  p0 = in_ends.xy;
+    vec2  p1 = in_ends.zw;
+    float hw = in_half_width;
+
+    vec2  d   = p1 - p0;
+    float len = length (d);
+    vec2  dir = len > 0.0f ? d / len : vec2 (1.0f, 0.0f);
+    vec2  nrm = vec2 (-dir.y, dir.x);
+
+    float d_strip = abs (dot (in_pos - p0, nrm)) - hw;
+
+    float dist = max (
+        sd_line_end (in_pos, p0, -dir, in_neighbours.xy, d_strip, hw),
+        sd_line_end (in_pos, p1, dir, in_neighbours.zw, d_strip, hw)
+    );
+
+    /* width of a pixel in distance units, so edges stay one pixel wide at any scale */
+    float aa = max (fwidth (dist), 1e-6f);
+
+    float coverage = clamp (0.5f - dist / aa, 0.0f, 1.0f);
+    if (coverage <= 0.0f) {
+        discard;
+    }
+
+    out_color = vec4 (in_color.rgb, in_color.a * coverage);
+}
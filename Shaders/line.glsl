@@ -0,0 +1,84 @@
+/* shared by line.vert and polyline.vert, expands a line segment to a quad */
+
+/* must match XuiLineCap2D and XuiLineJoin2D */
+#define LINE_CAP_BUTT    0u
+#define LINE_CAP_SQUARE  1u
+#define LINE_CAP_ROUND   2u
+#define LINE_JOIN_MITER  0u
+#define LINE_JOIN_BEVEL  1u
+#define LINE_JOIN_ROUND  2u
+
+/* miter joins longer than this many half widths are drawn as bevel */
+#define LINE_MITER_LIMIT 4.0f
+
+layout (location = 0) out vec2       out_pos;
+layout (location = 1) flat out vec4  out_ends;       /* p0.xy, p1.xy */
+layout (location = 2) flat out vec4  out_neighbours; /* prev.xy, next.xy */
+layout (location = 3) flat out vec4  out_color;
+layout (location = 4) flat out float out_half_width;
+layout (location = 5) flat out uvec2 out_cap_join;
+
+/* maps instance coordinates to clip space, same for all instances in a frame */
+layout (push_constant) uniform ViewTransform {
+    mat4 view;
+    vec2 viewport_size;
+
+    /* style of polyline, not used for independent segments */
+    vec4  polyline_color;
+    float polyline_width;
+    float polyline_depth;
+    uint  polyline_cap;
+    uint  polyline_join;
+} view_transform;
+
+/*
+ * Segment p0 -> p1 has a joint at an end if the neighbouring point differs from
+ * the end point, otherwise that end is capped. Quad is grown along the segment
+ * just enough to cover the cap or join, and by a pixel all around for AA.
+ * */
+void emit_line_vertex (
+    vec2  prev,
+    vec2  p0,
+    vec2  p1,
+    vec2  next,
+    float width,
+    float depth,
+    uint  cap,
+    uint  join,
+    vec4  color
+) {
+    /* size of a pixel in instance coordinates */
+    vec2  view_scale = abs (vec2 (view_transform.view[0][0], view_transform.view[1][1]));
+    vec2  px2        = 2.0f / (view_transform.viewport_size * view_scale);
+    float px         = max (px2.x, px2.y);
+
+    /* lines thinner than a pixel are drawn a pixel wide, but fainter */
+    float half_width = max (width, px) * 0.5f;
+    color.a         *= clamp (width / px, 0.0f, 1.0f);
+
+    vec2  d   = p1 - p0;
+    float len = length (d);
+    vec2  dir = len > 0.0f ? d / len : vec2 (1.0f, 0.0f);
+    vec2  nrm = vec2 (-dir.y, dir.x);
+
+    float join_ext  = half_width * (join == LINE_JOIN_MITER ? LINE_MITER_LIMIT : 1.0f);
+    float cap_ext   = cap == LINE_CAP_BUTT ? 0.0f : half_width;
+    float start_ext = prev == p0 ? cap_ext : join_ext;
+    float end_ext   = next == p1 ? cap_ext : join_ext;
+
+    /* corners of triangle strip : (0, -1), (1, -1), (0, 1), (1, 1) */
+    float along = float (gl_VertexIndex & 1);
+    float side  = float (gl_VertexIndex >> 1) * 2.0f - 1.0f;
+
+    vec2 pos = along == 0.0f ? p0 - dir * (start_ext + px) : p1 + dir * (end_ext + px);
+    pos     += nrm * side * (half_width + px);
+
+    gl_Position = view_transform.view * vec4 (pos, depth, 1.0f);
+
+    out_pos        = pos;
+    out_ends       = vec4 (p0, p1);
+    out_neighbours = vec4 (prev, next);
+    out_color      = color;
+    out_half_width = half_width;
+    out_cap_join   = uvec2 (cap, join);
+}
@@ -0,0 +1,28 @@
+#version 450
+#extension GL_GOOGLE_include_directive : require
+
+/* sent by batch buffer containing line segment data */
+/* per instance, there's no per vertex data */
+layout (location = 0) in vec4  instance_color;
+layout (location = 1) in vec2  instance_p0;
+layout (location = 2) in vec2  instance_p1;
+layout (location = 3) in float instance_width;
+layout (location = 4) in float instance_depth;
+layout (location = 5) in uint  instance_cap;
+
+#include "line.glsl"
+
+void main() {
+    /* independent segments have no neighbours, so both ends are capped */
+    emit_line_vertex (
+        instance_p0,
+        instance_p0,
+        instance_p1,
+        instance_p1,
+        instance_width,
+        instance_depth,
+        instance_cap,
+        LINE_JOIN_MITER,
+        instance_color
+    );
+}
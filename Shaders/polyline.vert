@@ -0,0 +1,25 @@
+#version 450
+#extension GL_GOOGLE_include_directive : require
+
+/* same point stream read at 4 consecutive offsets */
+/* per instance, there's no per vertex data */
+layout (location = 0) in vec2 point_prev;
+layout (location = 1) in vec2 point_p0;
+layout (location = 2) in vec2 point_p1;
+layout (location = 3) in vec2 point_next;
+
+#include "line.glsl"
+
+void main() {
+    emit_line_vertex (
+        point_prev,
+        point_p0,
+        point_p1,
+        point_next,
+        view_transform.polyline_width,
+        view_transform.polyline_depth,
+        view_transform.polyline_cap,
+        view_transform.polyline_join,
+        view_transform.polyline_color
+    );
+}
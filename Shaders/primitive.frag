@@ -0,0 +1,55 @@
+#version 450
+
+/* must match XuiPrimitiveType2D */
+#define PRIMITIVE_TYPE_ROUNDED_RECT 0u
+#define PRIMITIVE_TYPE_ELLIPSE      1u
+
+layout (location = 0) in vec2       in_local_pos;
+layout (location = 1) flat in uint  in_type;
+layout (location = 2) flat in vec2  in_half_size;
+layout (location = 3) flat in float in_border_width;
+layout (location = 4) flat in vec4  in_corner_radii;
+layout (location = 5) flat in vec4  in_fill_color;
+layout (location = 6) flat in vec4  in_border_color;
+
+layout (location = 0) out vec4 out_color;
+
+/* signed distance to a rect centered at origin, with a radius for each corner,
+ * in order top-left, top-right, bottom-right, bottom-left (top is -Y) */
+float sd_rounded_rect (vec2 p, vec2 half_size, vec4 radii) {
+    float r = p.x < 0.0f ? (p.y < 0.0f ? radii.x : radii.w) : (p.y < 0.0f ? radii.y : radii.z);
+    r       = clamp (r, 0.0f, min (half_size.x, half_size.y));
+
+    vec2 q = abs (p) - half_size + r;
+    return min (max (q.x, q.y), 0.0f) + length (max (q, 0.0f)) - r;
+}
+
+/* approximate signed distance to an ellipse centered at origin, exact for circles
+ * and close enough near the edge for anti-aliasing and borders */
+float sd_ellipse (vec2 p, vec2 radii) {
+    float k0 = length (p / radii);
+    float k1 = length (p / (radii * radii));
+    return k1 > 0.0f ? k0 * (k0 - 1.0f) / k1 : -min (radii.x, radii.y);
+}
+
+void main() {
+    float d = in_type == PRIMITIVE_TYPE_ELLIPSE ?
+                  sd_ellipse (in_local_pos, in_half_size) :
+                  sd_rounded_rect (in_local_pos, in_half_size, in_corner_radii);
+
+    /* width of a pixel in distance units, so edges stay one pixel wide at any scale */
+    float aa = max (fwidth (d), 1e-6f);
+
+    /* don't write depth for pixels outside the shape */
+    float coverage = clamp (0.5f - d / aa, 0.0f, 1.0f);
+    if (coverage <= 0.0f) {
+        discard;
+    }
+
+    /* border is the band [-border_width, 0] inside the edge */
+    float border = in_border_width > 0.0f ? clamp (0.5f + (d + in_border_width) / aa, 0.0f, 1.0f) :
+                                            0.0f;
+
+    vec4 color = mix (in_fill_color, in_border_color, border);
+    out_color  = vec4 (color.rgb, color.a * coverage);
+}
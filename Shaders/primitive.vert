@@ -0,0 +1,52 @@
+#version 450
+
+/* sent by batch buffer containing primitive data */
+/* per instance, there's no per vertex data */
+layout (location = 0) in vec3  instance_pos;
+layout (location = 1) in uint  instance_type;
+layout (location = 2) in vec2  instance_half_size;
+layout (location = 3) in float instance_rotation;
+layout (location = 4) in float instance_border_width;
+layout (location = 5) in vec4  instance_corner_radii;
+layout (location = 6) in vec4  instance_fill_color;
+layout (location = 7) in vec4  instance_border_color;
+
+layout (location = 0) out vec2       out_local_pos;
+layout (location = 1) flat out uint  out_type;
+layout (location = 2) flat out vec2  out_half_size;
+layout (location = 3) flat out float out_border_width;
+layout (location = 4) flat out vec4  out_corner_radii;
+layout (location = 5) flat out vec4  out_fill_color;
+layout (location = 6) flat out vec4  out_border_color;
+
+/* maps instance coordinates to clip space, same for all instances in a frame */
+layout (push_constant) uniform ViewTransform {
+    mat4 view;
+    vec2 viewport_size;
+} view_transform;
+
+void main() {
+    /* corners of triangle strip : (-1, -1), (1, -1), (-1, 1), (1, 1) */
+    vec2 corner = vec2 (gl_VertexIndex & 1, gl_VertexIndex >> 1) * 2.0f - 1.0f;
+
+    /* grow quad by a pixel on each side, so anti-aliased edges are not clipped */
+    vec2  view_scale      = abs (vec2 (view_transform.view[0][0], view_transform.view[1][1]));
+    vec2  units_per_pixel = 2.0f / (view_transform.viewport_size * view_scale);
+    float margin          = max (units_per_pixel.x, units_per_pixel.y);
+
+    vec2 local = corner * (instance_half_size + margin);
+
+    float c = cos (instance_rotation);
+    float s = sin (instance_rotation);
+
+    gl_Position = view_transform.view *
+                  vec4 (instance_pos.xy + mat2 (c, s, -s, c) * local, instance_pos.z, 1.0f);
+
+    out_local_pos    = local;
+    out_type         = instance_type;
+    out_half_size    = instance_half_size;
+    out_border_width = instance_border_width;
+    out_corner_radii = instance_corner_radii;
+    out_fill_color   = instance_fill_color;
+    out_border_color = instance_border_color;
+}
@@ -0,0 +1,20 @@
+#version 450
+
+layout (location = 0) in vec2      in_uv;
+layout (location = 1) flat in vec4 in_color;
+
+layout (location = 0) out vec4 out_color;
+
+/* 8 bit glyph coverage, rasterized at the size glyphs cover on screen */
+layout (set = 0, binding = 0) uniform sampler2D glyph_atlas;
+
+void main() {
+    float coverage = texture (glyph_atlas, in_uv).r;
+
+    /* don't write depth for pixels outside the glyph */
+    if (coverage <= 0.0f) {
+        discard;
+    }
+
+    out_color = vec4 (in_color.rgb, in_color.a * coverage);
+}
@@ -0,0 +1,34 @@
+#version 450
+
+/* sent by batch buffer containing glyph quads */
+/* per instance, there's no per vertex data */
+layout (location = 0) in vec4 instance_color;
+layout (location = 1) in vec4 instance_uv_rect;
+layout (location = 2) in vec2 instance_size;
+layout (location = 3) in vec3 instance_pos;
+
+layout (location = 0) out vec2      out_uv;
+layout (location = 1) flat out vec4 out_color;
+
+/* maps instance coordinates to clip space, same for all instances in a frame */
+layout (push_constant) uniform ViewTransform {
+    mat4 view;
+    vec2 viewport_size;
+} view_transform;
+
+void main() {
+    /* corners of triangle strip : (0, 0), (1, 0), (0, 1), (1, 1) */
+    vec2 corner = vec2 (gl_VertexIndex & 1, gl_VertexIndex >> 1);
+
+    /* snap top left corner to a pixel, glyphs are rasterized for pixel grid and blur otherwise */
+    vec4 origin = view_transform.view * vec4 (instance_pos.xy, instance_pos.z, 1.0f);
+    vec2 pixel  = (origin.xy * 0.5f + 0.5f) * view_transform.viewport_size;
+    origin.xy  += ((floor (pixel + 0.5f) - pixel) / view_transform.viewport_size) * 2.0f;
+
+    vec4 extent = view_transform.view * vec4 (instance_size * corner, 0.0f, 0.0f);
+
+    gl_Position = origin + extent;
+
+    out_uv    = instance_uv_rect.xy + instance_uv_rect.zw * corner;
+    out_color = instance_color;
+}
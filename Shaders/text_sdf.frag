@@ -0,0 +1,24 @@
+#version 450
+
+layout (location = 0) in vec2      in_uv;
+layout (location = 1) flat in vec4 in_color;
+
+layout (location = 0) out vec4 out_color;
+
+/* 8 bit signed distance fields, edge at 0.5 and increasing towards inside of glyph */
+layout (set = 0, binding = 0) uniform sampler2D glyph_atlas;
+
+void main() {
+    float distance = texture (glyph_atlas, in_uv).r;
+
+    /* change of distance across a pixel, so edge is antialiased over a single pixel at any scale */
+    float width    = max (fwidth (distance), 1e-4f) * 0.5f;
+    float coverage = smoothstep (0.5f - width, 0.5f + width, distance);
+
+    /* don't write depth for pixels outside the glyph */
+    if (coverage <= 0.0f) {
+        discard;
+    }
+
+    out_color = vec4 (in_color.rgb, in_color.a * coverage);
+}
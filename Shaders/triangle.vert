@@ -7,20 +7,33 @@ layout (location = 0) in vec2 mesh_vtx_pos;
 
 /* sent by batch buffer containing mesh instance data */
 /* per instance */
-layout (location = 1) in uint instance_mesh_type;
-layout (location = 2) in vec2 instance_scale;
-layout (location = 3) in vec3 instance_pos;
-layout (location = 4) in vec4 instance_color;
+layout (location = 1) in uint  instance_mesh_type;
+layout (location = 2) in vec2  instance_scale;
+layout (location = 3) in vec3  instance_pos;
+layout (location = 4) in vec4  instance_color;
+layout (location = 5) in float instance_rotation;
+layout (location = 6) in vec2  instance_skew;
+layout (location = 7) in vec2  instance_pivot;
 
 layout (location = 0) out vec4 out_color;
 
+/* maps instance coordinates to clip space, same for all instances in a frame */
+layout (push_constant) uniform ViewTransform {
+    mat4 view;
+    vec2 viewport_size;
+} view_transform;
+
 void main() {
-    gl_Position = vec4 (
-        instance_pos.x + (mesh_vtx_pos.x * instance_scale.x), /* x */
-        - instance_pos.y - (mesh_vtx_pos.y * instance_scale.y), /* y */
-        instance_pos.z,                                       /* z */
-        1.0f                                                  /* w */
-    );
+    /* scale around pivot, then shear, then rotate */
+    vec2 local = (mesh_vtx_pos - instance_pivot) * instance_scale;
+    local.x   += instance_skew.x * local.y;
+    local.y   += instance_skew.y * local.x;
+
+    float c = cos (instance_rotation);
+    float s = sin (instance_rotation);
+    local   = mat2 (c, s, -s, c) * local;
+
+    gl_Position = view_transform.view * vec4 (instance_pos.xy + local, instance_pos.z, 1.0f);
 
     out_color = instance_color;
 }
@@ -0,0 +1,257 @@
+/**
+ * @file HitTest.c
+ * @date Sun, 18th October 2026
+ * @author Siddharth Mishra (admin@brightprogrammer.in)
+ * @copyright Copyright 2024 Siddharth Mishra
+ * @copyright Copyright 2024 Anvie Labs
+ *
+ * Copyright 2024 Siddharth Mishra, Anvie Labs
+ * 
+ * Redistribution and use in source and binary forms, with or without modification, are permitted 
+ * provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+ *    and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions
+ *    and the following disclaimer in the documentation and/or other materials provided with the
+ *    distribution.
+ * 
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse
+ *    or promote products derived from this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND 
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * */
+
+#define ALLOCATOR_TAG ALLOCATOR_TAG_WIDGETS
+
+#include <Anvie/Common.h>
+#include <Anvie/CrossGui/Core/HitTest.h>
+
+/* libc */
+#include <stdlib.h>
+
+NEW_VECTOR_TYPE (Uint64, XuiWidgetKeyVector, xui_widget_key);
+
+/**
+ * @b Area being queried, and what's found so far.
+ * */
+typedef struct HitTestQuery {
+    XuiWidgetTree *tree;
+    Vec2f          min;
+    Vec2f          max;
+    Bool           is_point;  /**< @b Widgets must contain @c min, which equals @c max. */
+    Bool           is_inside; /**< @b Widgets must be entirely inside area. */
+    Uint64         top;       /**< @b Key of topmost widget found, for hit tests. */
+    Bool           is_ok;     /**< @b False if a widget could not be stored. */
+} HitTestQuery;
+
+/**************************************************************************************************/
+/********************************** PRIVATE METHOD DECLARATIONS ***********************************/
+/**************************************************************************************************/
+
+static Size hit_test_query (HitTestQuery *query, XuiWidgetId *hits, Size max_hits);
+static Bool hit_test_matches (HitTestQuery *query, XuiWidgetId id, Uint64 *key);
+static Bool hit_test_collect (Uint64 data, void *user);
+static Bool hit_test_find_top (Uint64 data, void *user);
+static int  hit_test_compare (const void *a, const void *b);
+
+/**************************************************************************************************/
+/*********************************** PUBLIC METHOD DEFINITIONS ************************************/
+/**************************************************************************************************/
+
+/**
+ * @b Find topmost widget under given point, where pointer events should go.
+ *
+ * Widgets are hit tested as of last @c xui_widget_tree_update, so result
+ * matches what's on screen. Deeper widgets are drawn over their ancestors,
+ * and are on top. Of widgets at same depth, the one with greater ID is on top.
+ * Hidden and empty widgets are never hit. Bounds include their top left edges,
+ * but not bottom right ones, so a point on an edge shared by two widgets hits
+ * only one of them.
+ *
+ * Cost grows with log of number of widgets, and number of widgets whose
+ * enlarged bounds contain point, so it's cheap enough for every pointer motion.
+ *
+ * @param tree
+ * @param point Point in logical units, same as world positions of widgets.
+ *
+ * @return Topmost widget containing point.
+ * @return @c XUI_WIDGET_NONE if there's none, or on failure.
+ * */
+XuiWidgetId xui_widget_tree_hit_test (XuiWidgetTree *tree, Vec2f point) {
+    RETURN_VALUE_IF (!tree, XUI_WIDGET_NONE, ERR_INVALID_ARGUMENTS);
+
+    HitTestQuery query = {.tree = tree, .min = point, .max = point, .is_point = True};
+    RETURN_VALUE_IF (
+        !aabb_tree_query (&tree->spatial, point, point, hit_test_find_top, &query),
+        XUI_WIDGET_NONE,
+        "Failed to query spatial index\n"
+    );
+
+    return (XuiWidgetId)query.top;
+}
+
+/**
+ * @b Find all widgets under given point, topmost first.
+ *
+ * Order and rules are same as of @c xui_widget_tree_hit_test, so events can
+ * bubble from first widget found to the last.
+ *
+ * @param tree
+ * @param point
+ * @param hits Filled with topmost widgets found. May be @c Null if @c max_hits is zero.
+ * @param max_hits Capacity of @c hits.
+ *
+ * @return Number of widgets found, may be more than @c max_hits.
+ * @return Zero otherwise.
+ * */
+Size xui_widget_tree_query_point (
+    XuiWidgetTree *tree,
+    Vec2f          point,
+    XuiWidgetId   *hits,
+    Size           max_hits
+) {
+    RETURN_VALUE_IF (!tree || (!hits && max_hits), 0, ERR_INVALID_ARGUMENTS);
+
+    HitTestQuery query = {.tree = tree, .min = point, .max = point, .is_point = True};
+    return hit_test_query (&query, hits, max_hits);
+}
+
+/**
+ * @b Find all widgets overlapping or inside given rectangle, topmost first.
+ *
+ * Meant for rubber band selection. Touching rectangle counts as overlapping.
+ *
+ * @param tree
+ * @param min Top left corner of rectangle.
+ * @param max Bottom right corner of rectangle.
+ * @param is_inside Find only widgets entirely inside rectangle.
+ * @param hits Filled with topmost widgets found. May be @c Null if @c max_hits is zero.
+ * @param max_hits Capacity of @c hits.
+ *
+ * @return Number of widgets found, may be more than @c max_hits.
+ * @return Zero otherwise.
+ * */
+Size xui_widget_tree_query_rect (
+    XuiWidgetTree *tree,
+    Vec2f          min,
+    Vec2f          max,
+    Bool           is_inside,
+    XuiWidgetId   *hits,
+    Size           max_hits
+) {
+    RETURN_VALUE_IF (
+        !tree || (!hits && max_hits) || !(min.x <= max.x) || !(min.y <= max.y),
+        0,
+        ERR_INVALID_ARGUMENTS
+    );
+
+    HitTestQuery query = {.tree = tree, .min = min, .max = max, .is_inside = is_inside};
+    return hit_test_query (&query, hits, max_hits);
+}
+
+/**************************************************************************************************/
+/*********************************** PRIVATE METHOD DEFINITIONS ***********************************/
+/**************************************************************************************************/
+
+/**
+ * @b Collect widgets matching query, sort them topmost first, and copy as many as fit.
+ *
+ * @return Number of widgets found.
+ * @return Zero on failure.
+ * */
+static Size hit_test_query (HitTestQuery *query, XuiWidgetId *hits, Size max_hits) {
+    XuiWidgetTree *tree = query->tree;
+
+    query->is_ok = True;
+    xui_widget_key_vector_clear (&tree->hits);
+    RETURN_VALUE_IF (
+        !aabb_tree_query (&tree->spatial, query->min, query->max, hit_test_collect, query) ||
+            !query->is_ok,
+        0,
+        "Failed to query spatial index\n"
+    );
+
+    Uint64 *keys = xui_widget_key_vector_data (&tree->hits);
+    qsort (keys, tree->hits.count, sizeof (Uint64), hit_test_compare);
+
+    for (Size h = 0; h < MIN (max_hits, tree->hits.count); h++) {
+        hits[h] = (XuiWidgetId)keys[h];
+    }
+
+    return tree->hits.count;
+}
+
+/**
+ * @b Check exact bounds of given widget against query, since spatial index
+ * stores enlarged ones.
+ *
+ * @param query
+ * @param id
+ * @param key Set to depth (high 32 bits) and ID of widget, greater for widgets on top.
+ *
+ * @return @c True if widget matches query.
+ * @return @c False otherwise.
+ * */
+static Bool hit_test_matches (HitTestQuery *query, XuiWidgetId id, Uint64 *key) {
+    XuiWidget *widget = xui_widget_get (query->tree, id);
+    Vec2f      min    = widget->world_position;
+    Vec2f      max    = {.x = min.x + widget->world_size.x, .y = min.y + widget->world_size.y};
+
+    Bool is_match;
+    if (query->is_point) {
+        is_match = min.x <= query->min.x && query->min.x < max.x && min.y <= query->min.y &&
+                   query->min.y < max.y;
+    } else if (query->is_inside) {
+        is_match = query->min.x <= min.x && max.x <= query->max.x && query->min.y <= min.y &&
+                   max.y <= query->max.y;
+    } else {
+        is_match = min.x <= query->max.x && query->min.x <= max.x && min.y <= query->max.y &&
+                   query->min.y <= max.y;
+    }
+
+    *key = ((Uint64)widget->depth << 32) | id;
+    return is_match;
+}
+
+static Bool hit_test_collect (Uint64 data, void *user) {
+    HitTestQuery *query = user;
+
+    Uint64 key;
+    if (hit_test_matches (query, (XuiWidgetId)data, &key) &&
+        !xui_widget_key_vector_push (&query->tree->hits, &key)) {
+        PRINT_ERR ("Failed to resize vector to store more hits\n");
+        query->is_ok = False;
+        return False;
+    }
+
+    return True;
+}
+
+static Bool hit_test_find_top (Uint64 data, void *user) {
+    HitTestQuery *query = user;
+
+    Uint64 key;
+    if (hit_test_matches (query, (XuiWidgetId)data, &key) && key > query->top) {
+        query->top = key;
+    }
+
+    return True;
+}
+
+/**
+ * @b Sort keys in descending order, so topmost widgets come first.
+ * */
+static int hit_test_compare (const void *a, const void *b) {
+    Uint64 x = *(const Uint64 *)a;
+    Uint64 y = *(const Uint64 *)b;
+    return (x < y) - (x > y);
+}
@@ -0,0 +1,725 @@
+/**
+ * @file Layout.c
+ * @date Sun, 18th October 2026
+ * @author Siddharth Mishra (admin@brightprogrammer.in)
+ * @copyright Copyright 2024 Siddharth Mishra
+ * @copyright Copyright 2024 Anvie Labs
+ *
+ * Copyright 2024 Siddharth Mishra, Anvie Labs
+ * 
+ * Redistribution and use in source and binary forms, with or without modification, are permitted 
+ * provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+ *    and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions
+ *    and the following disclaimer in the documentation and/or other materials provided with the
+ *    distribution.
+ * 
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse
+ *    or promote products derived from this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND 
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * */
+
+#define ALLOCATOR_TAG ALLOCATOR_TAG_WIDGETS
+
+#include <Anvie/Common.h>
+#include <Anvie/CrossGui/Core/Layout.h>
+#include <Anvie/CrossGui/Core/WidgetTree.h>
+
+/* libc */
+#include <math.h>
+#include <memory.h>
+
+typedef struct LayoutJobVector LayoutJobVector;
+
+/**
+ * @b State of a layout pass, or of a part of it run by a worker.
+ * */
+typedef struct LayoutContext {
+    XuiWidgetTree      *tree;
+    JobSystem          *job_system; /**< @b Runs jobs, @c Null if there are none. */
+    LayoutJobVector    *jobs;       /**< @b Fixed size subtrees left for jobs, @c Null if none. */
+    XuiWidgetKeyVector *dirty;      /**< @b Widgets a job moved, @c Null to mark them in tree. */
+    XuiWidgetId         root;       /**< @b Widget laid out by context, never left for a job. */
+    Uint64              laid_out;   /**< @b Added to @c XuiWidgetTree::laid_out at end of pass. */
+    Uint64              measured;   /**< @b Added to @c XuiWidgetTree::measured at end of pass. */
+} LayoutContext;
+
+/**
+ * @b Fixed size subtree laid out by a worker thread.
+ * */
+typedef struct LayoutJob {
+    LayoutContext      context;
+    XuiWidgetKeyVector dirty;   /**< @b Depth and ID of descendants of @c root that moved. */
+    XuiWidgetId        root;    /**< @b Widget whose descendants are laid out. */
+    Vec2f              size;    /**< @b Size @c root was given by it's parent. */
+    Bool               is_done; /**< @b Job ran and succeeded. */
+} LayoutJob;
+
+NEW_HEAP_VECTOR_STRUCT (LayoutJob, LayoutJobVector);
+
+NEW_VECTOR_TYPE (LayoutJob, LayoutJobVector, layout_job);
+NEW_VECTOR_TYPE (Uint64, XuiWidgetKeyVector, xui_widget_key);
+
+/**************************************************************************************************/
+/********************************** PRIVATE METHOD DECLARATIONS ***********************************/
+/**************************************************************************************************/
+
+static XuiWidgetTree *layout_tree (XuiWidgetTree *tree, Vec2f size, JobSystem *job_system);
+static Bool           layout_run_jobs (LayoutContext *context);
+static void           layout_run_job (void *data);
+static void           layout_mark_dirty (XuiWidgetTree *tree, XuiWidget *widget);
+static void           layout_mark_failed (LayoutContext *context, XuiWidgetId id);
+static void           layout_mark_moved (LayoutContext *context, XuiWidget *widget);
+static Vec2f          layout_measure (LayoutContext *context, XuiWidgetId id, Vec2f available);
+static Bool           layout_widget (LayoutContext *context, XuiWidgetId id, Vec2f size);
+static Bool layout_place_children (LayoutContext *context, XuiWidget *widget, Vec2f size);
+static Bool
+    layout_set_bounds (LayoutContext *context, XuiWidgetId id, Vec2f position, Vec2f size);
+static Bool  layout_is_fixed (XuiWidget *widget);
+static Vec2f layout_get_inner_size (Vec4f *edges, Vec2f size);
+static Vec2f layout_get_child_space (XuiWidget *child, Vec2f inner, Uint32 main);
+
+/**************************************************************************************************/
+/*********************************** PUBLIC METHOD DEFINITIONS ************************************/
+/**************************************************************************************************/
+
+/**
+ * @b Lay out widget tree in a window of given size.
+ *
+ * Root is resized to fill the window. Only subtrees marked for layout, or
+ * given a different size than last time, are visited. Cached measurements of
+ * unchanged widgets are reused, so changing a single widget costs about as
+ * much as measuring it's siblings and ancestors, and resizing window lays out
+ * every widget only once.
+ *
+ * Bounds are changed through @c xui_widget_set_bounds, so only widgets that
+ * actually moved are emitted by next @c xui_widget_tree_update.
+ *
+ * @param tree
+ * @param size Width and height of window, in logical units.
+ *
+ * @return @c tree on success.
+ * @return @c Null otherwise.
+ * */
+XuiWidgetTree *xui_widget_tree_layout (XuiWidgetTree *tree, Vec2f size) {
+    RETURN_VALUE_IF (!tree || !(size.x >= 0) || !(size.y >= 0), Null, ERR_INVALID_ARGUMENTS);
+    return layout_tree (tree, size, Null);
+}
+
+/**
+ * @b Same as @c xui_widget_tree_layout, but lays out independent subtrees in parallel.
+ *
+ * Widgets with a fixed width and height (panels, table cells, tabs) are never
+ * measured from their content, so their subtrees don't depend on anything
+ * outside them. Tree is laid out on calling thread down to such widgets, and
+ * their subtrees are then laid out by jobs in given job system, which split
+ * off fixed size widgets nested in them into more jobs the same way. Subtrees
+ * don't overlap, so jobs set bounds in them right away, and only widgets
+ * they moved are added to dirty list of tree once they finish. Result is
+ * exactly the same as of @c xui_widget_tree_layout, no matter how jobs were
+ * scheduled.
+ *
+ * Measure callbacks are called from worker threads, and must be safe to call
+ * concurrently for different widgets.
+ *
+ * @param tree
+ * @param size Width and height of window, in logical units.
+ * @param job_system Job system to run jobs in.
+ *
+ * @return @c tree on success.
+ * @return @c Null otherwise.
+ * */
+XuiWidgetTree *
+    xui_widget_tree_layout_parallel (XuiWidgetTree *tree, Vec2f size, JobSystem *job_system) {
+    RETURN_VALUE_IF (
+        !tree || !job_system || !(size.x >= 0) || !(size.y >= 0),
+        Null,
+        ERR_INVALID_ARGUMENTS
+    );
+    return layout_tree (tree, size, job_system);
+}
+
+/**
+ * @b Change how given widget is sized, and how it places it's children.
+ *
+ * Bounds of children of a widget with a direction other than
+ * @c XUI_LAYOUT_DIRECTION_NONE are overwritten by next layout.
+ *
+ * @param tree
+ * @param id
+ * @param layout
+ *
+ * @return @c tree on success.
+ * @return @c Null otherwise.
+ * */
+XuiWidgetTree *
+    xui_widget_set_layout (XuiWidgetTree *tree, XuiWidgetId id, XuiWidgetLayout *layout) {
+    RETURN_VALUE_IF (!tree || !layout, Null, ERR_INVALID_ARGUMENTS);
+
+    XuiWidget *widget = xui_widget_get (tree, id);
+    RETURN_VALUE_IF (!widget, Null, "Invalid widget %u\n", id);
+    RETURN_VALUE_IF (
+        layout->direction >= XUI_LAYOUT_DIRECTION_MAX ||
+            layout->justify >= XUI_LAYOUT_JUSTIFY_MAX || layout->align >= XUI_LAYOUT_ALIGN_MAX,
+        Null,
+        "Invalid layout direction %u, justify %u or align %u\n",
+        layout->direction,
+        layout->justify,
+        layout->align
+    );
+
+    if (!memcmp (&widget->layout, layout, sizeof (XuiWidgetLayout))) {
+        return tree;
+    }
+
+    widget->layout = *layout;
+    layout_mark_dirty (tree, widget);
+
+    return tree;
+}
+
+/**
+ * @b Set callback measuring content of given widget.
+ *
+ * Content of a widget without a callback is empty. Widgets having children
+ * are measured from their children instead.
+ *
+ * @param tree
+ * @param id
+ * @param measure Callback, or @c Null to remove it.
+ * @param data Passed to @c measure.
+ *
+ * @return @c tree on success.
+ * @return @c Null otherwise.
+ * */
+XuiWidgetTree *xui_widget_set_measure (
+    XuiWidgetTree   *tree,
+    XuiWidgetId      id,
+    XuiWidgetMeasure measure,
+    void            *data
+) {
+    RETURN_VALUE_IF (!tree, Null, ERR_INVALID_ARGUMENTS);
+
+    XuiWidget *widget = xui_widget_get (tree, id);
+    RETURN_VALUE_IF (!widget, Null, "Invalid widget %u\n", id);
+
+    if (widget->measure == measure && widget->measure_data == data) {
+        return tree;
+    }
+
+    widget->measure      = measure;
+    widget->measure_data = data;
+    layout_mark_dirty (tree, widget);
+
+    return tree;
+}
+
+/**
+ * @b Tell tree that content of given widget changed, and must be measured again.
+ *
+ * Must be called when whatever measure callback of widget measures changes,
+ * like text of a label.
+ *
+ * @param tree
+ * @param id
+ *
+ * @return @c tree on success.
+ * @return @c Null otherwise.
+ * */
+XuiWidgetTree *xui_widget_invalidate_layout (XuiWidgetTree *tree, XuiWidgetId id) {
+    RETURN_VALUE_IF (!tree, Null, ERR_INVALID_ARGUMENTS);
+
+    XuiWidget *widget = xui_widget_get (tree, id);
+    RETURN_VALUE_IF (!widget, Null, "Invalid widget %u\n", id);
+
+    layout_mark_dirty (tree, widget);
+
+    return tree;
+}
+
+/**************************************************************************************************/
+/*********************************** PRIVATE METHOD DEFINITIONS ***********************************/
+/**************************************************************************************************/
+
+/**
+ * @b Lay out tree, leaving fixed size subtrees to jobs of given job system, if any.
+ *
+ * @return @c tree on success.
+ * @return @c Null otherwise.
+ * */
+static XuiWidgetTree *layout_tree (XuiWidgetTree *tree, Vec2f size, JobSystem *job_system) {
+    LayoutJobVector jobs    = {0};
+    LayoutContext   context = {
+        .tree       = tree,
+        .job_system = job_system,
+        .jobs       = job_system ? &jobs : Null,
+        .root       = tree->root
+    };
+
+    Bool is_ok = xui_widget_set_bounds (tree, tree->root, (Vec2f) {0}, size) &&
+                 layout_widget (&context, tree->root, size);
+    is_ok      = layout_run_jobs (&context) && is_ok;
+
+    tree->laid_out = context.laid_out;
+    tree->measured = context.measured;
+
+    RETURN_VALUE_IF (!is_ok, Null, "Failed to lay out widget tree\n");
+
+    return tree;
+}
+
+/**
+ * @b Run jobs left by given context, wait for them, and add what they did to it.
+ *
+ * Jobs set bounds in their own subtrees. Widgets they moved, and ancestors of
+ * their roots, are shared with other jobs, and are marked only once all jobs
+ * are done.
+ *
+ * @return @c True if all jobs succeeded.
+ * @return @c False otherwise.
+ * */
+static Bool layout_run_jobs (LayoutContext *context) {
+    if (!context->jobs) {
+        return True;
+    }
+
+    XuiWidgetTree *tree    = context->tree;
+    LayoutJob     *job     = layout_job_vector_data (context->jobs);
+    Size           count   = context->jobs->count;
+    JobCounter     counter = {0};
+
+    /* vector does not grow anymore, so jobs can point inside it */
+    for (Size j = 0; j < count; j++) {
+        job[j].context = (LayoutContext) {
+            .tree       = tree,
+            .job_system = context->job_system,
+            .dirty      = &job[j].dirty,
+            .root       = job[j].root
+        };
+        if (!job_system_submit (context->job_system, layout_run_job, job + j, &counter)) {
+            layout_run_job (job + j);
+        }
+    }
+    if (count) {
+        job_system_wait (context->job_system, &counter);
+    }
+
+    Bool is_ok = True;
+    for (Size j = 0; j < count; j++) {
+        XuiWidget *root  = xui_widget_get (tree, job[j].root);
+        Uint64    *keys  = xui_widget_key_vector_data (&job[j].dirty);
+        Size       moved = job[j].dirty.count;
+
+        /* even a failed job moved these widgets, and they're marked as being in dirty list */
+        XuiWidgetKeyVector *dirty = context->dirty ? context->dirty : &tree->dirty;
+        if (!xui_widget_key_vector_append (dirty, keys, moved)) {
+            PRINT_ERR ("Failed to resize vector to store dirty widgets\n");
+            is_ok = False;
+        }
+        if (root->dirty) {
+            layout_mark_moved (context, root);
+        }
+
+        /* a failed job leaves it's subtree to be laid out again by next pass */
+        if (!job[j].is_done) {
+            layout_mark_failed (context, job[j].root);
+        }
+
+        is_ok              = is_ok && job[j].is_done;
+        context->laid_out += job[j].context.laid_out;
+        context->measured += job[j].context.measured;
+        xui_widget_key_vector_deinit (&job[j].dirty);
+    }
+    layout_job_vector_deinit (context->jobs);
+
+    return is_ok;
+}
+
+/**
+ * @b Lay out subtree of a job, and then fixed size subtrees nested in it.
+ * Job is given as @c void* so it can run in a @c JobSystem.
+ * */
+static void layout_run_job (void *data) {
+    LayoutJob      *job  = data;
+    LayoutJobVector jobs = {0};
+
+    job->context.jobs = &jobs;
+    job->is_done      = layout_widget (&job->context, job->root, job->size);
+    job->is_done      = layout_run_jobs (&job->context) && job->is_done;
+}
+
+/**
+ * @b Mark given widget and it's ancestors for layout, and forget their measurements.
+ *
+ * Measurements are made only during layout, and a layout clears all marks,
+ * so a marked ancestor has nothing cached, and so do all ancestors above it.
+ * Marking stops there.
+ * */
+static void layout_mark_dirty (XuiWidgetTree *tree, XuiWidget *widget) {
+    while (widget && !widget->layout_cache.is_dirty) {
+        widget->layout_cache.is_dirty = True;
+        widget->layout_cache.count    = 0;
+        widget->layout_cache.next     = 0;
+
+        widget = xui_widget_get (tree, widget->parent);
+    }
+}
+
+/**
+ * @b Mark given widget and it's ancestors for layout again, up to root of
+ * given context, after a job in it's subtree failed.
+ *
+ * Ancestors were laid out before job ran, so they're marked even if they're
+ * marked already, unlike in @c layout_mark_dirty.
+ * */
+static void layout_mark_failed (LayoutContext *context, XuiWidgetId id) {
+    for (XuiWidget *widget; (widget = xui_widget_get (context->tree, id));) {
+        widget->layout_cache.is_dirty = True;
+        widget->layout_cache.count    = 0;
+        widget->layout_cache.next     = 0;
+
+        id = id == context->root ? 0 : widget->parent;
+    }
+}
+
+/**
+ * @b Mark ancestors of given widget as having a dirty descendant, up to root
+ * of given context, so a job never marks widgets outside of it's subtree.
+ * Same as in @c XuiWidgetTree, marking stops at first ancestor already marked.
+ * */
+static void layout_mark_moved (LayoutContext *context, XuiWidget *widget) {
+    for (XuiWidgetId id = widget->parent; id;) {
+        XuiWidget *parent = xui_widget_get (context->tree, id);
+        if (parent->dirty & XUI_WIDGET_DIRTY_DESCENDANT) {
+            break;
+        }
+
+        parent->dirty |= XUI_WIDGET_DIRTY_DESCENDANT;
+        id             = id == context->root ? 0 : parent->parent;
+    }
+}
+
+/**
+ * @b Measure size given widget wants, without it's margin.
+ *
+ * Fixed sizes are used as is. Otherwise a widget with children wants enough
+ * space to fit them next to each other, and a widget without children wants
+ * what it's measure callback returns, plus padding. Widgets placing their
+ * children by hand want only their padding, and should have a fixed size.
+ *
+ * @param context
+ * @param id
+ * @param available Space given by parent, @c INFINITY on an axis without a limit.
+ *
+ * @return Width and height of widget.
+ * */
+static Vec2f layout_measure (LayoutContext *context, XuiWidgetId id, Vec2f available) {
+    XuiWidgetTree  *tree   = context->tree;
+    XuiWidget      *widget = xui_widget_get (tree, id);
+    XuiLayoutCache *cache  = &widget->layout_cache;
+    for (Uint32 c = 0; c < cache->count; c++) {
+        if (cache->available[c].x == available.x && cache->available[c].y == available.y) {
+            return cache->measured[c];
+        }
+    }
+
+    context->measured++;
+
+    XuiWidgetLayout *layout = &widget->layout;
+    Vec2f            inner  = layout_get_inner_size (
+        &layout->padding,
+        (Vec2f) {.x = layout->size.x > 0 ? layout->size.x : available.x,
+                 .y = layout->size.y > 0 ? layout->size.y : available.y}
+    );
+
+    /* content of fixed size widgets is never needed, so their subtrees are not visited */
+    Bool  is_fixed = layout_is_fixed (widget);
+    Vec2f content  = {0};
+    if (!is_fixed && widget->first_child && layout->direction != XUI_LAYOUT_DIRECTION_NONE) {
+        Uint32 main  = layout->direction == XUI_LAYOUT_DIRECTION_ROW ? 0 : 1;
+        Uint32 cross = 1 - main;
+
+        for (XuiWidgetId c = widget->first_child; c;) {
+            XuiWidget *child  = xui_widget_get (tree, c);
+            Vec4f     *margin = &child->layout.margin;
+
+            Vec2f measured =
+                layout_measure (context, c, layout_get_child_space (child, inner, main));
+            content.data[main] += measured.data[main] + margin->data[main] +
+                                  margin->data[main + 2];
+            content.data[cross] = MAX (
+                content.data[cross],
+                measured.data[cross] + margin->data[cross] + margin->data[cross + 2]
+            );
+
+            if (child->next_sibling) {
+                content.data[main] += layout->gap;
+            }
+            c = child->next_sibling;
+        }
+    } else if (!is_fixed && !widget->first_child && widget->measure) {
+        content = widget->measure (tree, id, inner, widget->measure_data);
+    }
+
+    Vec2f measured = {
+        .x = layout->size.x > 0 ? layout->size.x :
+                                  content.x + layout->padding.x + layout->padding.z,
+        .y = layout->size.y > 0 ? layout->size.y :
+                                  content.y + layout->padding.y + layout->padding.w
+    };
+
+    cache->available[cache->next] = available;
+    cache->measured[cache->next]  = measured;
+    cache->next                   = (cache->next + 1) % XUI_LAYOUT_MEASURE_CACHE_SIZE;
+    cache->count                  = MIN (cache->count + 1, XUI_LAYOUT_MEASURE_CACHE_SIZE);
+
+    return measured;
+}
+
+/**
+ * @b Lay out descendants of given widget, if it's marked or it's size changed.
+ *
+ * If context collects jobs, a fixed size widget with children is left for a
+ * job instead.
+ *
+ * @param context
+ * @param id
+ * @param size Size widget was given by it's parent.
+ *
+ * @return @c True on success.
+ * @return @c False otherwise.
+ * */
+static Bool layout_widget (LayoutContext *context, XuiWidgetId id, Vec2f size) {
+    XuiWidget      *widget = xui_widget_get (context->tree, id);
+    XuiLayoutCache *cache  = &widget->layout_cache;
+    if (!cache->is_dirty && cache->size.x == size.x && cache->size.y == size.y) {
+        return True;
+    }
+
+    if (context->jobs && id != context->root && widget->first_child && layout_is_fixed (widget)) {
+        LayoutJob job = {.root = id, .size = size};
+        RETURN_VALUE_IF (
+            !layout_job_vector_push (context->jobs, &job),
+            False,
+            "Failed to resize vector to store more layout jobs\n"
+        );
+        return True;
+    }
+
+    context->laid_out++;
+
+    /* setting bounds and measuring never create widgets, so pointers stay valid */
+    if (widget->layout.direction != XUI_LAYOUT_DIRECTION_NONE) {
+        RETURN_VALUE_IF (
+            !layout_place_children (context, widget, size),
+            False,
+            "Failed to place children of widget %u\n",
+            id
+        );
+    } else {
+        for (XuiWidgetId c = widget->first_child; c;) {
+            XuiWidget *child = xui_widget_get (context->tree, c);
+            if (!layout_widget (context, c, child->size)) {
+                return False;
+            }
+            c = child->next_sibling;
+        }
+    }
+
+    cache->size     = size;
+    cache->is_dirty = False;
+
+    return True;
+}
+
+/**
+ * @b Set bounds of children of given widget, along it's direction, and lay them out.
+ *
+ * Children are first measured to find how much space they want. Space left
+ * over is then shared among growing children, or space missing is taken from
+ * shrinking ones, in proportion to their size. Children are measured again in
+ * the same space, which is found in their cache.
+ *
+ * @param context
+ * @param widget
+ * @param size Size of widget.
+ *
+ * @return @c True on success.
+ * @return @c False otherwise.
+ * */
+static Bool layout_place_children (LayoutContext *context, XuiWidget *widget, Vec2f size) {
+    XuiWidgetTree   *tree   = context->tree;
+    XuiWidgetLayout *layout = &widget->layout;
+    Uint32           main   = layout->direction == XUI_LAYOUT_DIRECTION_ROW ? 0 : 1;
+    Uint32           cross  = 1 - main;
+    Vec2f            inner  = layout_get_inner_size (&layout->padding, size);
+
+    Float32 used   = 0;
+    Float32 grow   = 0;
+    Float32 shrink = 0;
+    Size    count  = 0;
+    for (XuiWidgetId id = widget->first_child; id;) {
+        XuiWidget *child  = xui_widget_get (tree, id);
+        Vec4f     *margin = &child->layout.margin;
+
+        Vec2f measured = layout_measure (context, id, layout_get_child_space (child, inner, main));
+        used   += measured.data[main] + margin->data[main] + margin->data[main + 2];
+        grow   += child->layout.grow;
+        shrink += child->layout.shrink * measured.data[main];
+        count++;
+
+        id = child->next_sibling;
+    }
+    used += layout->gap * (count ? count - 1 : 0);
+
+    Float32 free     = inner.data[main] - used;
+    Float32 leftover = free > 0 && !(grow > 0) ? free : 0;
+    Float32 offset   = layout->padding.data[main];
+    Float32 spacing  = layout->gap;
+    switch (layout->justify) {
+        case XUI_LAYOUT_JUSTIFY_CENTER :
+            offset += leftover * 0.5f;
+            break;
+        case XUI_LAYOUT_JUSTIFY_END :
+            offset += leftover;
+            break;
+        case XUI_LAYOUT_JUSTIFY_SPACE_BETWEEN :
+            spacing += count > 1 ? leftover / (count - 1) : 0;
+            break;
+        default :
+            break;
+    }
+
+    for (XuiWidgetId id = widget->first_child; id;) {
+        XuiWidget *child     = xui_widget_get (tree, id);
+        Vec4f     *margin    = &child->layout.margin;
+        Vec2f      available = layout_get_child_space (child, inner, main);
+
+        /* flex along direction */
+        Float32 base   = layout_measure (context, id, available).data[main];
+        Float32 length = base;
+        if (free > 0 && grow > 0) {
+            length += free * child->layout.grow / grow;
+        } else if (free < 0 && shrink > 0) {
+            length += free * child->layout.shrink * base / shrink;
+        }
+        length = MAX (length, 0);
+
+        /* stretch or align across direction */
+        Float32 breadth = available.data[cross];
+        if (layout->align != XUI_LAYOUT_ALIGN_STRETCH || child->layout.size.data[cross] > 0) {
+            Vec2f given      = available;
+            given.data[main] = length;
+            breadth          = layout_measure (context, id, given).data[cross];
+        }
+
+        Float32 across = layout->padding.data[cross] + margin->data[cross];
+        if (layout->align == XUI_LAYOUT_ALIGN_CENTER) {
+            across += (available.data[cross] - breadth) * 0.5f;
+        } else if (layout->align == XUI_LAYOUT_ALIGN_END) {
+            across += available.data[cross] - breadth;
+        }
+
+        Vec2f position       = {0};
+        Vec2f bounds         = {0};
+        position.data[main]  = offset + margin->data[main];
+        position.data[cross] = across;
+        bounds.data[main]    = length;
+        bounds.data[cross]   = breadth;
+
+        RETURN_VALUE_IF (
+            !layout_set_bounds (context, id, position, bounds),
+            False,
+            "Failed to set bounds of widget %u\n",
+            id
+        );
+        if (!layout_widget (context, id, bounds)) {
+            return False;
+        }
+
+        offset += margin->data[main] + length + margin->data[main + 2] + spacing;
+        id      = child->next_sibling;
+    }
+
+    return True;
+}
+
+/**
+ * @b Set bounds of given widget, same as @c xui_widget_set_bounds does.
+ *
+ * Subtree of a job belongs to it alone, so a job sets bounds right away, but
+ * dirty list of tree is shared, so moved widgets are remembered in context,
+ * and added to it once jobs are done.
+ *
+ * @return @c True on success.
+ * @return @c False otherwise.
+ * */
+static Bool
+    layout_set_bounds (LayoutContext *context, XuiWidgetId id, Vec2f position, Vec2f size) {
+    if (!context->dirty) {
+        return !!xui_widget_set_bounds (context->tree, id, position, size);
+    }
+
+    XuiWidget *widget = xui_widget_get (context->tree, id);
+    if (widget->position.x == position.x && widget->position.y == position.y &&
+        widget->size.x == size.x && widget->size.y == size.y) {
+        return True;
+    }
+
+    /* a widget goes into dirty list only once per update */
+    if (!(widget->dirty & (XUI_WIDGET_DIRTY_STYLE | XUI_WIDGET_DIRTY_SUBTREE))) {
+        Uint64 key = ((Uint64)widget->depth << 32) | id;
+        RETURN_VALUE_IF (
+            !xui_widget_key_vector_push (context->dirty, &key),
+            False,
+            "Failed to resize vector to store dirty widgets\n"
+        );
+    }
+
+    widget->position  = position;
+    widget->size      = size;
+    widget->dirty    |= XUI_WIDGET_DIRTY_SUBTREE;
+    layout_mark_moved (context, widget);
+
+    return True;
+}
+
+/**
+ * @b Fixed size widgets have both width and height fixed.
+ * */
+static Bool layout_is_fixed (XuiWidget *widget) {
+    return widget->layout.size.x > 0 && widget->layout.size.y > 0;
+}
+
+/**
+ * @b Get size left inside given edges (padding or margin), never negative.
+ * */
+static Vec2f layout_get_inner_size (Vec4f *edges, Vec2f size) {
+    return (Vec2f) {.x = MAX (size.x - edges->x - edges->z, 0),
+                    .y = MAX (size.y - edges->y - edges->w, 0)};
+}
+
+/**
+ * @b Get space a child is measured in, inside given inner size of it's parent.
+ *
+ * Children are measured without a limit along direction of parent, so they
+ * report their natural length, which is then grown or shrunk to fit. This
+ * also makes the space independent of length of parent, so resizing parent
+ * along it's direction finds it's children in cache.
+ * */
+static Vec2f layout_get_child_space (XuiWidget *child, Vec2f inner, Uint32 main) {
+    Vec2f space      = layout_get_inner_size (&child->layout.margin, inner);
+    space.data[main] = INFINITY;
+    return space;
+}
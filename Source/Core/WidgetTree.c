@@ -0,0 +1,664 @@
+/**
+ * @file WidgetTree.c
+ * @date Sun, 18th October 2026
+ * @author Siddharth Mishra (admin@brightprogrammer.in)
+ * @copyright Copyright 2024 Siddharth Mishra
+ * @copyright Copyright 2024 Anvie Labs
+ *
+ * Copyright 2024 Siddharth Mishra, Anvie Labs
+ * 
+ * Redistribution and use in source and binary forms, with or without modification, are permitted 
+ * provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+ *    and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions
+ *    and the following disclaimer in the documentation and/or other materials provided with the
+ *    distribution.
+ * 
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse
+ *    or promote products derived from this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND 
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * */
+
+#define ALLOCATOR_TAG ALLOCATOR_TAG_WIDGETS
+
+#include <Anvie/Common.h>
+#include <Anvie/CrossGui/Core/WidgetTree.h>
+
+/* libc */
+#include <memory.h>
+#include <stdlib.h>
+
+NEW_VECTOR_TYPE (XuiWidget, XuiWidgetVector, xui_widget);
+NEW_VECTOR_TYPE (XuiWidgetId, XuiWidgetIdVector, xui_widget_id);
+NEW_VECTOR_TYPE (Uint64, XuiWidgetKeyVector, xui_widget_key);
+
+/**************************************************************************************************/
+/********************************** PRIVATE METHOD DECLARATIONS ***********************************/
+/**************************************************************************************************/
+
+static void widget_tree_mark_dirty (XuiWidgetTree *tree, XuiWidget *widget, Uint32 dirty);
+static int  widget_dirty_compare (const void *a, const void *b);
+static Bool widget_tree_update_widget (XuiWidgetTree *tree, XuiWidgetId id, Bool is_moved);
+static Bool widget_tree_emit_widget (XuiWidgetTree *tree, XuiWidget *widget);
+static Bool widget_tree_index_widget (XuiWidgetTree *tree, XuiWidget *widget, XuiWidgetId id);
+static void widget_tree_destroy_subtree (XuiWidgetTree *tree, XuiWidgetId id);
+static XuiSlotContent2D *widget_get_slot_content (XuiWidget *widget, XuiSlotContent2D *content);
+
+/**************************************************************************************************/
+/*********************************** PUBLIC METHOD DEFINITIONS ************************************/
+/**************************************************************************************************/
+
+/**
+ * @b Initialize an empty widget tree, with just a root container.
+ *
+ * @param tree
+ * @param gplug Plugin providing persistent slots widgets are drawn in.
+ * @param gctx Graphics context slots are drawn in.
+ *
+ * @return @c tree on success.
+ * @return @c Null otherwise.
+ * */
+XuiWidgetTree *
+    xui_widget_tree_init (XuiWidgetTree *tree, XuiGraphicsPlugin *gplug, XuiGraphicsContext *gctx) {
+    RETURN_VALUE_IF (!tree || !gplug || !gctx, Null, ERR_INVALID_ARGUMENTS);
+    RETURN_VALUE_IF (
+        !gplug->slot_create_2d || !gplug->slot_update_2d || !gplug->slot_destroy_2d,
+        Null,
+        "Graphics plugin does not support persistent slots\n"
+    );
+
+    memset (tree, 0, sizeof (XuiWidgetTree));
+    tree->gplug = gplug;
+    tree->gctx  = gctx;
+
+    RETURN_VALUE_IF (
+        !aabb_tree_init (&tree->spatial, XUI_WIDGET_SPATIAL_MARGIN),
+        Null,
+        "Failed to create spatial index\n"
+    );
+
+    tree->root = xui_widget_create (tree, XUI_WIDGET_NONE);
+    RETURN_VALUE_IF (!tree->root, Null, "Failed to create root widget\n");
+
+    return tree;
+}
+
+/**
+ * @b Destroy all widgets of tree, along with their slots.
+ *
+ * @param tree
+ *
+ * @return @c tree on success.
+ * @return @c Null otherwise.
+ * */
+XuiWidgetTree *xui_widget_tree_deinit (XuiWidgetTree *tree) {
+    RETURN_VALUE_IF (!tree, Null, ERR_INVALID_ARGUMENTS);
+
+    if (tree->root) {
+        widget_tree_destroy_subtree (tree, tree->root);
+    }
+
+    xui_widget_vector_deinit (&tree->widgets);
+    xui_widget_id_vector_deinit (&tree->free_widgets);
+    xui_widget_key_vector_deinit (&tree->dirty);
+    xui_widget_key_vector_deinit (&tree->hits);
+    aabb_tree_deinit (&tree->spatial);
+
+    memset (tree, 0, sizeof (XuiWidgetTree));
+
+    return tree;
+}
+
+/**
+ * @b Emit slots of all widgets changed since last update.
+ *
+ * Dirty widgets are visited in order of their depth, so that parents are
+ * placed before their children. Descendants of moved widgets are visited
+ * along with them, and skipped later. If a slot fails to update, widgets not
+ * updated yet stay dirty, and are retried by next update.
+ *
+ * @param tree
+ *
+ * @return @c tree on success.
+ * @return @c Null otherwise.
+ * */
+XuiWidgetTree *xui_widget_tree_update (XuiWidgetTree *tree) {
+    RETURN_VALUE_IF (!tree, Null, ERR_INVALID_ARGUMENTS);
+
+    tree->visited = 0;
+    tree->emitted = 0;
+
+    Uint64 *dirty = xui_widget_key_vector_data (&tree->dirty);
+    qsort (dirty, tree->dirty.count, sizeof (Uint64), widget_dirty_compare);
+
+    for (Size d = 0; d < tree->dirty.count; d++) {
+        XuiWidgetId id     = (Uint32)dirty[d];
+        XuiWidget  *widget = xui_widget_get (tree, id);
+
+        /* destroyed, or already updated along with a moved ancestor */
+        if (!widget || !(widget->dirty & (XUI_WIDGET_DIRTY_STYLE | XUI_WIDGET_DIRTY_SUBTREE))) {
+            continue;
+        }
+
+        RETURN_VALUE_IF (
+            !widget_tree_update_widget (tree, id, False),
+            Null,
+            "Failed to update widget tree\n"
+        );
+    }
+
+    /* all dirty widgets are updated, so paths leading to them are clean again */
+    for (Size d = 0; d < tree->dirty.count; d++) {
+        XuiWidget *widget = xui_widget_get (tree, (Uint32)dirty[d]);
+        if (!widget) {
+            continue;
+        }
+
+        widget->dirty = 0;
+        for (widget = xui_widget_get (tree, widget->parent); widget && widget->dirty;
+             widget = xui_widget_get (tree, widget->parent)) {
+            widget->dirty = 0;
+        }
+    }
+
+    xui_widget_key_vector_clear (&tree->dirty);
+
+    return tree;
+}
+
+/**
+ * @b Create a new visible container widget, with empty bounds, as last child of given parent.
+ *
+ * @param tree
+ * @param parent Parent of new widget, @c tree->root for a top level widget.
+ *
+ * @return ID of new widget on success.
+ * @return @c XUI_WIDGET_NONE otherwise.
+ * */
+XuiWidgetId xui_widget_create (XuiWidgetTree *tree, XuiWidgetId parent) {
+    RETURN_VALUE_IF (!tree, XUI_WIDGET_NONE, ERR_INVALID_ARGUMENTS);
+
+    /* only root has no parent */
+    Uint32 depth = 0;
+    if (tree->root) {
+        XuiWidget *parent_widget = xui_widget_get (tree, parent);
+        RETURN_VALUE_IF (!parent_widget, XUI_WIDGET_NONE, "Invalid parent widget %u\n", parent);
+
+        depth = parent_widget->depth + 1;
+        RETURN_VALUE_IF (
+            depth >= XUI_WIDGET_DEPTH_MAX,
+            XUI_WIDGET_NONE,
+            "Widget tree cannot be deeper than %u\n",
+            XUI_WIDGET_DEPTH_MAX
+        );
+    } else {
+        parent = XUI_WIDGET_NONE;
+    }
+
+    XuiWidget *widget;
+    if (tree->free_widgets.count) {
+        Size        last = --tree->free_widgets.count;
+        XuiWidgetId free = xui_widget_id_vector_data (&tree->free_widgets)[last];
+        widget           = xui_widget_vector_data (&tree->widgets) + free - 1;
+    } else {
+        RETURN_VALUE_IF (
+            !(widget = xui_widget_vector_push (&tree->widgets, Null)),
+            XUI_WIDGET_NONE,
+            "Failed to resize vector to store more widgets\n"
+        );
+    }
+
+    XuiWidgetId id = widget - xui_widget_vector_data (&tree->widgets) + 1;
+    *widget        = (XuiWidget) {
+        .kind       = XUI_WIDGET_KIND_CONTAINER,
+        .is_visible = True,
+        .parent     = parent,
+        .depth      = depth,
+        .proxy      = AABB_TREE_NULL,
+        .is_used    = True
+    };
+
+    /* append to children of parent */
+    if (parent) {
+        XuiWidget *parent_widget = xui_widget_get (tree, parent);
+        if (parent_widget->last_child) {
+            xui_widget_get (tree, parent_widget->last_child)->next_sibling = id;
+            widget->prev_sibling = parent_widget->last_child;
+        } else {
+            parent_widget->first_child = id;
+        }
+        parent_widget->last_child = id;
+    }
+
+    widget_tree_mark_dirty (tree, widget, XUI_WIDGET_DIRTY_SUBTREE);
+    xui_widget_invalidate_layout (tree, id);
+
+    return id;
+}
+
+/**
+ * @b Destroy given widget along with all it's descendants, and their slots.
+ *
+ * @param tree
+ * @param id Widget to destroy, must not be root.
+ *
+ * @return @c tree on success.
+ * @return @c Null otherwise.
+ * */
+XuiWidgetTree *xui_widget_destroy (XuiWidgetTree *tree, XuiWidgetId id) {
+    RETURN_VALUE_IF (!tree, Null, ERR_INVALID_ARGUMENTS);
+
+    XuiWidget *widget = xui_widget_get (tree, id);
+    RETURN_VALUE_IF (!widget || id == tree->root, Null, "Invalid widget %u\n", id);
+
+    /* unlink from siblings and parent */
+    XuiWidget *parent = xui_widget_get (tree, widget->parent);
+    if (widget->prev_sibling) {
+        xui_widget_get (tree, widget->prev_sibling)->next_sibling = widget->next_sibling;
+    } else {
+        parent->first_child = widget->next_sibling;
+    }
+    if (widget->next_sibling) {
+        xui_widget_get (tree, widget->next_sibling)->prev_sibling = widget->prev_sibling;
+    } else {
+        parent->last_child = widget->prev_sibling;
+    }
+
+    xui_widget_invalidate_layout (tree, widget->parent);
+    widget_tree_destroy_subtree (tree, id);
+
+    return tree;
+}
+
+/**
+ * @b Get widget with given ID.
+ *
+ * Returned widget must not be modified directly, and pointer is valid only
+ * until next widget is created.
+ *
+ * @param tree
+ * @param id
+ *
+ * @return Widget on success.
+ * @return @c Null otherwise.
+ * */
+XuiWidget *xui_widget_get (XuiWidgetTree *tree, XuiWidgetId id) {
+    RETURN_VALUE_IF (!tree, Null, ERR_INVALID_ARGUMENTS);
+
+    if (!id || id > tree->widgets.count) {
+        return Null;
+    }
+
+    XuiWidget *widget = xui_widget_vector_data (&tree->widgets) + id - 1;
+    return widget->is_used ? widget : Null;
+}
+
+/**
+ * @b Move and resize given widget. Descendants move along with it.
+ *
+ * @param tree
+ * @param id
+ * @param position Top left corner relative to top left corner of parent.
+ * @param size Width and height.
+ *
+ * @return @c tree on success.
+ * @return @c Null otherwise.
+ * */
+XuiWidgetTree *
+    xui_widget_set_bounds (XuiWidgetTree *tree, XuiWidgetId id, Vec2f position, Vec2f size) {
+    RETURN_VALUE_IF (!tree, Null, ERR_INVALID_ARGUMENTS);
+
+    XuiWidget *widget = xui_widget_get (tree, id);
+    RETURN_VALUE_IF (!widget, Null, "Invalid widget %u\n", id);
+
+    /* setting same bounds again every frame must not cost an update */
+    if (widget->position.x == position.x && widget->position.y == position.y &&
+        widget->size.x == size.x && widget->size.y == size.y) {
+        return tree;
+    }
+
+    widget->position = position;
+    widget->size     = size;
+    widget_tree_mark_dirty (tree, widget, XUI_WIDGET_DIRTY_SUBTREE);
+
+    return tree;
+}
+
+/**
+ * @b Change appearance of given widget.
+ *
+ * @param tree
+ * @param id
+ * @param style
+ *
+ * @return @c tree on success.
+ * @return @c Null otherwise.
+ * */
+XuiWidgetTree *xui_widget_set_style (XuiWidgetTree *tree, XuiWidgetId id, XuiWidgetStyle *style) {
+    RETURN_VALUE_IF (!tree || !style, Null, ERR_INVALID_ARGUMENTS);
+
+    XuiWidget *widget = xui_widget_get (tree, id);
+    RETURN_VALUE_IF (!widget, Null, "Invalid widget %u\n", id);
+
+    if (!memcmp (&widget->style, style, sizeof (XuiWidgetStyle))) {
+        return tree;
+    }
+
+    widget->style = *style;
+    widget_tree_mark_dirty (tree, widget, XUI_WIDGET_DIRTY_STYLE);
+
+    return tree;
+}
+
+/**
+ * @b Change what given widget draws.
+ *
+ * @param tree
+ * @param id
+ * @param kind One of @c XuiWidgetKind.
+ * @param shape Mesh type for meshes, @c XuiPrimitiveType2D for primitives.
+ *
+ * @return @c tree on success.
+ * @return @c Null otherwise.
+ * */
+XuiWidgetTree *
+    xui_widget_set_shape (XuiWidgetTree *tree, XuiWidgetId id, Uint32 kind, Uint32 shape) {
+    RETURN_VALUE_IF (!tree, Null, ERR_INVALID_ARGUMENTS);
+
+    XuiWidget *widget = xui_widget_get (tree, id);
+    RETURN_VALUE_IF (!widget, Null, "Invalid widget %u\n", id);
+    RETURN_VALUE_IF (
+        kind >= XUI_WIDGET_KIND_MAX ||
+            (kind == XUI_WIDGET_KIND_PRIMITIVE && shape >= XUI_PRIMITIVE_TYPE_2D_MAX),
+        Null,
+        "Invalid widget kind %u or shape %u\n",
+        kind,
+        shape
+    );
+
+    if (widget->kind == kind && widget->shape == shape) {
+        return tree;
+    }
+
+    widget->kind  = kind;
+    widget->shape = shape;
+    widget_tree_mark_dirty (tree, widget, XUI_WIDGET_DIRTY_STYLE);
+
+    return tree;
+}
+
+/**
+ * @b Show or hide given widget, along with all it's descendants.
+ *
+ * Hidden widgets keep their slots, so showing them again does not create new ones.
+ *
+ * @param tree
+ * @param id
+ * @param is_visible
+ *
+ * @return @c tree on success.
+ * @return @c Null otherwise.
+ * */
+XuiWidgetTree *xui_widget_set_visible (XuiWidgetTree *tree, XuiWidgetId id, Bool is_visible) {
+    RETURN_VALUE_IF (!tree, Null, ERR_INVALID_ARGUMENTS);
+
+    XuiWidget *widget = xui_widget_get (tree, id);
+    RETURN_VALUE_IF (!widget, Null, "Invalid widget %u\n", id);
+
+    if (widget->is_visible == !!is_visible) {
+        return tree;
+    }
+
+    widget->is_visible = !!is_visible;
+    widget_tree_mark_dirty (tree, widget, XUI_WIDGET_DIRTY_SUBTREE);
+
+    return tree;
+}
+
+/**************************************************************************************************/
+/*********************************** PRIVATE METHOD DEFINITIONS ***********************************/
+/**************************************************************************************************/
+
+/**
+ * @b Mark widget dirty, and it's ancestors as having a dirty descendant.
+ *
+ * Ancestors of a widget marked with @c XUI_WIDGET_DIRTY_DESCENDANT are always
+ * marked too, so marking stops at first such ancestor, and marking many
+ * widgets of same subtree costs about as much as marking one.
+ *
+ * Upward marks are not needed to find dirty widgets, which are kept in a
+ * list, but tell whoever walks the tree from top (eg: layout) which subtrees
+ * have something changed in them.
+ * */
+static void widget_tree_mark_dirty (XuiWidgetTree *tree, XuiWidget *widget, Uint32 dirty) {
+    /* a widget goes into dirty list only once per update */
+    if (!(widget->dirty & (XUI_WIDGET_DIRTY_STYLE | XUI_WIDGET_DIRTY_SUBTREE))) {
+        XuiWidgetId id  = widget - xui_widget_vector_data (&tree->widgets) + 1;
+        Uint64      key = ((Uint64)widget->depth << 32) | id;
+
+        /* widget is still updated if an ancestor moves, or by a later change of it */
+        if (!xui_widget_key_vector_push (&tree->dirty, &key)) {
+            PRINT_ERR ("Failed to resize vector to store dirty widgets\n");
+            return;
+        }
+    }
+
+    widget->dirty |= dirty;
+
+    for (XuiWidgetId id = widget->parent; id;) {
+        XuiWidget *parent = xui_widget_vector_data (&tree->widgets) + id - 1;
+        if (parent->dirty & XUI_WIDGET_DIRTY_DESCENDANT) {
+            break;
+        }
+
+        parent->dirty |= XUI_WIDGET_DIRTY_DESCENDANT;
+        id             = parent->parent;
+    }
+}
+
+/**
+ * @b Update given widget, and all of it's descendants if it moved.
+ *
+ * @param tree
+ * @param id
+ * @param is_moved Bounds or visibility of an ancestor changed.
+ *
+ * @return @c True on success.
+ * @return @c False otherwise.
+ * */
+static Bool widget_tree_update_widget (XuiWidgetTree *tree, XuiWidgetId id, Bool is_moved) {
+    XuiWidget *widget = xui_widget_vector_data (&tree->widgets) + id - 1;
+    tree->visited++;
+
+    is_moved = is_moved || (widget->dirty & XUI_WIDGET_DIRTY_SUBTREE);
+    if (is_moved) {
+        XuiWidget *parent =
+            widget->parent ? xui_widget_vector_data (&tree->widgets) + widget->parent - 1 : Null;
+
+        widget->world_position = widget->position;
+        widget->world_size     = widget->size;
+        widget->is_drawn       = widget->is_visible;
+        if (parent) {
+            widget->world_position.x += parent->world_position.x;
+            widget->world_position.y += parent->world_position.y;
+            widget->is_drawn          = widget->is_drawn && parent->is_drawn;
+        }
+    }
+
+    RETURN_VALUE_IF (
+        !widget_tree_emit_widget (tree, widget),
+        False,
+        "Failed to update slot of widget %u\n",
+        id
+    );
+    RETURN_VALUE_IF (
+        is_moved && !widget_tree_index_widget (tree, widget, id),
+        False,
+        "Failed to update spatial index for widget %u\n",
+        id
+    );
+
+    /* descendant marks are cleared once all dirty widgets are updated */
+    widget->dirty &= XUI_WIDGET_DIRTY_DESCENDANT;
+
+    if (is_moved) {
+        for (XuiWidgetId child = widget->first_child; child;) {
+            if (!widget_tree_update_widget (tree, child, True)) {
+                return False;
+            }
+
+            /* slots are created by plugin, not in this tree, so widget pointers stay valid */
+            child = xui_widget_vector_data (&tree->widgets)[child - 1].next_sibling;
+        }
+    }
+
+    return True;
+}
+
+/**
+ * @b Update slot of given widget with what it draws now.
+ *
+ * A widget that never drew anything does not get a slot, and a widget that
+ * stops drawing keeps it's slot, updated to draw nothing.
+ *
+ * @return @c True on success.
+ * @return @c False otherwise.
+ * */
+static Bool widget_tree_emit_widget (XuiWidgetTree *tree, XuiWidget *widget) {
+    Bool is_drawn = widget->is_drawn && widget->kind != XUI_WIDGET_KIND_CONTAINER;
+    if (!is_drawn && !widget->slot) {
+        return True;
+    }
+
+    if (!widget->slot) {
+        widget->slot = tree->gplug->slot_create_2d (tree->gctx);
+        RETURN_VALUE_IF (!widget->slot, False, "Failed to create slot for widget\n");
+    }
+
+    XuiSlotContent2D content = {.type = XUI_SLOT_TYPE_2D_NONE};
+    if (is_drawn) {
+        widget_get_slot_content (widget, &content);
+    }
+
+    RETURN_VALUE_IF (
+        !tree->gplug->slot_update_2d (tree->gctx, widget->slot, &content),
+        False,
+        "Failed to update slot of widget\n"
+    );
+
+    tree->emitted++;
+
+    return True;
+}
+
+/**
+ * @b Put world bounds of given widget in spatial index, or take them out if
+ * it's not drawn, or is empty.
+ *
+ * @return @c True on success.
+ * @return @c False otherwise.
+ * */
+static Bool widget_tree_index_widget (XuiWidgetTree *tree, XuiWidget *widget, XuiWidgetId id) {
+    Bool is_indexed = widget->is_drawn && widget->world_size.x > 0 && widget->world_size.y > 0;
+    if (!is_indexed) {
+        if (widget->proxy != AABB_TREE_NULL) {
+            aabb_tree_remove (&tree->spatial, widget->proxy);
+            widget->proxy = AABB_TREE_NULL;
+        }
+        return True;
+    }
+
+    Vec2f min = widget->world_position;
+    Vec2f max = {.x = min.x + widget->world_size.x, .y = min.y + widget->world_size.y};
+    if (widget->proxy == AABB_TREE_NULL) {
+        widget->proxy = aabb_tree_insert (&tree->spatial, min, max, id);
+        return widget->proxy != AABB_TREE_NULL;
+    }
+
+    return !!aabb_tree_move (&tree->spatial, widget->proxy, min, max);
+}
+
+/**
+ * @b Destroy slots of given widget and all it's descendants, and free them for reuse.
+ *
+ * Widget is not unlinked from it's parent and siblings.
+ * */
+static void widget_tree_destroy_subtree (XuiWidgetTree *tree, XuiWidgetId id) {
+    XuiWidget *widget = xui_widget_vector_data (&tree->widgets) + id - 1;
+
+    for (XuiWidgetId child = widget->first_child; child;) {
+        XuiWidgetId next = xui_widget_vector_data (&tree->widgets)[child - 1].next_sibling;
+        widget_tree_destroy_subtree (tree, child);
+        child = next;
+    }
+
+    if (widget->slot && !tree->gplug->slot_destroy_2d (tree->gctx, widget->slot)) {
+        PRINT_ERR ("Failed to destroy slot of widget %u\n", id);
+    }
+    if (widget->proxy != AABB_TREE_NULL) {
+        aabb_tree_remove (&tree->spatial, widget->proxy);
+        widget->proxy = AABB_TREE_NULL;
+    }
+
+    /* failing to remember a free widget only wastes it, tree stays consistent */
+    widget->is_used = False;
+    widget->slot    = 0;
+    if (!xui_widget_id_vector_push (&tree->free_widgets, &id)) {
+        PRINT_ERR ("Failed to resize vector to store free widgets\n");
+    }
+}
+
+/**
+ * @b Get content of slot of given widget, filling it's bounds.
+ *
+ * Meshes are expected to span -1 to 1 on both axes, like the rectangle mesh.
+ * Deeper widgets are given smaller Z, so children are drawn over their parents.
+ * */
+static XuiSlotContent2D *widget_get_slot_content (XuiWidget *widget, XuiSlotContent2D *content) {
+    Vec2f half_size = {.x = widget->size.x * 0.5f, .y = widget->size.y * 0.5f};
+    Vec3f center    = {
+        .x = widget->world_position.x + half_size.x,
+        .y = widget->world_position.y + half_size.y,
+        .z = 1.f - (Float32)(widget->depth + 1) / (XUI_WIDGET_DEPTH_MAX + 1)
+    };
+
+    if (widget->kind == XUI_WIDGET_KIND_MESH) {
+        content->type = XUI_SLOT_TYPE_2D_MESH;
+        content->mesh = (XuiMeshInstance2D) {
+            .type     = widget->shape,
+            .scale    = half_size,
+            .position = center,
+            .color    = widget->style.color
+        };
+    } else {
+        content->type      = XUI_SLOT_TYPE_2D_PRIMITIVE;
+        content->primitive = (XuiPrimitive2D) {
+            .position     = center,
+            .type         = widget->shape,
+            .half_size    = half_size,
+            .border_width = widget->style.border_width,
+            .corner_radii = widget->style.corner_radii,
+            .fill_color   = widget->style.color,
+            .border_color = widget->style.border_color
+        };
+    }
+
+    return content;
+}
+
+static int widget_dirty_compare (const void *a, const void *b) {
+    Uint64 x = *(const Uint64 *)a;
+    Uint64 y = *(const Uint64 *)b;
+    return (x > y) - (x < y);
+}
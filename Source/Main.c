@@ -1,6 +1,9 @@
 #include <Anvie/Common.h>
 #include <Anvie/Types.h>
 
+/* libc */
+#include <string.h>
+
 /* crosswindow */
 #include <Anvie/CrossWindow/Event.h>
 #include <Anvie/CrossWindow/Window.h>
@@ -8,6 +11,7 @@
 /* crossgui */
 #include <Anvie/CrossGui/Plugin/Graphics/Graphics.h>
 #include <Anvie/CrossGui/Plugin/Plugin.h>
+#include <Anvie/CrossGui/Utils/JobSystem.h>
 
 typedef enum MeshType {
     MESH_TYPE_RECTANGLE,
@@ -96,37 +100,35 @@ void draw_ui (XuiGraphicsPlugin *gplug, XuiGraphicsContext *gctx, XwWindow *xwin
         return;
     }
 
-    // /* vertical line */
-    // if (!gplug->draw_2d (
-    //         gctx,
-    //         xwin,
-    //         &(XuiMeshInstance2D) {
-    //             .type     = MESH_TYPE_RECTANGLE,
-    //             .position = {.x = 0.0, .y = 0, .z = 0.f},
-    //             .scale    = {.x = 0.005, .y = 1},
-    //             .color    = {.r = 0.2, .g = 0.2, .b = 0.2, .a = 1},
-    // }
-    //     )) {
-    //     return;
-    // }
-    //
-    // /* horizontal line */
-    // if (!gplug->draw_2d (
-    //         gctx,
-    //         xwin,
-    //         &(XuiMeshInstance2D) {
-    //             .type     = MESH_TYPE_RECTANGLE,
-    //             .position = {.x = 0.0, .y = 0, .z = 0.f},
-    //             .scale    = {.x = 1, .y = 0.005},
-    //             .color    = {.r = 0.2, .g = 0.2, .b = 0.2, .a = 1},
-    // }
-    //     )) {
-    //     return;
-    // }
+    /* vertical line */
+    if (!gplug->draw_line_2d (
+            gctx,
+            &(XuiLineSegment2D) {
+                .p0    = {.x = 0, .y = -1},
+                .p1    = {.x = 0, .y = 1},
+                .width = 0.01,
+                .color = {.r = 0.2, .g = 0.2, .b = 0.2, .a = 1},
+    }
+        )) {
+        return;
+    }
+
+    /* horizontal line */
+    if (!gplug->draw_line_2d (
+            gctx,
+            &(XuiLineSegment2D) {
+                .p0    = {.x = -1, .y = 0},
+                .p1    = {.x = 1, .y = 0},
+                .width = 0.01,
+                .color = {.r = 0.2, .g = 0.2, .b = 0.2, .a = 1},
+    }
+        )) {
+        return;
+    }
 }
 
 int main (Int32 argc, CString *argv) {
-    RETURN_VALUE_IF (argc < 2, EXIT_FAILURE, "%s <plugin path>\n", argv[0]);
+    RETURN_VALUE_IF (argc < 2, EXIT_FAILURE, "%s <plugin path> [--render-thread]\n", argv[0]);
 
     XuiPlugin *plugin = xui_plugin_load (argv[1]);
     RETURN_VALUE_IF (!plugin, EXIT_FAILURE, "Failed to load plugin\n");
@@ -134,10 +136,31 @@ int main (Int32 argc, CString *argv) {
     plugin->init();
     XuiGraphicsPlugin *gplug = (XuiGraphicsPlugin *)plugin->plugin_data;
 
+    /* one set of threads for plugin and application, main thread helps when it waits */
+    JobSystem jobs;
+    RETURN_VALUE_IF (
+        !job_system_init (&jobs, 0, True),
+        EXIT_FAILURE,
+        "Failed to start job system\n"
+    );
+    if (gplug->set_job_system) {
+        gplug->set_job_system (&jobs);
+    }
+
     XwWindow           *xwin = xw_window_create (Null, 540, 360, 0, 0);
     XuiGraphicsContext *gctx = gplug->context_create (xwin);
     RETURN_VALUE_IF (!gctx, EXIT_FAILURE, "Failed to create graphics context\n");
 
+    /* frames are drawn on a thread of plugin, if asked to */
+    if (argc > 2 && !strcmp (argv[2], "--render-thread")) {
+        RETURN_VALUE_IF (
+            !gplug->context_start_render_thread ||
+                !gplug->context_start_render_thread (gctx, xwin),
+            EXIT_FAILURE,
+            "Failed to start render thread\n"
+        );
+    }
+
     XuiMesh2D mesh = {
         .type     = MESH_TYPE_TRIANGLE1,
         .vertices = (Vec2f[]) {{.x = 0.f, .y = 1.f}, {.x = 1.f, .y = 0.f}, {.x = -1.f, .y = 0.f}},
@@ -191,12 +214,20 @@ int main (Int32 argc, CString *argv) {
         if (resized) {
             gplug->context_resize (gctx, xwin);
             gplug->clear (gctx, xwin);
+            gplug->reset_2d (gctx);
+            draw_ui (gplug, gctx, xwin);
             gplug->display (gctx, xwin);
         }
     }
 
     gplug->context_destroy (gctx);
     xw_window_destroy (xwin);
+
+    if (gplug->set_job_system) {
+        gplug->set_job_system (Null);
+    }
+    job_system_deinit (&jobs);
+
     plugin->deinit();
 
     xui_plugin_unload (plugin);
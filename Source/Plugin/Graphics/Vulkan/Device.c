@@ -30,6 +30,8 @@
  * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  * */
 
+#define ALLOCATOR_TAG ALLOCATOR_TAG_PLUGIN
+
 #include <Anvie/Common.h>
 
 /* local includes */
@@ -392,6 +394,33 @@ DeviceBuffer *device_buffer_memcpy (DeviceBuffer *buffer, void *data, Size size)
     return buffer;
 }
 
+/**
+ * @b Copy given data to device memory of buffer, starting at given offset.
+ *
+ * @param buffer
+ * @param offset Offset in buffer in bytes, where data is copied to.
+ * @param data Pointer to data to be copied.
+ * @param size Size of data to be copied in number of bytes.
+ *
+ * @return @c buffer on success.
+ * @return @c Null otherwise
+ * */
+DeviceBuffer *device_buffer_write (DeviceBuffer *buffer, Size offset, void *data, Size size) {
+    RETURN_VALUE_IF (!buffer || !data || !size, Null, ERR_INVALID_ARGUMENTS);
+    RETURN_VALUE_IF (
+        offset + size > buffer->size,
+        Null,
+        "Write of %zu bytes at offset %zu is out of bounds of device buffer\n",
+        size,
+        offset
+    );
+
+    /* memory first mapped in init and first unmapped in deinit */
+    memcpy ((Uint8 *)buffer->mapped_mem + offset, data, size);
+
+    return buffer;
+}
+
 /**
  * @b Resize given buffer's memory.
  *
@@ -79,6 +79,7 @@ DeviceBuffer *device_buffer_init (
 );
 DeviceBuffer *device_buffer_deinit (DeviceBuffer *buffer);
 DeviceBuffer *device_buffer_memcpy (DeviceBuffer *buffer, void *data, Size size);
+DeviceBuffer *device_buffer_write (DeviceBuffer *buffer, Size offset, void *data, Size size);
 DeviceBuffer *device_buffer_resize (DeviceBuffer *buffer, Size size);
 
 /**
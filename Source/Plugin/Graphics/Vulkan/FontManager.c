@@ -0,0 +1,203 @@
+/**
+ * @file FontManager.c
+ * @date Sun, 18th October 2026
+ * @author Siddharth Mishra (admin@brightprogrammer.in)
+ * @copyright Copyright 2024 Siddharth Mishra
+ * @copyright Copyright 2024 Anvie Labs
+ *
+ * Copyright 2024 Siddharth Mishra, Anvie Labs
+ * 
+ * Redistribution and use in source and binary forms, with or without modification, are permitted 
+ * provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+ *    and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions
+ *    and the following disclaimer in the documentation and/or other materials provided with the
+ *    distribution.
+ * 
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse
+ *    or promote products derived from this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND 
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * */
+
+#define ALLOCATOR_TAG ALLOCATOR_TAG_PLUGIN
+
+#include <Anvie/Common.h>
+
+/* libc */
+#include <memory.h>
+#include <stdio.h>
+
+/* crossgui-utils */
+#include <Anvie/CrossGui/Utils/Vector.h>
+
+/* local includes */
+#include "FontManager.h"
+
+NEW_VECTOR_TYPE (FontData, FontDataVector, font_data);
+
+/**************************************************************************************************/
+/********************************** PRIVATE METHOD DECLARATIONS ***********************************/
+/**************************************************************************************************/
+
+static Bool hash_font_file (CString path, Uint32 *hash);
+
+/**************************************************************************************************/
+/*********************************** PUBLIC METHOD DEFINITIONS ************************************/
+/**************************************************************************************************/
+
+FontManager *font_manager_init (FontManager *fm) {
+    RETURN_VALUE_IF (!fm, Null, ERR_INVALID_ARGUMENTS);
+
+    FT_Error err = FT_Init_FreeType (&fm->library);
+    RETURN_VALUE_IF (err, Null, "Failed to initialize FreeType. ERR = %d\n", err);
+
+    if (!font_data_vector_init (&fm->fonts, 8)) {
+        PRINT_ERR ("Failed to create vector to store fonts\n");
+        font_manager_deinit (fm);
+        return Null;
+    }
+
+    return fm;
+}
+
+FontManager *font_manager_deinit (FontManager *fm) {
+    RETURN_VALUE_IF (!fm, Null, ERR_INVALID_ARGUMENTS);
+
+    FontData *fonts = font_data_vector_data (&fm->fonts);
+    for (Size s = 0; s < fm->fonts.count; s++) {
+        FT_Done_Face (fonts[s].face);
+    }
+
+    font_data_vector_deinit (&fm->fonts);
+
+    if (fm->library) {
+        FT_Done_FreeType (fm->library);
+    }
+
+    memset (fm, 0, sizeof (FontManager));
+    return fm;
+}
+
+/**
+ * @b Load font file at given path and make it available under given font ID.
+ *
+ * @param fm
+ * @param font ID not already in use by another loaded font.
+ * @param path Path of font file.
+ *
+ * @return @c fm on success.
+ * @return @c Null otherwise.
+ * */
+FontManager *font_manager_load_font (FontManager *fm, Uint32 font, CString path) {
+    RETURN_VALUE_IF (!fm || !path, Null, ERR_INVALID_ARGUMENTS);
+    RETURN_VALUE_IF (
+        font_manager_get_font_by_id (fm, font),
+        Null,
+        "Font with ID %u is already loaded\n",
+        font
+    );
+
+    FontData new_data = {.font = font};
+
+    RETURN_VALUE_IF (
+        !hash_font_file (path, &new_data.file_hash),
+        Null,
+        "Failed to read font \"%s\"\n",
+        path
+    );
+
+    FT_Error err = FT_New_Face (fm->library, path, 0, &new_data.face);
+    RETURN_VALUE_IF (err, Null, "Failed to load font \"%s\". ERR = %d\n", path, err);
+
+    /* insert data */
+    if (!font_data_vector_push (&fm->fonts, &new_data)) {
+        PRINT_ERR ("Failed to resize vector to store more fonts\n");
+        FT_Done_Face (new_data.face);
+        return Null;
+    }
+
+    return fm;
+}
+
+FontData *font_manager_get_font_by_id (FontManager *fm, Uint32 font) {
+    RETURN_VALUE_IF (!fm, Null, ERR_INVALID_ARGUMENTS);
+
+    FontData *fonts = font_data_vector_data (&fm->fonts);
+    for (Size s = 0; s < fm->fonts.count; s++) {
+        if (fonts[s].font == font) {
+            return fonts + s;
+        }
+    }
+
+    return Null;
+}
+
+/**
+ * @b Scale face of given font to given pixel size, if not already scaled to it.
+ *
+ * Glyph metrics and rendered bitmaps of the face depend on this size.
+ *
+ * @param font_data
+ * @param pixel_size Height of em square in pixels.
+ *
+ * @return @c font_data on success.
+ * @return @c Null otherwise.
+ * */
+FontData *font_data_set_pixel_size (FontData *font_data, Uint32 pixel_size) {
+    RETURN_VALUE_IF (!font_data || !pixel_size, Null, ERR_INVALID_ARGUMENTS);
+
+    if (font_data->pixel_size == pixel_size) {
+        return font_data;
+    }
+
+    FT_Error err = FT_Set_Pixel_Sizes (font_data->face, 0, pixel_size);
+    RETURN_VALUE_IF (
+        err,
+        Null,
+        "Failed to set font pixel size to %u. ERR = %d\n",
+        pixel_size,
+        err
+    );
+
+    font_data->pixel_size = pixel_size;
+    return font_data;
+}
+
+/**************************************************************************************************/
+/*********************************** PRIVATE METHOD DEFINITIONS ***********************************/
+/**************************************************************************************************/
+
+/**
+ * @b FNV-1a hash of contents of given file.
+ * */
+static Bool hash_font_file (CString path, Uint32 *hash) {
+    FILE *file = fopen (path, "rb");
+    RETURN_VALUE_IF (!file, False, ERR_FILE_OPEN_FAILED);
+
+    Uint32 h = 2166136261u;
+    Uint8  chunk[4096];
+    Size   read_size;
+    while ((read_size = fread (chunk, 1, sizeof (chunk), file))) {
+        for (Size s = 0; s < read_size; s++) {
+            h = (h ^ chunk[s]) * 16777619u;
+        }
+    }
+
+    Bool is_read = !ferror (file);
+    fclose (file);
+    RETURN_VALUE_IF (!is_read, False, ERR_FILE_READ_FAILED);
+
+    *hash = h;
+    return True;
+}
@@ -0,0 +1,75 @@
+/**
+ * @file FontManager.h
+ * @date Sun, 18th October 2026
+ * @author Siddharth Mishra (admin@brightprogrammer.in)
+ * @copyright Copyright 2024 Siddharth Mishra
+ * @copyright Copyright 2024 Anvie Labs
+ *
+ * Copyright 2024 Siddharth Mishra, Anvie Labs
+ * 
+ * Redistribution and use in source and binary forms, with or without modification, are permitted 
+ * provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+ *    and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions
+ *    and the following disclaimer in the documentation and/or other materials provided with the
+ *    distribution.
+ * 
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse
+ *    or promote products derived from this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND 
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * */
+
+#ifndef ANVIE_SOURCE_CROSSGUI_PLUGIN_GRAPHICS_VULKAN_FONT_MANAGER_H
+#define ANVIE_SOURCE_CROSSGUI_PLUGIN_GRAPHICS_VULKAN_FONT_MANAGER_H
+
+#include <Anvie/Types.h>
+
+/* freetype */
+#include <ft2build.h>
+#include FT_FREETYPE_H
+
+/* crossgui-utils */
+#include <Anvie/CrossGui/Utils/Vector.h>
+
+typedef struct FontData {
+    Uint32  font;       /**< @b A unique ID assigned to each font by the user code. */
+    FT_Face face;       /**< @b Loaded font face. */
+    Uint32  pixel_size; /**< @b Pixel size face is currently scaled to, zero if never set. */
+
+    /**
+     * @b Hash of contents of font file. Identifies font in glyph caches saved
+     * to disk, where font IDs assigned by user code mean nothing.
+     * */
+    Uint32 file_hash;
+} FontData;
+
+NEW_HEAP_VECTOR_STRUCT (FontData, FontDataVector);
+
+typedef struct FontManager {
+    FT_Library library;
+    /**
+     * @b Faces for each font ID.
+     * Like mesh data, fonts added to this vector stay as long as the plugin
+     * is in use and is kept loaded.
+     * */
+    FontDataVector fonts;
+} FontManager;
+
+FontManager *font_manager_init (FontManager *fm);
+FontManager *font_manager_deinit (FontManager *fm);
+FontManager *font_manager_load_font (FontManager *fm, Uint32 font, CString path);
+FontData    *font_manager_get_font_by_id (FontManager *fm, Uint32 font);
+FontData    *font_data_set_pixel_size (FontData *font_data, Uint32 pixel_size);
+
+#endif // ANVIE_SOURCE_CROSSGUI_PLUGIN_GRAPHICS_VULKAN_FONT_MANAGER_H
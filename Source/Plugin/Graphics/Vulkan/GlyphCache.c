@@ -0,0 +1,674 @@
+/**
+ * @file GlyphCache.c
+ * @date Sun, 18th October 2026
+ * @author Siddharth Mishra (admin@brightprogrammer.in)
+ * @copyright Copyright 2024 Siddharth Mishra
+ * @copyright Copyright 2024 Anvie Labs
+ *
+ * Copyright 2024 Siddharth Mishra, Anvie Labs
+ * 
+ * Redistribution and use in source and binary forms, with or without modification, are permitted 
+ * provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+ *    and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions
+ *    and the following disclaimer in the documentation and/or other materials provided with the
+ *    distribution.
+ * 
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse
+ *    or promote products derived from this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND 
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * */
+
+#define ALLOCATOR_TAG ALLOCATOR_TAG_PLUGIN
+
+#include <Anvie/Common.h>
+
+/* libc */
+#include <memory.h>
+
+/* crossgui-utils */
+#include <Anvie/CrossGui/Utils/GlyphAtlas.h>
+#include <Anvie/CrossGui/Utils/JobSystem.h>
+#include <Anvie/CrossGui/Utils/Profiler.h>
+#include <Anvie/CrossGui/Utils/Sdf.h>
+
+/* local includes */
+#include "Device.h"
+#include "GlyphCache.h"
+#include "Vulkan.h"
+
+NEW_VECTOR_TYPE (GlyphAtlasRect, GlyphAtlasRectVector, glyph_atlas_rect);
+
+/**
+ * @b A distance field glyph being generated, rasterized on calling thread and
+ * converted to a distance field on a worker thread.
+ * */
+typedef struct SdfGlyphJob {
+    GlyphKey key;
+    Uint8   *coverage;  /**< @b Rasterized glyph, tightly packed rows, top row first. */
+    Uint32   width;     /**< @b Width of @c coverage. */
+    Uint32   height;    /**< @b Height of @c coverage. */
+    Uint8   *sdf;       /**< @b Distance field, tightly packed rows. */
+    Uint32   sdf_width; /**< @b Width of @c sdf. */
+    Uint32   sdf_height;
+    Float32  bearing_x; /**< @b Bearings and advance at field size. */
+    Float32  bearing_y;
+    Float32  advance;
+    Bool     is_generated;
+} SdfGlyphJob;
+
+/**************************************************************************************************/
+/********************************** PRIVATE METHOD DECLARATIONS ***********************************/
+/**************************************************************************************************/
+
+static Bool glyph_cache_rasterize_sdf_glyph (FontData *font_data, SdfGlyphJob *job);
+static void generate_sdf_job (void *data);
+
+/**************************************************************************************************/
+/*********************************** PUBLIC METHOD DEFINITIONS ************************************/
+/**************************************************************************************************/
+
+/**
+ * @b Initialize given glyph cache, with an empty atlas.
+ *
+ * @param cache
+ *
+ * @return @c cache on success.
+ * @return @c Null otherwise.
+ * */
+GlyphCache *glyph_cache_init (GlyphCache *cache) {
+    RETURN_VALUE_IF (!cache, Null, ERR_INVALID_ARGUMENTS);
+
+    GOTO_HANDLER_IF (
+        !glyph_atlas_init (
+            &cache->atlas,
+            GLYPH_CACHE_ATLAS_WIDTH,
+            GLYPH_CACHE_ATLAS_HEIGHT,
+            GLYPH_CACHE_ATLAS_PAGES
+        ),
+        INIT_FAILED,
+        "Failed to create glyph atlas\n"
+    );
+
+    GOTO_HANDLER_IF (
+        !device_image_init (
+            &cache->image,
+            VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT,
+            (VkExtent3D
+            ) {.width = GLYPH_CACHE_ATLAS_WIDTH, .height = GLYPH_CACHE_ATLAS_HEIGHT, .depth = 1},
+            VK_FORMAT_R8_UNORM,
+            VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
+            VK_IMAGE_ASPECT_COLOR_BIT,
+            vk.device.graphics_queue.family_index
+        ),
+        INIT_FAILED,
+        "Failed to create glyph atlas image\n"
+    );
+
+    /* staging buffers can hold whole atlas, which is uploaded on first use */
+    for (Size s = 0; s < FRAME_LIMIT; s++) {
+        GOTO_HANDLER_IF (
+            !device_buffer_init (
+                cache->staging + s,
+                VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+                GLYPH_CACHE_ATLAS_WIDTH * GLYPH_CACHE_ATLAS_HEIGHT,
+                VK_MEMORY_PROPERTY_HOST_COHERENT_BIT | VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT,
+                vk.device.graphics_queue.family_index
+            ),
+            INIT_FAILED,
+            "Failed to create staging buffer for glyph atlas\n"
+        );
+    }
+
+    VkSamplerCreateInfo sampler_create_info = {
+        .sType                   = VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO,
+        .pNext                   = Null,
+        .flags                   = 0,
+        .magFilter               = VK_FILTER_LINEAR,
+        .minFilter               = VK_FILTER_LINEAR,
+        .mipmapMode              = VK_SAMPLER_MIPMAP_MODE_NEAREST,
+        .addressModeU            = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE,
+        .addressModeV            = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE,
+        .addressModeW            = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE,
+        .mipLodBias              = 0.f,
+        .anisotropyEnable        = VK_FALSE,
+        .maxAnisotropy           = 1.f,
+        .compareEnable           = VK_FALSE,
+        .compareOp               = VK_COMPARE_OP_ALWAYS,
+        .minLod                  = 0.f,
+        .maxLod                  = 0.f,
+        .borderColor             = VK_BORDER_COLOR_FLOAT_TRANSPARENT_BLACK,
+        .unnormalizedCoordinates = VK_FALSE
+    };
+
+    VkResult res = vkCreateSampler (vk.device.logical, &sampler_create_info, Null, &cache->sampler);
+    GOTO_HANDLER_IF (
+        res != VK_SUCCESS,
+        INIT_FAILED,
+        "Failed to create glyph atlas sampler. RET = %d\n",
+        res
+    );
+
+    return cache;
+
+INIT_FAILED:
+    glyph_cache_deinit (cache);
+    return Null;
+}
+
+GlyphCache *glyph_cache_deinit (GlyphCache *cache) {
+    RETURN_VALUE_IF (!cache, Null, ERR_INVALID_ARGUMENTS);
+
+    if (cache->sampler) {
+        vkDeviceWaitIdle (vk.device.logical);
+        vkDestroySampler (vk.device.logical, cache->sampler, Null);
+    }
+
+    for (Size s = 0; s < FRAME_LIMIT; s++) {
+        if (cache->staging[s].buffer) {
+            device_buffer_deinit (cache->staging + s);
+        }
+    }
+
+    if (cache->image.image) {
+        device_image_deinit (&cache->image);
+    }
+
+    glyph_atlas_deinit (&cache->atlas);
+
+    memset (cache, 0, sizeof (GlyphCache));
+    return cache;
+}
+
+/**
+ * @b Get atlas entry of a glyph at current pixel size of given font,
+ * rasterizing and caching it if it's not already in atlas.
+ *
+ * Returned entry stays valid only until next glyph is added to the cache.
+ *
+ * @param cache
+ * @param font_data Font with pixel size already set.
+ * @param glyph_index Index of glyph in font face.
+ * @param is_rasterized Set to @c True if glyph was rasterized by this call.
+ *
+ * @return @c GlyphAtlasEntry on success.
+ * @return @c Null otherwise.
+ * */
+GlyphAtlasEntry *glyph_cache_get_glyph (
+    GlyphCache *cache,
+    FontData   *font_data,
+    Uint32      glyph_index,
+    Bool       *is_rasterized
+) {
+    RETURN_VALUE_IF (
+        !cache || !font_data || !font_data->pixel_size || !is_rasterized,
+        Null,
+        ERR_INVALID_ARGUMENTS
+    );
+
+    *is_rasterized = False;
+
+    GlyphKey key = {.font = font_data->font, .glyph = glyph_index, .size = font_data->pixel_size};
+
+    GlyphAtlasEntry *entry = glyph_atlas_find (&cache->atlas, &key);
+    if (entry) {
+        return entry;
+    }
+
+    PROFILE_ZONE ("glyph_cache_rasterize_glyph");
+
+    FT_Face  face = font_data->face;
+    FT_Error err  = FT_Load_Glyph (face, glyph_index, FT_LOAD_RENDER);
+    RETURN_VALUE_IF (err, Null, "Failed to rasterize glyph %u. ERR = %d\n", glyph_index, err);
+
+    FT_Bitmap *bitmap = &face->glyph->bitmap;
+    RETURN_VALUE_IF (
+        bitmap->rows && bitmap->width && bitmap->pixel_mode != FT_PIXEL_MODE_GRAY,
+        Null,
+        "Glyph %u was not rendered to an 8 bit coverage bitmap\n",
+        glyph_index
+    );
+
+    /* rows go up when pitch is negative, and buffer then points to last row */
+    Uint8 *top_row = bitmap->buffer;
+    if (bitmap->pitch < 0 && bitmap->rows) {
+        top_row -= (Int64)bitmap->pitch * (bitmap->rows - 1);
+    }
+
+    entry = glyph_atlas_insert (
+        &cache->atlas,
+        &key,
+        bitmap->width,
+        bitmap->rows,
+        top_row,
+        bitmap->pitch
+    );
+    RETURN_VALUE_IF (!entry, Null, "Failed to insert glyph %u in glyph atlas\n", glyph_index);
+
+    entry->bearing_x = face->glyph->bitmap_left;
+    entry->bearing_y = face->glyph->bitmap_top;
+    entry->advance   = face->glyph->advance.x / 64.f;
+
+    *is_rasterized = True;
+    return entry;
+}
+
+/**
+ * @b Make sure distance fields of given glyphs are cached, generating missing ones.
+ *
+ * Missing glyphs are rasterized by FreeType on calling thread, at
+ * @c GLYPH_CACHE_SDF_UPSCALE times field size, since a face can't be used by
+ * multiple threads. Distance fields are then generated on worker threads, all
+ * at once, and this call returns once all of them are in the cache.
+ *
+ * Glyphs are cached by font file contents rather than font ID, so that caches
+ * saved to disk stay valid when fonts are loaded with different IDs. Font is
+ * left scaled to the upscaled size when anything was missing.
+ *
+ * @param cache
+ * @param font_data Font glyphs belong to.
+ * @param glyph_indices Indices of glyphs in font face, can have duplicates.
+ * @param glyph_count Number of glyph indices.
+ * @param job_system Job system to generate distance fields on, @c Null to
+ *        generate them on calling thread.
+ * @param glyphs_generated Incremented by number of glyphs missing in cache.
+ *
+ * @return @c cache on success.
+ * @return @c Null otherwise.
+ * */
+GlyphCache *glyph_cache_add_sdf_glyphs (
+    GlyphCache   *cache,
+    FontData     *font_data,
+    const Uint32 *glyph_indices,
+    Size          glyph_count,
+    JobSystem    *job_system,
+    Uint64       *glyphs_generated
+) {
+    RETURN_VALUE_IF (
+        !cache || !font_data || (!glyph_indices && glyph_count) || !glyphs_generated,
+        Null,
+        ERR_INVALID_ARGUMENTS
+    );
+
+    /* find missing glyphs first, so nothing is allocated for a fully cached run */
+    Size missing = 0;
+    for (Size s = 0; s < glyph_count; s++) {
+        missing += !glyph_cache_find_sdf_glyph (cache, font_data, glyph_indices[s]);
+    }
+    if (!missing) {
+        return cache;
+    }
+
+    PROFILE_ZONE ("glyph_cache_add_sdf_glyphs");
+
+    RETURN_VALUE_IF (
+        !font_data_set_pixel_size (font_data, GLYPH_CACHE_SDF_SIZE * GLYPH_CACHE_SDF_UPSCALE),
+        Null,
+        "Failed to scale font to distance field size\n"
+    );
+
+    SdfGlyphJob *jobs = ALLOCATE (SdfGlyphJob, missing);
+    RETURN_VALUE_IF (!jobs, Null, ERR_OUT_OF_MEMORY);
+
+    JobCounter counter = {0};
+
+    GlyphCache *result    = cache;
+    Size        job_count = 0;
+
+    for (Size s = 0; s < glyph_count && result; s++) {
+        GlyphKey key = {
+            .font  = font_data->file_hash,
+            .glyph = glyph_indices[s],
+            .size  = GLYPH_CACHE_SDF_SIZE
+        };
+
+        if (glyph_atlas_find (&cache->atlas, &key)) {
+            continue;
+        }
+
+        /* same glyph can appear many times in a run */
+        Bool is_duplicate = False;
+        for (Size j = 0; j < job_count && !is_duplicate; j++) {
+            is_duplicate = jobs[j].key.glyph == key.glyph;
+        }
+        if (is_duplicate) {
+            continue;
+        }
+
+        SdfGlyphJob *job = jobs + job_count++;
+        job->key         = key;
+
+        if (!glyph_cache_rasterize_sdf_glyph (font_data, job)) {
+            PRINT_ERR ("Failed to rasterize glyph %u\n", key.glyph);
+            result = Null;
+        } else if (job->width && job->height) {
+            if (!job_system || !job_system_submit (job_system, generate_sdf_job, job, &counter)) {
+                generate_sdf_job (job);
+            }
+        }
+    }
+
+    /* jobs must complete before their buffers are released, even on failure */
+    if (job_system) {
+        job_system_wait (job_system, &counter);
+    }
+
+    for (Size j = 0; j < job_count && result; j++) {
+        SdfGlyphJob *job      = jobs + j;
+        Bool         is_blank = !job->width || !job->height;
+
+        if (!is_blank && !job->is_generated) {
+            PRINT_ERR ("Failed to generate distance field of glyph %u\n", job->key.glyph);
+            result = Null;
+            break;
+        }
+
+        GlyphAtlasEntry *entry = glyph_atlas_insert (
+            &cache->atlas,
+            &job->key,
+            is_blank ? 0 : job->sdf_width,
+            is_blank ? 0 : job->sdf_height,
+            job->sdf,
+            job->sdf_width
+        );
+        if (!entry) {
+            PRINT_ERR ("Failed to insert glyph %u in glyph atlas\n", job->key.glyph);
+            result = Null;
+            break;
+        }
+
+        entry->bearing_x = job->bearing_x;
+        entry->bearing_y = job->bearing_y;
+        entry->advance   = job->advance;
+
+        *glyphs_generated += 1;
+    }
+
+    for (Size j = 0; j < job_count; j++) {
+        if (jobs[j].coverage) {
+            FREE (jobs[j].coverage);
+        }
+        if (jobs[j].sdf) {
+            FREE (jobs[j].sdf);
+        }
+    }
+    FREE (jobs);
+
+    return result;
+}
+
+/**
+ * @b Find distance field of given glyph in cache, and mark it used in current frame.
+ *
+ * @param cache
+ * @param font_data Font glyph belongs to.
+ * @param glyph_index Index of glyph in font face.
+ *
+ * @return @c GlyphAtlasEntry if glyph is cached.
+ * @return @c Null otherwise.
+ * */
+GlyphAtlasEntry *
+    glyph_cache_find_sdf_glyph (GlyphCache *cache, FontData *font_data, Uint32 glyph_index) {
+    RETURN_VALUE_IF (!cache || !font_data, Null, ERR_INVALID_ARGUMENTS);
+
+    GlyphKey key = {
+        .font  = font_data->file_hash,
+        .glyph = glyph_index,
+        .size  = GLYPH_CACHE_SDF_SIZE
+    };
+    return glyph_atlas_find (&cache->atlas, &key);
+}
+
+/**
+ * @b Record copy of dirty atlas rectangles to atlas image in given command buffer.
+ *
+ * Must be recorded outside of a render pass, before any draw that samples atlas
+ * image. Leaves image in @c VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL layout.
+ * Nothing is recorded if atlas has no dirty rectangles.
+ *
+ * @param cache
+ * @param cmd Command buffer being recorded.
+ * @param frame_slot Index of frame data being recorded, selects staging buffer,
+ *        which must not be in use by device anymore.
+ * @param bytes_uploaded Incremented by number of bytes copied to staging buffer.
+ *
+ * @return @c cache on success.
+ * @return @c Null otherwise.
+ * */
+GlyphCache *glyph_cache_record_upload (
+    GlyphCache     *cache,
+    VkCommandBuffer cmd,
+    Uint32          frame_slot,
+    Size           *bytes_uploaded
+) {
+    RETURN_VALUE_IF (
+        !cache || !cmd || frame_slot >= FRAME_LIMIT || !bytes_uploaded,
+        Null,
+        ERR_INVALID_ARGUMENTS
+    );
+
+    GlyphAtlas *atlas = &cache->atlas;
+    if (!atlas->dirty_rects.count) {
+        return cache;
+    }
+
+    PROFILE_ZONE ("glyph_cache_record_upload");
+
+    DeviceBuffer   *staging    = cache->staging + frame_slot;
+    GlyphAtlasRect *rects      = glyph_atlas_rect_vector_data (&atlas->dirty_rects);
+    Size            rect_count = atlas->dirty_rects.count;
+
+    /* merged dirty rects can overlap, upload whole atlas if they don't fit in staging buffer */
+    Size total_size = 0;
+    for (Size s = 0; s < rect_count; s++) {
+        total_size += ((Size)rects[s].width * rects[s].height + 3) & ~(Size)3;
+    }
+
+    GlyphAtlasRect whole_atlas = {.width = atlas->width, .height = atlas->height};
+    if (total_size > staging->size) {
+        rects      = &whole_atlas;
+        rect_count = 1;
+    }
+
+    VkBufferImageCopy *regions = ALLOCATE (VkBufferImageCopy, rect_count);
+    RETURN_VALUE_IF (!regions, Null, ERR_OUT_OF_MEMORY);
+
+    /* pack rows of each rect tightly in staging buffer, with 4 byte aligned offsets */
+    Size offset = 0;
+    for (Size s = 0; s < rect_count; s++) {
+        GlyphAtlasRect *rect = rects + s;
+
+        for (Uint32 row = 0; row < rect->height; row++) {
+            memcpy (
+                (Uint8 *)staging->mapped_mem + offset + (Size)row * rect->width,
+                atlas->pixels + (Size)(rect->y + row) * atlas->width + rect->x,
+                rect->width
+            );
+        }
+
+        regions[s] = (VkBufferImageCopy
+        ) {.bufferOffset      = offset,
+           .bufferRowLength   = 0,
+           .bufferImageHeight = 0,
+           .imageSubresource  = {.aspectMask     = VK_IMAGE_ASPECT_COLOR_BIT,
+                                 .mipLevel       = 0,
+                                 .baseArrayLayer = 0,
+                                 .layerCount     = 1},
+           .imageOffset       = {.x = rect->x, .y = rect->y, .z = 0},
+           .imageExtent       = {.width = rect->width, .height = rect->height, .depth = 1}};
+
+        offset += ((Size)rect->width * rect->height + 3) & ~(Size)3;
+    }
+
+    VkImageSubresourceRange subresource_range = {
+        .aspectMask     = VK_IMAGE_ASPECT_COLOR_BIT,
+        .baseMipLevel   = 0,
+        .levelCount     = 1,
+        .baseArrayLayer = 0,
+        .layerCount     = 1
+    };
+
+    /* wait for previous frames to stop sampling atlas before overwriting it */
+    VkImageMemoryBarrier to_transfer = {
+        .sType               = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
+        .pNext               = Null,
+        .srcAccessMask       = cache->is_image_initialized ? VK_ACCESS_SHADER_READ_BIT : 0,
+        .dstAccessMask       = VK_ACCESS_TRANSFER_WRITE_BIT,
+        .oldLayout           = cache->is_image_initialized ?
+                                   VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL :
+                                   VK_IMAGE_LAYOUT_UNDEFINED,
+        .newLayout           = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+        .srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+        .dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+        .image               = cache->image.image,
+        .subresourceRange    = subresource_range
+    };
+
+    vkCmdPipelineBarrier (
+        cmd,
+        cache->is_image_initialized ? VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT :
+                                      VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
+        VK_PIPELINE_STAGE_TRANSFER_BIT,
+        0,
+        0,
+        Null,
+        0,
+        Null,
+        1,
+        &to_transfer
+    );
+
+    vkCmdCopyBufferToImage (
+        cmd,
+        staging->buffer,
+        cache->image.image,
+        VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+        rect_count,
+        regions
+    );
+
+    VkImageMemoryBarrier to_shader_read = {
+        .sType               = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
+        .pNext               = Null,
+        .srcAccessMask       = VK_ACCESS_TRANSFER_WRITE_BIT,
+        .dstAccessMask       = VK_ACCESS_SHADER_READ_BIT,
+        .oldLayout           = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+        .newLayout           = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+        .srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+        .dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+        .image               = cache->image.image,
+        .subresourceRange    = subresource_range
+    };
+
+    vkCmdPipelineBarrier (
+        cmd,
+        VK_PIPELINE_STAGE_TRANSFER_BIT,
+        VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,
+        0,
+        0,
+        Null,
+        0,
+        Null,
+        1,
+        &to_shader_read
+    );
+
+    FREE (regions);
+
+    cache->is_image_initialized  = True;
+    *bytes_uploaded             += offset;
+
+    glyph_atlas_clear_dirty_rects (atlas);
+
+    return cache;
+}
+
+/**************************************************************************************************/
+/*********************************** PRIVATE METHOD DEFINITIONS ***********************************/
+/**************************************************************************************************/
+
+/**
+ * @b Rasterize glyph of given job with font already scaled to upscaled field size,
+ * and allocate memory for it's distance field.
+ * */
+static Bool glyph_cache_rasterize_sdf_glyph (FontData *font_data, SdfGlyphJob *job) {
+    FT_Face  face = font_data->face;
+    FT_Error err  = FT_Load_Glyph (face, job->key.glyph, FT_LOAD_RENDER);
+    RETURN_VALUE_IF (err, False, "Failed to rasterize glyph. ERR = %d\n", err);
+
+    FT_Bitmap *bitmap = &face->glyph->bitmap;
+    RETURN_VALUE_IF (
+        bitmap->rows && bitmap->width && bitmap->pixel_mode != FT_PIXEL_MODE_GRAY,
+        False,
+        "Glyph was not rendered to an 8 bit coverage bitmap\n"
+    );
+
+    /* field origin is padding pixels above and left of bitmap origin */
+    job->bearing_x = (Float32)face->glyph->bitmap_left / GLYPH_CACHE_SDF_UPSCALE -
+                     GLYPH_CACHE_SDF_PADDING;
+    job->bearing_y = (Float32)face->glyph->bitmap_top / GLYPH_CACHE_SDF_UPSCALE +
+                     GLYPH_CACHE_SDF_PADDING;
+    job->advance   = face->glyph->advance.x / (64.f * GLYPH_CACHE_SDF_UPSCALE);
+
+    if (!bitmap->width || !bitmap->rows) {
+        return True;
+    }
+
+    /* glyph slot is reused by next glyph, so bitmap is copied for the worker */
+    job->width    = bitmap->width;
+    job->height   = bitmap->rows;
+    job->coverage = ALLOCATE (Uint8, (Size)job->width * job->height);
+    RETURN_VALUE_IF (!job->coverage, False, ERR_OUT_OF_MEMORY);
+
+    Uint8 *top_row = bitmap->buffer;
+    if (bitmap->pitch < 0) {
+        top_row -= (Int64)bitmap->pitch * (bitmap->rows - 1);
+    }
+    for (Uint32 row = 0; row < job->height; row++) {
+        memcpy (
+            job->coverage + (Size)row * job->width,
+            top_row + (Int64)row * bitmap->pitch,
+            job->width
+        );
+    }
+
+    job->sdf_width  = sdf_size (job->width, GLYPH_CACHE_SDF_UPSCALE, GLYPH_CACHE_SDF_PADDING);
+    job->sdf_height = sdf_size (job->height, GLYPH_CACHE_SDF_UPSCALE, GLYPH_CACHE_SDF_PADDING);
+    job->sdf        = ALLOCATE (Uint8, (Size)job->sdf_width * job->sdf_height);
+    RETURN_VALUE_IF (!job->sdf, False, ERR_OUT_OF_MEMORY);
+
+    return True;
+}
+
+/**
+ * @b Worker job generating distance field of a single glyph.
+ * */
+static void generate_sdf_job (void *data) {
+    SdfGlyphJob *job = data;
+
+    PROFILE_ZONE ("generate_sdf_job");
+
+    job->is_generated = !!sdf_generate (
+        job->sdf,
+        job->sdf_width,
+        job->sdf_height,
+        job->coverage,
+        job->width,
+        job->height,
+        job->width,
+        GLYPH_CACHE_SDF_UPSCALE,
+        GLYPH_CACHE_SDF_PADDING,
+        GLYPH_CACHE_SDF_SPREAD
+    );
+}
@@ -0,0 +1,126 @@
+/**
+ * @file GlyphCache.h
+ * @date Sun, 18th October 2026
+ * @author Siddharth Mishra (admin@brightprogrammer.in)
+ * @copyright Copyright 2024 Siddharth Mishra
+ * @copyright Copyright 2024 Anvie Labs
+ *
+ * Copyright 2024 Siddharth Mishra, Anvie Labs
+ * 
+ * Redistribution and use in source and binary forms, with or without modification, are permitted 
+ * provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+ *    and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions
+ *    and the following disclaimer in the documentation and/or other materials provided with the
+ *    distribution.
+ * 
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse
+ *    or promote products derived from this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND 
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * */
+
+#ifndef ANVIE_SOURCE_CROSSGUI_PLUGIN_GRAPHICS_VULKAN_GLYPH_CACHE_H
+#define ANVIE_SOURCE_CROSSGUI_PLUGIN_GRAPHICS_VULKAN_GLYPH_CACHE_H
+
+#include <Anvie/Types.h>
+
+/* crossgui-utils */
+#include <Anvie/CrossGui/Utils/GlyphAtlas.h>
+#include <Anvie/CrossGui/Utils/JobSystem.h>
+
+/* vulkan includes */
+#include <vulkan/vulkan.h>
+
+/* local includes */
+#include "Device.h"
+#include "FontManager.h"
+#include "RenderPass.h"
+
+#define GLYPH_CACHE_ATLAS_WIDTH  1024
+#define GLYPH_CACHE_ATLAS_HEIGHT 1024
+#define GLYPH_CACHE_ATLAS_PAGES  8
+
+/**
+ * @b Size in pixels distance field glyphs are generated at, whatever size they're drawn at.
+ * */
+#define GLYPH_CACHE_SDF_SIZE 32
+
+/**
+ * @b Distance field glyphs are rasterized this many times larger, and distances
+ * are averaged down to field size, so edges are placed with sub-pixel accuracy.
+ * */
+#define GLYPH_CACHE_SDF_UPSCALE 4
+
+/**
+ * @b Field pixels left around each distance field glyph, so it's edge can be
+ * reconstructed when drawn at a larger size.
+ * */
+#define GLYPH_CACHE_SDF_PADDING 4
+
+/**
+ * @b Distance in field pixels, on either side of edge, covered by field values.
+ * */
+#define GLYPH_CACHE_SDF_SPREAD 4.f
+
+/**
+ * @b Glyphs rasterized by FreeType, cached in a @c GlyphAtlas and mirrored to
+ * a sampled device image.
+ *
+ * Glyphs are rasterized on CPU when they're first drawn, and only the atlas
+ * rectangles changed since last upload are copied to the device image, through
+ * a staging buffer of the frame being recorded.
+ *
+ * A cache holds either coverage bitmaps at the size they're drawn at, or
+ * signed distance fields at @c GLYPH_CACHE_SDF_SIZE, depending on whether
+ * glyphs are added with @c glyph_cache_get_glyph or
+ * @c glyph_cache_add_sdf_glyphs.
+ * */
+typedef struct GlyphCache {
+    GlyphAtlas   atlas;   /**< @b CPU copy of atlas, with glyph placement and metrics. */
+    DeviceImage  image;   /**< @b Atlas image sampled by text pipeline. */
+    VkSampler    sampler; /**< @b Bilinear sampler for @c image. */
+    DeviceBuffer staging[FRAME_LIMIT]; /**< @b Dirty atlas pixels, for each frame in flight. */
+
+    /**
+     * @b False until first upload moves @c image out of undefined layout.
+     * */
+    Bool is_image_initialized;
+} GlyphCache;
+
+GlyphCache      *glyph_cache_init (GlyphCache *cache);
+GlyphCache      *glyph_cache_deinit (GlyphCache *cache);
+GlyphAtlasEntry *glyph_cache_get_glyph (
+    GlyphCache *cache,
+    FontData   *font_data,
+    Uint32      glyph_index,
+    Bool       *is_rasterized
+);
+GlyphCache *glyph_cache_add_sdf_glyphs (
+    GlyphCache   *cache,
+    FontData     *font_data,
+    const Uint32 *glyph_indices,
+    Size          glyph_count,
+    JobSystem    *job_system,
+    Uint64       *glyphs_generated
+);
+GlyphAtlasEntry *
+    glyph_cache_find_sdf_glyph (GlyphCache *cache, FontData *font_data, Uint32 glyph_index);
+GlyphCache *glyph_cache_record_upload (
+    GlyphCache     *cache,
+    VkCommandBuffer cmd,
+    Uint32          frame_slot,
+    Size           *bytes_uploaded
+);
+
+#endif // ANVIE_SOURCE_CROSSGUI_PLUGIN_GRAPHICS_VULKAN_GLYPH_CACHE_H
@@ -30,6 +30,8 @@
  * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  * */
 
+#define ALLOCATOR_TAG ALLOCATOR_TAG_PLUGIN
+
 #include <Anvie/Common.h>
 
 /* crosswindow */
@@ -41,7 +43,9 @@
 /* local includes */
 #include "GraphicsContext.h"
 #include "RenderPass.h"
+#include "RenderThread.h"
 #include "Renderer.h"
+#include "Vulkan.h"
 
 /**
  * @b Create graphics context for Vulkan plugin.
@@ -86,6 +90,10 @@ GCTX_FAILED:
 void graphics_context_destroy (XuiGraphicsContext *gctx) {
     RETURN_IF (!gctx, ERR_INVALID_ARGUMENTS);
 
+    if (gctx->render_thread.is_running) {
+        render_thread_stop (&gctx->render_thread);
+    }
+
     batch_renderer_deinit (&gctx->batch_renderer);
     swapchain_deinit (&gctx->swapchain);
 
@@ -106,11 +114,50 @@ void graphics_context_destroy (XuiGraphicsContext *gctx) {
 Bool graphics_context_resize (XuiGraphicsContext *gctx, XwWindow *xwin) {
     RETURN_VALUE_IF (!gctx || !xwin, False, ERR_INVALID_ARGUMENTS);
 
-    RETURN_VALUE_IF (
-        !swapchain_reinit (&gctx->swapchain, xwin),
-        False,
-        "Failed to resize graphics context.\n"
-    );
+    /* swapchain is in use by render thread, so it's resized there */
+    if (gctx->render_thread.is_running) {
+        FrameCommand command = {.type = FRAME_COMMAND_TYPE_RESIZE, .win = xwin};
+        return !!render_thread_record (&gctx->render_thread, &command, Null, 0);
+    }
+
+    pthread_mutex_lock (&vk.resource_mutex);
+    Bool is_resized = !!swapchain_reinit (&gctx->swapchain, xwin);
+    pthread_mutex_unlock (&vk.resource_mutex);
+
+    RETURN_VALUE_IF (!is_resized, False, "Failed to resize graphics context.\n");
 
     return True;
 }
+
+/**
+ * @b Start drawing frames of graphics context on a thread owned by plugin.
+ *
+ * Until render thread is stopped, calls made on graphics context are
+ * recorded, and display hands them over to render thread without waiting
+ * for it. Status returned by display is status of frames drawn by render
+ * thread since previous display.
+ *
+ * @param gctx
+ * @param xwin Window associated with this graphics context.
+ *
+ * @return True on success.
+ * @return False otherwise.
+ * */
+Bool graphics_context_start_render_thread (XuiGraphicsContext *gctx, XwWindow *xwin) {
+    RETURN_VALUE_IF (!gctx || !xwin, False, ERR_INVALID_ARGUMENTS);
+    return !!render_thread_start (&gctx->render_thread, gctx, xwin);
+}
+
+/**
+ * @b Stop render thread of graphics context, after it draws last frame
+ * handed over to it. Frames are drawn by calling thread after this.
+ *
+ * @param gctx
+ *
+ * @return True on success.
+ * @return False otherwise.
+ * */
+Bool graphics_context_stop_render_thread (XuiGraphicsContext *gctx) {
+    RETURN_VALUE_IF (!gctx, False, ERR_INVALID_ARGUMENTS);
+    return !!render_thread_stop (&gctx->render_thread);
+}
@@ -34,6 +34,7 @@
 #define ANVIE_CROSSGUI_SOURCE_PLUGIN_GRAPHICS_VULKAN_GRAPHICS_CONTEXT_H
 
 /* local includes */
+#include "RenderThread.h"
 #include "Renderer.h"
 #include "Swapchain.h"
 
@@ -41,10 +42,13 @@ typedef struct XuiGraphicsContext {
     VkSurfaceKHR  surface;
     Swapchain     swapchain;
     BatchRenderer batch_renderer;
+    RenderThread  render_thread; /**< @b Draws frames while @c is_running, see @c RenderThread. */
 } XuiGraphicsContext;
 
 XuiGraphicsContext *graphics_context_create (XwWindow *xwin);
 void                graphics_context_destroy (XuiGraphicsContext *gctx);
 Bool                graphics_context_resize (XuiGraphicsContext *gctx, XwWindow *xwin);
+Bool                graphics_context_start_render_thread (XuiGraphicsContext *gctx, XwWindow *xwin);
+Bool                graphics_context_stop_render_thread (XuiGraphicsContext *gctx);
 
 #endif // ANVIE_CROSSGUI_SOURCE_PLUGIN_GRAPHICS_VULKAN_GRAPHICS_CONTEXT_H
@@ -30,13 +30,17 @@
  * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  * */
 
+#define ALLOCATOR_TAG ALLOCATOR_TAG_PLUGIN
+
 #include <Anvie/Common.h>
 
 /* crossgui utils */
 #include <Anvie/CrossGui/Utils/Maths.h>
 
 /* crossgui-graphics-api */
+#include <Anvie/CrossGui/Plugin/Graphics/Api/Line2D.h>
 #include <Anvie/CrossGui/Plugin/Graphics/Api/Mesh2D.h>
+#include <Anvie/CrossGui/Plugin/Graphics/Api/Primitive2D.h>
 #include <vulkan/vulkan_core.h>
 
 /* local includes */
@@ -49,7 +53,29 @@
 /********************************** PRIVATE METHOD DELCARATIONS ***********************************/
 /**************************************************************************************************/
 
+/**
+ * @b Pipeline specific state that differs between graphics pipelines.
+ * */
+typedef struct GraphicsPipelineConfig {
+    CString                               vert_shader_path;
+    CString                               frag_shader_path;
+    VkPipelineVertexInputStateCreateInfo *vertex_input_state;
+    VkPrimitiveTopology                   topology;
+    VkDescriptorSetLayoutBinding         *bindings; /**< @b Null if pipeline uses no resources. */
+    Uint32                                binding_count;
+} GraphicsPipelineConfig;
+
 /* private helper methods */
+static GraphicsPipeline *graphics_pipeline_init (
+    GraphicsPipeline       *pipeline,
+    RenderPass             *render_pass,
+    GraphicsPipelineConfig *config
+);
+static GraphicsPipeline *graphics_pipeline_init_glyphs_2d (
+    GraphicsPipeline *pipeline,
+    RenderPass       *render_pass,
+    CString           frag_shader_path
+);
 static inline VkShaderModule load_shader (VkDevice device, CString path);
 
 /**************************************************************************************************/
@@ -57,101 +83,642 @@ static inline VkShaderModule load_shader (VkDevice device, CString path);
 /**************************************************************************************************/
 
 /**
- * @b Create a new Shader UI binding.
+ * @b Create graphics pipeline to draw instanced 2D meshes.
+ *
+ * @param pipeline Pipeline to be initialized.
+ * @param render_pass Render pass pipeline will be used in.
+ *
+ * @return @p pipeline on success.
+ * @return @c Null otherwise.
+ * */
+GraphicsPipeline *
+    graphics_pipeline_init_default (GraphicsPipeline *pipeline, RenderPass *render_pass) {
+    RETURN_VALUE_IF (!pipeline || !render_pass, Null, ERR_INVALID_ARGUMENTS);
+
+    /*
+     * NOTE : Instead of sending vertex positions and vertex colors together, we
+     * send in position data only and send color and scale separately as a uniform.
+     * This allows reuse of position data and different color support.
+     *
+     * Therfore, we just describe position as input attribute below
+     * */
+
+    /* describe how vertex data is sent to GPU */
+    VkVertexInputBindingDescription vertex_binding_descs[] = {
+        {  .binding = 0,.stride = sizeof (Vec2f),.inputRate = VK_VERTEX_INPUT_RATE_VERTEX              },
+
+        {.binding   = 1,
+         .stride    = sizeof (XuiMeshInstance2D),
+         .inputRate = VK_VERTEX_INPUT_RATE_INSTANCE}
+    };
+
+    VkVertexInputAttributeDescription vertex_attribute_descs[] = {
+        /* mesh vertex position */
+        {.location = 0, .binding = 0, .format = VK_FORMAT_R32G32_SFLOAT, .offset = 0},
+
+        {.location = 1,
+         .binding  = 1,
+         .format   = VK_FORMAT_R32_UINT,
+         .offset   = offsetof (XuiMeshInstance2D, type)}, /* instance mesh type */
+        {.location = 2,
+         .binding  = 1,
+         .format   = VK_FORMAT_R32G32_SFLOAT,
+         .offset   = offsetof (XuiMeshInstance2D, scale)}, /* instance scale */
+        {.location = 3,
+         .binding  = 1,
+         .format   = VK_FORMAT_R32G32B32_SFLOAT,
+         .offset   = offsetof (XuiMeshInstance2D, position)}, /* instance position */
+        {.location = 4,
+         .binding  = 1,
+         .format   = VK_FORMAT_R32G32B32A32_SFLOAT,
+         .offset   = offsetof (XuiMeshInstance2D, color)}, /* instance color */
+        {.location = 5,
+         .binding  = 1,
+         .format   = VK_FORMAT_R32_SFLOAT,
+         .offset   = offsetof (XuiMeshInstance2D, rotation)}, /* instance rotation */
+        {.location = 6,
+         .binding  = 1,
+         .format   = VK_FORMAT_R32G32_SFLOAT,
+         .offset   = offsetof (XuiMeshInstance2D, skew)}, /* instance skew */
+        {.location = 7,
+         .binding  = 1,
+         .format   = VK_FORMAT_R32G32_SFLOAT,
+         .offset   = offsetof (XuiMeshInstance2D, pivot)}, /* instance pivot */
+    };
+
+    /* describe vertex input state */
+    VkPipelineVertexInputStateCreateInfo vertex_input_state = {
+        .sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO,
+        .pNext = Null,
+        .flags = 0,
+        .vertexBindingDescriptionCount   = ARRAY_SIZE (vertex_binding_descs),
+        .pVertexBindingDescriptions      = vertex_binding_descs,
+        .vertexAttributeDescriptionCount = ARRAY_SIZE (vertex_attribute_descs),
+        .pVertexAttributeDescriptions    = vertex_attribute_descs
+    };
+
+    return graphics_pipeline_init (
+        pipeline,
+        render_pass,
+        &(GraphicsPipelineConfig
+        ) {.vert_shader_path   = "bin/Shaders/triangle.vert.spv",
+           .frag_shader_path   = "bin/Shaders/triangle.frag.spv",
+           .vertex_input_state = &vertex_input_state,
+           .topology           = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST}
+    );
+}
+
+/**
+ * @b Create graphics pipeline to draw analytic 2D primitives.
+ *
+ * There is no per-vertex data. Each @c XuiPrimitive2D instance is drawn as a
+ * 4 vertex triangle strip, and quad corners are generated from vertex index
+ * in primitive.vert.
+ *
+ * @param pipeline Pipeline to be initialized.
+ * @param render_pass Render pass pipeline will be used in.
+ *
+ * @return @p pipeline on success.
+ * @return @c Null otherwise.
+ * */
+GraphicsPipeline *
+    graphics_pipeline_init_primitive_2d (GraphicsPipeline *pipeline, RenderPass *render_pass) {
+    RETURN_VALUE_IF (!pipeline || !render_pass, Null, ERR_INVALID_ARGUMENTS);
+
+    VkVertexInputBindingDescription vertex_binding_descs[] = {
+        {.binding   = 0,
+         .stride    = sizeof (XuiPrimitive2D),
+         .inputRate = VK_VERTEX_INPUT_RATE_INSTANCE}
+    };
+
+    VkVertexInputAttributeDescription vertex_attribute_descs[] = {
+        {.location = 0,
+         .binding  = 0,
+         .format   = VK_FORMAT_R32G32B32_SFLOAT,
+         .offset   = offsetof (XuiPrimitive2D, position)}, /* primitive center */
+        {.location = 1,
+         .binding  = 0,
+         .format   = VK_FORMAT_R32_UINT,
+         .offset   = offsetof (XuiPrimitive2D, type)}, /* primitive type */
+        {.location = 2,
+         .binding  = 0,
+         .format   = VK_FORMAT_R32G32_SFLOAT,
+         .offset   = offsetof (XuiPrimitive2D, half_size)}, /* primitive half size */
+        {.location = 3,
+         .binding  = 0,
+         .format   = VK_FORMAT_R32_SFLOAT,
+         .offset   = offsetof (XuiPrimitive2D, rotation)}, /* primitive rotation */
+        {.location = 4,
+         .binding  = 0,
+         .format   = VK_FORMAT_R32_SFLOAT,
+         .offset   = offsetof (XuiPrimitive2D, border_width)}, /* primitive border width */
+        {.location = 5,
+         .binding  = 0,
+         .format   = VK_FORMAT_R32G32B32A32_SFLOAT,
+         .offset   = offsetof (XuiPrimitive2D, corner_radii)}, /* primitive corner radii */
+        {.location = 6,
+         .binding  = 0,
+         .format   = VK_FORMAT_R32G32B32A32_SFLOAT,
+         .offset   = offsetof (XuiPrimitive2D, fill_color)}, /* primitive fill color */
+        {.location = 7,
+         .binding  = 0,
+         .format   = VK_FORMAT_R32G32B32A32_SFLOAT,
+         .offset   = offsetof (XuiPrimitive2D, border_color)}, /* primitive border color */
+    };
+
+    VkPipelineVertexInputStateCreateInfo vertex_input_state = {
+        .sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO,
+        .pNext = Null,
+        .flags = 0,
+        .vertexBindingDescriptionCount   = ARRAY_SIZE (vertex_binding_descs),
+        .pVertexBindingDescriptions      = vertex_binding_descs,
+        .vertexAttributeDescriptionCount = ARRAY_SIZE (vertex_attribute_descs),
+        .pVertexAttributeDescriptions    = vertex_attribute_descs
+    };
+
+    return graphics_pipeline_init (
+        pipeline,
+        render_pass,
+        &(GraphicsPipelineConfig
+        ) {.vert_shader_path   = "bin/Shaders/primitive.vert.spv",
+           .frag_shader_path   = "bin/Shaders/primitive.frag.spv",
+           .vertex_input_state = &vertex_input_state,
+           .topology           = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_STRIP}
+    );
+}
+
+/**
+ * @b Create graphics pipeline to draw independent thick line segments.
+ *
+ * Each @c XuiLineSegment2D instance is drawn as a 4 vertex triangle strip,
+ * expanded to a quad around the segment in line.vert.
+ *
+ * @param pipeline Pipeline to be initialized.
+ * @param render_pass Render pass pipeline will be used in.
+ *
+ * @return @p pipeline on success.
+ * @return @c Null otherwise.
+ * */
+GraphicsPipeline *
+    graphics_pipeline_init_line_2d (GraphicsPipeline *pipeline, RenderPass *render_pass) {
+    RETURN_VALUE_IF (!pipeline || !render_pass, Null, ERR_INVALID_ARGUMENTS);
+
+    VkVertexInputBindingDescription vertex_binding_descs[] = {
+        {.binding   = 0,
+         .stride    = sizeof (XuiLineSegment2D),
+         .inputRate = VK_VERTEX_INPUT_RATE_INSTANCE}
+    };
+
+    VkVertexInputAttributeDescription vertex_attribute_descs[] = {
+        {.location = 0,
+         .binding  = 0,
+         .format   = VK_FORMAT_R32G32B32A32_SFLOAT,
+         .offset   = offsetof (XuiLineSegment2D, color)}, /* line color */
+        {.location = 1,
+         .binding  = 0,
+         .format   = VK_FORMAT_R32G32_SFLOAT,
+         .offset   = offsetof (XuiLineSegment2D, p0)}, /* line start point */
+        {.location = 2,
+         .binding  = 0,
+         .format   = VK_FORMAT_R32G32_SFLOAT,
+         .offset   = offsetof (XuiLineSegment2D, p1)}, /* line end point */
+        {.location = 3,
+         .binding  = 0,
+         .format   = VK_FORMAT_R32_SFLOAT,
+         .offset   = offsetof (XuiLineSegment2D, width)}, /* line width */
+        {.location = 4,
+         .binding  = 0,
+         .format   = VK_FORMAT_R32_SFLOAT,
+         .offset   = offsetof (XuiLineSegment2D, depth)}, /* line depth */
+        {.location = 5,
+         .binding  = 0,
+         .format   = VK_FORMAT_R32_UINT,
+         .offset   = offsetof (XuiLineSegment2D, cap)}, /* line cap */
+    };
+
+    VkPipelineVertexInputStateCreateInfo vertex_input_state = {
+        .sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO,
+        .pNext = Null,
+        .flags = 0,
+        .vertexBindingDescriptionCount   = ARRAY_SIZE (vertex_binding_descs),
+        .pVertexBindingDescriptions      = vertex_binding_descs,
+        .vertexAttributeDescriptionCount = ARRAY_SIZE (vertex_attribute_descs),
+        .pVertexAttributeDescriptions    = vertex_attribute_descs
+    };
+
+    return graphics_pipeline_init (
+        pipeline,
+        render_pass,
+        &(GraphicsPipelineConfig
+        ) {.vert_shader_path   = "bin/Shaders/line.vert.spv",
+           .frag_shader_path   = "bin/Shaders/line.frag.spv",
+           .vertex_input_state = &vertex_input_state,
+           .topology           = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_STRIP}
+    );
+}
+
+/**
+ * @b Create graphics pipeline to draw polylines from point streams.
+ *
+ * Polyline points are uploaded as a tightly packed @c Vec2f array, with first
+ * and last point repeated. Instance @c i is the segment between points @c i+1
+ * and @c i+2, and reads it's neighbouring points @c i and @c i+3 as well, to
+ * compute joins. This is done by reading same binding at 4 different offsets,
+ * so each point is uploaded just once. Style is sent as push constant.
+ *
+ * @param pipeline Pipeline to be initialized.
+ * @param render_pass Render pass pipeline will be used in.
+ *
+ * @return @p pipeline on success.
+ * @return @c Null otherwise.
+ * */
+GraphicsPipeline *
+    graphics_pipeline_init_polyline_2d (GraphicsPipeline *pipeline, RenderPass *render_pass) {
+    RETURN_VALUE_IF (!pipeline || !render_pass, Null, ERR_INVALID_ARGUMENTS);
+
+    VkVertexInputBindingDescription vertex_binding_descs[] = {
+        {.binding = 0, .stride = sizeof (Vec2f), .inputRate = VK_VERTEX_INPUT_RATE_INSTANCE}
+    };
+
+    VkVertexInputAttributeDescription vertex_attribute_descs[] = {
+        {.location = 0,
+         .binding  = 0,
+         .format   = VK_FORMAT_R32G32_SFLOAT,
+         .offset   = 0 * sizeof (Vec2f)}, /* previous point */
+        {.location = 1,
+         .binding  = 0,
+         .format   = VK_FORMAT_R32G32_SFLOAT,
+         .offset   = 1 * sizeof (Vec2f)}, /* segment start point */
+        {.location = 2,
+         .binding  = 0,
+         .format   = VK_FORMAT_R32G32_SFLOAT,
+         .offset   = 2 * sizeof (Vec2f)}, /* segment end point */
+        {.location = 3,
+         .binding  = 0,
+         .format   = VK_FORMAT_R32G32_SFLOAT,
+         .offset   = 3 * sizeof (Vec2f)}, /* next point */
+    };
+
+    VkPipelineVertexInputStateCreateInfo vertex_input_state = {
+        .sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO,
+        .pNext = Null,
+        .flags = 0,
+        .vertexBindingDescriptionCount   = ARRAY_SIZE (vertex_binding_descs),
+        .pVertexBindingDescriptions      = vertex_binding_descs,
+        .vertexAttributeDescriptionCount = ARRAY_SIZE (vertex_attribute_descs),
+        .pVertexAttributeDescriptions    = vertex_attribute_descs
+    };
+
+    return graphics_pipeline_init (
+        pipeline,
+        render_pass,
+        &(GraphicsPipelineConfig
+        ) {.vert_shader_path   = "bin/Shaders/polyline.vert.spv",
+           .frag_shader_path   = "bin/Shaders/line.frag.spv",
+           .vertex_input_state = &vertex_input_state,
+           .topology           = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_STRIP}
+    );
+}
+
+/**
+ * @b Create graphics pipeline to draw text as textured glyph quads.
+ *
+ * Each @c GlyphInstance2D is drawn as a 4 vertex triangle strip, like
+ * primitives. Glyph coverage is sampled from glyph atlas image, bound as a
+ * combined image sampler at binding 0 of pipeline's descriptor set.
+ *
+ * @param pipeline Pipeline to be initialized.
+ * @param render_pass Render pass pipeline will be used in.
+ *
+ * @return @p pipeline on success.
+ * @return @c Null otherwise.
+ * */
+GraphicsPipeline *
+    graphics_pipeline_init_text_2d (GraphicsPipeline *pipeline, RenderPass *render_pass) {
+    RETURN_VALUE_IF (!pipeline || !render_pass, Null, ERR_INVALID_ARGUMENTS);
+    return graphics_pipeline_init_glyphs_2d (pipeline, render_pass, "bin/Shaders/text.frag.spv");
+}
+
+/**
+ * @b Create graphics pipeline to draw text as glyph quads from a signed distance field atlas.
+ *
+ * Same as @c graphics_pipeline_init_text_2d, except that fragment shader
+ * reconstructs glyph edges from distance fields, so atlas can be sampled at
+ * any scale.
+ *
+ * @param pipeline Pipeline to be initialized.
+ * @param render_pass Render pass pipeline will be used in.
+ *
+ * @return @p pipeline on success.
+ * @return @c Null otherwise.
+ * */
+GraphicsPipeline *
+    graphics_pipeline_init_text_sdf_2d (GraphicsPipeline *pipeline, RenderPass *render_pass) {
+    RETURN_VALUE_IF (!pipeline || !render_pass, Null, ERR_INVALID_ARGUMENTS);
+    return graphics_pipeline_init_glyphs_2d (
+        pipeline,
+        render_pass,
+        "bin/Shaders/text_sdf.frag.spv"
+    );
+}
+
+/**
+ * @b Destroy given ShaderResourceBinding object.
+ *
+ * @param srb 
+ * @param device
+ * */
+GraphicsPipeline *graphics_pipeline_deinit (GraphicsPipeline *pipeline) {
+    RETURN_VALUE_IF (!pipeline, Null, ERR_INVALID_ARGUMENTS);
+
+    VkDevice device = vk.device.logical;
+
+    vkDeviceWaitIdle (device);
+
+    if (pipeline->pipeline) {
+        vkDestroyPipeline (device, pipeline->pipeline, Null);
+        pipeline->pipeline = VK_NULL_HANDLE;
+    }
+
+    if (pipeline->pipeline_layout) {
+        vkDestroyPipelineLayout (device, pipeline->pipeline_layout, Null);
+        pipeline->pipeline_layout = VK_NULL_HANDLE;
+    }
+
+    if (pipeline->descriptor_pool) {
+        vkDestroyDescriptorPool (device, pipeline->descriptor_pool, Null);
+        pipeline->descriptor_pool = VK_NULL_HANDLE;
+        pipeline->descriptor_set  = VK_NULL_HANDLE;
+    }
+
+    if (pipeline->descriptor_set_layout) {
+        vkDestroyDescriptorSetLayout (device, pipeline->descriptor_set_layout, Null);
+        pipeline->descriptor_set_layout = VK_NULL_HANDLE;
+    }
+
+    return pipeline;
+}
+
+/**
+ * @b Write given uniform buffer's information to default descriptor set.
  *
- * @return @c ShaderResourceBinding on success.
+ * @param pipeline
+ * @param uniform_barrier
+ *
+ * @return @p pipeline on success.
+ * @return @c Null otherwise.
+ * */
+GraphicsPipeline *graphics_pipeline_write_to_descriptor_set (
+    GraphicsPipeline *pipeline,
+    DeviceBuffer     *uniform_buffer
+) {
+    RETURN_VALUE_IF (!pipeline || !uniform_buffer, Null, ERR_INVALID_ARGUMENTS);
+
+    VkDevice device = vk.device.logical;
+
+    /* write this buffer info to descriptor set */
+    {
+        VkDescriptorBufferInfo buffer_info = {
+            .buffer = uniform_buffer->buffer,
+            .range  = uniform_buffer->size,
+            .offset = 0
+        };
+
+        VkWriteDescriptorSet write_descriptor_set = {
+            .sType            = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
+            .pNext            = Null,
+            .dstSet           = pipeline->descriptor_set,
+            .dstBinding       = 0,
+            .dstArrayElement  = 0,
+            .descriptorCount  = 1,
+            .descriptorType   = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER,
+            .pImageInfo       = Null,
+            .pBufferInfo      = &buffer_info,
+            .pTexelBufferView = Null
+        };
+
+        vkUpdateDescriptorSets (device, 1, &write_descriptor_set, 0, Null);
+    }
+
+    return pipeline;
+}
+
+/**
+ * @b Write given sampled image to binding 0 of pipeline's descriptor set.
+ *
+ * Image is expected to be in @c VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL layout
+ * whenever a draw using this pipeline executes.
+ *
+ * @param pipeline Pipeline created with a combined image sampler at binding 0.
+ * @param image
+ * @param sampler
+ *
+ * @return @p pipeline on success.
  * @return @c Null otherwise.
  * */
-GraphicsPipeline *graphics_pipeline_init_default (
+GraphicsPipeline *graphics_pipeline_write_image_to_descriptor_set (
+    GraphicsPipeline *pipeline,
+    DeviceImage      *image,
+    VkSampler         sampler
+) {
+    RETURN_VALUE_IF (
+        !pipeline || !pipeline->descriptor_set || !image || !sampler,
+        Null,
+        ERR_INVALID_ARGUMENTS
+    );
+
+    VkDescriptorImageInfo image_info = {
+        .sampler     = sampler,
+        .imageView   = image->view,
+        .imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL
+    };
+
+    VkWriteDescriptorSet write_descriptor_set = {
+        .sType            = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
+        .pNext            = Null,
+        .dstSet           = pipeline->descriptor_set,
+        .dstBinding       = 0,
+        .dstArrayElement  = 0,
+        .descriptorCount  = 1,
+        .descriptorType   = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
+        .pImageInfo       = &image_info,
+        .pBufferInfo      = Null,
+        .pTexelBufferView = Null
+    };
+
+    vkUpdateDescriptorSets (vk.device.logical, 1, &write_descriptor_set, 0, Null);
+
+    return pipeline;
+}
+
+/**************************************************************************************************/
+/******************************* PRIVATE HELPER METHOD DEFINITIONS ********************************/
+/**************************************************************************************************/
+
+/**
+ * @b Create a pipeline drawing @c GlyphInstance2D quads, sampling glyph atlas
+ * bound at binding 0, with given fragment shader.
+ * */
+static GraphicsPipeline *graphics_pipeline_init_glyphs_2d (
     GraphicsPipeline *pipeline,
     RenderPass       *render_pass,
-    Swapchain        *swapchain
+    CString           frag_shader_path
+) {
+    VkVertexInputBindingDescription vertex_binding_descs[] = {
+        {.binding   = 0,
+         .stride    = sizeof (GlyphInstance2D),
+         .inputRate = VK_VERTEX_INPUT_RATE_INSTANCE}
+    };
+
+    VkVertexInputAttributeDescription vertex_attribute_descs[] = {
+        {.location = 0,
+         .binding  = 0,
+         .format   = VK_FORMAT_R32G32B32A32_SFLOAT,
+         .offset   = offsetof (GlyphInstance2D, color)}, /* text color */
+        {.location = 1,
+         .binding  = 0,
+         .format   = VK_FORMAT_R32G32B32A32_SFLOAT,
+         .offset   = offsetof (GlyphInstance2D, uv_rect)}, /* glyph rect in atlas */
+        {.location = 2,
+         .binding  = 0,
+         .format   = VK_FORMAT_R32G32_SFLOAT,
+         .offset   = offsetof (GlyphInstance2D, size)}, /* quad size */
+        {.location = 3,
+         .binding  = 0,
+         .format   = VK_FORMAT_R32G32B32_SFLOAT,
+         .offset   = offsetof (GlyphInstance2D, position)}, /* quad top left corner */
+    };
+
+    VkPipelineVertexInputStateCreateInfo vertex_input_state = {
+        .sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO,
+        .pNext = Null,
+        .flags = 0,
+        .vertexBindingDescriptionCount   = ARRAY_SIZE (vertex_binding_descs),
+        .pVertexBindingDescriptions      = vertex_binding_descs,
+        .vertexAttributeDescriptionCount = ARRAY_SIZE (vertex_attribute_descs),
+        .pVertexAttributeDescriptions    = vertex_attribute_descs
+    };
+
+    VkDescriptorSetLayoutBinding bindings[] = {
+        {.binding            = 0,
+         .descriptorType     = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
+         .descriptorCount    = 1,
+         .stageFlags         = VK_SHADER_STAGE_FRAGMENT_BIT,
+         .pImmutableSamplers = Null}
+    };
+
+    return graphics_pipeline_init (
+        pipeline,
+        render_pass,
+        &(GraphicsPipelineConfig
+        ) {.vert_shader_path   = "bin/Shaders/text.vert.spv",
+           .frag_shader_path   = frag_shader_path,
+           .vertex_input_state = &vertex_input_state,
+           .topology           = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_STRIP,
+           .bindings           = bindings,
+           .binding_count      = ARRAY_SIZE (bindings)}
+    );
+}
+
+/**
+ * @b Create a graphics pipeline in subpass 0 of given render pass.
+ *
+ * All pipelines share same push constant range (@c DefaultPushConstants),
+ * fixed function state and dynamic viewport and scissor. They differ only in
+ * the shaders, vertex input, topology and descriptor bindings provided in
+ * @p config. Pipelines with bindings get a single descriptor set of their own.
+ *
+ * @param pipeline Pipeline to be initialized.
+ * @param render_pass Render pass pipeline will be used in.
+ * @param config Pipeline specific state.
+ *
+ * @return @p pipeline on success.
+ * @return @c Null otherwise.
+ * */
+static GraphicsPipeline *graphics_pipeline_init (
+    GraphicsPipeline       *pipeline,
+    RenderPass             *render_pass,
+    GraphicsPipelineConfig *config
 ) {
-    RETURN_VALUE_IF (!pipeline || !render_pass || !swapchain, Null, ERR_OUT_OF_MEMORY);
+    RETURN_VALUE_IF (!pipeline || !render_pass || !config, Null, ERR_INVALID_ARGUMENTS);
 
     VkDevice       device      = vk.device.logical;
     VkShaderModule vert_shader = VK_NULL_HANDLE, frag_shader = VK_NULL_HANDLE;
 
-    // /* create descriptor pool */
-    // {
-    //     VkDescriptorPoolSize pool_sizes[] = {
-    //         {.type = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, .descriptorCount = 1}
-    //     };
-    //
-    //     VkDescriptorPoolCreateInfo descriptor_pool_create_info = {
-    //         .sType         = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO,
-    //         .pNext         = Null,
-    //         .flags         = 0,
-    //         .maxSets       = 1,
-    //         .poolSizeCount = ARRAY_SIZE (pool_sizes),
-    //         .pPoolSizes    = pool_sizes
-    //     };
-    //
-    //     VkResult res = vkCreateDescriptorPool (
-    //         device,
-    //         &descriptor_pool_create_info,
-    //         Null,
-    //         &pipeline->descriptor_pool
-    //     );
-    //     GOTO_HANDLER_IF (
-    //         res != VK_SUCCESS,
-    //         INIT_FAILED,
-    //         "Failed to create descriptor set. RET = %d\n",
-    //         res
-    //     );
-    // }
-    //
-    // /* describe descriptor set layout */
-    // {
-    //     VkDescriptorSetLayoutBinding bindings[] = {
-    //         {.binding            = 0,
-    //          .descriptorType     = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER,
-    //          .descriptorCount    = 1,
-    //          .stageFlags         = VK_SHADER_STAGE_VERTEX_BIT,
-    //          .pImmutableSamplers = Null}
-    //     };
-    //
-    //     VkDescriptorSetLayoutCreateInfo set_layout_create_info = {
-    //         .sType        = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO,
-    //         .pNext        = Null,
-    //         .flags        = 0,
-    //         .bindingCount = ARRAY_SIZE (bindings),
-    //         .pBindings    = bindings
-    //     };
-    //
-    //     VkResult res = vkCreateDescriptorSetLayout (
-    //         device,
-    //         &set_layout_create_info,
-    //         Null,
-    //         &pipeline->descriptor_set_layout
-    //     );
-    //     GOTO_HANDLER_IF (
-    //         res != VK_SUCCESS,
-    //         INIT_FAILED,
-    //         "Failed to create descriptor set layout. RET = %d\n",
-    //         res
-    //     );
-    // }
-    //
-    // /* allocate one single descriptor set */
-    // {
-    //     VkDescriptorSetAllocateInfo set_allocate_info = {
-    //         .sType              = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO,
-    //         .pNext              = Null,
-    //         .descriptorPool     = pipeline->descriptor_pool,
-    //         .descriptorSetCount = 1,
-    //         .pSetLayouts        = (VkDescriptorSetLayout[]) {pipeline->descriptor_set_layout}
-    //     };
-    //
-    //     VkResult res =
-    //         vkAllocateDescriptorSets (device, &set_allocate_info, &pipeline->descriptor_set);
-    //     GOTO_HANDLER_IF (
-    //         res != VK_SUCCESS,
-    //         INIT_FAILED,
-    //         "Failed to create descriptor set layout. RET = %d\n",
-    //         res
-    //     );
-    // }
+    /* create descriptor pool, set layout and a single set, if pipeline uses any resources */
+    if (config->binding_count) {
+        VkDescriptorPoolSize pool_sizes[8];
+        GOTO_HANDLER_IF (
+            config->binding_count > ARRAY_SIZE (pool_sizes),
+            INIT_FAILED,
+            "Too many descriptor bindings in pipeline config\n"
+        );
+
+        for (Uint32 b = 0; b < config->binding_count; b++) {
+            pool_sizes[b] = (VkDescriptorPoolSize
+            ) {.type            = config->bindings[b].descriptorType,
+               .descriptorCount = config->bindings[b].descriptorCount};
+        }
+
+        VkDescriptorPoolCreateInfo descriptor_pool_create_info = {
+            .sType         = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO,
+            .pNext         = Null,
+            .flags         = 0,
+            .maxSets       = 1,
+            .poolSizeCount = config->binding_count,
+            .pPoolSizes    = pool_sizes
+        };
+
+        VkResult res = vkCreateDescriptorPool (
+            device,
+            &descriptor_pool_create_info,
+            Null,
+            &pipeline->descriptor_pool
+        );
+        GOTO_HANDLER_IF (
+            res != VK_SUCCESS,
+            INIT_FAILED,
+            "Failed to create descriptor pool. RET = %d\n",
+            res
+        );
+
+        VkDescriptorSetLayoutCreateInfo set_layout_create_info = {
+            .sType        = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO,
+            .pNext        = Null,
+            .flags        = 0,
+            .bindingCount = config->binding_count,
+            .pBindings    = config->bindings
+        };
+
+        res = vkCreateDescriptorSetLayout (
+            device,
+            &set_layout_create_info,
+            Null,
+            &pipeline->descriptor_set_layout
+        );
+        GOTO_HANDLER_IF (
+            res != VK_SUCCESS,
+            INIT_FAILED,
+            "Failed to create descriptor set layout. RET = %d\n",
+            res
+        );
+
+        VkDescriptorSetAllocateInfo set_allocate_info = {
+            .sType              = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO,
+            .pNext              = Null,
+            .descriptorPool     = pipeline->descriptor_pool,
+            .descriptorSetCount = 1,
+            .pSetLayouts        = &pipeline->descriptor_set_layout
+        };
+
+        res = vkAllocateDescriptorSets (device, &set_allocate_info, &pipeline->descriptor_set);
+        GOTO_HANDLER_IF (
+            res != VK_SUCCESS,
+            INIT_FAILED,
+            "Failed to allocate descriptor set. RET = %d\n",
+            res
+        );
+    }
 
     /* create a pipeline layout including provided shader resource binding */
     {
@@ -159,10 +726,13 @@ GraphicsPipeline *graphics_pipeline_init_default (
             .sType          = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO,
             .pNext          = Null,
             .flags          = 0,
-            .setLayoutCount = 0,
-            // .pSetLayouts            = (VkDescriptorSetLayout[]) {pipeline->descriptor_set_layout},
-            .pushConstantRangeCount = 0,
-            .pPushConstantRanges    = Null
+            .setLayoutCount = pipeline->descriptor_set_layout ? 1 : 0,
+            .pSetLayouts    = &pipeline->descriptor_set_layout,
+            .pushConstantRangeCount = 1,
+            .pPushConstantRanges    = (VkPushConstantRange[]
+            ) {{.stageFlags = VK_SHADER_STAGE_VERTEX_BIT,
+                   .offset     = 0,
+                   .size       = sizeof (DefaultPushConstants)}}
         };
 
         VkResult res = vkCreatePipelineLayout (
@@ -182,8 +752,8 @@ GraphicsPipeline *graphics_pipeline_init_default (
 
     /* create pipeline */
     {
-        vert_shader = load_shader (device, "bin/Shaders/triangle.vert.spv");
-        frag_shader = load_shader (device, "bin/Shaders/triangle.frag.spv");
+        vert_shader = load_shader (device, config->vert_shader_path);
+        frag_shader = load_shader (device, config->frag_shader_path);
         GOTO_HANDLER_IF (
             !vert_shader || !frag_shader,
             INIT_FAILED,
@@ -212,81 +782,37 @@ GraphicsPipeline *graphics_pipeline_init_default (
                .pSpecializationInfo = Null};
         }
 
-        /*
-         * NOTE : Instead of sending vertex positions and vertex colors together, we
-         * send in position data only and send color and scale separately as a uniform.
-         * This allows reuse of position data and different color support.
-         *
-         * Therfore, we just describe position as input attribute below
-         * */
-
-        /* describe how vertex data is sent to GPU */
-        VkVertexInputBindingDescription vertex_binding_descs[] = {
-            {  .binding = 0,.stride = sizeof (Vec2f),.inputRate = VK_VERTEX_INPUT_RATE_VERTEX              },
-
-            {.binding   = 1,
-             .stride    = sizeof (XuiMeshInstance2D),
-             .inputRate = VK_VERTEX_INPUT_RATE_INSTANCE}
-        };
-
-        VkVertexInputAttributeDescription vertex_attribute_descs[] = {
-            /* mesh vertex position */
-            {.location = 0, .binding = 0, .format = VK_FORMAT_R32G32_SFLOAT, .offset = 0},
-
-            {.location = 1,
-             .binding  = 1,
-             .format   = VK_FORMAT_R32_UINT,
-             .offset   = offsetof (XuiMeshInstance2D, type)}, /* instance mesh type */
-            {.location = 2,
-             .binding  = 1,
-             .format   = VK_FORMAT_R32G32_SFLOAT,
-             .offset   = offsetof (XuiMeshInstance2D, scale)}, /* instance scale */
-            {.location = 3,
-             .binding  = 1,
-             .format   = VK_FORMAT_R32G32B32_SFLOAT,
-             .offset   = offsetof (XuiMeshInstance2D, position)}, /* instance position */
-            {.location = 4,
-             .binding  = 1,
-             .format   = VK_FORMAT_R32G32B32A32_SFLOAT,
-             .offset   = offsetof (XuiMeshInstance2D, color)}, /* instance color */
-        };
-
-        /* describe vertex input state */
-        VkPipelineVertexInputStateCreateInfo vertex_input_state = {
-            .sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO,
-            .pNext = Null,
-            .flags = 0,
-            .vertexBindingDescriptionCount   = ARRAY_SIZE (vertex_binding_descs),
-            .pVertexBindingDescriptions      = vertex_binding_descs,
-            .vertexAttributeDescriptionCount = ARRAY_SIZE (vertex_attribute_descs),
-            .pVertexAttributeDescriptions    = vertex_attribute_descs
-        };
-
         /* how to assemble input vertex data */
         VkPipelineInputAssemblyStateCreateInfo input_assembly_state = {0};
         input_assembly_state.sType    = VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO;
-        input_assembly_state.topology = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+        input_assembly_state.topology = config->topology;
 
         /* describe tesselation state */
         VkPipelineTessellationStateCreateInfo tesselation_state = {0};
         tesselation_state.sType = VK_STRUCTURE_TYPE_PIPELINE_TESSELLATION_STATE_CREATE_INFO;
 
-        /* describe viewport and scissor */
+        /*
+         * viewport and scissor are dynamic, so that pipeline does not need to be
+         * recreated when swapchain is resized. These are set at record time.
+         * */
         VkPipelineViewportStateCreateInfo viewport_state = {
             .sType         = VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO,
             .pNext         = Null,
             .flags         = 0,
             .viewportCount = 1,
-            .pViewports    = (VkViewport[]
-            ) {{.x        = 0,
-                   .y        = 0,
-                   .width    = swapchain->image_extent.width,
-                   .height   = swapchain->image_extent.height,
-                   .minDepth = 0.f,
-                   .maxDepth = 1.f}},
+            .pViewports    = Null,
             .scissorCount  = 1,
-            .pScissors =
-                (VkRect2D[]) {{.offset = {.x = 0, .y = 0}, .extent = swapchain->image_extent}}
+            .pScissors     = Null
+        };
+
+        VkDynamicState dynamic_states[] = {VK_DYNAMIC_STATE_VIEWPORT, VK_DYNAMIC_STATE_SCISSOR};
+
+        VkPipelineDynamicStateCreateInfo dynamic_state = {
+            .sType             = VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO,
+            .pNext             = Null,
+            .flags             = 0,
+            .dynamicStateCount = ARRAY_SIZE (dynamic_states),
+            .pDynamicStates    = dynamic_states
         };
 
         /* describe rasterization state */
@@ -360,7 +886,7 @@ GraphicsPipeline *graphics_pipeline_init_default (
             .flags               = 0,
             .stageCount          = ARRAY_SIZE (shader_stages),
             .pStages             = shader_stages,
-            .pVertexInputState   = &vertex_input_state,
+            .pVertexInputState   = config->vertex_input_state,
             .pInputAssemblyState = &input_assembly_state,
             .pTessellationState  = &tesselation_state,
             .pViewportState      = &viewport_state,
@@ -368,7 +894,7 @@ GraphicsPipeline *graphics_pipeline_init_default (
             .pMultisampleState   = &multisample_state,
             .pDepthStencilState  = &depth_stencil_state,
             .pColorBlendState    = &color_blend_state,
-            .pDynamicState       = Null,
+            .pDynamicState       = &dynamic_state,
             .layout              = pipeline->pipeline_layout,
             .renderPass          = render_pass->render_pass,
             .subpass             = 0,
@@ -413,91 +939,6 @@ INIT_FAILED:
     return Null;
 }
 
-/**
- * @b Destroy given ShaderResourceBinding object.
- *
- * @param srb 
- * @param device
- * */
-GraphicsPipeline *graphics_pipeline_deinit (GraphicsPipeline *pipeline) {
-    RETURN_VALUE_IF (!pipeline, Null, ERR_INVALID_ARGUMENTS);
-
-    VkDevice device = vk.device.logical;
-
-    vkDeviceWaitIdle (device);
-
-    if (pipeline->pipeline) {
-        vkDestroyPipeline (device, pipeline->pipeline, Null);
-        pipeline->pipeline = VK_NULL_HANDLE;
-    }
-
-    if (pipeline->pipeline_layout) {
-        vkDestroyPipelineLayout (device, pipeline->pipeline_layout, Null);
-        pipeline->pipeline_layout = VK_NULL_HANDLE;
-    }
-
-    // if (pipeline->descriptor_pool) {
-    //     vkDestroyDescriptorPool (device, pipeline->descriptor_pool, Null);
-    //     pipeline->descriptor_pool = VK_NULL_HANDLE;
-    //     pipeline->descriptor_set  = VK_NULL_HANDLE;
-    // }
-    //
-    // if (pipeline->descriptor_set_layout) {
-    //     vkDestroyDescriptorSetLayout (device, pipeline->descriptor_set_layout, Null);
-    //     pipeline->descriptor_set_layout = VK_NULL_HANDLE;
-    // }
-
-    return pipeline;
-}
-
-/**
- * @b Write given uniform buffer's information to default descriptor set.
- *
- * @param pipeline
- * @param uniform_barrier
- *
- * @return @p pipeline on success.
- * @return @c Null otherwise.
- * */
-GraphicsPipeline *graphics_pipeline_write_to_descriptor_set (
-    GraphicsPipeline *pipeline,
-    DeviceBuffer     *uniform_buffer
-) {
-    RETURN_VALUE_IF (!pipeline || !uniform_buffer, Null, ERR_INVALID_ARGUMENTS);
-
-    VkDevice device = vk.device.logical;
-
-    /* write this buffer info to descriptor set */
-    {
-        VkDescriptorBufferInfo buffer_info = {
-            .buffer = uniform_buffer->buffer,
-            .range  = uniform_buffer->size,
-            .offset = 0
-        };
-
-        VkWriteDescriptorSet write_descriptor_set = {
-            .sType            = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
-            .pNext            = Null,
-            .dstSet           = pipeline->descriptor_set,
-            .dstBinding       = 0,
-            .dstArrayElement  = 0,
-            .descriptorCount  = 1,
-            .descriptorType   = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER,
-            .pImageInfo       = Null,
-            .pBufferInfo      = &buffer_info,
-            .pTexelBufferView = Null
-        };
-
-        vkUpdateDescriptorSets (device, 1, &write_descriptor_set, 0, Null);
-    }
-
-    return pipeline;
-}
-
-/**************************************************************************************************/
-/******************************* PRIVATE HELPER METHOD DEFINITIONS ********************************/
-/**************************************************************************************************/
-
 /**
  * @b Create a shader module by loading it from file.
  *
@@ -35,6 +35,9 @@
 
 #include <Anvie/Types.h>
 
+/* crossgui-utils */
+#include <Anvie/CrossGui/Utils/Maths.h>
+
 /* vulkan includes */
 #include <vulkan/vulkan.h>
 
@@ -42,6 +45,42 @@
 typedef struct Swapchain    Swapchain;
 typedef struct RenderPass   RenderPass;
 typedef struct DeviceBuffer DeviceBuffer;
+typedef struct DeviceImage  DeviceImage;
+
+/**
+ * @b Style of polyline being drawn, sent as push constant for each polyline.
+ * */
+typedef struct PolylineStyle2D {
+    Vec4f   color;
+    Float32 width;
+    Float32 depth;
+    Uint32  cap;
+    Uint32  join;
+} PolylineStyle2D;
+
+/**
+ * @b A single glyph quad, built by renderer from @c XuiText2D.
+ * Must match vertex inputs of text.vert.
+ * */
+typedef struct GlyphInstance2D {
+    Vec4f color;    /**< @b Text color. */
+    Vec4f uv_rect;  /**< @b Normalized atlas coordinates of glyph (x, y, width, height). */
+    Vec2f size;     /**< @b Size of quad in instance coordinates. */
+    Vec3f position; /**< @b Top left corner of quad in instance coordinates, Z is depth. */
+} GlyphInstance2D;
+
+/**
+ * @b Push constants shared by all graphics pipelines in default render pass.
+ * Must match the push constant blocks in triangle.vert, primitive.vert and line.glsl.
+ *
+ * All pipelines use same push constant range, so pipeline layouts stay
+ * compatible, and @c view is pushed just once per frame.
+ * */
+typedef struct DefaultPushConstants {
+    Mat4f           view;          /**< @b Maps instance coordinates to clip space. */
+    Vec2f           viewport_size; /**< @b Size of viewport in pixels. */
+    PolylineStyle2D polyline;      /**< @b Used only by polyline pipeline. */
+} DefaultPushConstants;
 
 typedef struct GraphicsPipeline {
     VkDescriptorPool      descriptor_pool;
@@ -52,15 +91,27 @@ typedef struct GraphicsPipeline {
     VkPipeline       pipeline;
 } GraphicsPipeline;
 
-GraphicsPipeline *graphics_pipeline_init_default (
-    GraphicsPipeline *pipeline,
-    RenderPass       *render_pass,
-    Swapchain        *swapchain
-);
+GraphicsPipeline *
+    graphics_pipeline_init_default (GraphicsPipeline *pipeline, RenderPass *render_pass);
+GraphicsPipeline *
+    graphics_pipeline_init_primitive_2d (GraphicsPipeline *pipeline, RenderPass *render_pass);
+GraphicsPipeline *
+    graphics_pipeline_init_line_2d (GraphicsPipeline *pipeline, RenderPass *render_pass);
+GraphicsPipeline *
+    graphics_pipeline_init_polyline_2d (GraphicsPipeline *pipeline, RenderPass *render_pass);
+GraphicsPipeline *
+    graphics_pipeline_init_text_2d (GraphicsPipeline *pipeline, RenderPass *render_pass);
+GraphicsPipeline *
+    graphics_pipeline_init_text_sdf_2d (GraphicsPipeline *pipeline, RenderPass *render_pass);
 GraphicsPipeline *graphics_pipeline_deinit (GraphicsPipeline *pipeline);
 GraphicsPipeline *graphics_pipeline_write_to_descriptor_set (
     GraphicsPipeline *pipeline,
     DeviceBuffer     *uniform_buffer
 );
+GraphicsPipeline *graphics_pipeline_write_image_to_descriptor_set (
+    GraphicsPipeline *pipeline,
+    DeviceImage      *image,
+    VkSampler         sampler
+);
 
 #endif // ANVIE_CROSSGUI_SOURCE_PLUGINS_GRAPHICS_VULKAN_GRAPHICS_PIPELINE_H
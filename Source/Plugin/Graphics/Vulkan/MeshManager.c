@@ -31,6 +31,8 @@
  * */
 
 
+#define ALLOCATOR_TAG ALLOCATOR_TAG_MESH_MANAGER
+
 #include <Anvie/Common.h>
 
 /* libc */
@@ -48,13 +50,13 @@
 #include "MeshManager.h"
 #include "Vulkan.h"
 
-NEW_VECTOR_TYPE (MeshData2D, mesh_data_2d);
+NEW_VECTOR_TYPE (MeshData2D, MeshData2DVector, mesh_data_2d);
 
 MeshManager *mesh_manager_init (MeshManager *mm) {
     RETURN_VALUE_IF (!mm, Null, ERR_INVALID_ARGUMENTS);
 
     RETURN_VALUE_IF (
-        !(mm->mesh_data_2d.data = mesh_data_2d_vector_create (256, &mm->mesh_data_2d.capacity)),
+        !mesh_data_2d_vector_init (&mm->mesh_data_2d, 256),
         Null,
         "Failed to create vector to store mesh"
     );
@@ -65,15 +67,14 @@ MeshManager *mesh_manager_init (MeshManager *mm) {
 MeshManager *mesh_manager_deinit (MeshManager *mm) {
     RETURN_VALUE_IF (!mm, Null, ERR_INVALID_ARGUMENTS);
 
-    if (mm->mesh_data_2d.data) {
-        for (Size s = 0; s < mm->mesh_data_2d.count; s++) {
-            device_buffer_deinit (&mm->mesh_data_2d.data[s].vertex);
-            device_buffer_deinit (&mm->mesh_data_2d.data[s].index);
-        }
-
-        mesh_data_2d_vector_destroy (mm->mesh_data_2d.data);
+    MeshData2D *mesh_data = mesh_data_2d_vector_data (&mm->mesh_data_2d);
+    for (Size s = 0; s < mm->mesh_data_2d.count; s++) {
+        device_buffer_deinit (&mesh_data[s].vertex);
+        device_buffer_deinit (&mesh_data[s].index);
     }
 
+    mesh_data_2d_vector_deinit (&mm->mesh_data_2d);
+
     memset (mm, 0, sizeof (MeshManager));
     return mm;
 }
@@ -81,26 +82,6 @@ MeshManager *mesh_manager_deinit (MeshManager *mm) {
 MeshManager *mesh_manager_upload_mesh_2d (MeshManager *mm, XuiMesh2D *mesh) {
     RETURN_VALUE_IF (!mm || !mesh, Null, ERR_INVALID_ARGUMENTS);
 
-    /* resize if required */
-    if (mm->mesh_data_2d.count >= mm->mesh_data_2d.capacity) {
-        Size        newcap = 0;
-        MeshData2D *tmpbuf = Null;
-        RETURN_VALUE_IF (
-            !(tmpbuf = mesh_data_2d_vector_resize (
-                  mm->mesh_data_2d.data,
-                  mm->mesh_data_2d.count,     /* from count */
-                  mm->mesh_data_2d.count + 1, /* to count */
-                  mm->mesh_data_2d.capacity,  /* from cap */
-                  &newcap                     /* to new cap (automatically set by the function) */
-              )),
-            Null,
-            "Failed to resize vector to store more mesh data\n"
-        );
-
-        mm->mesh_data_2d.data     = tmpbuf;
-        mm->mesh_data_2d.capacity = newcap;
-    }
-
     MeshData2D new_data = {
         .type         = mesh->type,
         .vertex_count = mesh->vertex_count,
@@ -155,7 +136,11 @@ MeshManager *mesh_manager_upload_mesh_2d (MeshManager *mm, XuiMesh2D *mesh) {
     }
 
     /* insert data */
-    mm->mesh_data_2d.data[mm->mesh_data_2d.count++] = new_data;
+    RETURN_VALUE_IF (
+        !mesh_data_2d_vector_push (&mm->mesh_data_2d, &new_data),
+        Null,
+        "Failed to resize vector to store more mesh data\n"
+    );
 
     return mm;
 }
@@ -164,9 +149,10 @@ MeshData2D *mesh_manager_get_mesh_data_by_type_2d (MeshManager *mm, Uint32 type)
     RETURN_VALUE_IF (!mm, Null, ERR_INVALID_ARGUMENTS);
 
     /* TODO: find a way to convert this linear search to binary search */
+    MeshData2D *mesh_data = mesh_data_2d_vector_data (&mm->mesh_data_2d);
     for (Size s = 0; s < mm->mesh_data_2d.count; s++) {
-        if (mm->mesh_data_2d.data[s].type == type) {
-            return mm->mesh_data_2d.data + s;
+        if (mesh_data[s].type == type) {
+            return mesh_data + s;
         }
     }
 
@@ -37,6 +37,7 @@
 
 /* local inclueds */
 #include "Anvie/Common.h"
+#include "Anvie/CrossGui/Utils/Vector.h"
 #include "Device.h"
 
 /* fwd-declaration */
@@ -51,17 +52,15 @@ typedef struct MeshData2D {
     Size         index_count;
 } MeshData2D;
 
+NEW_HEAP_VECTOR_STRUCT (MeshData2D, MeshData2DVector);
+
 typedef struct MeshManager {
     /**
      * @b Mesh data for each mesh type.
      * Mesh data added to this vector stays as long as the application is
      * running (plugin is in use and is kept loaded)
      * */
-    struct {
-        Size        count;
-        Size        capacity;
-        MeshData2D *data;
-    } mesh_data_2d;
+    MeshData2DVector mesh_data_2d;
 } MeshManager;
 
 MeshManager         *mesh_manager_init (MeshManager *mm);
@@ -30,6 +30,8 @@
  * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  * */
 
+#define ALLOCATOR_TAG ALLOCATOR_TAG_PLUGIN
+
 #include <Anvie/Common.h>
 #include <vulkan/vulkan_core.h>
 
@@ -175,16 +177,37 @@ RenderPass *render_pass_init_default (RenderPass *render_pass, Swapchain *swapch
         "Failed to create render targets for render pass\n"
     );
 
-    /* create graphics pipeline for subpass 0 */
+    /* create graphics pipelines for subpass 0 */
     GOTO_HANDLER_IF (
-        !graphics_pipeline_init_default (
-            &render_pass->pipelines.default_graphics,
-            render_pass,
-            swapchain
-        ),
+        !graphics_pipeline_init_default (&render_pass->pipelines.default_graphics, render_pass),
         INIT_FAILED,
         "Failed to create default graphics pipeline for default renderpass.\n"
     );
+    GOTO_HANDLER_IF (
+        !graphics_pipeline_init_primitive_2d (&render_pass->pipelines.primitive_2d, render_pass),
+        INIT_FAILED,
+        "Failed to create primitive 2D graphics pipeline for default renderpass.\n"
+    );
+    GOTO_HANDLER_IF (
+        !graphics_pipeline_init_line_2d (&render_pass->pipelines.line_2d, render_pass),
+        INIT_FAILED,
+        "Failed to create line 2D graphics pipeline for default renderpass.\n"
+    );
+    GOTO_HANDLER_IF (
+        !graphics_pipeline_init_polyline_2d (&render_pass->pipelines.polyline_2d, render_pass),
+        INIT_FAILED,
+        "Failed to create polyline 2D graphics pipeline for default renderpass.\n"
+    );
+    GOTO_HANDLER_IF (
+        !graphics_pipeline_init_text_2d (&render_pass->pipelines.text_2d, render_pass),
+        INIT_FAILED,
+        "Failed to create text 2D graphics pipeline for default renderpass.\n"
+    );
+    GOTO_HANDLER_IF (
+        !graphics_pipeline_init_text_sdf_2d (&render_pass->pipelines.text_sdf_2d, render_pass),
+        INIT_FAILED,
+        "Failed to create SDF text 2D graphics pipeline for default renderpass.\n"
+    );
 
     /* finally register this renderpass to handle swapchain reinit events */
     GOTO_HANDLER_IF (
@@ -286,6 +309,56 @@ RenderPass *render_pass_init_default (RenderPass *render_pass, Swapchain *swapch
             INIT_FAILED,
             "Failed to set debug object name for graphics pipeline in default renderpass\n"
         );
+
+        GOTO_HANDLER_IF (
+            !device_set_object_debug_name (
+                VK_OBJECT_TYPE_PIPELINE,
+                (Uint64)render_pass->pipelines.primitive_2d.pipeline,
+                "Primitive 2D Graphics Pipeline in Default Render Pass"
+            ),
+            INIT_FAILED,
+            "Failed to set debug object name for primitive 2D pipeline in default renderpass\n"
+        );
+
+        GOTO_HANDLER_IF (
+            !device_set_object_debug_name (
+                VK_OBJECT_TYPE_PIPELINE,
+                (Uint64)render_pass->pipelines.line_2d.pipeline,
+                "Line 2D Graphics Pipeline in Default Render Pass"
+            ),
+            INIT_FAILED,
+            "Failed to set debug object name for line 2D pipeline in default renderpass\n"
+        );
+
+        GOTO_HANDLER_IF (
+            !device_set_object_debug_name (
+                VK_OBJECT_TYPE_PIPELINE,
+                (Uint64)render_pass->pipelines.polyline_2d.pipeline,
+                "Polyline 2D Graphics Pipeline in Default Render Pass"
+            ),
+            INIT_FAILED,
+            "Failed to set debug object name for polyline 2D pipeline in default renderpass\n"
+        );
+
+        GOTO_HANDLER_IF (
+            !device_set_object_debug_name (
+                VK_OBJECT_TYPE_PIPELINE,
+                (Uint64)render_pass->pipelines.text_2d.pipeline,
+                "Text 2D Graphics Pipeline in Default Render Pass"
+            ),
+            INIT_FAILED,
+            "Failed to set debug object name for text 2D pipeline in default renderpass\n"
+        );
+
+        GOTO_HANDLER_IF (
+            !device_set_object_debug_name (
+                VK_OBJECT_TYPE_PIPELINE,
+                (Uint64)render_pass->pipelines.text_sdf_2d.pipeline,
+                "SDF Text 2D Graphics Pipeline in Default Render Pass"
+            ),
+            INIT_FAILED,
+            "Failed to set debug object name for SDF text 2D pipeline in default renderpass\n"
+        );
     }
 
     return render_pass;
@@ -309,6 +382,11 @@ RenderPass *render_pass_deinit (RenderPass *render_pass) {
 
     if (render_pass->type == RENDER_PASS_TYPE_DEFAULT) {
         graphics_pipeline_deinit (&render_pass->pipelines.default_graphics);
+        graphics_pipeline_deinit (&render_pass->pipelines.primitive_2d);
+        graphics_pipeline_deinit (&render_pass->pipelines.line_2d);
+        graphics_pipeline_deinit (&render_pass->pipelines.polyline_2d);
+        graphics_pipeline_deinit (&render_pass->pipelines.text_2d);
+        graphics_pipeline_deinit (&render_pass->pipelines.text_sdf_2d);
     }
 
     VkDevice device = vk.device.logical;
@@ -323,6 +401,39 @@ RenderPass *render_pass_deinit (RenderPass *render_pass) {
     return render_pass;
 }
 
+/**
+ * @b Get arena of the frame that'll be recorded next.
+ *
+ * If arena of that frame still belongs to a frame previously submitted with it,
+ * then this waits for that submission to complete and resets the arena first.
+ *
+ * @param render_pass
+ *
+ * @return @c Arena on success.
+ * @return @c Null otherwise.
+ * */
+Arena *render_pass_get_frame_arena (RenderPass *render_pass) {
+    RETURN_VALUE_IF (!render_pass, Null, ERR_INVALID_ARGUMENTS);
+
+    FrameData *frame_data = render_pass->frame_data + (render_pass->frame_index % FRAME_LIMIT);
+
+    if (!frame_data->is_arena_ready) {
+        VkResult res =
+            vkWaitForFences (vk.device.logical, 1, &frame_data->sync.render_fence, True, 1e9);
+        RETURN_VALUE_IF (
+            res != VK_SUCCESS,
+            Null,
+            "Timeout (1s) while waiting for fences. RET = %d\n",
+            res
+        );
+
+        arena_reset (&frame_data->arena);
+        frame_data->is_arena_ready = True;
+    }
+
+    return &frame_data->arena;
+}
+
 /**************************************************************************************************/
 /**************************************** PRIVATE METHODS *****************************************/
 /**************************************************************************************************/
@@ -519,6 +630,13 @@ static inline RenderPass *render_pass_create_frame_data (RenderPass *render_pass
             );
         }
 
+        /* transient memory of frame */
+        RETURN_VALUE_IF (
+            !arena_init (&frame_data->arena, FRAME_ARENA_BLOCK_SIZE, ALLOCATOR_TAG_FRAME_ARENA),
+            Null,
+            "Failed to initialize frame arena\n"
+        );
+
         /* move on to next frame_data */
         frame_data++;
     }
@@ -561,6 +679,8 @@ static inline RenderPass *render_pass_destroy_frame_data (RenderPass *render_pas
             vkDestroySemaphore (device, frame_data->sync.present_semaphore, Null);
         }
 
+        arena_deinit (&frame_data->arena);
+
         frame_data++;
     }
 
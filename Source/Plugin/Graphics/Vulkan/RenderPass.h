@@ -35,6 +35,9 @@
 
 #include <Anvie/Types.h>
 
+/* crossgui-utils */
+#include <Anvie/CrossGui/Utils/Arena.h>
+
 /* vulkan includes */
 #include <vulkan/vulkan.h>
 
@@ -86,10 +89,30 @@ typedef struct FrameData {
          * */
         VkCommandBuffer buffer;
     } command;
+
+    /**
+     * @b Transient host memory for everything built for this frame.
+     *
+     * Reset only after @c render_fence of this frame has signaled, so whatever
+     * the GPU might still be reading from the previous use of this frame is safe.
+     * */
+    Arena arena;
+
+    /**
+     * @b @c True once @c arena has been reset for the frame currently being built.
+     * Cleared when the frame is submitted, so that next use of this @c FrameData
+     * waits for its fence and resets the arena again.
+     * */
+    Bool is_arena_ready;
 } FrameData;
 
 #define FRAME_LIMIT 2
 
+/**
+ * @b Default block size of frame arenas.
+ * */
+#define FRAME_ARENA_BLOCK_SIZE (64 * 1024)
+
 /**
  * @b RenderPass objects are pre-baked for each swapchain.
  * Meaning for each swapchain, there exists a set number of RenderPass objects,
@@ -129,7 +152,15 @@ typedef struct RenderPass {
      * @b Tagged union to store graphics pipelines for different renderpass type.
      * */
     union {
-        GraphicsPipeline default_graphics;
+        /* RENDER_PASS_TYPE_DEFAULT */
+        struct {
+            GraphicsPipeline default_graphics; /**< @b Draws instanced 2D meshes. */
+            GraphicsPipeline primitive_2d;     /**< @b Draws analytic 2D primitives. */
+            GraphicsPipeline line_2d;          /**< @b Draws independent line segments. */
+            GraphicsPipeline polyline_2d;      /**< @b Draws polylines from point streams. */
+            GraphicsPipeline text_2d;          /**< @b Draws glyph quads from glyph atlas. */
+            GraphicsPipeline text_sdf_2d;      /**< @b Draws glyph quads from distance fields. */
+        };
     } pipelines;
 } RenderPass;
 
@@ -137,5 +168,6 @@ RenderPass *render_pass_init_default (RenderPass *rp, Swapchain *swapchain);
 RenderPass *render_pass_deinit (RenderPass *rp);
 Bool        render_pass_wait_frame (RenderPass *rp);
 Bool        render_pass_reset_frame (RenderPass *rp);
+Arena      *render_pass_get_frame_arena (RenderPass *rp);
 
 #endif // ANVIE_CROSSGUI_SOURCE_PLUGIN_GRAPHICS_VULKAN_RENDER_PASS_H
@@ -0,0 +1,110 @@
+/**
+ * @file RenderStats.c
+ * @date Sun, 18th October 2026
+ * @author Siddharth Mishra (admin@brightprogrammer.in)
+ * @copyright Copyright 2024 Siddharth Mishra
+ * @copyright Copyright 2024 Anvie Labs
+ *
+ * Copyright 2024 Siddharth Mishra, Anvie Labs
+ * 
+ * Redistribution and use in source and binary forms, with or without modification, are permitted 
+ * provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+ *    and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions
+ *    and the following disclaimer in the documentation and/or other materials provided with the
+ *    distribution.
+ * 
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse
+ *    or promote products derived from this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND 
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * */
+
+#include <Anvie/Common.h>
+
+/* libc */
+#include <memory.h>
+
+/* local includes */
+#include "RenderStats.h"
+
+/**
+ * @b Reset all statistics, including counters of frame in progress.
+ *
+ * @param stats
+ *
+ * @return @c stats on success.
+ * @return @c Null otherwise.
+ * */
+RenderStats *render_stats_reset (RenderStats *stats) {
+    RETURN_VALUE_IF (!stats, Null, ERR_INVALID_ARGUMENTS);
+
+    /* keep track of reinit count, otherwise first frame after reset will
+     * account for all reinits that ever happened */
+    Uint64 last_swapchain_reinit_count = stats->last_swapchain_reinit_count;
+
+    memset (stats, 0, sizeof (RenderStats));
+    stats->last_swapchain_reinit_count = last_swapchain_reinit_count;
+
+    return stats;
+}
+
+/**
+ * @b Commit counters of frame in progress to the running totals, min and max
+ * and start counting a new frame.
+ *
+ * @param stats
+ * @param swapchain_reinit_count Current value of @c Swapchain::reinit_count
+ *
+ * @return @c stats on success.
+ * @return @c Null otherwise.
+ * */
+RenderStats *render_stats_commit_frame (RenderStats *stats, Uint64 swapchain_reinit_count) {
+    RETURN_VALUE_IF (!stats, Null, ERR_INVALID_ARGUMENTS);
+
+    XuiRenderFrameStats *frame = &stats->frame;
+    XuiRenderStats      *s     = &stats->stats;
+
+    frame->swapchain_reinits           = swapchain_reinit_count - stats->last_swapchain_reinit_count;
+    stats->last_swapchain_reinit_count = swapchain_reinit_count;
+
+    Bool is_first_frame = !s->frame_count;
+
+#define COMMIT_FIELD(field)                                                                        \
+    do {                                                                                           \
+        s->total.field += frame->field;                                                            \
+        s->min.field    = is_first_frame ? frame->field : MIN (s->min.field, frame->field);        \
+        s->max.field    = is_first_frame ? frame->field : MAX (s->max.field, frame->field);        \
+    } while (0)
+
+    COMMIT_FIELD (draw_calls);
+    COMMIT_FIELD (batches);
+    COMMIT_FIELD (instances);
+    COMMIT_FIELD (bytes_uploaded);
+    COMMIT_FIELD (device_allocations);
+    COMMIT_FIELD (swapchain_reinits);
+    COMMIT_FIELD (fence_wait_ns);
+    COMMIT_FIELD (continue_count);
+    COMMIT_FIELD (glyphs_rasterized);
+    COMMIT_FIELD (text_layouts);
+    COMMIT_FIELD (text_layout_bytes);
+
+#undef COMMIT_FIELD
+
+    s->last_frame = *frame;
+    s->frame_count++;
+
+    memset (frame, 0, sizeof (XuiRenderFrameStats));
+
+    return stats;
+}
@@ -0,0 +1,62 @@
+/**
+ * @file RenderStats.h
+ * @date Sun, 18th October 2026
+ * @author Siddharth Mishra (admin@brightprogrammer.in)
+ * @copyright Copyright 2024 Siddharth Mishra
+ * @copyright Copyright 2024 Anvie Labs
+ *
+ * Copyright 2024 Siddharth Mishra, Anvie Labs
+ * 
+ * Redistribution and use in source and binary forms, with or without modification, are permitted 
+ * provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+ *    and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions
+ *    and the following disclaimer in the documentation and/or other materials provided with the
+ *    distribution.
+ * 
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse
+ *    or promote products derived from this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND 
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * */
+
+#ifndef ANVIE_CROSSGUI_SOURCE_PLUGIN_GRAPHICS_VULKAN_RENDER_STATS_H
+#define ANVIE_CROSSGUI_SOURCE_PLUGIN_GRAPHICS_VULKAN_RENDER_STATS_H
+
+#include <Anvie/Types.h>
+
+/* crossgui-graphics-api */
+#include <Anvie/CrossGui/Plugin/Graphics/Api/Stats.h>
+
+/**
+ * @b Statistics of a @c BatchRenderer.
+ *
+ * Renderer code keeps adding to @c frame while a frame is being prepared and
+ * displayed, and commits it into @c stats once the frame is done.
+ * */
+typedef struct RenderStats {
+    XuiRenderStats      stats; /**< @b Committed statistics, this is what user code gets. */
+    XuiRenderFrameStats frame; /**< @b Counters of frame currently in progress. */
+
+    /**
+     * @b Value of @c Swapchain::reinit_count when last frame was committed.
+     * Used to compute number of swapchain reinits that happened during a frame,
+     * irrespective of whether they were triggered by renderer or by a resize.
+     * */
+    Uint64 last_swapchain_reinit_count;
+} RenderStats;
+
+RenderStats *render_stats_reset (RenderStats *stats);
+RenderStats *render_stats_commit_frame (RenderStats *stats, Uint64 swapchain_reinit_count);
+
+#endif // ANVIE_CROSSGUI_SOURCE_PLUGIN_GRAPHICS_VULKAN_RENDER_STATS_H
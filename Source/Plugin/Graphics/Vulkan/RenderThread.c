@@ -0,0 +1,616 @@
+/**
+ * @file RenderThread.c
+ * @date Sun, 18th October 2026
+ * @author Siddharth Mishra (admin@brightprogrammer.in)
+ * @copyright Copyright 2024 Siddharth Mishra
+ * @copyright Copyright 2024 Anvie Labs
+ *
+ * Copyright 2024 Siddharth Mishra, Anvie Labs
+ * 
+ * Redistribution and use in source and binary forms, with or without modification, are permitted 
+ * provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+ *    and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions
+ *    and the following disclaimer in the documentation and/or other materials provided with the
+ *    distribution.
+ * 
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse
+ *    or promote products derived from this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND 
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * */
+
+#define ALLOCATOR_TAG ALLOCATOR_TAG_BATCHES
+
+#include <Anvie/Common.h>
+
+/* libc */
+#include <memory.h>
+
+/* crossgui-utils */
+#include <Anvie/CrossGui/Utils/Profiler.h>
+#include <Anvie/CrossGui/Utils/Vector.h>
+
+/* local includes */
+#include "GraphicsContext.h"
+#include "RenderPass.h"
+#include "RenderThread.h"
+#include "Renderer.h"
+#include "Vulkan.h"
+
+/* data copied into a snapshot starts at this alignment */
+#define FRAME_SNAPSHOT_ALIGNMENT 8
+
+NEW_VECTOR_TYPE (FrameCommand, FrameCommandVector, frame_command);
+NEW_VECTOR_TYPE (Uint8, ByteVector, byte);
+NEW_VECTOR_TYPE (XuiSlot2D, SlotVector, slot);
+NEW_VECTOR_TYPE (SlotEntry2D, SlotEntry2DVector, slot_entry_2d);
+
+/**************************************************************************************************/
+/********************************** PRIVATE METHOD DECLARATIONS ***********************************/
+/**************************************************************************************************/
+
+static void           *render_thread_main (void *arg);
+static Bool            render_thread_wait_snapshot (RenderThread *thread);
+static void            render_thread_draw (RenderThread *thread, FrameSnapshot *snapshot);
+static XuiRenderStatus render_thread_replay (RenderThread *thread, FrameSnapshot *snapshot);
+static RenderThread   *render_thread_deinit (RenderThread *thread);
+static inline Bool     render_thread_is_slot_used (RenderThread *thread, XuiSlot2D slot);
+static inline XuiRenderStatus merge_status (XuiRenderStatus status, XuiRenderStatus other);
+
+/**************************************************************************************************/
+/*********************************** PUBLIC METHOD DEFINITIONS ************************************/
+/**************************************************************************************************/
+
+/**
+ * @b Start drawing frames of given graphics context on a new thread.
+ *
+ * From now on, all calls made on graphics context are recorded on calling
+ * thread, which must be the only thread using graphics context, until
+ * render thread is stopped.
+ *
+ * @param thread
+ * @param gctx Graphics context @c thread is member of.
+ * @param win Window frames are presented to.
+ *
+ * @return @c thread on success.
+ * @return @c Null otherwise.
+ * */
+RenderThread *render_thread_start (RenderThread *thread, XuiGraphicsContext *gctx, XwWindow *win) {
+    RETURN_VALUE_IF (!thread || !gctx || !win, Null, ERR_INVALID_ARGUMENTS);
+    RETURN_VALUE_IF (thread->is_running, Null, "Render thread is already running\n");
+
+    memset (thread, 0, sizeof (RenderThread));
+
+    thread->gctx     = gctx;
+    thread->win      = win;
+    thread->building = 0;
+    thread->drawing  = 1;
+    atomic_init (&thread->ready, 2);
+    atomic_init (&thread->is_waiting, False);
+    atomic_init (&thread->is_stopping, False);
+    atomic_init (&thread->status, XUI_RENDER_STATUS_OK);
+
+    pthread_mutex_init (&thread->mutex, Null);
+    pthread_cond_init (&thread->snapshot_ready, Null);
+    pthread_mutex_init (&thread->renderer_mutex, Null);
+    pthread_mutex_init (&thread->stats_mutex, Null);
+
+    GOTO_HANDLER_IF (
+        !arena_init (&thread->scratch, FRAME_ARENA_BLOCK_SIZE, ALLOCATOR_TAG_FRAME_ARENA),
+        START_FAILED,
+        "Failed to create frame scratch arena for render thread\n"
+    );
+
+    /* slot allocator is mirrored from renderer, with slots created before render thread */
+    {
+        SlotBatch2D *slots = &gctx->batch_renderer.slots_2d;
+
+        GOTO_HANDLER_IF (
+            !byte_vector_resize (&thread->used_slots, slots->entries.count, False) ||
+                !slot_vector_append (
+                    &thread->free_slots,
+                    slot_vector_data (&slots->free_slots),
+                    slots->free_slots.count
+                ),
+            START_FAILED,
+            "Failed to copy slots of renderer\n"
+        );
+
+        SlotEntry2D *entries = slot_entry_2d_vector_data (&slots->entries);
+        for (Size s = 0; s < slots->entries.count; s++) {
+            byte_vector_data (&thread->used_slots)[s] = entries[s].is_used;
+        }
+        thread->slot_count = slots->entries.count;
+    }
+
+    thread->stats = gctx->batch_renderer.stats.stats;
+
+    GOTO_HANDLER_IF (
+        pthread_create (&thread->thread, Null, render_thread_main, thread),
+        START_FAILED,
+        "Failed to create render thread\n"
+    );
+    thread->is_running = True;
+
+    return thread;
+
+START_FAILED:
+    render_thread_deinit (thread);
+    return Null;
+}
+
+/**
+ * @b Stop render thread, after it draws last frame handed over to it.
+ *
+ * Calls recorded after last display are applied to renderer directly, so
+ * they're drawn by next display, made on calling thread.
+ *
+ * @param thread
+ *
+ * @return @c thread on success.
+ * @return @c Null otherwise.
+ * */
+RenderThread *render_thread_stop (RenderThread *thread) {
+    RETURN_VALUE_IF (!thread, Null, ERR_INVALID_ARGUMENTS);
+    RETURN_VALUE_IF (!thread->is_running, Null, "Render thread is not running\n");
+
+    pthread_mutex_lock (&thread->mutex);
+    atomic_store (&thread->is_stopping, True);
+    pthread_cond_signal (&thread->snapshot_ready);
+    pthread_mutex_unlock (&thread->mutex);
+
+    pthread_join (thread->thread, Null);
+    thread->is_running = False;
+
+    pthread_mutex_lock (&vk.resource_mutex);
+    XuiRenderStatus status = render_thread_replay (thread, thread->snapshots + thread->building);
+    pthread_mutex_unlock (&vk.resource_mutex);
+
+    if (status == XUI_RENDER_STATUS_ERR) {
+        PRINT_ERR ("Failed to apply calls recorded after last display\n");
+    }
+
+    render_thread_deinit (thread);
+
+    return thread;
+}
+
+/**
+ * @b Record given command into snapshot being built.
+ *
+ * @param thread
+ * @param command Command to record. @c offset is set if @c bytes are given.
+ * @param bytes Data command points to, copied into snapshot, followed by a
+ *        NUL byte. Can be @c Null if @c size is zero.
+ * @param size Size of @c bytes.
+ *
+ * @return @c thread on success.
+ * @return @c Null otherwise.
+ * */
+RenderThread *render_thread_record (
+    RenderThread *thread,
+    FrameCommand *command,
+    const void   *bytes,
+    Size          size
+) {
+    RETURN_VALUE_IF (!thread || !command || (size && !bytes), Null, ERR_INVALID_ARGUMENTS);
+
+    FrameSnapshot *snapshot   = thread->snapshots + thread->building;
+    Size           byte_count = snapshot->bytes.count;
+
+    if (bytes) {
+        Size offset = (byte_count + FRAME_SNAPSHOT_ALIGNMENT - 1) &
+                      ~(Size)(FRAME_SNAPSHOT_ALIGNMENT - 1);
+        RETURN_VALUE_IF (
+            !byte_vector_resize (&snapshot->bytes, offset + size + 1, False),
+            Null,
+            "Failed to resize vector to store data of recorded command\n"
+        );
+
+        Uint8 *data = byte_vector_data (&snapshot->bytes) + offset;
+        memcpy (data, bytes, size);
+        data[size]      = 0;
+        command->offset = offset;
+    }
+
+    if (!frame_command_vector_push (&snapshot->commands, command)) {
+        snapshot->bytes.count = byte_count;
+        PRINT_ERR ("Failed to resize vector to store recorded command\n");
+        return Null;
+    }
+
+    return thread;
+}
+
+/**
+ * @b Hand snapshot being built over to render thread, if it has taken
+ * previous one, otherwise keep building same snapshot. Never waits.
+ *
+ * @param thread
+ *
+ * @return Worst status of frames drawn since previous call.
+ * */
+XuiRenderStatus render_thread_publish (RenderThread *thread) {
+    RETURN_VALUE_IF (!thread, XUI_RENDER_STATUS_ERR, ERR_INVALID_ARGUMENTS);
+
+    PROFILE_ZONE ("render_thread_publish");
+
+    /* only this thread marks a snapshot fresh, so it can't become fresh after this check */
+    if (!(atomic_load (&thread->ready) & RENDER_THREAD_SNAPSHOT_FRESH)) {
+        thread->building =
+            atomic_exchange (&thread->ready, thread->building | RENDER_THREAD_SNAPSHOT_FRESH);
+
+        FrameSnapshot *snapshot = thread->snapshots + thread->building;
+        frame_command_vector_clear (&snapshot->commands);
+        byte_vector_clear (&snapshot->bytes);
+
+        if (atomic_load (&thread->is_waiting)) {
+            pthread_mutex_lock (&thread->mutex);
+            pthread_cond_signal (&thread->snapshot_ready);
+            pthread_mutex_unlock (&thread->mutex);
+        }
+    }
+
+    /* everything allocated from scratch memory was copied into snapshot when recorded */
+    arena_reset (&thread->scratch);
+
+    return atomic_exchange (&thread->status, XUI_RENDER_STATUS_OK);
+}
+
+/**
+ * @b Create a slot with same handle renderer gives when creation is replayed.
+ *
+ * @param thread
+ *
+ * @return Handle of new slot on success.
+ * @return Zero otherwise.
+ * */
+XuiSlot2D render_thread_create_slot (RenderThread *thread) {
+    RETURN_VALUE_IF (!thread, 0, ERR_INVALID_ARGUMENTS);
+
+    /* picked same way renderer picks it, last freed slot first */
+    Bool      is_reused = !!thread->free_slots.count;
+    XuiSlot2D slot      = (XuiSlot2D)thread->slot_count + 1;
+    if (is_reused) {
+        slot = slot_vector_data (&thread->free_slots)[thread->free_slots.count - 1];
+    }
+
+    RETURN_VALUE_IF (
+        !byte_vector_resize (&thread->used_slots, MAX (thread->slot_count, slot), False),
+        0,
+        "Failed to resize vector to store more slots\n"
+    );
+
+    FrameCommand command = {.type = FRAME_COMMAND_TYPE_SLOT_CREATE_2D, .slot = slot};
+    RETURN_VALUE_IF (
+        !render_thread_record (thread, &command, Null, 0),
+        0,
+        "Failed to record creation of slot\n"
+    );
+
+    if (is_reused) {
+        thread->free_slots.count--;
+    } else {
+        thread->slot_count++;
+    }
+    byte_vector_data (&thread->used_slots)[slot - 1] = True;
+
+    return slot;
+}
+
+/**
+ * @b Record new content of given slot. Content is checked when it's replayed,
+ * and an error is reported by a later display.
+ *
+ * @param thread
+ * @param slot
+ * @param content
+ *
+ * @return @c thread on success.
+ * @return @c Null otherwise.
+ * */
+RenderThread *render_thread_update_slot (
+    RenderThread     *thread,
+    XuiSlot2D         slot,
+    XuiSlotContent2D *content
+) {
+    RETURN_VALUE_IF (!thread || !content, Null, ERR_INVALID_ARGUMENTS);
+    RETURN_VALUE_IF (!render_thread_is_slot_used (thread, slot), Null, "Invalid slot %u\n", slot);
+    RETURN_VALUE_IF (
+        content->type >= XUI_SLOT_TYPE_2D_MAX,
+        Null,
+        "Invalid slot content type %u\n",
+        content->type
+    );
+
+    FrameCommand command = {
+        .type    = FRAME_COMMAND_TYPE_SLOT_UPDATE_2D,
+        .slot    = slot,
+        .content = *content
+    };
+    return render_thread_record (thread, &command, Null, 0);
+}
+
+/**
+ * @b Record destruction of given slot, and free it's handle for reuse.
+ *
+ * @param thread
+ * @param slot
+ *
+ * @return @c thread on success.
+ * @return @c Null otherwise.
+ * */
+RenderThread *render_thread_destroy_slot (RenderThread *thread, XuiSlot2D slot) {
+    RETURN_VALUE_IF (!thread, Null, ERR_INVALID_ARGUMENTS);
+    RETURN_VALUE_IF (!render_thread_is_slot_used (thread, slot), Null, "Invalid slot %u\n", slot);
+
+    /* handle must be freed once destruction is recorded, so space for it is made first */
+    RETURN_VALUE_IF (
+        !slot_vector_reserve (&thread->free_slots, thread->free_slots.count + 1),
+        Null,
+        "Failed to resize vector to store free slots\n"
+    );
+
+    FrameCommand command = {.type = FRAME_COMMAND_TYPE_SLOT_DESTROY_2D, .slot = slot};
+    RETURN_VALUE_IF (
+        !render_thread_record (thread, &command, Null, 0),
+        Null,
+        "Failed to record destruction of slot\n"
+    );
+
+    slot_vector_push (&thread->free_slots, &slot);
+    byte_vector_data (&thread->used_slots)[slot - 1] = False;
+
+    return thread;
+}
+
+/**
+ * @b Get statistics of renderer, as they were after last frame drawn.
+ *
+ * @param thread
+ * @param stats Where statistics are copied to.
+ *
+ * @return @c thread on success.
+ * @return @c Null otherwise.
+ * */
+RenderThread *render_thread_get_stats (RenderThread *thread, XuiRenderStats *stats) {
+    RETURN_VALUE_IF (!thread || !stats, Null, ERR_INVALID_ARGUMENTS);
+
+    pthread_mutex_lock (&thread->stats_mutex);
+    *stats = thread->stats;
+    pthread_mutex_unlock (&thread->stats_mutex);
+
+    return thread;
+}
+
+/**************************************************************************************************/
+/*********************************** PRIVATE METHOD DEFINITIONS ***********************************/
+/**************************************************************************************************/
+
+static void *render_thread_main (void *arg) {
+    RenderThread *thread = arg;
+
+    PROFILE_THREAD_NAME ("render");
+
+    while (render_thread_wait_snapshot (thread)) {
+        /* snapshot drawn last is given back in place of fresh one */
+        thread->drawing = atomic_exchange (&thread->ready, thread->drawing) &
+                          ~RENDER_THREAD_SNAPSHOT_FRESH;
+        render_thread_draw (thread, thread->snapshots + thread->drawing);
+    }
+
+    return Null;
+}
+
+/**
+ * @b Wait until a fresh snapshot is handed over, or render thread is stopped.
+ *
+ * @return @c True if a fresh snapshot is ready, even when stopping.
+ * @return @c False if render thread must exit.
+ * */
+static Bool render_thread_wait_snapshot (RenderThread *thread) {
+    if (atomic_load (&thread->ready) & RENDER_THREAD_SNAPSHOT_FRESH) {
+        return True;
+    }
+
+    PROFILE_WAIT_ZONE ("render_thread_wait_snapshot");
+
+    /* UI thread checks is_waiting after handing over, so one of us sees the other */
+    pthread_mutex_lock (&thread->mutex);
+    atomic_store (&thread->is_waiting, True);
+    while (!(atomic_load (&thread->ready) & RENDER_THREAD_SNAPSHOT_FRESH) &&
+           !atomic_load (&thread->is_stopping)) {
+        pthread_cond_wait (&thread->snapshot_ready, &thread->mutex);
+    }
+    atomic_store (&thread->is_waiting, False);
+    pthread_mutex_unlock (&thread->mutex);
+
+    return !!(atomic_load (&thread->ready) & RENDER_THREAD_SNAPSHOT_FRESH);
+}
+
+/**
+ * @b Replay given snapshot into renderer and display it. Errors are kept in
+ * @c status, to be returned by next display on UI thread.
+ * */
+static void render_thread_draw (RenderThread *thread, FrameSnapshot *snapshot) {
+    PROFILE_ZONE ("render_thread_draw");
+
+    XuiGraphicsContext *gctx     = thread->gctx;
+    BatchRenderer      *renderer = &gctx->batch_renderer;
+
+    pthread_mutex_lock (&thread->renderer_mutex);
+
+    /* replayed draws read shared meshes and fonts, display takes the lock
+     * itself, only while it's needed, and never across fence waits */
+    pthread_mutex_lock (&vk.resource_mutex);
+    XuiRenderStatus status = render_thread_replay (thread, snapshot);
+    pthread_mutex_unlock (&vk.resource_mutex);
+
+    XuiRenderStatus displayed = batch_renderer_display (renderer, &gctx->swapchain, thread->win);
+    status                    = merge_status (status, displayed);
+
+    pthread_mutex_lock (&thread->stats_mutex);
+    thread->stats = renderer->stats.stats;
+    pthread_mutex_unlock (&thread->stats_mutex);
+
+    pthread_mutex_unlock (&thread->renderer_mutex);
+
+    /* only this thread makes status worse, UI thread only resets it */
+    /* UI thread may reset status in between, then it's merged again */
+    Uint32 last = atomic_load (&thread->status);
+    while (!atomic_compare_exchange_weak (&thread->status, &last, merge_status (last, status))) {
+        continue;
+    }
+}
+
+/**
+ * @b Apply calls recorded in given snapshot to renderer, in order they were
+ * made. Replay continues after a failed call, like it would have without
+ * a render thread. Called with @c vk.resource_mutex held.
+ *
+ * @return Worst status of replayed calls.
+ * */
+static XuiRenderStatus render_thread_replay (RenderThread *thread, FrameSnapshot *snapshot) {
+    PROFILE_ZONE ("render_thread_replay");
+
+    XuiGraphicsContext *gctx     = thread->gctx;
+    BatchRenderer      *renderer = &gctx->batch_renderer;
+    FrameCommand       *commands = frame_command_vector_data (&snapshot->commands);
+    Uint8              *bytes    = byte_vector_data (&snapshot->bytes);
+
+    XuiRenderStatus status = XUI_RENDER_STATUS_OK;
+    for (Size c = 0; c < snapshot->commands.count; c++) {
+        FrameCommand   *command = commands + c;
+        XuiRenderStatus res     = XUI_RENDER_STATUS_OK;
+        Bool            is_ok   = True;
+
+        switch (command->type) {
+            case FRAME_COMMAND_TYPE_DRAW_2D : {
+                res = batch_renderer_draw_2d (renderer, &command->mesh);
+                break;
+            }
+            case FRAME_COMMAND_TYPE_DRAW_PRIMITIVE_2D : {
+                res = batch_renderer_draw_primitive_2d (renderer, &command->primitive);
+                break;
+            }
+            case FRAME_COMMAND_TYPE_DRAW_LINE_2D : {
+                res = batch_renderer_draw_line_2d (renderer, &command->line);
+                break;
+            }
+            case FRAME_COMMAND_TYPE_DRAW_POLYLINE_2D : {
+                command->polyline.points = (Vec2f *)(bytes + command->offset);
+                res = batch_renderer_draw_polyline_2d (renderer, &command->polyline);
+                break;
+            }
+            case FRAME_COMMAND_TYPE_DRAW_TEXT_2D : {
+                command->text.text = (CString)(bytes + command->offset);
+                res                = batch_renderer_draw_text_2d (renderer, &command->text);
+                break;
+            }
+            case FRAME_COMMAND_TYPE_SET_VIEW_2D : {
+                is_ok = !!batch_renderer_set_view_2d (
+                    renderer,
+                    command->is_view_set ? &command->view : Null
+                );
+                break;
+            }
+            case FRAME_COMMAND_TYPE_SLOT_CREATE_2D : {
+                XuiSlot2D slot = slot_batch_create_slot_2d (&renderer->slots_2d);
+                is_ok          = slot == command->slot;
+                if (slot && !is_ok) {
+                    PRINT_ERR ("Slot %u created by renderer, instead of %u\n", slot, command->slot);
+                }
+                break;
+            }
+            case FRAME_COMMAND_TYPE_SLOT_UPDATE_2D : {
+                is_ok = !!slot_batch_update_slot_2d (
+                    &renderer->slots_2d,
+                    command->slot,
+                    &command->content
+                );
+                break;
+            }
+            case FRAME_COMMAND_TYPE_SLOT_DESTROY_2D : {
+                is_ok = !!slot_batch_destroy_slot_2d (&renderer->slots_2d, command->slot);
+                break;
+            }
+            case FRAME_COMMAND_TYPE_CLEAR : {
+                /* clear waits for a fence, and takes the lock itself to submit */
+                pthread_mutex_unlock (&vk.resource_mutex);
+                res = batch_renderer_clear (renderer, &gctx->swapchain, command->win);
+                pthread_mutex_lock (&vk.resource_mutex);
+                break;
+            }
+            case FRAME_COMMAND_TYPE_RESIZE : {
+                is_ok = !!swapchain_reinit (&gctx->swapchain, command->win);
+                break;
+            }
+            case FRAME_COMMAND_TYPE_RESET_STATS : {
+                is_ok = !!render_stats_reset (&renderer->stats);
+                break;
+            }
+            case FRAME_COMMAND_TYPE_RESET_2D : {
+                is_ok = !!batch_renderer_reset_batches_2d (renderer);
+                break;
+            }
+            default : {
+                PRINT_ERR ("Invalid frame command type %u\n", command->type);
+                is_ok = False;
+                break;
+            }
+        }
+
+        status = merge_status (status, is_ok ? res : XUI_RENDER_STATUS_ERR);
+    }
+
+    return status;
+}
+
+/**
+ * @b Free everything owned by render thread. Thread must not be running.
+ * */
+static RenderThread *render_thread_deinit (RenderThread *thread) {
+    for (Size s = 0; s < RENDER_THREAD_SNAPSHOT_COUNT; s++) {
+        frame_command_vector_deinit (&thread->snapshots[s].commands);
+        byte_vector_deinit (&thread->snapshots[s].bytes);
+    }
+
+    slot_vector_deinit (&thread->free_slots);
+    byte_vector_deinit (&thread->used_slots);
+
+    arena_deinit (&thread->scratch);
+
+    pthread_mutex_destroy (&thread->mutex);
+    pthread_cond_destroy (&thread->snapshot_ready);
+    pthread_mutex_destroy (&thread->renderer_mutex);
+    pthread_mutex_destroy (&thread->stats_mutex);
+
+    memset (thread, 0, sizeof (RenderThread));
+
+    return thread;
+}
+
+static inline Bool render_thread_is_slot_used (RenderThread *thread, XuiSlot2D slot) {
+    return slot && slot <= thread->slot_count && byte_vector_data (&thread->used_slots)[slot - 1];
+}
+
+/**
+ * @b Worse of two statuses, an error is worse than having to continue.
+ * */
+static inline XuiRenderStatus merge_status (XuiRenderStatus status, XuiRenderStatus other) {
+    if (status == XUI_RENDER_STATUS_ERR || other == XUI_RENDER_STATUS_ERR) {
+        return XUI_RENDER_STATUS_ERR;
+    }
+    return status == XUI_RENDER_STATUS_OK ? other : status;
+}
@@ -0,0 +1,185 @@
+/**
+ * @file RenderThread.h
+ * @date Sun, 18th October 2026
+ * @author Siddharth Mishra (admin@brightprogrammer.in)
+ * @copyright Copyright 2024 Siddharth Mishra
+ * @copyright Copyright 2024 Anvie Labs
+ *
+ * Copyright 2024 Siddharth Mishra, Anvie Labs
+ * 
+ * Redistribution and use in source and binary forms, with or without modification, are permitted 
+ * provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+ *    and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions
+ *    and the following disclaimer in the documentation and/or other materials provided with the
+ *    distribution.
+ * 
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse
+ *    or promote products derived from this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND 
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * */
+
+#ifndef ANVIE_CROSSGUI_SOURCE_PLUGIN_GRAPHICS_VULKAN_RENDER_THREAD_H
+#define ANVIE_CROSSGUI_SOURCE_PLUGIN_GRAPHICS_VULKAN_RENDER_THREAD_H
+
+#include <Anvie/Types.h>
+
+/* libc */
+#include <pthread.h>
+#include <stdatomic.h>
+
+/* crossgui-graphics-api */
+#include <Anvie/CrossGui/Plugin/Graphics/Api/Common.h>
+#include <Anvie/CrossGui/Plugin/Graphics/Api/Line2D.h>
+#include <Anvie/CrossGui/Plugin/Graphics/Api/Mesh2D.h>
+#include <Anvie/CrossGui/Plugin/Graphics/Api/Primitive2D.h>
+#include <Anvie/CrossGui/Plugin/Graphics/Api/Slot2D.h>
+#include <Anvie/CrossGui/Plugin/Graphics/Api/Stats.h>
+#include <Anvie/CrossGui/Plugin/Graphics/Api/Text2D.h>
+
+/* crossgui-utils */
+#include <Anvie/CrossGui/Utils/Arena.h>
+#include <Anvie/CrossGui/Utils/Vector.h>
+
+/* local includes */
+#include "Renderer.h"
+
+/* fwd declarations */
+typedef struct XuiGraphicsContext XuiGraphicsContext;
+typedef struct XwWindow           XwWindow;
+
+/**
+ * @b One snapshot is built by UI thread, one is drawn by render thread, and
+ * last one is handed from one to the other.
+ * */
+#define RENDER_THREAD_SNAPSHOT_COUNT 3
+
+/**
+ * @b Set in index of handed over snapshot, until render thread takes it.
+ * */
+#define RENDER_THREAD_SNAPSHOT_FRESH (1u << 31)
+
+/**
+ * @b Calls made on UI thread, recorded to be replayed by render thread in same order.
+ * */
+typedef enum FrameCommandType {
+    FRAME_COMMAND_TYPE_NONE = 0,
+    FRAME_COMMAND_TYPE_DRAW_2D,
+    FRAME_COMMAND_TYPE_DRAW_PRIMITIVE_2D,
+    FRAME_COMMAND_TYPE_DRAW_LINE_2D,
+    FRAME_COMMAND_TYPE_DRAW_POLYLINE_2D,
+    FRAME_COMMAND_TYPE_DRAW_TEXT_2D,
+    FRAME_COMMAND_TYPE_SET_VIEW_2D,
+    FRAME_COMMAND_TYPE_SLOT_CREATE_2D,
+    FRAME_COMMAND_TYPE_SLOT_UPDATE_2D,
+    FRAME_COMMAND_TYPE_SLOT_DESTROY_2D,
+    FRAME_COMMAND_TYPE_CLEAR,
+    FRAME_COMMAND_TYPE_RESIZE,
+    FRAME_COMMAND_TYPE_RESET_STATS,
+    FRAME_COMMAND_TYPE_RESET_2D,
+    FRAME_COMMAND_TYPE_MAX
+} FrameCommandType;
+
+typedef struct FrameCommand {
+    Uint32    type;   /**< @b One of @c FrameCommandType, selects member of union. */
+    XuiSlot2D slot;   /**< @b Slot created, updated or destroyed. */
+    Size      offset; /**< @b Where points of polyline or text of text are in snapshot bytes. */
+    Bool      is_view_set;
+
+    union {
+        XuiMeshInstance2D mesh;
+        XuiPrimitive2D    primitive;
+        XuiLineSegment2D  line;
+        XuiPolyline2D     polyline;
+        XuiText2D         text;
+        XuiView2D         view;
+        XuiSlotContent2D  content;
+        XwWindow         *win; /**< @b Window cleared or resized. */
+    };
+} FrameCommand;
+
+NEW_HEAP_VECTOR_STRUCT (FrameCommand, FrameCommandVector);
+
+/**
+ * @b Everything that changed on UI thread since last snapshot was handed over.
+ *
+ * Draws add to what renderer draws, just like they do without a render
+ * thread, so snapshots are deltas and none of them can be skipped.
+ * */
+typedef struct FrameSnapshot {
+    FrameCommandVector commands;
+    ByteVector         bytes; /**< @b Data commands point to, copied when they're recorded. */
+} FrameSnapshot;
+
+/**
+ * @b Thread owned by plugin, uploading, recording, submitting and presenting
+ * frames of a graphics context, so that UI thread never waits for GPU.
+ *
+ * UI thread records it's calls into a snapshot. On display, snapshot is
+ * handed over by swapping it's index with an atomic exchange, only if render
+ * thread has taken previous one. Otherwise UI thread keeps recording into
+ * same snapshot, and it's handed over with next display. Render thread takes
+ * latest snapshot the same way, replays it into renderer and displays it.
+ * Neither thread ever waits for the other, except when render thread has
+ * nothing to do.
+ *
+ * Slots are created on UI thread, by mirroring slot allocator of renderer,
+ * which gives same handles when create and destroy are replayed in order.
+ * */
+typedef struct RenderThread {
+    FrameSnapshot    snapshots[RENDER_THREAD_SNAPSHOT_COUNT];
+    Uint32           building; /**< @b Snapshot being recorded, UI thread only. */
+    Uint32           drawing;  /**< @b Snapshot being drawn, render thread only. */
+    _Atomic (Uint32) ready;    /**< @b Snapshot handed over, may be marked fresh. */
+
+    XuiGraphicsContext *gctx;
+    XwWindow           *win; /**< @b Window frames are presented to. */
+    pthread_t           thread;
+    Bool                is_running;
+
+    pthread_mutex_t  mutex;
+    pthread_cond_t   snapshot_ready; /**< @b Signalled when a fresh snapshot is handed over. */
+    _Atomic (Bool)   is_waiting;     /**< @b Render thread waits for @c snapshot_ready. */
+    _Atomic (Bool)   is_stopping;
+    _Atomic (Uint32) status;         /**< @b Status of frames drawn since last display. */
+
+    pthread_mutex_t renderer_mutex; /**< @b Held while renderer is used by render thread. */
+    pthread_mutex_t stats_mutex;
+    XuiRenderStats  stats;          /**< @b Statistics of renderer after last frame drawn. */
+
+    Arena      scratch;    /**< @b Frame scratch memory of UI thread. */
+    Size       slot_count; /**< @b Number of slot handles ever given out. */
+    SlotVector free_slots;
+    ByteVector used_slots; /**< @b Non-zero for each slot in use. */
+} RenderThread;
+
+RenderThread   *render_thread_start (RenderThread *thread, XuiGraphicsContext *gctx, XwWindow *win);
+RenderThread   *render_thread_stop (RenderThread *thread);
+RenderThread   *render_thread_record (
+    RenderThread *thread,
+    FrameCommand *command,
+    const void   *bytes,
+    Size          size
+);
+XuiRenderStatus render_thread_publish (RenderThread *thread);
+XuiSlot2D       render_thread_create_slot (RenderThread *thread);
+RenderThread   *render_thread_update_slot (
+    RenderThread     *thread,
+    XuiSlot2D         slot,
+    XuiSlotContent2D *content
+);
+RenderThread   *render_thread_destroy_slot (RenderThread *thread, XuiSlot2D slot);
+RenderThread   *render_thread_get_stats (RenderThread *thread, XuiRenderStats *stats);
+
+#endif // ANVIE_CROSSGUI_SOURCE_PLUGIN_GRAPHICS_VULKAN_RENDER_THREAD_H
@@ -30,22 +30,41 @@
  * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  * */
 
+#define ALLOCATOR_TAG ALLOCATOR_TAG_BATCHES
+
 #include <Anvie/Common.h>
 
 /* crossgui-utils */
+#include <Anvie/CrossGui/Utils/DrawKey.h>
+#include <Anvie/CrossGui/Utils/Profiler.h>
+#include <Anvie/CrossGui/Utils/RadixSort.h>
+#include <Anvie/CrossGui/Utils/Unicode.h>
 #include <Anvie/CrossGui/Utils/Vector.h>
 
 /* crossgui-graphics-api */
+#include <Anvie/CrossGui/Plugin/Graphics/Api/Line2D.h>
 #include <Anvie/CrossGui/Plugin/Graphics/Api/Mesh2D.h>
+#include <Anvie/CrossGui/Plugin/Graphics/Api/Primitive2D.h>
+#include <Anvie/CrossGui/Plugin/Graphics/Api/Slot2D.h>
+#include <Anvie/CrossGui/Plugin/Graphics/Api/Text2D.h>
 
 /* libc */
+#include <math.h>
 #include <memory.h>
+#include <stdalign.h>
+#include <stdatomic.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
 
 /* local includes */
 #include "Device.h"
+#include "FontManager.h"
+#include "GlyphCache.h"
 #include "GraphicsContext.h"
 #include "MeshManager.h"
 #include "RenderPass.h"
+#include "RenderThread.h"
 #include "Renderer.h"
 #include "Swapchain.h"
 #include "Vulkan.h"
@@ -54,8 +73,26 @@ typedef struct BeginEndInfo {
     FrameData    *frame_data;
     VkFramebuffer framebuffer;
     Uint32        image_index;
+    Uint64        fence_wait_ns; /**< @b Time spent waiting for render fence of this frame. */
 } BeginEndInfo;
 
+/**
+ * @b Staging calling thread used last, looked up again only when it draws
+ * into another renderer.
+ * */
+typedef struct ThreadStaging2D {
+    Uint64             renderer_id;
+    InstanceStaging2D *staging;
+} ThreadStaging2D;
+
+static _Thread_local ThreadStaging2D this_thread_staging = {0};
+
+/* id of next renderer created, zero is never used */
+static _Atomic (Uint64) next_renderer_id = 1;
+
+/* value of a sort key is index of instance, with this bit set if instance is a primitive */
+#define SORT_VALUE_PRIMITIVE (1u << 31)
+
 /**************************************************************************************************/
 /********************************** PRIVATE METHOD DECLARATIONS ***********************************/
 /**************************************************************************************************/
@@ -72,20 +109,81 @@ static XuiRenderStatus end_frame (
     XwWindow     *win,
     BeginEndInfo *end_info
 );
-
-NEW_VECTOR_TYPE (MeshInstanceBatch2D, mesh_instance_batch_2d);
-NEW_VECTOR_TYPE (XuiMeshInstance2D, mesh_instance_2d);
+static Mat4f  *get_view_transform_2d (Mat4f *res, BatchRenderer *renderer, VkExtent2D extent);
+static Float32 get_view_scale_2d (BatchRenderer *renderer);
+static Bool    upload_to_device_buffer (DeviceBuffer *buffer, void *data, Size size);
+static TextBatch2D *text_batch_add_sdf_glyphs_2d (
+    TextBatch2D *batch,
+    TextLayout  *layout,
+    FontData    *font_data,
+    Uint64      *glyphs_generated
+);
+static TextLayout *text_batch_layout_text_2d (
+    TextBatch2D   *batch,
+    TextLayoutKey *key,
+    FontData      *font_data,
+    Uint64        *glyphs_rasterized
+);
+static inline Bool is_line_terminator (Uint32 codepoint);
+static SlotEntry2D *slot_batch_get_entry_2d (SlotBatch2D *batch, XuiSlot2D slot);
+static SlotGroup2D *
+    slot_batch_get_group_2d (SlotBatch2D *batch, Uint32 slot_type, Uint32 mesh_type);
+static void        slot_batch_remove_content_2d (SlotBatch2D *batch, SlotEntry2D *entry);
+static inline void slot_group_mark_dirty_2d (SlotGroup2D *group, Size index);
+static inline void slot_group_mark_clean_2d (SlotGroup2D *group);
+static StagingRun2D *instance_staging_get_run_2d (InstanceStaging2D *staging);
+static int          compare_staging_runs_2d (const void *a, const void *b);
+static Bool         batch_renderer_merge_sorted_2d (
+    BatchRenderer      *renderer,
+    RenderThread       *thread,
+    InstanceStaging2D **stagings,
+    StagingRun2D       *runs,
+    Size                run_count
+);
+static Bool batch_renderer_add_staged_mesh_2d (
+    BatchRenderer        *renderer,
+    RenderThread         *thread,
+    XuiMeshInstance2D    *mesh,
+    MeshInstanceBatch2D **batch
+);
+static Bool batch_renderer_add_staged_primitive_2d (
+    BatchRenderer  *renderer,
+    RenderThread   *thread,
+    XuiPrimitive2D *primitive
+);
+static inline DrawPass get_mesh_pass_2d (XuiMeshInstance2D *mesh);
+
+NEW_VECTOR_TYPE (MeshInstanceBatch2D, MeshInstanceBatch2DVector, mesh_instance_batch_2d);
+NEW_VECTOR_TYPE (XuiMeshInstance2D, MeshInstance2DVector, mesh_instance_2d);
+NEW_VECTOR_TYPE (XuiPrimitive2D, Primitive2DVector, primitive_2d);
+NEW_VECTOR_TYPE (XuiLineSegment2D, LineSegment2DVector, line_segment_2d);
+NEW_VECTOR_TYPE (Vec2f, Vec2fVector, vec2f);
+NEW_VECTOR_TYPE (PolylineDraw2D, PolylineDraw2DVector, polyline_draw_2d);
+NEW_VECTOR_TYPE (GlyphInstance2D, GlyphInstance2DVector, glyph_instance_2d);
+NEW_VECTOR_TYPE (Uint32, GlyphIndexVector, glyph_index);
+NEW_VECTOR_TYPE (TextLayoutGlyph, TextLayoutGlyphVector, text_layout_glyph);
+NEW_VECTOR_TYPE (Uint32, CodepointVector, codepoint);
+NEW_VECTOR_TYPE (Uint8, LineBreakVector, line_break);
+NEW_VECTOR_TYPE (Uint8, ByteVector, byte);
+NEW_VECTOR_TYPE (XuiSlot2D, SlotVector, slot);
+NEW_VECTOR_TYPE (SlotGroup2D, SlotGroup2DVector, slot_group_2d);
+NEW_VECTOR_TYPE (SlotEntry2D, SlotEntry2DVector, slot_entry_2d);
+NEW_VECTOR_TYPE (StagingRun2D, StagingRun2DVector, staging_run_2d);
+NEW_VECTOR_TYPE (Uint64, SortKeyVector, sort_key);
+NEW_VECTOR_TYPE (Uint32, SortValueVector, sort_value);
+NEW_VECTOR_TYPE (InstanceStaging2D *, InstanceStaging2DVector, instance_staging_2d);
 
 /**************************************************************************************************/
 /***************************** MESH INSTANCE BATCH 2D PUBLIC METHODS ******************************/
 /**************************************************************************************************/
 
-MeshInstanceBatch2D *mesh_instance_batch_init_2d (MeshInstanceBatch2D *batch, Uint32 type) {
+MeshInstanceBatch2D *
+    mesh_instance_batch_init_2d (MeshInstanceBatch2D *batch, Uint32 type, DrawPass pass) {
     RETURN_VALUE_IF (!batch, Null, ERR_INVALID_ARGUMENTS);
 
     /* create vector */
     RETURN_VALUE_IF (
-        !(batch->instances.data = mesh_instance_2d_vector_create (16, &batch->instances.capacity)),
+        !mesh_instance_2d_vector_init (&batch->instances, 16),
         Null,
         "Failed to create vector to store batch of mesh instances 2D.\n"
     );
@@ -104,6 +202,7 @@ MeshInstanceBatch2D *mesh_instance_batch_init_2d (MeshInstanceBatch2D *batch, Ui
 
     /* set type */
     batch->mesh_type = type;
+    batch->pass      = pass;
 
     return batch;
 }
@@ -111,9 +210,7 @@ MeshInstanceBatch2D *mesh_instance_batch_init_2d (MeshInstanceBatch2D *batch, Ui
 MeshInstanceBatch2D *mesh_instance_batch_deinit_2d (MeshInstanceBatch2D *batch) {
     RETURN_VALUE_IF (!batch, Null, ERR_INVALID_ARGUMENTS);
 
-    if (batch->instances.data) {
-        mesh_instance_2d_vector_destroy (batch->instances.data);
-    }
+    mesh_instance_2d_vector_deinit (&batch->instances);
 
     if (batch->device_data.buffer) {
         device_buffer_deinit (&batch->device_data);
@@ -130,27 +227,11 @@ MeshInstanceBatch2D *mesh_instance_batch_add_instance_2d (
 ) {
     RETURN_VALUE_IF (!batch || !mesh_instance, Null, ERR_INVALID_ARGUMENTS);
 
-    /* resize if required */
-    if (batch->instances.count >= batch->instances.capacity) {
-        Size               newcap = 0;
-        XuiMeshInstance2D *tmpbuf = Null;
-        RETURN_VALUE_IF (
-            !(tmpbuf = mesh_instance_2d_vector_resize (
-                  batch->instances.data,
-                  batch->instances.count,     /* from count */
-                  batch->instances.count + 1, /* to count */
-                  batch->instances.capacity,  /* from cap */
-                  &newcap                     /* to new cap (automatically set by the function) */
-              )),
-            Null,
-            "Failed to resize vector to store more mesh instance data in corresponding batch\n"
-        );
-
-        batch->instances.data     = tmpbuf;
-        batch->instances.capacity = newcap;
-    }
-
-    batch->instances.data[batch->instances.count++] = *mesh_instance;
+    RETURN_VALUE_IF (
+        !mesh_instance_2d_vector_push (&batch->instances, mesh_instance),
+        Null,
+        "Failed to resize vector to store more mesh instance data in corresponding batch\n"
+    );
 
     return batch;
 }
@@ -161,7 +242,7 @@ MeshInstanceBatch2D *mesh_instance_batch_reset_2d (MeshInstanceBatch2D *batch) {
     /* for now and probably forever, reset just means this 
      * until unless we enter some crazy memory optimization and we cap memory of
      * vectors after a reset */
-    batch->instances.count = 0;
+    mesh_instance_2d_vector_clear (&batch->instances);
 
     return batch;
 }
@@ -169,11 +250,18 @@ MeshInstanceBatch2D *mesh_instance_batch_reset_2d (MeshInstanceBatch2D *batch) {
 MeshInstanceBatch2D *mesh_instance_batch_upload_to_gpu_2d (MeshInstanceBatch2D *batch) {
     RETURN_VALUE_IF (!batch, Null, ERR_INVALID_ARGUMENTS);
 
+    PROFILE_ZONE ("mesh_instance_batch_upload_to_gpu_2d");
+
+    /* nothing to upload */
+    if (!batch->instances.count) {
+        return batch;
+    }
+
     /* resize if required */
     Size batch_size_in_bytes = sizeof (XuiMeshInstance2D) * batch->instances.count;
     if (batch->device_data.size < batch_size_in_bytes) {
         RETURN_VALUE_IF (
-            device_buffer_resize (&batch->device_data, batch_size_in_bytes),
+            !device_buffer_resize (&batch->device_data, batch_size_in_bytes),
             Null,
             "Failed to resize batch data device buffer\n"
         );
@@ -181,7 +269,11 @@ MeshInstanceBatch2D *mesh_instance_batch_upload_to_gpu_2d (MeshInstanceBatch2D *
 
     /* upload data */
     RETURN_VALUE_IF (
-        !device_buffer_memcpy (&batch->device_data, batch->instances.data, batch_size_in_bytes),
+        !device_buffer_memcpy (
+            &batch->device_data,
+            mesh_instance_2d_vector_data (&batch->instances),
+            batch_size_in_bytes
+        ),
         Null,
         "Failed to upload batch data to GPU"
     );
@@ -190,164 +282,1597 @@ MeshInstanceBatch2D *mesh_instance_batch_upload_to_gpu_2d (MeshInstanceBatch2D *
 }
 
 /**************************************************************************************************/
-/*********************************** PUBLIC METHOD DEFINITIONS ************************************/
+/******************************** PRIMITIVE BATCH 2D PUBLIC METHODS *******************************/
 /**************************************************************************************************/
 
-BatchRenderer *batch_renderer_init (BatchRenderer *renderer, Swapchain *swapchain) {
-    RETURN_VALUE_IF (!renderer || !swapchain, Null, ERR_INVALID_ARGUMENTS);
+PrimitiveBatch2D *primitive_batch_init_2d (PrimitiveBatch2D *batch) {
+    RETURN_VALUE_IF (!batch, Null, ERR_INVALID_ARGUMENTS);
 
     RETURN_VALUE_IF (
-        !render_pass_init_default (&renderer->default_render_pass, swapchain),
+        !primitive_2d_vector_init (&batch->instances, 16),
         Null,
-        "Failed to create default render pass for Batch Renderer\n"
+        "Failed to create vector to store batch of primitives 2D.\n"
     );
 
     RETURN_VALUE_IF (
-        !(renderer->batches_2d.data =
-              mesh_instance_batch_2d_vector_create (128, &renderer->batches_2d.capacity)),
+        !device_buffer_init (
+            &batch->device_data,
+            VK_BUFFER_USAGE_VERTEX_BUFFER_BIT,
+            sizeof (XuiPrimitive2D) * 1024,
+            VK_MEMORY_PROPERTY_HOST_COHERENT_BIT | VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT,
+            vk.device.graphics_queue.family_index
+        ),
         Null,
-        "Failed to create vector to store batches"
+        "Failed to create device buffer\n"
     );
 
-    return renderer;
+    return batch;
 }
 
-BatchRenderer *batch_renderer_deinit (BatchRenderer *renderer) {
-    RETURN_VALUE_IF (!renderer, Null, ERR_INVALID_ARGUMENTS);
+PrimitiveBatch2D *primitive_batch_deinit_2d (PrimitiveBatch2D *batch) {
+    RETURN_VALUE_IF (!batch, Null, ERR_INVALID_ARGUMENTS);
 
-    if (renderer->batches_2d.data) {
-        /* since in a batch reset we don't free the memory, it's possible
-         * that some batch exceed the current count boundary is left allocated,
-         * we need to free those as well, so we instead search the complete array of left out memory */
-        for (Size s = 0; s < renderer->batches_2d.capacity; s++) {
-            mesh_instance_batch_deinit_2d (renderer->batches_2d.data + s);
-        }
+    primitive_2d_vector_deinit (&batch->instances);
 
-        mesh_instance_batch_2d_vector_destroy (renderer->batches_2d.data);
+    if (batch->device_data.buffer) {
+        device_buffer_deinit (&batch->device_data);
     }
 
-    render_pass_deinit (&renderer->default_render_pass);
+    memset (batch, 0, sizeof (PrimitiveBatch2D));
 
-    return renderer;
+    return batch;
 }
 
-MeshInstanceBatch2D *
-    batch_renderer_get_mesh_instance_batch_by_type_2d (BatchRenderer *renderer, Uint32 type) {
-    RETURN_VALUE_IF (!renderer, Null, ERR_INVALID_ARGUMENTS);
+PrimitiveBatch2D *primitive_batch_upload_to_gpu_2d (PrimitiveBatch2D *batch) {
+    RETURN_VALUE_IF (!batch, Null, ERR_INVALID_ARGUMENTS);
 
-    for (Size s = 0; s < renderer->batches_2d.count; s++) {
-        if (renderer->batches_2d.data[s].mesh_type == type) {
-            return renderer->batches_2d.data + s;
-        }
+    PROFILE_ZONE ("primitive_batch_upload_to_gpu_2d");
+
+    RETURN_VALUE_IF (
+        !upload_to_device_buffer (
+            &batch->device_data,
+            primitive_2d_vector_data (&batch->instances),
+            sizeof (XuiPrimitive2D) * batch->instances.count
+        ),
+        Null,
+        "Failed to upload primitive batch data to GPU\n"
+    );
+
+    return batch;
+}
+
+/**************************************************************************************************/
+/*********************************** LINE BATCH 2D PUBLIC METHODS *********************************/
+/**************************************************************************************************/
+
+LineBatch2D *line_batch_init_2d (LineBatch2D *batch) {
+    RETURN_VALUE_IF (!batch, Null, ERR_INVALID_ARGUMENTS);
+
+    RETURN_VALUE_IF (
+        !line_segment_2d_vector_init (&batch->instances, 16),
+        Null,
+        "Failed to create vector to store batch of line segments 2D.\n"
+    );
+
+    RETURN_VALUE_IF (
+        !device_buffer_init (
+            &batch->device_data,
+            VK_BUFFER_USAGE_VERTEX_BUFFER_BIT,
+            sizeof (XuiLineSegment2D) * 1024,
+            VK_MEMORY_PROPERTY_HOST_COHERENT_BIT | VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT,
+            vk.device.graphics_queue.family_index
+        ),
+        Null,
+        "Failed to create device buffer\n"
+    );
+
+    return batch;
+}
+
+LineBatch2D *line_batch_deinit_2d (LineBatch2D *batch) {
+    RETURN_VALUE_IF (!batch, Null, ERR_INVALID_ARGUMENTS);
+
+    line_segment_2d_vector_deinit (&batch->instances);
+
+    if (batch->device_data.buffer) {
+        device_buffer_deinit (&batch->device_data);
+    }
+
+    memset (batch, 0, sizeof (LineBatch2D));
+
+    return batch;
+}
+
+LineBatch2D *line_batch_upload_to_gpu_2d (LineBatch2D *batch) {
+    RETURN_VALUE_IF (!batch, Null, ERR_INVALID_ARGUMENTS);
+
+    PROFILE_ZONE ("line_batch_upload_to_gpu_2d");
+
+    RETURN_VALUE_IF (
+        !upload_to_device_buffer (
+            &batch->device_data,
+            line_segment_2d_vector_data (&batch->instances),
+            sizeof (XuiLineSegment2D) * batch->instances.count
+        ),
+        Null,
+        "Failed to upload line batch data to GPU\n"
+    );
+
+    return batch;
+}
+
+/**************************************************************************************************/
+/********************************* POLYLINE BATCH 2D PUBLIC METHODS *******************************/
+/**************************************************************************************************/
+
+PolylineBatch2D *polyline_batch_init_2d (PolylineBatch2D *batch) {
+    RETURN_VALUE_IF (!batch, Null, ERR_INVALID_ARGUMENTS);
+
+    RETURN_VALUE_IF (
+        !vec2f_vector_init (&batch->points, 256) ||
+            !polyline_draw_2d_vector_init (&batch->draws, 16),
+        Null,
+        "Failed to create vectors to store batch of polylines 2D.\n"
+    );
+
+    RETURN_VALUE_IF (
+        !device_buffer_init (
+            &batch->device_data,
+            VK_BUFFER_USAGE_VERTEX_BUFFER_BIT,
+            sizeof (Vec2f) * 4096,
+            VK_MEMORY_PROPERTY_HOST_COHERENT_BIT | VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT,
+            vk.device.graphics_queue.family_index
+        ),
+        Null,
+        "Failed to create device buffer\n"
+    );
+
+    return batch;
+}
+
+PolylineBatch2D *polyline_batch_deinit_2d (PolylineBatch2D *batch) {
+    RETURN_VALUE_IF (!batch, Null, ERR_INVALID_ARGUMENTS);
+
+    vec2f_vector_deinit (&batch->points);
+    polyline_draw_2d_vector_deinit (&batch->draws);
+
+    if (batch->device_data.buffer) {
+        device_buffer_deinit (&batch->device_data);
     }
 
+    memset (batch, 0, sizeof (PolylineBatch2D));
+
+    return batch;
+}
+
+/**
+ * @b Append points of given polyline to point stream of batch.
+ *
+ * First and last points are repeated in the stream. This way every segment can
+ * read one point before and after it, and a repeated point tells the shader
+ * that the segment end is capped instead of joined.
+ *
+ * @param batch
+ * @param polyline
+ *
+ * @return @p batch on success.
+ * @return @c Null otherwise.
+ * */
+PolylineBatch2D *polyline_batch_add_polyline_2d (PolylineBatch2D *batch, XuiPolyline2D *polyline) {
+    RETURN_VALUE_IF (!batch || !polyline || !polyline->points, Null, ERR_INVALID_ARGUMENTS);
+    RETURN_VALUE_IF (polyline->point_count < 2, Null, "Polyline needs at least 2 points\n");
+
+    Size   old_count = batch->points.count;
+    Vec2f *first     = polyline->points;
+    Vec2f *last      = polyline->points + polyline->point_count - 1;
+
+    PolylineDraw2D draw = {
+        .first_point   = old_count,
+        .segment_count = polyline->point_count - 1,
+        .style         = {.color = polyline->color,
+                          .width = polyline->width,
+                          .depth = polyline->depth,
+                          .cap   = polyline->cap,
+                          .join  = polyline->join}
+    };
+
+    GOTO_HANDLER_IF (
+        !vec2f_vector_push (&batch->points, first) ||
+            !vec2f_vector_append (&batch->points, polyline->points, polyline->point_count) ||
+            !vec2f_vector_push (&batch->points, last) ||
+            !polyline_draw_2d_vector_push (&batch->draws, &draw),
+        ADD_FAILED,
+        "Failed to resize vectors to store more polyline data in batch\n"
+    );
+
+    return batch;
+
+ADD_FAILED:
+    batch->points.count = old_count;
     return Null;
 }
-BatchRenderer *batch_renderer_add_mesh_instance_2d (
-    BatchRenderer     *renderer,
-    XuiMeshInstance2D *mesh_instance
+
+PolylineBatch2D *polyline_batch_reset_2d (PolylineBatch2D *batch) {
+    RETURN_VALUE_IF (!batch, Null, ERR_INVALID_ARGUMENTS);
+
+    vec2f_vector_clear (&batch->points);
+    polyline_draw_2d_vector_clear (&batch->draws);
+
+    return batch;
+}
+
+PolylineBatch2D *polyline_batch_upload_to_gpu_2d (PolylineBatch2D *batch) {
+    RETURN_VALUE_IF (!batch, Null, ERR_INVALID_ARGUMENTS);
+
+    PROFILE_ZONE ("polyline_batch_upload_to_gpu_2d");
+
+    RETURN_VALUE_IF (
+        !upload_to_device_buffer (
+            &batch->device_data,
+            vec2f_vector_data (&batch->points),
+            sizeof (Vec2f) * batch->points.count
+        ),
+        Null,
+        "Failed to upload polyline batch data to GPU\n"
+    );
+
+    return batch;
+}
+
+/**************************************************************************************************/
+/*********************************** TEXT BATCH 2D PUBLIC METHODS *********************************/
+/**************************************************************************************************/
+
+TextBatch2D *text_batch_init_2d (TextBatch2D *batch) {
+    RETURN_VALUE_IF (!batch, Null, ERR_INVALID_ARGUMENTS);
+
+    RETURN_VALUE_IF (
+        !glyph_instance_2d_vector_init (&batch->instances, 256) ||
+            !glyph_instance_2d_vector_init (&batch->sdf_instances, 256),
+        Null,
+        "Failed to create vector to store batch of glyphs 2D.\n"
+    );
+
+    RETURN_VALUE_IF (
+        !device_buffer_init (
+            &batch->device_data,
+            VK_BUFFER_USAGE_VERTEX_BUFFER_BIT,
+            sizeof (GlyphInstance2D) * 1024,
+            VK_MEMORY_PROPERTY_HOST_COHERENT_BIT | VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT,
+            vk.device.graphics_queue.family_index
+        ) ||
+            !device_buffer_init (
+                &batch->sdf_device_data,
+                VK_BUFFER_USAGE_VERTEX_BUFFER_BIT,
+                sizeof (GlyphInstance2D) * 1024,
+                VK_MEMORY_PROPERTY_HOST_COHERENT_BIT | VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT,
+                vk.device.graphics_queue.family_index
+            ),
+        Null,
+        "Failed to create device buffer\n"
+    );
+
+    RETURN_VALUE_IF (
+        !glyph_cache_init (&batch->glyph_cache) || !glyph_cache_init (&batch->sdf_glyph_cache),
+        Null,
+        "Failed to create glyph cache\n"
+    );
+
+    RETURN_VALUE_IF (
+        !text_layout_cache_init (&batch->layout_cache, TEXT_BATCH_LAYOUT_CACHE_BUDGET),
+        Null,
+        "Failed to create text layout cache\n"
+    );
+
+    return batch;
+}
+
+TextBatch2D *text_batch_deinit_2d (TextBatch2D *batch) {
+    RETURN_VALUE_IF (!batch, Null, ERR_INVALID_ARGUMENTS);
+
+    glyph_instance_2d_vector_deinit (&batch->instances);
+    glyph_instance_2d_vector_deinit (&batch->sdf_instances);
+    glyph_index_vector_deinit (&batch->glyph_indices);
+
+    if (batch->device_data.buffer) {
+        device_buffer_deinit (&batch->device_data);
+    }
+
+    if (batch->sdf_device_data.buffer) {
+        device_buffer_deinit (&batch->sdf_device_data);
+    }
+
+    glyph_cache_deinit (&batch->glyph_cache);
+    glyph_cache_deinit (&batch->sdf_glyph_cache);
+
+    text_layout_cache_deinit (&batch->layout_cache);
+    text_layout_glyph_vector_deinit (&batch->layout_glyphs);
+    codepoint_vector_deinit (&batch->codepoints);
+    line_break_vector_deinit (&batch->line_breaks);
+
+    memset (batch, 0, sizeof (TextBatch2D));
+
+    return batch;
+}
+
+/**
+ * @b Lay out given text and add a glyph quad for each visible glyph.
+ *
+ * Glyphs are rasterized at @c size * @p scale pixels, the size text covers on
+ * screen, and quads are scaled back to instance coordinates, so each glyph maps
+ * to atlas texels one to one.
+ *
+ * Text in @c XUI_TEXT_RENDER_MODE_SDF is laid out independent of @p scale
+ * instead, with distance field glyphs scaled to text size.
+ *
+ * Layouts are looked up in layout cache first, keyed by everything that moves
+ * glyphs around, so only text not drawn same way recently is laid out again.
+ *
+ * @param batch
+ * @param text
+ * @param scale Pixels per instance coordinate unit.
+ * @param glyphs_rasterized Incremented by number of glyphs missing in glyph cache.
+ * @param text_layouts Incremented if text is missing in layout cache.
+ *
+ * @return @p batch on success.
+ * @return @c Null otherwise.
+ * */
+TextBatch2D *text_batch_add_text_2d (
+    TextBatch2D *batch,
+    XuiText2D   *text,
+    Float32      scale,
+    Uint64      *glyphs_rasterized,
+    Uint64      *text_layouts
 ) {
-    RETURN_VALUE_IF (!renderer || !mesh_instance, Null, ERR_INVALID_ARGUMENTS);
+    RETURN_VALUE_IF (
+        !batch || !text || !text->text || !(scale > 0.f) || !glyphs_rasterized || !text_layouts,
+        Null,
+        ERR_INVALID_ARGUMENTS
+    );
+
+    FontData *font_data = font_manager_get_font_by_id (&vk.font_manager, text->font);
+    RETURN_VALUE_IF (!font_data, Null, "Text given with a non-existent font %u\n", text->font);
+
+    Bool is_sdf = text->mode == XUI_TEXT_RENDER_MODE_SDF;
+
+    /* layout is done in pixels of glyphs, so unit converts them to instance coordinates */
+    TextLayoutKey key = {
+        .text   = text->text,
+        .length = text->length ? text->length : strlen (text->text),
+        .font   = text->font,
+        .flags  = text->mode
+    };
+    Float32 unit;
+    if (is_sdf) {
+        if (!(text->size > 0.f)) {
+            return batch;
+        }
+
+        key.size = GLYPH_CACHE_SDF_SIZE;
+        unit     = text->size / GLYPH_CACHE_SDF_SIZE;
+    } else {
+        /* too small to cover a single pixel */
+        Uint32 pixel_size = (Uint32)(text->size * scale + 0.5f);
+        if (!pixel_size) {
+            return batch;
+        }
+
+        key.size = pixel_size;
+        unit     = 1.f / scale;
+    }
+    key.max_width = text->max_width > 0.f ? text->max_width / unit : 0.f;
+
+    PROFILE_ZONE ("text_batch_add_text_2d");
+
+    TextLayout *layout = text_layout_cache_find (&batch->layout_cache, &key);
+
+    /* text is decoded only when it has to be laid out */
+    if (!layout) {
+        RETURN_VALUE_IF (
+            !codepoint_vector_resize (&batch->codepoints, key.length, False),
+            Null,
+            "Failed to resize vector to store codepoints of text\n"
+        );
+        batch->codepoints.count =
+            utf8_decode (codepoint_vector_data (&batch->codepoints), key.text, key.length);
+    }
+
+    if (is_sdf) {
+        RETURN_VALUE_IF (
+            !text_batch_add_sdf_glyphs_2d (batch, layout, font_data, glyphs_rasterized),
+            Null,
+            "Failed to generate distance field glyphs\n"
+        );
+    }
+
+    /* face is shared by all text using it's font, so size is set again for each run */
+    RETURN_VALUE_IF (
+        !font_data_set_pixel_size (font_data, (Uint32)key.size),
+        Null,
+        "Failed to scale font to text size\n"
+    );
+
+    if (!layout) {
+        layout = text_batch_layout_text_2d (batch, &key, font_data, glyphs_rasterized);
+        RETURN_VALUE_IF (!layout, Null, "Failed to lay out text\n");
+        *text_layouts += 1;
+    }
+
+    GlyphCache            *glyph_cache = is_sdf ? &batch->sdf_glyph_cache : &batch->glyph_cache;
+    GlyphInstance2DVector *instances   = is_sdf ? &batch->sdf_instances : &batch->instances;
+    GlyphAtlasPageMask    *pages       = is_sdf ? &batch->sdf_pages : &batch->pages;
+    GlyphAtlas            *atlas       = &glyph_cache->atlas;
+    Size                   old_count   = instances->count;
+
+    for (Uint32 g = 0; g < layout->glyph_count; g++) {
+        TextLayoutGlyph *placed = layout->glyphs + g;
+
+        /* glyphs are looked up every time, since they might've been evicted since layout */
+        GlyphAtlasEntry *glyph;
+        if (is_sdf) {
+            glyph = glyph_cache_find_sdf_glyph (glyph_cache, font_data, placed->glyph);
+        } else {
+            Bool is_rasterized  = False;
+            glyph               = glyph_cache_get_glyph (
+                glyph_cache,
+                font_data,
+                placed->glyph,
+                &is_rasterized
+            );
+            *glyphs_rasterized += is_rasterized;
+        }
+        GOTO_HANDLER_IF (!glyph, ADD_FAILED, "Failed to get glyph %u\n", placed->glyph);
+
+        /* blank glyphs (spaces) only moved the pen */
+        if (glyph->page == GLYPH_ATLAS_PAGE_NONE) {
+            continue;
+        }
+
+        GlyphAtlasRect *rect = &glyph->rect;
+
+        GlyphInstance2D instance = {
+            .color    = text->color,
+            .uv_rect  = {.x = (Float32)rect->x / atlas->width,
+                         .y = (Float32)rect->y / atlas->height,
+                         .z = (Float32)rect->width / atlas->width,
+                         .w = (Float32)rect->height / atlas->height},
+            .size     = {.x = rect->width * unit, .y = rect->height * unit},
+            .position = {.x = text->position.x + (placed->x + glyph->bearing_x) * unit,
+                         .y = text->position.y + (placed->y - glyph->bearing_y) * unit,
+                         .z = text->position.z}
+        };
+
+        GOTO_HANDLER_IF (
+            !glyph_instance_2d_vector_push (instances, &instance),
+            ADD_FAILED,
+            "Failed to add glyph for drawing\n"
+        );
+        *pages |= (GlyphAtlasPageMask)1 << glyph->page;
+    }
+
+    return batch;
+
+ADD_FAILED:
+    instances->count = old_count;
+    return Null;
+}
+
+/**
+ * @b Remove all glyph instances from batch.
+ *
+ * Atlas pages they were drawn from are no longer kept from next frame on, so
+ * glyphs not drawn again can be evicted to make space for new ones.
+ *
+ * @param batch
+ *
+ * @return @p batch on success.
+ * @return @c Null otherwise.
+ * */
+TextBatch2D *text_batch_reset_2d (TextBatch2D *batch) {
+    RETURN_VALUE_IF (!batch, Null, ERR_INVALID_ARGUMENTS);
+
+    glyph_instance_2d_vector_clear (&batch->instances);
+    glyph_instance_2d_vector_clear (&batch->sdf_instances);
+    batch->pages     = 0;
+    batch->sdf_pages = 0;
+
+    return batch;
+}
+
+/**
+ * @b Start a new frame in glyph caches and layout cache, called once per display.
+ *
+ * Glyphs looked up after this can be packed over glyphs not used since,
+ * except glyphs of instances still in batch, which are drawn again in every
+ * frame until batch is reset. Layouts not used since are evicted if layout
+ * cache is over @c TEXT_BATCH_LAYOUT_CACHE_BUDGET.
+ *
+ * @param batch
+ *
+ * @return @p batch on success.
+ * @return @c Null otherwise.
+ * */
+TextBatch2D *text_batch_begin_frame_2d (TextBatch2D *batch) {
+    RETURN_VALUE_IF (!batch, Null, ERR_INVALID_ARGUMENTS);
+
+    glyph_atlas_begin_frame (&batch->glyph_cache.atlas);
+    glyph_atlas_keep_pages (&batch->glyph_cache.atlas, batch->pages);
+    glyph_atlas_begin_frame (&batch->sdf_glyph_cache.atlas);
+    glyph_atlas_keep_pages (&batch->sdf_glyph_cache.atlas, batch->sdf_pages);
+    RETURN_VALUE_IF (
+        !text_layout_cache_begin_frame (&batch->layout_cache),
+        Null,
+        "Failed to evict text layouts\n"
+    );
+
+    return batch;
+}
+
+TextBatch2D *text_batch_upload_to_gpu_2d (TextBatch2D *batch) {
+    RETURN_VALUE_IF (!batch, Null, ERR_INVALID_ARGUMENTS);
+
+    PROFILE_ZONE ("text_batch_upload_to_gpu_2d");
+
+    RETURN_VALUE_IF (
+        !upload_to_device_buffer (
+            &batch->device_data,
+            glyph_instance_2d_vector_data (&batch->instances),
+            sizeof (GlyphInstance2D) * batch->instances.count
+        ) ||
+            !upload_to_device_buffer (
+                &batch->sdf_device_data,
+                glyph_instance_2d_vector_data (&batch->sdf_instances),
+                sizeof (GlyphInstance2D) * batch->sdf_instances.count
+            ),
+        Null,
+        "Failed to upload text batch data to GPU\n"
+    );
+
+    return batch;
+}
+
+/**************************************************************************************************/
+/********************************** SLOT BATCH 2D PUBLIC METHODS **********************************/
+/**************************************************************************************************/
+
+SlotBatch2D *slot_batch_init_2d (SlotBatch2D *batch) {
+    RETURN_VALUE_IF (!batch, Null, ERR_INVALID_ARGUMENTS);
+
+    /* vectors and device buffers of groups are created on first use */
+    memset (batch, 0, sizeof (SlotBatch2D));
+
+    return batch;
+}
+
+SlotBatch2D *slot_batch_deinit_2d (SlotBatch2D *batch) {
+    RETURN_VALUE_IF (!batch, Null, ERR_INVALID_ARGUMENTS);
+
+    SlotGroup2D *groups = slot_group_2d_vector_data (&batch->groups);
+    for (Size s = 0; s < batch->groups.count; s++) {
+        byte_vector_deinit (&groups[s].contents);
+        slot_vector_deinit (&groups[s].owners);
+
+        if (groups[s].device_data.buffer) {
+            device_buffer_deinit (&groups[s].device_data);
+        }
+    }
+
+    slot_group_2d_vector_deinit (&batch->groups);
+    slot_entry_2d_vector_deinit (&batch->entries);
+    slot_vector_deinit (&batch->free_slots);
+
+    memset (batch, 0, sizeof (SlotBatch2D));
+
+    return batch;
+}
+
+/**
+ * @b Create a new persistent slot, drawing nothing.
+ *
+ * @param batch
+ *
+ * @return Handle of new slot on success.
+ * @return Zero otherwise.
+ * */
+XuiSlot2D slot_batch_create_slot_2d (SlotBatch2D *batch) {
+    RETURN_VALUE_IF (!batch, 0, ERR_INVALID_ARGUMENTS);
+
+    SlotEntry2D *entry;
+    if (batch->free_slots.count) {
+        XuiSlot2D slot = slot_vector_data (&batch->free_slots)[--batch->free_slots.count];
+        entry          = slot_entry_2d_vector_data (&batch->entries) + slot - 1;
+    } else {
+        RETURN_VALUE_IF (
+            !(entry = slot_entry_2d_vector_push (&batch->entries, Null)),
+            0,
+            "Failed to resize vector to store more slots\n"
+        );
+    }
+
+    *entry = (SlotEntry2D) {.group = SLOT_GROUP_NONE, .index = 0, .is_used = True};
+
+    return entry - slot_entry_2d_vector_data (&batch->entries) + 1;
+}
+
+/**
+ * @b Replace content of given slot.
+ *
+ * Content is updated in place when slot keeps drawing same mesh, or a
+ * primitive, otherwise it's moved to group of what it draws now.
+ *
+ * @param batch
+ * @param slot
+ * @param content
+ *
+ * @return @c batch on success.
+ * @return @c Null otherwise, and slot keeps it's previous content.
+ * */
+SlotBatch2D *
+    slot_batch_update_slot_2d (SlotBatch2D *batch, XuiSlot2D slot, XuiSlotContent2D *content) {
+    RETURN_VALUE_IF (!batch || !content, Null, ERR_INVALID_ARGUMENTS);
+
+    SlotEntry2D *entry = slot_batch_get_entry_2d (batch, slot);
+    RETURN_VALUE_IF (!entry, Null, "Invalid slot %u\n", slot);
+
+    RETURN_VALUE_IF (
+        content->type >= XUI_SLOT_TYPE_2D_MAX,
+        Null,
+        "Invalid slot content type %u\n",
+        content->type
+    );
+
+    /* slot stops drawing */
+    if (content->type == XUI_SLOT_TYPE_2D_NONE) {
+        slot_batch_remove_content_2d (batch, entry);
+        return batch;
+    }
+
+    void  *data      = Null;
+    Uint32 mesh_type = 0;
+    if (content->type == XUI_SLOT_TYPE_2D_MESH) {
+        RETURN_VALUE_IF (
+            !mesh_manager_get_mesh_data_by_type_2d (&vk.mesh_manager, content->mesh.type),
+            Null,
+            "Slot content given with a non-existent mesh type\n"
+        );
+
+        data      = &content->mesh;
+        mesh_type = content->mesh.type;
+    } else {
+        RETURN_VALUE_IF (
+            content->primitive.type >= XUI_PRIMITIVE_TYPE_2D_MAX,
+            Null,
+            "Invalid primitive type %u\n",
+            content->primitive.type
+        );
+
+        data = &content->primitive;
+    }
+
+    SlotGroup2D *group = slot_batch_get_group_2d (batch, content->type, mesh_type);
+    RETURN_VALUE_IF (!group, Null, "Failed to create group of slot contents\n");
+
+    /* content moves to another group when slot draws something else */
+    Uint32 group_index = group - slot_group_2d_vector_data (&batch->groups);
+    if (entry->group != group_index) {
+        Size index = group->owners.count;
+
+        RETURN_VALUE_IF (
+            !byte_vector_resize (&group->contents, group->contents.count + group->stride, False),
+            Null,
+            "Failed to resize vector to store more slot contents\n"
+        );
+
+        if (!slot_vector_push (&group->owners, &slot)) {
+            group->contents.count -= group->stride;
+            PRINT_ERR ("Failed to resize vector to store more slot contents\n");
+            return Null;
+        }
+
+        slot_batch_remove_content_2d (batch, entry);
+        entry->group = group_index;
+        entry->index = index;
+    }
+
+    Uint8 *contents = byte_vector_data (&group->contents);
+    memcpy (contents + entry->index * group->stride, data, group->stride);
+    slot_group_mark_dirty_2d (group, entry->index);
+
+    return batch;
+}
+
+/**
+ * @b Stop drawing given slot, and free it for reuse.
+ *
+ * @param batch
+ * @param slot
+ *
+ * @return @c batch on success.
+ * @return @c Null otherwise.
+ * */
+SlotBatch2D *slot_batch_destroy_slot_2d (SlotBatch2D *batch, XuiSlot2D slot) {
+    RETURN_VALUE_IF (!batch, Null, ERR_INVALID_ARGUMENTS);
+
+    SlotEntry2D *entry = slot_batch_get_entry_2d (batch, slot);
+    RETURN_VALUE_IF (!entry, Null, "Invalid slot %u\n", slot);
+
+    RETURN_VALUE_IF (
+        !slot_vector_push (&batch->free_slots, &slot),
+        Null,
+        "Failed to resize vector to store free slots\n"
+    );
+
+    slot_batch_remove_content_2d (batch, entry);
+    entry->is_used = False;
+
+    return batch;
+}
+
+/**
+ * @b Upload contents of slots changed since last upload.
+ *
+ * @param batch
+ * @param bytes_uploaded Incremented by number of bytes copied to device memory.
+ * @param device_allocations Incremented by number of device buffers (re)created.
+ *
+ * @return @c batch on success.
+ * @return @c Null otherwise.
+ * */
+SlotBatch2D *slot_batch_upload_to_gpu_2d (
+    SlotBatch2D *batch,
+    Uint64      *bytes_uploaded,
+    Uint64      *device_allocations
+) {
+    RETURN_VALUE_IF (!batch || !bytes_uploaded || !device_allocations, Null, ERR_INVALID_ARGUMENTS);
+
+    PROFILE_ZONE ("slot_batch_upload_to_gpu_2d");
+
+    SlotGroup2D *groups = slot_group_2d_vector_data (&batch->groups);
+    for (Size s = 0; s < batch->groups.count; s++) {
+        SlotGroup2D *group = groups + s;
+        Size         begin = group->dirty_begin;
+        Size         end   = MIN (group->dirty_end, group->owners.count);
+
+        /* nothing changed, or only contents removed from end did */
+        if (begin >= end) {
+            slot_group_mark_clean_2d (group);
+            continue;
+        }
+
+        /* buffer grows geometrically, so that adding slots one by one does not
+         * recreate it every frame, and a new buffer needs all contents again */
+        if (group->device_data.size < group->contents.count) {
+            Size size = MAX (group->contents.count, group->device_data.size * 2);
+            size      = MAX (size, group->stride * 64);
+
+            if (group->device_data.buffer) {
+                RETURN_VALUE_IF (
+                    !device_buffer_resize (&group->device_data, size),
+                    Null,
+                    "Failed to resize slot group device buffer\n"
+                );
+            } else {
+                RETURN_VALUE_IF (
+                    !device_buffer_init (
+                        &group->device_data,
+                        VK_BUFFER_USAGE_VERTEX_BUFFER_BIT,
+                        size,
+                        VK_MEMORY_PROPERTY_HOST_COHERENT_BIT | VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT,
+                        vk.device.graphics_queue.family_index
+                    ),
+                    Null,
+                    "Failed to create slot group device buffer\n"
+                );
+            }
+
+            *device_allocations += 1;
+            begin                = 0;
+            end                  = group->owners.count;
+        }
+
+        Size offset = begin * group->stride;
+        Size size   = (end - begin) * group->stride;
+        RETURN_VALUE_IF (
+            !device_buffer_write (
+                &group->device_data,
+                offset,
+                byte_vector_data (&group->contents) + offset,
+                size
+            ),
+            Null,
+            "Failed to upload slot contents to GPU\n"
+        );
+
+        *bytes_uploaded += size;
+        slot_group_mark_clean_2d (group);
+    }
+
+    return batch;
+}
+
+InstanceStaging2D *instance_staging_init_2d (InstanceStaging2D *staging) {
+    RETURN_VALUE_IF (!staging, Null, ERR_INVALID_ARGUMENTS);
+
+    /* vectors are created on first draw */
+    memset (staging, 0, sizeof (InstanceStaging2D));
+    staging->thread = pthread_self();
+
+    return staging;
+}
+
+InstanceStaging2D *instance_staging_deinit_2d (InstanceStaging2D *staging) {
+    RETURN_VALUE_IF (!staging, Null, ERR_INVALID_ARGUMENTS);
+
+    mesh_instance_2d_vector_deinit (&staging->meshes);
+    primitive_2d_vector_deinit (&staging->primitives);
+    staging_run_2d_vector_deinit (&staging->runs);
+
+    memset (staging, 0, sizeof (InstanceStaging2D));
+
+    return staging;
+}
+
+InstanceStaging2D *
+    instance_staging_add_mesh_instance_2d (InstanceStaging2D *staging, XuiMeshInstance2D *mesh) {
+    RETURN_VALUE_IF (!staging || !mesh, Null, ERR_INVALID_ARGUMENTS);
+
+    RETURN_VALUE_IF (
+        !instance_staging_get_run_2d (staging) ||
+            !mesh_instance_2d_vector_push (&staging->meshes, mesh),
+        Null,
+        "Failed to resize vector to stage mesh instance\n"
+    );
+
+    return staging;
+}
+
+InstanceStaging2D *
+    instance_staging_add_primitive_2d (InstanceStaging2D *staging, XuiPrimitive2D *primitive) {
+    RETURN_VALUE_IF (!staging || !primitive, Null, ERR_INVALID_ARGUMENTS);
+
+    RETURN_VALUE_IF (
+        !instance_staging_get_run_2d (staging) ||
+            !primitive_2d_vector_push (&staging->primitives, primitive),
+        Null,
+        "Failed to resize vector to stage primitive\n"
+    );
+
+    return staging;
+}
+
+/**
+ * @b Forget instances staged so far, keeping memory for next frame.
+ * Ordering key stays as it is.
+ * */
+InstanceStaging2D *instance_staging_reset_2d (InstanceStaging2D *staging) {
+    RETURN_VALUE_IF (!staging, Null, ERR_INVALID_ARGUMENTS);
+
+    mesh_instance_2d_vector_clear (&staging->meshes);
+    primitive_2d_vector_clear (&staging->primitives);
+    staging_run_2d_vector_clear (&staging->runs);
+
+    return staging;
+}
+
+/**************************************************************************************************/
+/*********************************** PUBLIC METHOD DEFINITIONS ************************************/
+/**************************************************************************************************/
+
+BatchRenderer *batch_renderer_init (BatchRenderer *renderer, Swapchain *swapchain) {
+    RETURN_VALUE_IF (!renderer || !swapchain, Null, ERR_INVALID_ARGUMENTS);
+
+    RETURN_VALUE_IF (
+        !render_pass_init_default (&renderer->default_render_pass, swapchain),
+        Null,
+        "Failed to create default render pass for Batch Renderer\n"
+    );
+
+    RETURN_VALUE_IF (
+        !mesh_instance_batch_2d_vector_init (&renderer->batches_2d, 128) ||
+            !sort_key_vector_init (&renderer->batch_keys_2d, 128),
+        Null,
+        "Failed to create vector to store batches"
+    );
+
+    RETURN_VALUE_IF (
+        !primitive_batch_init_2d (&renderer->primitives_2d),
+        Null,
+        "Failed to create batch to store primitives\n"
+    );
+
+    RETURN_VALUE_IF (
+        !line_batch_init_2d (&renderer->lines_2d) ||
+            !polyline_batch_init_2d (&renderer->polylines_2d),
+        Null,
+        "Failed to create batches to store lines\n"
+    );
+
+    RETURN_VALUE_IF (
+        !text_batch_init_2d (&renderer->text_2d),
+        Null,
+        "Failed to create batch to store text\n"
+    );
+
+    RETURN_VALUE_IF (
+        !slot_batch_init_2d (&renderer->slots_2d),
+        Null,
+        "Failed to create batch to store persistent slots\n"
+    );
+
+    /* glyph atlas image never changes, only it's contents do */
+    RETURN_VALUE_IF (
+        !graphics_pipeline_write_image_to_descriptor_set (
+            &renderer->default_render_pass.pipelines.text_2d,
+            &renderer->text_2d.glyph_cache.image,
+            renderer->text_2d.glyph_cache.sampler
+        ),
+        Null,
+        "Failed to bind glyph atlas to text pipeline\n"
+    );
+
+    RETURN_VALUE_IF (
+        !graphics_pipeline_write_image_to_descriptor_set (
+            &renderer->default_render_pass.pipelines.text_sdf_2d,
+            &renderer->text_2d.sdf_glyph_cache.image,
+            renderer->text_2d.sdf_glyph_cache.sampler
+        ),
+        Null,
+        "Failed to bind distance field glyph atlas to text pipeline\n"
+    );
+
+    pthread_mutex_init (&renderer->staging_mutex, Null);
+    renderer->id = atomic_fetch_add (&next_renderer_id, 1);
+
+    return renderer;
+}
+
+BatchRenderer *batch_renderer_deinit (BatchRenderer *renderer) {
+    RETURN_VALUE_IF (!renderer, Null, ERR_INVALID_ARGUMENTS);
+
+    /* batches are never removed, only their instances are, so every batch is within count */
+    MeshInstanceBatch2D *batches = mesh_instance_batch_2d_vector_data (&renderer->batches_2d);
+    for (Size s = 0; s < renderer->batches_2d.count; s++) {
+        mesh_instance_batch_deinit_2d (batches + s);
+    }
+
+    mesh_instance_batch_2d_vector_deinit (&renderer->batches_2d);
+    sort_key_vector_deinit (&renderer->batch_keys_2d);
+
+    primitive_batch_deinit_2d (&renderer->primitives_2d);
+    line_batch_deinit_2d (&renderer->lines_2d);
+    polyline_batch_deinit_2d (&renderer->polylines_2d);
+    text_batch_deinit_2d (&renderer->text_2d);
+    slot_batch_deinit_2d (&renderer->slots_2d);
+
+    InstanceStaging2D **stagings = instance_staging_2d_vector_data (&renderer->stagings_2d);
+    for (Size s = 0; s < renderer->stagings_2d.count; s++) {
+        instance_staging_deinit_2d (stagings[s]);
+        FREE (stagings[s]);
+    }
+    instance_staging_2d_vector_deinit (&renderer->stagings_2d);
+    staging_run_2d_vector_deinit (&renderer->staging_runs_2d);
+    mesh_instance_2d_vector_deinit (&renderer->sorted_meshes_2d);
+    primitive_2d_vector_deinit (&renderer->sorted_primitives_2d);
+    sort_key_vector_deinit (&renderer->sort_keys_2d);
+    sort_value_vector_deinit (&renderer->sort_values_2d);
+
+    /* renderer is initialized once id is given, only then there's a mutex to destroy */
+    if (renderer->id) {
+        pthread_mutex_destroy (&renderer->staging_mutex);
+        renderer->id = 0;
+    }
+
+    render_pass_deinit (&renderer->default_render_pass);
+
+    return renderer;
+}
+
+/**
+ * @b Find batch of given pass and mesh type.
+ *
+ * @param renderer
+ * @param pass Pass instances of batch are drawn in.
+ * @param type Mesh type of instances in batch.
+ *
+ * @return Batch on success.
+ * @return @c Null if there's no such batch yet.
+ * */
+MeshInstanceBatch2D *batch_renderer_get_mesh_instance_batch_2d (
+    BatchRenderer *renderer,
+    DrawPass       pass,
+    Uint32         type
+) {
+    RETURN_VALUE_IF (!renderer, Null, ERR_INVALID_ARGUMENTS);
+
+    Uint64 *keys  = sort_key_vector_data (&renderer->batch_keys_2d);
+    Size    count = renderer->batch_keys_2d.count;
+    Uint64  key   = draw_key_batch (draw_key_pack_2d (pass, False, type, 0.f));
+    Size    index = draw_key_find_batch (keys, count, key);
+
+    if (index < count && keys[index] == key) {
+        return mesh_instance_batch_2d_vector_data (&renderer->batches_2d) + index;
+    }
+
+    return Null;
+}
+BatchRenderer *batch_renderer_add_mesh_instance_2d (
+    BatchRenderer     *renderer,
+    XuiMeshInstance2D *mesh_instance
+) {
+    RETURN_VALUE_IF (!renderer || !mesh_instance, Null, ERR_INVALID_ARGUMENTS);
+
+    /* find batch */
+    DrawPass             pass  = get_mesh_pass_2d (mesh_instance);
+    MeshInstanceBatch2D *batch =
+        batch_renderer_get_mesh_instance_batch_2d (renderer, pass, mesh_instance->type);
+
+    /* create batch if not already created */
+    if (!batch) {
+        /* check if mesh type already exists */
+        RETURN_VALUE_IF (
+            !mesh_manager_get_mesh_data_by_type_2d (&vk.mesh_manager, mesh_instance->type),
+            Null,
+            "Mesh instance given with a non-existent mesh type. Cannot create batch\n"
+        );
+
+        MeshInstanceBatch2D new_batch = {0};
+        if (!mesh_instance_batch_init_2d (&new_batch, mesh_instance->type, pass)) {
+            mesh_instance_batch_deinit_2d (&new_batch);
+            PRINT_ERR ("Failed to initialize new batch\n");
+            return Null;
+        }
+
+        Uint64 key   = draw_key_batch (draw_key_pack_2d (pass, False, mesh_instance->type, 0.f));
+        Size   count = renderer->batches_2d.count;
+        Size   index =
+            draw_key_find_batch (sort_key_vector_data (&renderer->batch_keys_2d), count, key);
+
+        if (!mesh_instance_batch_2d_vector_push (&renderer->batches_2d, &new_batch) ||
+            !sort_key_vector_push (&renderer->batch_keys_2d, &key)) {
+            renderer->batches_2d.count    = count;
+            renderer->batch_keys_2d.count = count;
+            mesh_instance_batch_deinit_2d (&new_batch);
+            PRINT_ERR ("Failed to resize vector to batches\n");
+            return Null;
+        }
+
+        /* keep batches in order of their keys, which is order they're drawn in */
+        MeshInstanceBatch2D *batches = mesh_instance_batch_2d_vector_data (&renderer->batches_2d);
+        Uint64              *keys    = sort_key_vector_data (&renderer->batch_keys_2d);
+        memmove (batches + index + 1, batches + index, (count - index) * sizeof (*batches));
+        memmove (keys + index + 1, keys + index, (count - index) * sizeof (*keys));
+        batches[index] = new_batch;
+        keys[index]    = key;
+        batch          = batches + index;
+
+        /* new batch allocates a new device buffer */
+        renderer->stats.frame.device_allocations++;
+    }
+
+    /* insert mesh instance to corresponding batch */
+    RETURN_VALUE_IF (
+        !mesh_instance_batch_add_instance_2d (batch, mesh_instance),
+        Null,
+        "Failed to add mesh instance to batch\n"
+    );
+
+    return renderer;
+}
+/**
+ * @b Get staging of calling thread, adding a new one on first draw of thread.
+ *
+ * Only adding a staging takes a lock, after that, a thread finds it's
+ * staging again without one, as long as it keeps drawing into same renderer.
+ *
+ * @param renderer
+ *
+ * @return Staging of calling thread on success.
+ * @return @c Null otherwise.
+ * */
+InstanceStaging2D *batch_renderer_get_staging_2d (BatchRenderer *renderer) {
+    RETURN_VALUE_IF (!renderer, Null, ERR_INVALID_ARGUMENTS);
+
+    if (this_thread_staging.renderer_id == renderer->id) {
+        return this_thread_staging.staging;
+    }
+
+    pthread_t          self    = pthread_self();
+    InstanceStaging2D *staging = Null;
+
+    pthread_mutex_lock (&renderer->staging_mutex);
+
+    InstanceStaging2D **stagings = instance_staging_2d_vector_data (&renderer->stagings_2d);
+    for (Size s = 0; s < renderer->stagings_2d.count && !staging; s++) {
+        if (pthread_equal (stagings[s]->thread, self)) {
+            staging = stagings[s];
+        }
+    }
+
+    if (!staging) {
+        staging = NEW (InstanceStaging2D);
+        if (staging && !instance_staging_2d_vector_push (&renderer->stagings_2d, &staging)) {
+            FREE (staging);
+            staging = Null;
+        }
+        if (staging) {
+            instance_staging_init_2d (staging);
+        }
+    }
+
+    pthread_mutex_unlock (&renderer->staging_mutex);
+
+    RETURN_VALUE_IF (!staging, Null, "Failed to add staging for drawing thread\n");
+
+    this_thread_staging = (ThreadStaging2D) {.renderer_id = renderer->id, .staging = staging};
+
+    return staging;
+}
+
+/**
+ * @b Drop instances staged by all threads since last merge. All threads must
+ * be done drawing before this is called.
+ *
+ * @param renderer
+ *
+ * @return @c renderer on success.
+ * @return @c Null otherwise.
+ * */
+BatchRenderer *batch_renderer_reset_stagings_2d (BatchRenderer *renderer) {
+    RETURN_VALUE_IF (!renderer, Null, ERR_INVALID_ARGUMENTS);
+
+    InstanceStaging2D **stagings = instance_staging_2d_vector_data (&renderer->stagings_2d);
+    for (Size s = 0; s < renderer->stagings_2d.count; s++) {
+        instance_staging_reset_2d (stagings[s]);
+    }
+
+    return renderer;
+}
+
+/**
+ * @b Add instances staged by all threads to batches, or record them into
+ * given render thread, and reset stagings.
+ *
+ * Runs of instances are added in order of their ordering keys. Runs with
+ * same key are added in order of stagings, and then in order they were
+ * drawn. All threads must be done drawing before this is called.
+ *
+ * @param renderer
+ * @param thread Render thread to record instances into, @c Null to add
+ *        them to batches directly.
+ *
+ * @return @c renderer on success.
+ * @return @c Null if any instance failed to be added, all others are still added.
+ * */
+BatchRenderer *batch_renderer_merge_stagings_2d (BatchRenderer *renderer, RenderThread *thread) {
+    RETURN_VALUE_IF (!renderer, Null, ERR_INVALID_ARGUMENTS);
+
+    PROFILE_ZONE ("batch_renderer_merge_stagings_2d");
+
+    /* new stagings are added only by their threads, which are done drawing by now */
+    InstanceStaging2D **stagings      = instance_staging_2d_vector_data (&renderer->stagings_2d);
+    Size                staging_count = renderer->stagings_2d.count;
+
+    /* gather runs of all stagings, and find where each one ends */
+    staging_run_2d_vector_clear (&renderer->staging_runs_2d);
+    Bool is_sorted = True;
+    for (Size s = 0; s < staging_count; s++) {
+        InstanceStaging2D *staging = stagings[s];
+        StagingRun2D      *runs    = staging_run_2d_vector_data (&staging->runs);
+
+        for (Size r = 0; r < staging->runs.count; r++) {
+            StagingRun2D run = runs[r];
+            run.staging      = s;
+            run.sequence     = renderer->staging_runs_2d.count;
+
+            /* a run ends where next one begins */
+            Bool is_last      = r + 1 == staging->runs.count;
+            run.mesh_end      = is_last ? staging->meshes.count : runs[r + 1].mesh_begin;
+            run.primitive_end = is_last ? staging->primitives.count : runs[r + 1].primitive_begin;
+
+            StagingRun2D *merged = staging_run_2d_vector_push (&renderer->staging_runs_2d, &run);
+            GOTO_HANDLER_IF (
+                !merged,
+                MERGE_FAILED,
+                "Failed to resize vector to merge staged instances\n"
+            );
+
+            is_sorted = is_sorted && (!run.sequence || merged[-1].order <= run.order);
+        }
+    }
+
+    StagingRun2D *runs      = staging_run_2d_vector_data (&renderer->staging_runs_2d);
+    Size          run_count = renderer->staging_runs_2d.count;
+
+    /* usually everything is drawn with same key, and runs are already in order */
+    if (!is_sorted) {
+        qsort (runs, run_count, sizeof (StagingRun2D), compare_staging_runs_2d);
+    }
+
+    Bool is_ok = True;
+    if (renderer->is_sorting_2d) {
+        is_ok = batch_renderer_merge_sorted_2d (renderer, thread, stagings, runs, run_count);
+    } else {
+        MeshInstanceBatch2D *batch = Null;
+        for (Size r = 0; r < run_count; r++) {
+            InstanceStaging2D *staging    = stagings[runs[r].staging];
+            XuiMeshInstance2D *meshes     = mesh_instance_2d_vector_data (&staging->meshes);
+            XuiPrimitive2D    *primitives = primitive_2d_vector_data (&staging->primitives);
+
+            for (Size m = runs[r].mesh_begin; m < runs[r].mesh_end; m++) {
+                is_ok = batch_renderer_add_staged_mesh_2d (renderer, thread, meshes + m, &batch) &&
+                        is_ok;
+            }
+
+            for (Size p = runs[r].primitive_begin; p < runs[r].primitive_end; p++) {
+                is_ok = batch_renderer_add_staged_primitive_2d (renderer, thread, primitives + p) &&
+                        is_ok;
+            }
+        }
+    }
+
+    batch_renderer_reset_stagings_2d (renderer);
+
+    RETURN_VALUE_IF (!is_ok, Null, "Failed to add some of staged instances for drawing\n");
+
+    return renderer;
+
+MERGE_FAILED:
+    /* never merge same instances again in next display */
+    batch_renderer_reset_stagings_2d (renderer);
+    return Null;
+}
+
+BatchRenderer *batch_renderer_reset_batches_2d (BatchRenderer *renderer) {
+    RETURN_VALUE_IF (!renderer, Null, ERR_INVALID_ARGUMENTS);
+
+    MeshInstanceBatch2D *batches = mesh_instance_batch_2d_vector_data (&renderer->batches_2d);
+    for (Size s = 0; s < renderer->batches_2d.count; s++) {
+        mesh_instance_batch_reset_2d (batches + s);
+    }
+
+    primitive_2d_vector_clear (&renderer->primitives_2d.instances);
+    line_segment_2d_vector_clear (&renderer->lines_2d.instances);
+    polyline_batch_reset_2d (&renderer->polylines_2d);
+    text_batch_reset_2d (&renderer->text_2d);
+
+    return renderer;
+}
+
+BatchRenderer *batch_renderer_upload_batches_to_gpu_2d (BatchRenderer *renderer) {
+    RETURN_VALUE_IF (!renderer, Null, ERR_INVALID_ARGUMENTS);
+
+    PROFILE_ZONE ("batch_renderer_upload_batches_to_gpu_2d");
+
+    MeshInstanceBatch2D *batches = mesh_instance_batch_2d_vector_data (&renderer->batches_2d);
+    for (Size s = 0; s < renderer->batches_2d.count; s++) {
+        MeshInstanceBatch2D *batch      = batches + s;
+        VkBuffer             old_buffer = batch->device_data.buffer;
+
+        if (!mesh_instance_batch_upload_to_gpu_2d (batch)) {
+            continue;
+        }
+
+        /* device buffer is recreated when batch outgrows it */
+        if (batch->device_data.buffer != old_buffer) {
+            renderer->stats.frame.device_allocations++;
+        }
+
+        renderer->stats.frame.bytes_uploaded += sizeof (XuiMeshInstance2D) * batch->instances.count;
+    }
+
+    /* persistent slots upload only what changed since last display */
+    slot_batch_upload_to_gpu_2d (
+        &renderer->slots_2d,
+        &renderer->stats.frame.bytes_uploaded,
+        &renderer->stats.frame.device_allocations
+    );
+
+    /* primitives, lines and text are stored in single batches */
+    PrimitiveBatch2D *primitives = &renderer->primitives_2d;
+    LineBatch2D      *lines      = &renderer->lines_2d;
+    PolylineBatch2D  *polylines  = &renderer->polylines_2d;
+    TextBatch2D      *text       = &renderer->text_2d;
+
+    DeviceBuffer *buffers[] = {
+        &primitives->device_data,
+        &lines->device_data,
+        &polylines->device_data,
+        &text->device_data,
+        &text->sdf_device_data,
+    };
+    VkBuffer old_buffers[ARRAY_SIZE (buffers)];
+    for (Size s = 0; s < ARRAY_SIZE (buffers); s++) {
+        old_buffers[s] = buffers[s]->buffer;
+    }
+
+    if (primitive_batch_upload_to_gpu_2d (primitives)) {
+        renderer->stats.frame.bytes_uploaded +=
+            sizeof (XuiPrimitive2D) * primitives->instances.count;
+    }
+
+    if (line_batch_upload_to_gpu_2d (lines)) {
+        renderer->stats.frame.bytes_uploaded += sizeof (XuiLineSegment2D) * lines->instances.count;
+    }
+
+    if (polyline_batch_upload_to_gpu_2d (polylines)) {
+        renderer->stats.frame.bytes_uploaded += sizeof (Vec2f) * polylines->points.count;
+    }
+
+    if (text_batch_upload_to_gpu_2d (text)) {
+        renderer->stats.frame.bytes_uploaded +=
+            sizeof (GlyphInstance2D) * (text->instances.count + text->sdf_instances.count);
+    }
+
+    /* device buffers are recreated when batches outgrow them */
+    for (Size s = 0; s < ARRAY_SIZE (buffers); s++) {
+        if (buffers[s]->buffer != old_buffers[s]) {
+            renderer->stats.frame.device_allocations++;
+        }
+    }
+
+    return renderer;
+}
+
+/**
+ * @b Set view used to map 2D instance coordinates to clip space in next display.
+ *
+ * @param renderer
+ * @param view View to use. @c Null to use instance coordinates as normalized
+ *        device coordinates.
+ *
+ * @return @c renderer on success.
+ * @return @c Null otherwise.
+ * */
+BatchRenderer *batch_renderer_set_view_2d (BatchRenderer *renderer, XuiView2D *view) {
+    RETURN_VALUE_IF (!renderer, Null, ERR_INVALID_ARGUMENTS);
+
+    if (!view) {
+        renderer->is_view_2d_set = False;
+        return renderer;
+    }
+
+    RETURN_VALUE_IF (
+        !(view->zoom >= 0.f) || !(view->dpi_scale >= 0.f),
+        Null,
+        "Zoom and DPI scale of view must not be negative\n"
+    );
+
+    renderer->view_2d        = *view;
+    renderer->is_view_2d_set = True;
+
+    return renderer;
+}
+
+XuiRenderStatus batch_renderer_draw_2d (BatchRenderer *renderer, XuiMeshInstance2D *mesh_instance) {
+    RETURN_VALUE_IF (!renderer || !mesh_instance, XUI_RENDER_STATUS_ERR, ERR_INVALID_ARGUMENTS);
+
+    RETURN_VALUE_IF (
+        !batch_renderer_add_mesh_instance_2d (renderer, mesh_instance),
+        XUI_RENDER_STATUS_ERR,
+        "Failed to add mesh instance for drawing"
+    );
+
+    return XUI_RENDER_STATUS_OK;
+}
+
+XuiRenderStatus
+    batch_renderer_draw_primitive_2d (BatchRenderer *renderer, XuiPrimitive2D *primitive) {
+    RETURN_VALUE_IF (!renderer || !primitive, XUI_RENDER_STATUS_ERR, ERR_INVALID_ARGUMENTS);
+
+    RETURN_VALUE_IF (
+        primitive->type >= XUI_PRIMITIVE_TYPE_2D_MAX,
+        XUI_RENDER_STATUS_ERR,
+        "Invalid primitive type %u\n",
+        primitive->type
+    );
+
+    RETURN_VALUE_IF (
+        !primitive_2d_vector_push (&renderer->primitives_2d.instances, primitive),
+        XUI_RENDER_STATUS_ERR,
+        "Failed to add primitive for drawing\n"
+    );
 
-    /* find batch */
-    MeshInstanceBatch2D *batch =
-        batch_renderer_get_mesh_instance_batch_by_type_2d (renderer, mesh_instance->type);
+    return XUI_RENDER_STATUS_OK;
+}
 
-    /* create batch if not already created */
-    if (!batch) {
-        /* check if mesh type already exists */
-        RETURN_VALUE_IF (
-            !mesh_manager_get_mesh_data_by_type_2d (&vk.mesh_manager, mesh_instance->type),
-            Null,
-            "Mesh instance given with a non-existent mesh type. Cannot create batch\n"
-        );
+XuiRenderStatus batch_renderer_draw_line_2d (BatchRenderer *renderer, XuiLineSegment2D *line) {
+    RETURN_VALUE_IF (!renderer || !line, XUI_RENDER_STATUS_ERR, ERR_INVALID_ARGUMENTS);
 
-        /* resize if required */
-        if (renderer->batches_2d.count >= renderer->batches_2d.capacity) {
-            Size                 newcap = 0;
-            MeshInstanceBatch2D *tmpbuf = Null;
-            RETURN_VALUE_IF (
-                !(tmpbuf = mesh_instance_batch_2d_vector_resize (
-                      renderer->batches_2d.data,
-                      renderer->batches_2d.count,     /* from count */
-                      renderer->batches_2d.count + 1, /* to count */
-                      renderer->batches_2d.capacity,  /* from cap */
-                      &newcap /* to new cap (automatically set by the function) */
-                  )),
-                Null,
-                "Failed to resize vector to batches\n"
-            );
+    RETURN_VALUE_IF (
+        line->cap >= XUI_LINE_CAP_2D_MAX || !(line->width >= 0.f),
+        XUI_RENDER_STATUS_ERR,
+        "Invalid line cap or width\n"
+    );
 
-            renderer->batches_2d.data     = tmpbuf;
-            renderer->batches_2d.capacity = newcap;
-        }
+    RETURN_VALUE_IF (
+        !line_segment_2d_vector_push (&renderer->lines_2d.instances, line),
+        XUI_RENDER_STATUS_ERR,
+        "Failed to add line segment for drawing\n"
+    );
 
-        batch = renderer->batches_2d.data + renderer->batches_2d.count++;
-        mesh_instance_batch_init_2d (batch, mesh_instance->type);
-    }
+    return XUI_RENDER_STATUS_OK;
+}
 
-    /* insert mesh instance to corresponding batch */
-    mesh_instance_batch_add_instance_2d (batch, mesh_instance);
+XuiRenderStatus
+    batch_renderer_draw_polyline_2d (BatchRenderer *renderer, XuiPolyline2D *polyline) {
+    RETURN_VALUE_IF (!renderer || !polyline, XUI_RENDER_STATUS_ERR, ERR_INVALID_ARGUMENTS);
 
-    return renderer;
+    RETURN_VALUE_IF (
+        polyline->cap >= XUI_LINE_CAP_2D_MAX || polyline->join >= XUI_LINE_JOIN_2D_MAX ||
+            !(polyline->width >= 0.f),
+        XUI_RENDER_STATUS_ERR,
+        "Invalid polyline cap, join or width\n"
+    );
+
+    RETURN_VALUE_IF (
+        !polyline_batch_add_polyline_2d (&renderer->polylines_2d, polyline),
+        XUI_RENDER_STATUS_ERR,
+        "Failed to add polyline for drawing\n"
+    );
+
+    return XUI_RENDER_STATUS_OK;
 }
-BatchRenderer *batch_renderer_reset_batches_2d (BatchRenderer *renderer) {
-    RETURN_VALUE_IF (!renderer, Null, ERR_INVALID_ARGUMENTS);
 
-    for (Size s = 0; s < renderer->batches_2d.count; s++) {
-        mesh_instance_batch_reset_2d (renderer->batches_2d.data + s);
-    }
+/**
+ * @b Add glyph quads of given text to text batch.
+ *
+ * Text is rasterized for the view set when it's drawn, so it stays sharp at
+ * any zoom and DPI scale, as long as it's drawn again after view changes.
+ *
+ * @param renderer
+ * @param text
+ *
+ * @return @c XUI_RENDER_STATUS_OK on success.
+ * @return @c XUI_RENDER_STATUS_ERR otherwise.
+ * */
+XuiRenderStatus batch_renderer_draw_text_2d (BatchRenderer *renderer, XuiText2D *text) {
+    RETURN_VALUE_IF (!renderer || !text, XUI_RENDER_STATUS_ERR, ERR_INVALID_ARGUMENTS);
 
-    return renderer;
+    RETURN_VALUE_IF (
+        !text->text || !(text->size >= 0.f),
+        XUI_RENDER_STATUS_ERR,
+        "Invalid text or text size\n"
+    );
+
+    RETURN_VALUE_IF (
+        !text_batch_add_text_2d (
+            &renderer->text_2d,
+            text,
+            get_view_scale_2d (renderer),
+            &renderer->stats.frame.glyphs_rasterized,
+            &renderer->stats.frame.text_layouts
+        ),
+        XUI_RENDER_STATUS_ERR,
+        "Failed to add text for drawing\n"
+    );
+
+    return XUI_RENDER_STATUS_OK;
 }
 
-BatchRenderer *batch_renderer_upload_batches_to_gpu_2d (BatchRenderer *renderer) {
-    RETURN_VALUE_IF (!renderer, Null, ERR_INVALID_ARGUMENTS);
+/**
+ * @b Replace distance field glyphs cached by renderer with ones saved to given file.
+ *
+ * Distance field text already added for next display refers to glyphs being
+ * replaced, so cache can only be loaded before any such text is drawn.
+ *
+ * @param renderer
+ * @param path Path of file saved by @c batch_renderer_save_sdf_cache.
+ *
+ * @return @c renderer on success.
+ * @return @c Null otherwise.
+ * */
+BatchRenderer *batch_renderer_load_sdf_cache (BatchRenderer *renderer, CString path) {
+    RETURN_VALUE_IF (!renderer || !path, Null, ERR_INVALID_ARGUMENTS);
 
-    for (Size s = 0; s < renderer->batches_2d.count; s++) {
-        mesh_instance_batch_upload_to_gpu_2d (renderer->batches_2d.data + s);
-    }
+    TextBatch2D *text = &renderer->text_2d;
+    RETURN_VALUE_IF (
+        text->sdf_instances.count,
+        Null,
+        "Distance field glyph cache can't be loaded while distance field text is being drawn\n"
+    );
+
+    RETURN_VALUE_IF (
+        !glyph_atlas_load (&text->sdf_glyph_cache.atlas, path),
+        Null,
+        "Failed to load distance field glyph cache\n"
+    );
 
     return renderer;
 }
 
-XuiRenderStatus batch_renderer_draw_2d (BatchRenderer *renderer, XuiMeshInstance2D *mesh_instance) {
-    RETURN_VALUE_IF (!renderer || !mesh_instance, XUI_RENDER_STATUS_ERR, ERR_INVALID_ARGUMENTS);
+/**
+ * @b Save distance field glyphs cached by renderer to given file.
+ *
+ * @param renderer
+ * @param path Path of file to write to.
+ *
+ * @return @c renderer on success.
+ * @return @c Null otherwise.
+ * */
+BatchRenderer *batch_renderer_save_sdf_cache (BatchRenderer *renderer, CString path) {
+    RETURN_VALUE_IF (!renderer || !path, Null, ERR_INVALID_ARGUMENTS);
 
     RETURN_VALUE_IF (
-        !batch_renderer_add_mesh_instance_2d (renderer, mesh_instance),
-        XUI_RENDER_STATUS_ERR,
-        "Failed to add mesh instance for drawing"
+        !glyph_atlas_save (&renderer->text_2d.sdf_glyph_cache.atlas, path),
+        Null,
+        "Failed to save distance field glyph cache\n"
     );
 
-    return XUI_RENDER_STATUS_OK;
+    return renderer;
 }
 
+/**
+ * @b Draw all batches to next image of swapchain, and present it.
+ *
+ * Must be called without holding @c vk.resource_mutex. It's taken only while
+ * commands are recorded from shared meshes, and while queue is submitted to,
+ * so fence waits of one graphics context never block other threads.
+ *
+ * @param renderer
+ * @param swapchain
+ * @param win
+ *
+ * @return @c XUI_RENDER_STATUS_OK, XUI_RENDER_STATUS_CONTINUE on success.
+ * @return @c XUI_RENDER_STATUS_ERR otherwise.
+ * */
 XuiRenderStatus
     batch_renderer_display (BatchRenderer *renderer, Swapchain *swapchain, XwWindow *win) {
     RETURN_VALUE_IF (!renderer || !swapchain || !win, XUI_RENDER_STATUS_ERR, ERR_INVALID_ARGUMENTS);
 
-    RenderPass       *render_pass      = &renderer->default_render_pass;
-    GraphicsPipeline *default_pipeline = &render_pass->pipelines.default_graphics;
+    PROFILE_FRAME_MARK ("frame");
+    PROFILE_ZONE ("batch_renderer_display");
+
+    /* glyphs and layouts looked up since previous display belong to this frame */
+    if (!text_batch_begin_frame_2d (&renderer->text_2d)) {
+        PRINT_ERR ("Failed to begin frame in text batch\n");
+    }
+
+    TextLayoutCache *layout_cache = &renderer->text_2d.layout_cache;
+    if (layout_cache->bytes > layout_cache->budget) {
+        PRINT_ERR (
+            "Text layouts take %zu bytes, over budget of %zu bytes\n",
+            layout_cache->bytes,
+            layout_cache->budget
+        );
+    }
+    renderer->stats.frame.text_layout_bytes = layout_cache->bytes;
+
+    RenderPass       *render_pass        = &renderer->default_render_pass;
+    GraphicsPipeline *default_pipeline   = &render_pass->pipelines.default_graphics;
+    GraphicsPipeline *primitive_pipeline = &render_pass->pipelines.primitive_2d;
+    GraphicsPipeline *line_pipeline      = &render_pass->pipelines.line_2d;
+    GraphicsPipeline *polyline_pipeline  = &render_pass->pipelines.polyline_2d;
+    GraphicsPipeline *text_pipeline      = &render_pass->pipelines.text_2d;
+    GraphicsPipeline *text_sdf_pipeline  = &render_pass->pipelines.text_sdf_2d;
 
     BeginEndInfo info = {0};
 
     /* begin frame rendering and command recording,
      * will get new frame data in info struct */
     XuiRenderStatus status = begin_frame (render_pass, swapchain, win, &info);
+    renderer->stats.frame.fence_wait_ns += info.fence_wait_ns;
     if (status != XUI_RENDER_STATUS_OK) {
+        renderer->stats.frame.continue_count += status == XUI_RENDER_STATUS_CONTINUE;
+        render_stats_commit_frame (&renderer->stats, swapchain->reinit_count);
         return status;
     }
 
     VkCommandBuffer cmd = info.frame_data->command.buffer;
 
+    /* recording reads shared meshes, and may wait for device idle on reinit or
+     * buffer growth, which needs all queues to be externally synchronized */
+    pthread_mutex_lock (&vk.resource_mutex);
+
     /* Since we're not clearing color images, the transition won't happen automatically.
      * For this, we need to transition these images ourselves before we begin renderpass */
     if (swapchain->is_reinited) {
         PRINT_ERR ("Changed image layout on renit\n");
 
         /* wait for pending device operations to complete */
-        vkDeviceWaitIdle (vk.device.logical);
+        {
+            PROFILE_WAIT_ZONE ("device_wait_idle");
+            vkDeviceWaitIdle (vk.device.logical);
+        }
 
         /* change layout of all images */
         swapchain_change_image_layout (
@@ -378,6 +1903,25 @@ XuiRenderStatus
         );
     }
 
+    /* copy glyphs rasterized since last display to atlas images, before render pass samples them */
+    {
+        Uint32 frame_slot     = info.frame_data - render_pass->frame_data;
+        Size   bytes_uploaded = 0;
+        glyph_cache_record_upload (
+            &renderer->text_2d.glyph_cache,
+            cmd,
+            frame_slot,
+            &bytes_uploaded
+        );
+        glyph_cache_record_upload (
+            &renderer->text_2d.sdf_glyph_cache,
+            cmd,
+            frame_slot,
+            &bytes_uploaded
+        );
+        renderer->stats.frame.bytes_uploaded += bytes_uploaded;
+    }
+
     /* begin render pass */
     {
         VkRenderPassBeginInfo render_pass_begin_info = {
@@ -392,49 +1936,282 @@ XuiRenderStatus
         vkCmdBeginRenderPass (cmd, &render_pass_begin_info, VK_SUBPASS_CONTENTS_INLINE);
     }
 
+    /* viewport and scissor are dynamic and shared by all pipelines */
+    {
+        VkExtent2D extent = swapchain->image_extent;
+
+        VkViewport viewport = {
+            .x        = 0,
+            .y        = 0,
+            .width    = extent.width,
+            .height   = extent.height,
+            .minDepth = 0.f,
+            .maxDepth = 1.f
+        };
+        vkCmdSetViewport (cmd, 0, 1, &viewport);
+
+        VkRect2D scissor = {.offset = {.x = 0, .y = 0}, .extent = extent};
+        vkCmdSetScissor (cmd, 0, 1, &scissor);
+    }
+
     vkCmdBindPipeline (cmd, VK_PIPELINE_BIND_POINT_GRAPHICS, default_pipeline->pipeline);
 
+    /* pipelines in default render pass have identical push constant ranges, so push
+     * constants stay valid across pipeline binds and are pushed just once */
+    {
+        DefaultPushConstants push_constants;
+        get_view_transform_2d (&push_constants.view, renderer, swapchain->image_extent);
+        push_constants.viewport_size = (Vec2f) {
+            .x = swapchain->image_extent.width,
+            .y = swapchain->image_extent.height
+        };
+
+        vkCmdPushConstants (
+            cmd,
+            default_pipeline->pipeline_layout,
+            VK_SHADER_STAGE_VERTEX_BIT,
+            0,
+            sizeof (push_constants),
+            &push_constants
+        );
+    }
+
     batch_renderer_upload_batches_to_gpu_2d (renderer);
 
-    /* issue a draw call for each batch just once */
-    for (Size s = 0; s < renderer->batches_2d.count; s++) {
-        /* get batch */
-        MeshInstanceBatch2D *batch = renderer->batches_2d.data + s;
+    /* issue a draw call for each batch just once, in order of their keys, so
+     * blended instances are drawn over all opaque ones */
+    {
+        PROFILE_ZONE ("record_draw_commands");
 
-        /* skip if batch as no instances */
-        if (!batch->instances.count) {
-            continue;
+        MeshInstanceBatch2D *batches = mesh_instance_batch_2d_vector_data (&renderer->batches_2d);
+        for (Size s = 0; s < renderer->batches_2d.count; s++) {
+            /* get batch */
+            MeshInstanceBatch2D *batch = batches + s;
+
+            /* skip if batch as no instances */
+            if (!batch->instances.count) {
+                continue;
+            }
+
+            /* get mesh data */
+            MeshData2D *mesh =
+                mesh_manager_get_mesh_data_by_type_2d (&vk.mesh_manager, batch->mesh_type);
+
+            /* bind shape data */
+            vkCmdBindVertexBuffers (
+                cmd,
+                0,                                                             /* first binding */
+                2,                                                             /* binding count */
+                (VkBuffer[]) {mesh->vertex.buffer, batch->device_data.buffer}, /* buffers */
+                (VkDeviceSize[]) {0, 0}                                        /* offsets */
+            );
+
+            vkCmdBindIndexBuffer (cmd, mesh->index.buffer, 0, VK_INDEX_TYPE_UINT32);
+
+            /* draw */
+            vkCmdDrawIndexed (cmd, mesh->index_count, batch->instances.count, 0, 0, 0);
+
+            renderer->stats.frame.draw_calls++;
+            renderer->stats.frame.batches++;
+            renderer->stats.frame.instances += batch->instances.count;
         }
 
-        /* get mesh data */
-        MeshData2D *mesh =
-            mesh_manager_get_mesh_data_by_type_2d (&vk.mesh_manager, batch->mesh_type);
+        /* persistent slots are drawn with one draw call per group, and a group
+         * whose upload failed is skipped instead of reading past it's buffer */
+        SlotGroup2D *slot_groups = slot_group_2d_vector_data (&renderer->slots_2d.groups);
+        for (Size s = 0; s < renderer->slots_2d.groups.count; s++) {
+            SlotGroup2D *group = slot_groups + s;
+            Size         count = group->owners.count;
+            if (!count || group->device_data.size < group->contents.count) {
+                continue;
+            }
+
+            if (group->slot_type == XUI_SLOT_TYPE_2D_MESH) {
+                MeshData2D *mesh =
+                    mesh_manager_get_mesh_data_by_type_2d (&vk.mesh_manager, group->mesh_type);
 
-        /* bind shape data */
-        vkCmdBindVertexBuffers (
-            cmd,
-            0,                                                             /* first binding */
-            2,                                                             /* binding count */
-            (VkBuffer[]) {mesh->vertex.buffer, batch->device_data.buffer}, /* buffers */
-            (VkDeviceSize[]) {0, 0}                                        /* offsets */
-        );
+                vkCmdBindPipeline (
+                    cmd,
+                    VK_PIPELINE_BIND_POINT_GRAPHICS,
+                    default_pipeline->pipeline
+                );
+
+                vkCmdBindVertexBuffers (
+                    cmd,
+                    0,                                                   /* first binding */
+                    2,                                                   /* binding count */
+                    (VkBuffer[]) {mesh->vertex.buffer, group->device_data.buffer}, /* buffers */
+                    (VkDeviceSize[]) {0, 0}                              /* offsets */
+                );
+
+                vkCmdBindIndexBuffer (cmd, mesh->index.buffer, 0, VK_INDEX_TYPE_UINT32);
+                vkCmdDrawIndexed (cmd, mesh->index_count, count, 0, 0, 0);
+            } else {
+                vkCmdBindPipeline (
+                    cmd,
+                    VK_PIPELINE_BIND_POINT_GRAPHICS,
+                    primitive_pipeline->pipeline
+                );
+
+                vkCmdBindVertexBuffers (
+                    cmd,
+                    0,                                         /* first binding */
+                    1,                                         /* binding count */
+                    (VkBuffer[]) {group->device_data.buffer}, /* buffers */
+                    (VkDeviceSize[]) {0}                       /* offsets */
+                );
+
+                vkCmdDraw (cmd, 4, count, 0, 0);
+            }
+
+            renderer->stats.frame.draw_calls++;
+            renderer->stats.frame.batches++;
+            renderer->stats.frame.instances += count;
+        }
+
+        /* draw all primitives on top of meshes, with a single instanced quad draw */
+        PrimitiveBatch2D *primitives = &renderer->primitives_2d;
+        if (primitives->instances.count) {
+            vkCmdBindPipeline (cmd, VK_PIPELINE_BIND_POINT_GRAPHICS, primitive_pipeline->pipeline);
+
+            vkCmdBindVertexBuffers (
+                cmd,
+                0,                                              /* first binding */
+                1,                                              /* binding count */
+                (VkBuffer[]) {primitives->device_data.buffer}, /* buffers */
+                (VkDeviceSize[]) {0}                            /* offsets */
+            );
+
+            /* 4 vertices make a quad as triangle strip */
+            vkCmdDraw (cmd, 4, primitives->instances.count, 0, 0);
+
+            renderer->stats.frame.draw_calls++;
+            renderer->stats.frame.batches++;
+            renderer->stats.frame.instances += primitives->instances.count;
+        }
+
+        /* independent line segments are drawn with a single instanced draw too */
+        LineBatch2D *lines = &renderer->lines_2d;
+        if (lines->instances.count) {
+            vkCmdBindPipeline (cmd, VK_PIPELINE_BIND_POINT_GRAPHICS, line_pipeline->pipeline);
+
+            vkCmdBindVertexBuffers (
+                cmd,
+                0,                                         /* first binding */
+                1,                                         /* binding count */
+                (VkBuffer[]) {lines->device_data.buffer}, /* buffers */
+                (VkDeviceSize[]) {0}                       /* offsets */
+            );
+
+            vkCmdDraw (cmd, 4, lines->instances.count, 0, 0);
+
+            renderer->stats.frame.draw_calls++;
+            renderer->stats.frame.batches++;
+            renderer->stats.frame.instances += lines->instances.count;
+        }
 
-        vkCmdBindIndexBuffer (cmd, mesh->index.buffer, 0, VK_INDEX_TYPE_UINT32);
+        /* polylines share a point stream, each one is drawn with it's own style,
+         * with first instance selecting where it's points begin in the stream */
+        PolylineBatch2D *polylines = &renderer->polylines_2d;
+        if (polylines->draws.count) {
+            vkCmdBindPipeline (cmd, VK_PIPELINE_BIND_POINT_GRAPHICS, polyline_pipeline->pipeline);
+
+            vkCmdBindVertexBuffers (
+                cmd,
+                0,                                             /* first binding */
+                1,                                             /* binding count */
+                (VkBuffer[]) {polylines->device_data.buffer}, /* buffers */
+                (VkDeviceSize[]) {0}                           /* offsets */
+            );
+
+            PolylineDraw2D *draws = polyline_draw_2d_vector_data (&polylines->draws);
+            for (Size s = 0; s < polylines->draws.count; s++) {
+                vkCmdPushConstants (
+                    cmd,
+                    polyline_pipeline->pipeline_layout,
+                    VK_SHADER_STAGE_VERTEX_BIT,
+                    offsetof (DefaultPushConstants, polyline),
+                    sizeof (PolylineStyle2D),
+                    &draws[s].style
+                );
+
+                vkCmdDraw (cmd, 4, draws[s].segment_count, 0, draws[s].first_point);
+
+                renderer->stats.frame.draw_calls++;
+                renderer->stats.frame.instances += draws[s].segment_count;
+            }
+
+            renderer->stats.frame.batches++;
+        }
+
+        /* text is drawn last, on top of everything, with a single instanced quad draw
+         * for bitmap glyphs and another for distance field glyphs */
+        TextBatch2D *text = &renderer->text_2d;
+        struct {
+            GraphicsPipeline      *pipeline;
+            GlyphInstance2DVector *instances;
+            DeviceBuffer          *device_data;
+        } text_draws[] = {
+            {text_pipeline, &text->instances, &text->device_data},
+            {text_sdf_pipeline, &text->sdf_instances, &text->sdf_device_data},
+        };
+
+        for (Size s = 0; s < ARRAY_SIZE (text_draws); s++) {
+            GraphicsPipeline *pipeline = text_draws[s].pipeline;
+            Size              count    = text_draws[s].instances->count;
+            if (!count) {
+                continue;
+            }
+
+            vkCmdBindPipeline (cmd, VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline->pipeline);
+
+            vkCmdBindDescriptorSets (
+                cmd,
+                VK_PIPELINE_BIND_POINT_GRAPHICS,
+                pipeline->pipeline_layout,
+                0,
+                1,
+                &pipeline->descriptor_set,
+                0,
+                Null
+            );
 
-        /* draw */
-        vkCmdDrawIndexed (cmd, mesh->index_count, batch->instances.count, 0, 0, 0);
+            vkCmdBindVertexBuffers (
+                cmd,
+                0,                                                 /* first binding */
+                1,                                                 /* binding count */
+                (VkBuffer[]) {text_draws[s].device_data->buffer}, /* buffers */
+                (VkDeviceSize[]) {0}                               /* offsets */
+            );
+
+            vkCmdDraw (cmd, 4, count, 0, 0);
+
+            renderer->stats.frame.draw_calls++;
+            renderer->stats.frame.batches++;
+            renderer->stats.frame.instances += count;
+        }
     }
 
     /* end render pass */
     vkCmdEndRenderPass (cmd);
 
+    pthread_mutex_unlock (&vk.resource_mutex);
+
     /* end command recording, submit for rendering and present to screen */
-    return end_frame (render_pass, swapchain, win, &info);
+    status = end_frame (render_pass, swapchain, win, &info);
+
+    renderer->stats.frame.continue_count += status == XUI_RENDER_STATUS_CONTINUE;
+    render_stats_commit_frame (&renderer->stats, swapchain->reinit_count);
+
+    return status;
 }
 
 /**
  * @b Clear next frame instead of drawing something to it.
  *
+ * Must be called without holding @c vk.resource_mutex, which is taken only
+ * to submit to queue.
+ *
  * @param gctx
  * @param win
  *
@@ -445,14 +2222,21 @@ XuiRenderStatus
     batch_renderer_clear (BatchRenderer *renderer, Swapchain *swapchain, XwWindow *win) {
     RETURN_VALUE_IF (!renderer || !swapchain || !win, XUI_RENDER_STATUS_ERR, ERR_INVALID_ARGUMENTS);
 
+    PROFILE_ZONE ("batch_renderer_clear");
+
     RenderPass *render_pass = &renderer->default_render_pass;
     FrameData  *frame_data  = render_pass->frame_data + (render_pass->frame_index % FRAME_LIMIT);
 
     /* wait for prending operations */
     {
         /* wait for rendering operations to complete for selected fence */
-        VkResult res =
-            vkWaitForFences (vk.device.logical, 1, &frame_data->sync.render_fence, True, 1e9);
+        VkResult res;
+        {
+            PROFILE_WAIT_ZONE ("wait_render_fence");
+            Uint64 wait_begin_ns = profiler_now_ns();
+            res = vkWaitForFences (vk.device.logical, 1, &frame_data->sync.render_fence, True, 1e9);
+            renderer->stats.frame.fence_wait_ns += profiler_now_ns() - wait_begin_ns;
+        }
         RETURN_VALUE_IF (
             res != VK_SUCCESS,
             XUI_RENDER_STATUS_ERR,
@@ -551,35 +2335,257 @@ XuiRenderStatus
                 .pCommandBuffers      = &cmd
             };
 
-            VkResult res = vkQueueSubmit (
-                vk.device.graphics_queue.handle,
-                1,
-                &submit_info,
-                frame_data->sync.render_fence
-            );
+            pthread_mutex_lock (&vk.resource_mutex);
+            VkResult res = vkQueueSubmit (
+                vk.device.graphics_queue.handle,
+                1,
+                &submit_info,
+                frame_data->sync.render_fence
+            );
+            pthread_mutex_unlock (&vk.resource_mutex);
+
+            RETURN_VALUE_IF (
+                res != VK_SUCCESS,
+                XUI_RENDER_STATUS_ERR,
+                "Failed to submit command buffers for execution. RET = %d\n",
+                res
+            );
+        }
+    }
+    return XUI_RENDER_STATUS_OK;
+}
+
+XuiRenderStatus gfx_draw_2d (XuiGraphicsContext *gctx, XuiMeshInstance2D *mesh_instance) {
+    RETURN_VALUE_IF (!gctx || !mesh_instance, XUI_RENDER_STATUS_ERR, ERR_INVALID_ARGUMENTS);
+
+    /* mesh type is checked when staged instances are merged on display */
+    InstanceStaging2D *staging = batch_renderer_get_staging_2d (&gctx->batch_renderer);
+    return staging && instance_staging_add_mesh_instance_2d (staging, mesh_instance) ?
+               XUI_RENDER_STATUS_OK :
+               XUI_RENDER_STATUS_ERR;
+}
+XuiRenderStatus gfx_draw_primitive_2d (XuiGraphicsContext *gctx, XuiPrimitive2D *primitive) {
+    RETURN_VALUE_IF (!gctx || !primitive, XUI_RENDER_STATUS_ERR, ERR_INVALID_ARGUMENTS);
+    RETURN_VALUE_IF (
+        primitive->type >= XUI_PRIMITIVE_TYPE_2D_MAX,
+        XUI_RENDER_STATUS_ERR,
+        "Invalid primitive type %u\n",
+        primitive->type
+    );
+
+    InstanceStaging2D *staging = batch_renderer_get_staging_2d (&gctx->batch_renderer);
+    return staging && instance_staging_add_primitive_2d (staging, primitive) ?
+               XUI_RENDER_STATUS_OK :
+               XUI_RENDER_STATUS_ERR;
+}
+Bool gfx_set_instance_sort_2d (XuiGraphicsContext *gctx, Bool is_enabled) {
+    RETURN_VALUE_IF (!gctx, False, ERR_INVALID_ARGUMENTS);
+
+    gctx->batch_renderer.is_sorting_2d = is_enabled;
+    return True;
+}
+Bool gfx_set_draw_order_2d (XuiGraphicsContext *gctx, Uint32 order) {
+    RETURN_VALUE_IF (!gctx, False, ERR_INVALID_ARGUMENTS);
+
+    InstanceStaging2D *staging = batch_renderer_get_staging_2d (&gctx->batch_renderer);
+    RETURN_VALUE_IF (!staging, False, "Failed to get staging of calling thread\n");
+
+    staging->order = order;
+    return True;
+}
+XuiRenderStatus gfx_draw_line_2d (XuiGraphicsContext *gctx, XuiLineSegment2D *line) {
+    RETURN_VALUE_IF (!gctx || !line, XUI_RENDER_STATUS_ERR, ERR_INVALID_ARGUMENTS);
+    if (gctx->render_thread.is_running) {
+        FrameCommand command = {.type = FRAME_COMMAND_TYPE_DRAW_LINE_2D, .line = *line};
+        return render_thread_record (&gctx->render_thread, &command, Null, 0) ?
+                   XUI_RENDER_STATUS_OK :
+                   XUI_RENDER_STATUS_ERR;
+    }
+    return batch_renderer_draw_line_2d (&gctx->batch_renderer, line);
+}
+XuiRenderStatus gfx_draw_polyline_2d (XuiGraphicsContext *gctx, XuiPolyline2D *polyline) {
+    RETURN_VALUE_IF (!gctx || !polyline, XUI_RENDER_STATUS_ERR, ERR_INVALID_ARGUMENTS);
+    if (gctx->render_thread.is_running) {
+        RETURN_VALUE_IF (!polyline->points, XUI_RENDER_STATUS_ERR, ERR_INVALID_ARGUMENTS);
+
+        /* points are copied into snapshot, and found there again when replayed */
+        FrameCommand command = {.type = FRAME_COMMAND_TYPE_DRAW_POLYLINE_2D, .polyline = *polyline};
+        return render_thread_record (
+                   &gctx->render_thread,
+                   &command,
+                   polyline->points,
+                   polyline->point_count * sizeof (Vec2f)
+               ) ?
+                   XUI_RENDER_STATUS_OK :
+                   XUI_RENDER_STATUS_ERR;
+    }
+    return batch_renderer_draw_polyline_2d (&gctx->batch_renderer, polyline);
+}
+XuiRenderStatus gfx_draw_text_2d (XuiGraphicsContext *gctx, XuiText2D *text) {
+    RETURN_VALUE_IF (!gctx || !text, XUI_RENDER_STATUS_ERR, ERR_INVALID_ARGUMENTS);
+    if (gctx->render_thread.is_running) {
+        RETURN_VALUE_IF (!text->text, XUI_RENDER_STATUS_ERR, ERR_INVALID_ARGUMENTS);
+
+        /* text is copied into snapshot, and found there again when replayed */
+        FrameCommand command = {.type = FRAME_COMMAND_TYPE_DRAW_TEXT_2D, .text = *text};
+        command.text.length  = text->length ? text->length : strlen (text->text);
+        return render_thread_record (
+                   &gctx->render_thread,
+                   &command,
+                   text->text,
+                   command.text.length
+               ) ?
+                   XUI_RENDER_STATUS_OK :
+                   XUI_RENDER_STATUS_ERR;
+    }
+
+    /* font faces are shared with render threads of other contexts */
+    pthread_mutex_lock (&vk.resource_mutex);
+    XuiRenderStatus status = batch_renderer_draw_text_2d (&gctx->batch_renderer, text);
+    pthread_mutex_unlock (&vk.resource_mutex);
+
+    return status;
+}
+Bool gfx_sdf_cache_load (XuiGraphicsContext *gctx, CString path) {
+    RETURN_VALUE_IF (!gctx || !path, False, ERR_INVALID_ARGUMENTS);
+    if (gctx->render_thread.is_running) {
+        pthread_mutex_lock (&gctx->render_thread.renderer_mutex);
+        Bool is_loaded = !!batch_renderer_load_sdf_cache (&gctx->batch_renderer, path);
+        pthread_mutex_unlock (&gctx->render_thread.renderer_mutex);
+        return is_loaded;
+    }
+    return !!batch_renderer_load_sdf_cache (&gctx->batch_renderer, path);
+}
+Bool gfx_sdf_cache_save (XuiGraphicsContext *gctx, CString path) {
+    RETURN_VALUE_IF (!gctx || !path, False, ERR_INVALID_ARGUMENTS);
+    if (gctx->render_thread.is_running) {
+        pthread_mutex_lock (&gctx->render_thread.renderer_mutex);
+        Bool is_saved = !!batch_renderer_save_sdf_cache (&gctx->batch_renderer, path);
+        pthread_mutex_unlock (&gctx->render_thread.renderer_mutex);
+        return is_saved;
+    }
+    return !!batch_renderer_save_sdf_cache (&gctx->batch_renderer, path);
+}
+XuiRenderStatus gfx_display (XuiGraphicsContext *gctx, XwWindow *win) {
+    RETURN_VALUE_IF (!gctx || !win, XUI_RENDER_STATUS_ERR, ERR_INVALID_ARGUMENTS);
+
+    BatchRenderer *renderer = &gctx->batch_renderer;
+
+    if (gctx->render_thread.is_running) {
+        RenderThread *thread    = &gctx->render_thread;
+        Bool          is_merged = !!batch_renderer_merge_stagings_2d (renderer, thread);
+
+        XuiRenderStatus status = render_thread_publish (thread);
+        return is_merged ? status : XUI_RENDER_STATUS_ERR;
+    }
+
+    /* merged instances are checked against meshes, which other threads may be uploading */
+    pthread_mutex_lock (&vk.resource_mutex);
+    Bool is_merged = !!batch_renderer_merge_stagings_2d (renderer, Null);
+    pthread_mutex_unlock (&vk.resource_mutex);
+
+    /* takes resource lock only while it's needed, render threads of other contexts
+     * may be submitting to same queue */
+    XuiRenderStatus status = batch_renderer_display (renderer, &gctx->swapchain, win);
+
+    return is_merged ? status : XUI_RENDER_STATUS_ERR;
+}
+XuiRenderStatus gfx_clear (XuiGraphicsContext *gctx, XwWindow *win) {
+    RETURN_VALUE_IF (!gctx || !win, XUI_RENDER_STATUS_ERR, ERR_INVALID_ARGUMENTS);
+    if (gctx->render_thread.is_running) {
+        FrameCommand command = {.type = FRAME_COMMAND_TYPE_CLEAR, .win = win};
+        return render_thread_record (&gctx->render_thread, &command, Null, 0) ?
+                   XUI_RENDER_STATUS_OK :
+                   XUI_RENDER_STATUS_ERR;
+    }
+
+    return batch_renderer_clear (&gctx->batch_renderer, &gctx->swapchain, win);
+}
+Bool gfx_reset_2d (XuiGraphicsContext *gctx) {
+    RETURN_VALUE_IF (!gctx, False, ERR_INVALID_ARGUMENTS);
+
+    batch_renderer_reset_stagings_2d (&gctx->batch_renderer);
+
+    if (gctx->render_thread.is_running) {
+        FrameCommand command = {.type = FRAME_COMMAND_TYPE_RESET_2D};
+        return !!render_thread_record (&gctx->render_thread, &command, Null, 0);
+    }
+
+    return !!batch_renderer_reset_batches_2d (&gctx->batch_renderer);
+}
+void *gfx_frame_scratch_alloc (XuiGraphicsContext *gctx, Size size, Size alignment) {
+    RETURN_VALUE_IF (!gctx || !size, Null, ERR_INVALID_ARGUMENTS);
+
+    if (!alignment) {
+        alignment = alignof (max_align_t);
+    }
+
+    /* frame arenas of render pass are reset by render thread */
+    if (gctx->render_thread.is_running) {
+        return arena_alloc (&gctx->render_thread.scratch, size, alignment);
+    }
+
+    Arena *arena = render_pass_get_frame_arena (&gctx->batch_renderer.default_render_pass);
+    RETURN_VALUE_IF (!arena, Null, "Failed to get frame arena\n");
 
-            RETURN_VALUE_IF (
-                res != VK_SUCCESS,
-                XUI_RENDER_STATUS_ERR,
-                "Failed to submit command buffers for execution. RET = %d\n",
-                res
-            );
+    return arena_alloc (arena, size, alignment);
+}
+Bool gfx_set_view_2d (XuiGraphicsContext *gctx, XuiView2D *view) {
+    RETURN_VALUE_IF (!gctx, False, ERR_INVALID_ARGUMENTS);
+    if (gctx->render_thread.is_running) {
+        FrameCommand command = {.type = FRAME_COMMAND_TYPE_SET_VIEW_2D, .is_view_set = !!view};
+        if (view) {
+            command.view = *view;
         }
+        return !!render_thread_record (&gctx->render_thread, &command, Null, 0);
     }
-    return XUI_RENDER_STATUS_OK;
+    return !!batch_renderer_set_view_2d (&gctx->batch_renderer, view);
+}
+XuiSlot2D gfx_slot_create_2d (XuiGraphicsContext *gctx) {
+    RETURN_VALUE_IF (!gctx, 0, ERR_INVALID_ARGUMENTS);
+    if (gctx->render_thread.is_running) {
+        return render_thread_create_slot (&gctx->render_thread);
+    }
+    return slot_batch_create_slot_2d (&gctx->batch_renderer.slots_2d);
 }
+Bool gfx_slot_update_2d (XuiGraphicsContext *gctx, XuiSlot2D slot, XuiSlotContent2D *content) {
+    RETURN_VALUE_IF (!gctx || !content, False, ERR_INVALID_ARGUMENTS);
+    if (gctx->render_thread.is_running) {
+        return !!render_thread_update_slot (&gctx->render_thread, slot, content);
+    }
 
-XuiRenderStatus gfx_draw_2d (XuiGraphicsContext *gctx, XuiMeshInstance2D *mesh_instance) {
-    RETURN_VALUE_IF (!gctx || !mesh_instance, XUI_RENDER_STATUS_ERR, ERR_INVALID_ARGUMENTS);
-    return batch_renderer_draw_2d (&gctx->batch_renderer, mesh_instance);
+    pthread_mutex_lock (&vk.resource_mutex);
+    Bool is_updated = !!slot_batch_update_slot_2d (&gctx->batch_renderer.slots_2d, slot, content);
+    pthread_mutex_unlock (&vk.resource_mutex);
+
+    return is_updated;
 }
-XuiRenderStatus gfx_display (XuiGraphicsContext *gctx, XwWindow *win) {
-    RETURN_VALUE_IF (!gctx || !win, XUI_RENDER_STATUS_ERR, ERR_INVALID_ARGUMENTS);
-    return batch_renderer_display (&gctx->batch_renderer, &gctx->swapchain, win);
+Bool gfx_slot_destroy_2d (XuiGraphicsContext *gctx, XuiSlot2D slot) {
+    RETURN_VALUE_IF (!gctx, False, ERR_INVALID_ARGUMENTS);
+    if (gctx->render_thread.is_running) {
+        return !!render_thread_destroy_slot (&gctx->render_thread, slot);
+    }
+    return !!slot_batch_destroy_slot_2d (&gctx->batch_renderer.slots_2d, slot);
 }
-XuiRenderStatus gfx_clear (XuiGraphicsContext *gctx, XwWindow *win) {
-    RETURN_VALUE_IF (!gctx || !win, XUI_RENDER_STATUS_ERR, ERR_INVALID_ARGUMENTS);
-    return batch_renderer_clear (&gctx->batch_renderer, &gctx->swapchain, win);
+Bool gfx_get_stats (XuiGraphicsContext *gctx, XuiRenderStats *stats) {
+    RETURN_VALUE_IF (!gctx || !stats, False, ERR_INVALID_ARGUMENTS);
+    if (gctx->render_thread.is_running) {
+        return !!render_thread_get_stats (&gctx->render_thread, stats);
+    }
+    *stats = gctx->batch_renderer.stats.stats;
+    return True;
+}
+void gfx_reset_stats (XuiGraphicsContext *gctx) {
+    RETURN_IF (!gctx, ERR_INVALID_ARGUMENTS);
+    if (gctx->render_thread.is_running) {
+        FrameCommand command = {.type = FRAME_COMMAND_TYPE_RESET_STATS};
+        RETURN_IF (
+            !render_thread_record (&gctx->render_thread, &command, Null, 0),
+            "Failed to record reset of render stats\n"
+        );
+        return;
+    }
+    render_stats_reset (&gctx->batch_renderer.stats);
 }
 
 
@@ -616,6 +2622,8 @@ static XuiRenderStatus begin_frame (
         ERR_INVALID_ARGUMENTS
     );
 
+    PROFILE_ZONE ("begin_frame");
+
     VkDevice device = vk.device.logical;
 
     FrameData *frame_data  = render_pass->frame_data + (render_pass->frame_index++ % FRAME_LIMIT);
@@ -624,7 +2632,14 @@ static XuiRenderStatus begin_frame (
     /* get next image index */
     Uint32 image_index = -1;
     {
-        VkResult res = vkWaitForFences (device, 1, &frame_data->sync.render_fence, True, 1e9);
+        /* time spent here is time the CPU is ahead of the GPU */
+        VkResult res;
+        {
+            PROFILE_WAIT_ZONE ("wait_render_fence");
+            Uint64 wait_begin_ns = profiler_now_ns();
+            res = vkWaitForFences (device, 1, &frame_data->sync.render_fence, True, 1e9);
+            begin_info->fence_wait_ns = profiler_now_ns() - wait_begin_ns;
+        }
         RETURN_VALUE_IF (
             res != VK_SUCCESS,
             XUI_RENDER_STATUS_ERR,
@@ -632,21 +2647,34 @@ static XuiRenderStatus begin_frame (
             res
         );
 
+        /* GPU is done with previous use of this frame, recycle it's transient memory */
+        if (!frame_data->is_arena_ready) {
+            arena_reset (&frame_data->arena);
+            frame_data->is_arena_ready = True;
+        }
+
         /* get next image index */
         {
-            res = vkAcquireNextImageKHR (
-                device,
-                swapchain->swapchain,
-                1e9, /* 1e9 ns = 1 s */
-                frame_data->sync.present_semaphore,
-                Null,
-                &image_index
-            );
+            {
+                PROFILE_WAIT_ZONE ("acquire_next_image");
+                res = vkAcquireNextImageKHR (
+                    device,
+                    swapchain->swapchain,
+                    1e9, /* 1e9 ns = 1 s */
+                    frame_data->sync.present_semaphore,
+                    Null,
+                    &image_index
+                );
+            }
 
             /* recoverable error cases */
             if (res == VK_SUBOPTIMAL_KHR || res == VK_ERROR_OUT_OF_DATE_KHR) {
+                pthread_mutex_lock (&vk.resource_mutex);
+                Bool is_reinited = !!swapchain_reinit (swapchain, win);
+                pthread_mutex_unlock (&vk.resource_mutex);
+
                 RETURN_VALUE_IF (
-                    !swapchain_reinit (swapchain, win),
+                    !is_reinited,
                     XUI_RENDER_STATUS_ERR,
                     "Failed to reinit swapchain\n"
                 );
@@ -737,6 +2765,8 @@ static XuiRenderStatus end_frame (
         ERR_INVALID_ARGUMENTS
     );
 
+    PROFILE_ZONE ("end_frame");
+
     FrameData      *frame_data = end_info->frame_data;
     VkCommandBuffer cmd        = frame_data->command.buffer;
 
@@ -765,12 +2795,14 @@ static XuiRenderStatus end_frame (
             .pCommandBuffers      = &cmd
         };
 
+        pthread_mutex_lock (&vk.resource_mutex);
         VkResult res = vkQueueSubmit (
             vk.device.graphics_queue.handle,
             1,
             &submit_info,
             frame_data->sync.render_fence
         );
+        pthread_mutex_unlock (&vk.resource_mutex);
 
         RETURN_VALUE_IF (
             res != VK_SUCCESS,
@@ -778,6 +2810,9 @@ static XuiRenderStatus end_frame (
             "Failed to submit command buffers for execution. RET = %d\n",
             res
         );
+
+        /* arena must now outlive this submission, next use of frame will reset it */
+        frame_data->is_arena_ready = False;
     }
 
     /* submit for presentation to surface */
@@ -792,14 +2827,22 @@ static XuiRenderStatus end_frame (
             .pImageIndices      = &end_info->image_index
         };
 
-        VkResult res = vkQueuePresentKHR (vk.device.graphics_queue.handle, &present_info);
+        /* swapchain is reinited under same lock, since it waits for device idle */
+        pthread_mutex_lock (&vk.resource_mutex);
+        VkResult res;
+        {
+            PROFILE_WAIT_ZONE ("queue_present");
+            res = vkQueuePresentKHR (vk.device.graphics_queue.handle, &present_info);
+        }
 
+        Bool is_reinited = True;
         if (res == VK_SUBOPTIMAL_KHR || res == VK_ERROR_OUT_OF_DATE_KHR) {
-            RETURN_VALUE_IF (
-                !swapchain_reinit (swapchain, win),
-                XUI_RENDER_STATUS_ERR,
-                "Failed to reinit swapchain\n"
-            );
+            is_reinited = !!swapchain_reinit (swapchain, win);
+        }
+        pthread_mutex_unlock (&vk.resource_mutex);
+
+        if (res == VK_SUBOPTIMAL_KHR || res == VK_ERROR_OUT_OF_DATE_KHR) {
+            RETURN_VALUE_IF (!is_reinited, XUI_RENDER_STATUS_ERR, "Failed to reinit swapchain\n");
 
             return XUI_RENDER_STATUS_CONTINUE;
         }
@@ -814,3 +2857,607 @@ static XuiRenderStatus end_frame (
 
     return XUI_RENDER_STATUS_OK;
 }
+
+/**
+ * @b Compute matrix mapping 2D instance coordinates to clip space, for
+ * currently set view of renderer.
+ *
+ * @param res Where matrix will be stored.
+ * @param renderer
+ * @param extent Size of image being rendered to, in pixels.
+ *
+ * @return @c res.
+ * */
+static Mat4f *get_view_transform_2d (Mat4f *res, BatchRenderer *renderer, VkExtent2D extent) {
+    /* normalized device coordinates, with Y axis flipped to point up */
+    if (!renderer->is_view_2d_set || !extent.width || !extent.height) {
+        *res = (Mat4f) {
+            .elem = {{1, 0, 0, 0}, {0, -1, 0, 0}, {0, 0, 1, 0}, {0, 0, 0, 1}}
+        };
+        return res;
+    }
+
+    XuiView2D *view  = &renderer->view_2d;
+    Float32    scale = get_view_scale_2d (renderer);
+
+    /* logical units -> pixels -> [-1, 1], Y already points down in Vulkan clip space */
+    Float32 sx = 2.f * scale / extent.width;
+    Float32 sy = 2.f * scale / extent.height;
+
+    *res = (Mat4f) {
+        .elem = {{sx, 0, 0, 0},
+                 {0, sy, 0, 0},
+                 {0, 0, 1, 0},
+                 {-sx * view->origin.x - 1.f, -sy * view->origin.y - 1.f, 0, 1}}
+    };
+
+    return res;
+}
+
+/**
+ * @b Get number of pixels per 2D instance coordinate unit, for currently set view.
+ *
+ * @param renderer
+ *
+ * @return Scale of view, or 1 if no view is set.
+ * */
+static Float32 get_view_scale_2d (BatchRenderer *renderer) {
+    if (!renderer->is_view_2d_set) {
+        return 1.f;
+    }
+
+    XuiView2D *view = &renderer->view_2d;
+    Float32    zoom = view->zoom ? view->zoom : 1.f;
+    Float32    dpi  = view->dpi_scale ? view->dpi_scale : 1.f;
+
+    return zoom * dpi;
+}
+
+/**
+ * @b Copy given data to a host visible device buffer, growing the buffer if required.
+ *
+ * @param buffer Buffer to copy to.
+ * @param data Data to be copied.
+ * @param size Size of data in bytes. Nothing is copied if zero.
+ *
+ * @return @c True on success.
+ * @return @c False otherwise.
+ * */
+static Bool upload_to_device_buffer (DeviceBuffer *buffer, void *data, Size size) {
+    RETURN_VALUE_IF (!buffer || (size && !data), False, ERR_INVALID_ARGUMENTS);
+
+    /* nothing to upload */
+    if (!size) {
+        return True;
+    }
+
+    if (buffer->size < size) {
+        RETURN_VALUE_IF (
+            !device_buffer_resize (buffer, size),
+            False,
+            "Failed to resize device buffer\n"
+        );
+    }
+
+    RETURN_VALUE_IF (
+        !device_buffer_memcpy (buffer, data, size),
+        False,
+        "Failed to copy data to device buffer\n"
+    );
+
+    return True;
+}
+
+/**
+ * @b Make sure distance fields of all glyphs of given text are in glyph cache.
+ *
+ * Glyphs of whole run are looked up together, so that missing distance fields
+ * are generated together on worker threads. This is done even when layout of
+ * text is cached, since distance fields might've been evicted since then.
+ *
+ * @param batch
+ * @param layout Cached layout of text, @c Null if text is not laid out yet, in
+ *        which case it's decoded codepoints are taken from @c batch->codepoints.
+ * @param font_data Font of text.
+ * @param glyphs_generated Incremented by number of glyphs missing in glyph cache.
+ *
+ * @return @p batch on success.
+ * @return @c Null otherwise.
+ * */
+static TextBatch2D *text_batch_add_sdf_glyphs_2d (
+    TextBatch2D *batch,
+    TextLayout  *layout,
+    FontData    *font_data,
+    Uint64      *glyphs_generated
+) {
+    glyph_index_vector_clear (&batch->glyph_indices);
+
+    if (layout) {
+        for (Uint32 g = 0; g < layout->glyph_count; g++) {
+            RETURN_VALUE_IF (
+                !glyph_index_vector_push (&batch->glyph_indices, &layout->glyphs[g].glyph),
+                Null,
+                "Failed to resize vector to store glyphs of text\n"
+            );
+        }
+    } else {
+        /* glyph indices don't depend on font size, line terminators take no glyph */
+        Uint32 *codepoints = codepoint_vector_data (&batch->codepoints);
+        for (Size c = 0; c < batch->codepoints.count; c++) {
+            if (is_line_terminator (codepoints[c])) {
+                continue;
+            }
+
+            Uint32 glyph_index = FT_Get_Char_Index (font_data->face, codepoints[c]);
+            RETURN_VALUE_IF (
+                !glyph_index_vector_push (&batch->glyph_indices, &glyph_index),
+                Null,
+                "Failed to resize vector to store glyphs of text\n"
+            );
+        }
+    }
+
+    RETURN_VALUE_IF (
+        !glyph_cache_add_sdf_glyphs (
+            &batch->sdf_glyph_cache,
+            font_data,
+            glyph_index_vector_data (&batch->glyph_indices),
+            batch->glyph_indices.count,
+            vk.jobs,
+            glyphs_generated
+        ),
+        Null,
+        "Failed to generate distance field glyphs\n"
+    );
+
+    return batch;
+}
+
+/**
+ * @b Lay out text of given key, and add it's layout to layout cache.
+ *
+ * Layout is done in pixels of glyph cache text is drawn from, with font face
+ * already scaled to @c key->size, since that's where glyph metrics are cached.
+ * Bitmap glyphs are placed at whole pixels so that they map to atlas texels one
+ * to one, while distance field glyphs are placed exactly, since they're scaled
+ * anyway.
+ *
+ * Lines are broken after each line terminator, and at last break opportunity
+ * (see @c line_break_find) before a glyph that would cross @c key->max_width.
+ * A word wider than whole line is never broken.
+ *
+ * @param batch
+ * @param key Key of text in layout cache, @c flags holds @c XuiTextRenderMode.
+ * @param font_data Font of text.
+ * @param glyphs_rasterized Incremented by number of glyphs missing in glyph cache.
+ *
+ * @return Cached layout on success.
+ * @return @c Null otherwise.
+ * */
+static TextLayout *text_batch_layout_text_2d (
+    TextBatch2D   *batch,
+    TextLayoutKey *key,
+    FontData      *font_data,
+    Uint64        *glyphs_rasterized
+) {
+    PROFILE_ZONE ("text_batch_layout_text_2d");
+
+    Bool    is_sdf       = key->flags == XUI_TEXT_RENDER_MODE_SDF;
+    FT_Face face         = font_data->face;
+    Bool    has_kerning  = !!FT_HAS_KERNING (face);
+    FT_UInt kerning_mode = is_sdf ? FT_KERNING_UNFITTED : FT_KERNING_DEFAULT;
+    Float32 line_height  = face->size->metrics.height / 64.f;
+
+    Uint32 *codepoints = codepoint_vector_data (&batch->codepoints);
+    Size    count      = batch->codepoints.count;
+
+    RETURN_VALUE_IF (
+        !line_break_vector_resize (&batch->line_breaks, count, False),
+        Null,
+        "Failed to resize vector to store line breaks of text\n"
+    );
+    Uint8 *breaks =
+        line_break_find (line_break_vector_data (&batch->line_breaks), codepoints, count);
+
+    TextLayoutGlyphVector *glyphs = &batch->layout_glyphs;
+    text_layout_glyph_vector_clear (glyphs);
+
+    /* pen position in pixels, relative to start of baseline, and end of last visible glyph */
+    Float32 pen_x      = 0.f;
+    Float32 pen_y      = 0.f;
+    Float32 content_x  = 0.f;
+    Float32 width      = 0.f;
+    Uint32  prev_glyph = 0;
+
+    /* first glyph of current line, and glyph after last break opportunity on it */
+    Size    line_start = 0;
+    Size    line_break = 0;
+    Float32 break_x    = 0.f;
+
+    for (Size c = 0; c < count; c++) {
+        Uint32 codepoint = codepoints[c];
+
+        if (!is_line_terminator (codepoint)) {
+            Uint32 glyph_index = FT_Get_Char_Index (face, codepoint);
+
+            if (has_kerning && prev_glyph && glyph_index) {
+                FT_Vector delta;
+                if (!FT_Get_Kerning (face, prev_glyph, glyph_index, kerning_mode, &delta)) {
+                    pen_x += delta.x / 64.f;
+                }
+            }
+
+            GlyphAtlasEntry *glyph;
+            if (is_sdf) {
+                glyph =
+                    glyph_cache_find_sdf_glyph (&batch->sdf_glyph_cache, font_data, glyph_index);
+            } else {
+                Bool is_rasterized  = False;
+                glyph               = glyph_cache_get_glyph (
+                    &batch->glyph_cache,
+                    font_data,
+                    glyph_index,
+                    &is_rasterized
+                );
+                *glyphs_rasterized += is_rasterized;
+            }
+            RETURN_VALUE_IF (!glyph, Null, "Failed to get glyph for codepoint %u\n", codepoint);
+
+            /* spaces hang past end of line instead of wrapping it */
+            Bool is_space = line_break_class (codepoint) == LINE_BREAK_CLASS_SP;
+
+            /* move everything after last break opportunity to a new line */
+            if (key->max_width > 0.f && !is_space && line_break > line_start &&
+                pen_x + glyph->advance > key->max_width) {
+                TextLayoutGlyph *placed_glyphs = text_layout_glyph_vector_data (glyphs);
+
+                Float32 shift = line_break < glyphs->count ? placed_glyphs[line_break].x : pen_x;
+                for (Size g = line_break; g < glyphs->count; g++) {
+                    placed_glyphs[g].x -= shift;
+                    placed_glyphs[g].y += line_height;
+                }
+
+                width      = MAX (width, break_x);
+                pen_x     -= shift;
+                content_x -= shift;
+                pen_y     += line_height;
+                line_start = line_break;
+            }
+
+            TextLayoutGlyph placed = {
+                .glyph = glyph_index,
+                .x     = is_sdf ? pen_x : roundf (pen_x),
+                .y     = pen_y
+            };
+            RETURN_VALUE_IF (
+                !text_layout_glyph_vector_push (glyphs, &placed),
+                Null,
+                "Failed to resize vector to store glyphs of text\n"
+            );
+
+            pen_x      += glyph->advance;
+            prev_glyph  = glyph_index;
+            if (!is_space) {
+                content_x = pen_x;
+            }
+        }
+
+        if (breaks[c] == LINE_BREAK_ALLOWED) {
+            line_break = glyphs->count;
+            break_x    = content_x;
+        } else if (breaks[c] == LINE_BREAK_MANDATORY && c + 1 < count) {
+            width      = MAX (width, content_x);
+            pen_x      = 0.f;
+            content_x  = 0.f;
+            pen_y     += line_height;
+            prev_glyph = 0;
+            line_start = line_break = glyphs->count;
+        }
+    }
+
+    TextLayout *layout = text_layout_cache_insert (
+        &batch->layout_cache,
+        key,
+        text_layout_glyph_vector_data (glyphs),
+        glyphs->count
+    );
+    RETURN_VALUE_IF (!layout, Null, "Failed to add text layout to cache\n");
+
+    layout->width  = MAX (width, content_x);
+    layout->height = pen_y;
+
+    return layout;
+}
+
+/**
+ * @b Line terminators end a line, and take no glyph.
+ * */
+static inline Bool is_line_terminator (Uint32 codepoint) {
+    LineBreakClass cls = line_break_class (codepoint);
+    return cls == LINE_BREAK_CLASS_BK || cls == LINE_BREAK_CLASS_CR || cls == LINE_BREAK_CLASS_LF;
+}
+
+/**
+ * @b Get entry of given slot.
+ *
+ * @return Entry of slot if it's a slot in use.
+ * @return @c Null otherwise.
+ * */
+static SlotEntry2D *slot_batch_get_entry_2d (SlotBatch2D *batch, XuiSlot2D slot) {
+    if (!slot || slot > batch->entries.count) {
+        return Null;
+    }
+
+    SlotEntry2D *entry = slot_entry_2d_vector_data (&batch->entries) + slot - 1;
+    return entry->is_used ? entry : Null;
+}
+
+/**
+ * @b Find group storing contents of given type, creating it if required.
+ *
+ * There's one group per mesh drawn through slots, and one for all primitives,
+ * so a linear search is enough, just like batches of mesh instances.
+ *
+ * @return Group on success.
+ * @return @c Null otherwise.
+ * */
+static SlotGroup2D *
+    slot_batch_get_group_2d (SlotBatch2D *batch, Uint32 slot_type, Uint32 mesh_type) {
+    SlotGroup2D *groups = slot_group_2d_vector_data (&batch->groups);
+    for (Size s = 0; s < batch->groups.count; s++) {
+        if (groups[s].slot_type == slot_type &&
+            (slot_type != XUI_SLOT_TYPE_2D_MESH || groups[s].mesh_type == mesh_type)) {
+            return groups + s;
+        }
+    }
+
+    SlotGroup2D *group = slot_group_2d_vector_push (&batch->groups, Null);
+    RETURN_VALUE_IF (!group, Null, "Failed to resize vector to store more slot groups\n");
+
+    group->slot_type = slot_type;
+    group->mesh_type = mesh_type;
+    group->stride =
+        slot_type == XUI_SLOT_TYPE_2D_MESH ? sizeof (XuiMeshInstance2D) : sizeof (XuiPrimitive2D);
+    slot_group_mark_clean_2d (group);
+
+    return group;
+}
+
+/**
+ * @b Remove content of given slot from it's group, if it has any.
+ *
+ * Last content of group is moved in place of removed one, so only one
+ * content changes, and slot owning moved content is told where it went.
+ * */
+static void slot_batch_remove_content_2d (SlotBatch2D *batch, SlotEntry2D *entry) {
+    if (entry->group == SLOT_GROUP_NONE) {
+        return;
+    }
+
+    SlotGroup2D *group  = slot_group_2d_vector_data (&batch->groups) + entry->group;
+    XuiSlot2D   *owners = slot_vector_data (&group->owners);
+    Size         last   = group->owners.count - 1;
+
+    if (entry->index != last) {
+        Uint8 *contents = byte_vector_data (&group->contents);
+        memcpy (
+            contents + entry->index * group->stride,
+            contents + last * group->stride,
+            group->stride
+        );
+
+        owners[entry->index] = owners[last];
+        slot_entry_2d_vector_data (&batch->entries)[owners[last] - 1].index = entry->index;
+        slot_group_mark_dirty_2d (group, entry->index);
+    }
+
+    group->owners.count--;
+    group->contents.count -= group->stride;
+
+    entry->group = SLOT_GROUP_NONE;
+    entry->index = 0;
+}
+
+static inline void slot_group_mark_dirty_2d (SlotGroup2D *group, Size index) {
+    group->dirty_begin = MIN (group->dirty_begin, index);
+    group->dirty_end   = MAX (group->dirty_end, index + 1);
+}
+
+static inline void slot_group_mark_clean_2d (SlotGroup2D *group) {
+    group->dirty_begin = (Size)-1;
+    group->dirty_end   = 0;
+}
+
+/**
+ * @b Get run instances drawn next are added to, starting a new one if
+ * ordering key changed since last draw.
+ * */
+static StagingRun2D *instance_staging_get_run_2d (InstanceStaging2D *staging) {
+    StagingRun2D *runs = staging_run_2d_vector_data (&staging->runs);
+    if (staging->runs.count && runs[staging->runs.count - 1].order == staging->order) {
+        return runs + staging->runs.count - 1;
+    }
+
+    StagingRun2D run = {
+        .order           = staging->order,
+        .mesh_begin      = staging->meshes.count,
+        .primitive_begin = staging->primitives.count
+    };
+    return staging_run_2d_vector_push (&staging->runs, &run);
+}
+
+/**
+ * @b Add staged instances to batches sorted by their draw keys, see
+ * @c draw_key_pack_2d. Instances with same key stay in order of their runs.
+ *
+ * Sorted instances of same batch are next to each other, so each batch is
+ * looked up just once, and instances of each batch are added front to back
+ * if opaque, and back to front if blended. Batches themselves are drawn in
+ * order of their keys.
+ *
+ * @return @c True on success.
+ * @return @c False if any instance failed to be added, all others are still added.
+ * */
+static Bool batch_renderer_merge_sorted_2d (
+    BatchRenderer      *renderer,
+    RenderThread       *thread,
+    InstanceStaging2D **stagings,
+    StagingRun2D       *runs,
+    Size                run_count
+) {
+    PROFILE_ZONE ("batch_renderer_merge_sorted_2d");
+
+    MeshInstance2DVector *meshes     = &renderer->sorted_meshes_2d;
+    Primitive2DVector    *primitives = &renderer->sorted_primitives_2d;
+    mesh_instance_2d_vector_clear (meshes);
+    primitive_2d_vector_clear (primitives);
+
+    /* instances are gathered in order of runs, which is kept for equal keys */
+    for (Size r = 0; r < run_count; r++) {
+        InstanceStaging2D *staging = stagings[runs[r].staging];
+
+        RETURN_VALUE_IF (
+            !mesh_instance_2d_vector_append (
+                meshes,
+                mesh_instance_2d_vector_data (&staging->meshes) + runs[r].mesh_begin,
+                runs[r].mesh_end - runs[r].mesh_begin
+            ) ||
+                !primitive_2d_vector_append (
+                    primitives,
+                    primitive_2d_vector_data (&staging->primitives) + runs[r].primitive_begin,
+                    runs[r].primitive_end - runs[r].primitive_begin
+                ),
+            False,
+            "Failed to resize vector to sort staged instances\n"
+        );
+    }
+
+    Size count = meshes->count + primitives->count;
+    if (!count) {
+        return True;
+    }
+    RETURN_VALUE_IF (count >= SORT_VALUE_PRIMITIVE, False, "Too many instances to sort\n");
+
+    /* second half of keys and values is scratch memory of sort */
+    RETURN_VALUE_IF (
+        !sort_key_vector_resize (&renderer->sort_keys_2d, count * 2, False) ||
+            !sort_value_vector_resize (&renderer->sort_values_2d, count * 2, False),
+        False,
+        "Failed to resize vector to store sort keys\n"
+    );
+
+    Uint64            *keys           = sort_key_vector_data (&renderer->sort_keys_2d);
+    Uint32            *values         = sort_value_vector_data (&renderer->sort_values_2d);
+    XuiMeshInstance2D *mesh_data      = mesh_instance_2d_vector_data (meshes);
+    XuiPrimitive2D    *primitive_data = primitive_2d_vector_data (primitives);
+
+    for (Size m = 0; m < meshes->count; m++) {
+        XuiMeshInstance2D *mesh = mesh_data + m;
+        keys[m]   = draw_key_pack_2d (get_mesh_pass_2d (mesh), False, mesh->type, mesh->position.z);
+        values[m] = m;
+    }
+
+    /* edges of primitives are anti-aliased, so they're always blended */
+    for (Size p = 0; p < primitives->count; p++) {
+        Float32 depth             = primitive_data[p].position.z;
+        keys[meshes->count + p]   = draw_key_pack_2d (DRAW_PASS_BLENDED, True, 0, depth);
+        values[meshes->count + p] = p | SORT_VALUE_PRIMITIVE;
+    }
+
+    RETURN_VALUE_IF (
+        !radix_sort_u64 (keys, values, keys + count, values + count, count),
+        False,
+        "Failed to sort staged instances\n"
+    );
+
+    Bool                 is_ok = True;
+    MeshInstanceBatch2D *batch = Null;
+    for (Size v = 0; v < count; v++) {
+        Uint32 index = values[v] & ~SORT_VALUE_PRIMITIVE;
+        if (values[v] & SORT_VALUE_PRIMITIVE) {
+            is_ok =
+                batch_renderer_add_staged_primitive_2d (renderer, thread, primitive_data + index) &&
+                is_ok;
+        } else {
+            is_ok =
+                batch_renderer_add_staged_mesh_2d (renderer, thread, mesh_data + index, &batch) &&
+                is_ok;
+        }
+    }
+
+    return is_ok;
+}
+
+/**
+ * @b Add a staged mesh instance to it's batch, or record it into given
+ * render thread.
+ *
+ * @param batch Batch last instance was added to, reused while mesh type and
+ *        pass stay same, and updated when they change.
+ * */
+static Bool batch_renderer_add_staged_mesh_2d (
+    BatchRenderer        *renderer,
+    RenderThread         *thread,
+    XuiMeshInstance2D    *mesh,
+    MeshInstanceBatch2D **batch
+) {
+    if (thread) {
+        FrameCommand command = {.type = FRAME_COMMAND_TYPE_DRAW_2D, .mesh = *mesh};
+        return !!render_thread_record (thread, &command, Null, 0);
+    }
+
+    DrawPass pass = get_mesh_pass_2d (mesh);
+    if (*batch && (*batch)->mesh_type == mesh->type && (*batch)->pass == pass) {
+        return !!mesh_instance_batch_add_instance_2d (*batch, mesh);
+    }
+
+    /* adding may create a new batch, moving others, so batch is looked up after it */
+    if (!batch_renderer_add_mesh_instance_2d (renderer, mesh)) {
+        *batch = Null;
+        return False;
+    }
+    *batch = batch_renderer_get_mesh_instance_batch_2d (renderer, pass, mesh->type);
+
+    return True;
+}
+
+/**
+ * @b Add a staged primitive to it's batch, or record it into given render thread.
+ * */
+static Bool batch_renderer_add_staged_primitive_2d (
+    BatchRenderer  *renderer,
+    RenderThread   *thread,
+    XuiPrimitive2D *primitive
+) {
+    if (thread) {
+        FrameCommand command = {
+            .type      = FRAME_COMMAND_TYPE_DRAW_PRIMITIVE_2D,
+            .primitive = *primitive
+        };
+        return !!render_thread_record (thread, &command, Null, 0);
+    }
+
+    return batch_renderer_draw_primitive_2d (renderer, primitive) == XUI_RENDER_STATUS_OK;
+}
+
+/**
+ * @b Instances that are not fully opaque are blended, so they're drawn after
+ * all opaque instances, instead of hiding what's behind them from depth test.
+ * */
+static inline DrawPass get_mesh_pass_2d (XuiMeshInstance2D *mesh) {
+    return mesh->color.a < 1.f ? DRAW_PASS_BLENDED : DRAW_PASS_OPAQUE;
+}
+
+/**
+ * @b Order runs by ordering key, and then by order they were gathered in,
+ * so that merge is same no matter how sort moves equal runs.
+ * */
+static int compare_staging_runs_2d (const void *a, const void *b) {
+    const StagingRun2D *x = a;
+    const StagingRun2D *y = b;
+
+    if (x->order != y->order) {
+        return x->order < y->order ? -1 : 1;
+    }
+    return x->sequence < y->sequence ? -1 : x->sequence > y->sequence;
+}
@@ -35,22 +35,39 @@
 
 #include <Anvie/Types.h>
 
+/* libc */
+#include <pthread.h>
+
 /* crossgui-graphics-api */
 #include <Anvie/CrossGui/Plugin/Graphics/Api/Common.h>
+#include <Anvie/CrossGui/Plugin/Graphics/Api/Line2D.h>
+#include <Anvie/CrossGui/Plugin/Graphics/Api/Mesh2D.h>
+#include <Anvie/CrossGui/Plugin/Graphics/Api/Primitive2D.h>
+#include <Anvie/CrossGui/Plugin/Graphics/Api/Slot2D.h>
+#include <Anvie/CrossGui/Plugin/Graphics/Api/Text2D.h>
+
+/* crossgui-utils */
+#include <Anvie/CrossGui/Utils/DrawKey.h>
+#include <Anvie/CrossGui/Utils/TextLayoutCache.h>
+#include <Anvie/CrossGui/Utils/Vector.h>
 
 /* local includes */
 #include "Device.h"
+#include "GlyphCache.h"
 #include "RenderPass.h"
+#include "RenderStats.h"
 
 /* fwd declarations */
 typedef struct XuiGraphicsContext XuiGraphicsContext;
 typedef struct XwWindow           XwWindow;
-typedef struct XuiMeshInstance2D  XuiMeshInstance2D;
+typedef struct RenderThread       RenderThread;
+
+NEW_HEAP_VECTOR_STRUCT (XuiMeshInstance2D, MeshInstance2DVector);
 
 /**
  * @b A batch is made by grouping together all mesh instances that belong to
- * a certain mesh type. The mesh manager then creates an array of these batches,
- * corresponding to each mesh type.
+ * a certain mesh type and are drawn in same pass. The batch renderer then
+ * creates an array of these batches, corresponding to each pass and mesh type.
  * */
 typedef struct MeshInstanceBatch2D {
     /**
@@ -58,19 +75,21 @@ typedef struct MeshInstanceBatch2D {
      * */
     Uint32 mesh_type;
 
+    /**
+     * @b Pass instances of this batch are drawn in, decided by their alpha.
+     * */
+    DrawPass pass;
+
     /**
      * @b Vector of mesh instances corresponding to this batch.
      * */
-    struct {
-        Size               count;
-        Size               capacity;
-        XuiMeshInstance2D *data;
-    } instances;
+    MeshInstance2DVector instances;
 
     DeviceBuffer device_data;
 } MeshInstanceBatch2D;
 
-MeshInstanceBatch2D *mesh_instance_batch_init_2d (MeshInstanceBatch2D *batch, Uint32 type);
+MeshInstanceBatch2D *
+    mesh_instance_batch_init_2d (MeshInstanceBatch2D *batch, Uint32 type, DrawPass pass);
 MeshInstanceBatch2D *mesh_instance_batch_deinit_2d (MeshInstanceBatch2D *batch);
 MeshInstanceBatch2D *mesh_instance_batch_add_instance_2d (
     MeshInstanceBatch2D *batch,
@@ -79,6 +98,222 @@ MeshInstanceBatch2D *mesh_instance_batch_add_instance_2d (
 MeshInstanceBatch2D *mesh_instance_batch_reset_2d (MeshInstanceBatch2D *batch);
 MeshInstanceBatch2D *mesh_instance_batch_upload_to_gpu_2d (MeshInstanceBatch2D *batch);
 
+NEW_HEAP_VECTOR_STRUCT (MeshInstanceBatch2D, MeshInstanceBatch2DVector);
+NEW_HEAP_VECTOR_STRUCT (XuiPrimitive2D, Primitive2DVector);
+
+/**
+ * @b All analytic 2D primitives are drawn by same pipeline and need no mesh,
+ * so all of them go into a single batch and are drawn with one draw call.
+ * */
+typedef struct PrimitiveBatch2D {
+    Primitive2DVector instances;
+    DeviceBuffer      device_data;
+} PrimitiveBatch2D;
+
+PrimitiveBatch2D *primitive_batch_init_2d (PrimitiveBatch2D *batch);
+PrimitiveBatch2D *primitive_batch_deinit_2d (PrimitiveBatch2D *batch);
+PrimitiveBatch2D *primitive_batch_upload_to_gpu_2d (PrimitiveBatch2D *batch);
+
+NEW_HEAP_VECTOR_STRUCT (XuiLineSegment2D, LineSegment2DVector);
+
+/**
+ * @b All independent line segments go into a single batch, drawn with one draw call.
+ * */
+typedef struct LineBatch2D {
+    LineSegment2DVector instances;
+    DeviceBuffer        device_data;
+} LineBatch2D;
+
+LineBatch2D *line_batch_init_2d (LineBatch2D *batch);
+LineBatch2D *line_batch_deinit_2d (LineBatch2D *batch);
+LineBatch2D *line_batch_upload_to_gpu_2d (LineBatch2D *batch);
+
+/**
+ * @b Range of points in @c PolylineBatch2D belonging to a single polyline.
+ * */
+typedef struct PolylineDraw2D {
+    Uint32          first_point;   /**< @b Index of repeated first point in point stream. */
+    Uint32          segment_count; /**< @b One less than number of points in polyline. */
+    PolylineStyle2D style;
+} PolylineDraw2D;
+
+NEW_HEAP_VECTOR_STRUCT (Vec2f, Vec2fVector);
+NEW_HEAP_VECTOR_STRUCT (PolylineDraw2D, PolylineDraw2DVector);
+
+/**
+ * @b Points of all polylines are packed in a single point stream, and each
+ * polyline is drawn with it's own instanced draw call, starting at
+ * @c first_point, with it's style pushed as push constant.
+ * */
+typedef struct PolylineBatch2D {
+    Vec2fVector          points;
+    PolylineDraw2DVector draws;
+    DeviceBuffer         device_data;
+} PolylineBatch2D;
+
+PolylineBatch2D *polyline_batch_init_2d (PolylineBatch2D *batch);
+PolylineBatch2D *polyline_batch_deinit_2d (PolylineBatch2D *batch);
+PolylineBatch2D *polyline_batch_add_polyline_2d (PolylineBatch2D *batch, XuiPolyline2D *polyline);
+PolylineBatch2D *polyline_batch_reset_2d (PolylineBatch2D *batch);
+PolylineBatch2D *polyline_batch_upload_to_gpu_2d (PolylineBatch2D *batch);
+
+NEW_HEAP_VECTOR_STRUCT (GlyphInstance2D, GlyphInstance2DVector);
+NEW_HEAP_VECTOR_STRUCT (Uint32, GlyphIndexVector);
+NEW_HEAP_VECTOR_STRUCT (TextLayoutGlyph, TextLayoutGlyphVector);
+NEW_HEAP_VECTOR_STRUCT (Uint32, CodepointVector);
+NEW_HEAP_VECTOR_STRUCT (Uint8, LineBreakVector);
+
+/**
+ * @b Memory cached text layouts may take, before least recently used ones are evicted.
+ * */
+#define TEXT_BATCH_LAYOUT_CACHE_BUDGET (4 << 20)
+
+/**
+ * @b Glyphs of all text are drawn as textured quads sampling a single glyph
+ * atlas, so all text goes into a single batch, drawn with one draw call.
+ *
+ * Text drawn with distance field glyphs samples a separate atlas, with a
+ * different pipeline, so it gets a batch of it's own.
+ *
+ * Layout of text is cached separately from it's glyphs, so text that does
+ * not change only looks up it's glyphs again each frame.
+ * */
+typedef struct TextBatch2D {
+    GlyphInstance2DVector instances;
+    DeviceBuffer          device_data;
+    GlyphCache            glyph_cache;
+    GlyphAtlasPageMask    pages;           /**< @b Atlas pages @c instances are drawn from. */
+
+    GlyphInstance2DVector sdf_instances;   /**< @b Glyphs of @c XUI_TEXT_RENDER_MODE_SDF text. */
+    DeviceBuffer          sdf_device_data;
+    GlyphCache            sdf_glyph_cache; /**< @b Distance fields at @c GLYPH_CACHE_SDF_SIZE. */
+    GlyphAtlasPageMask    sdf_pages;       /**< @b Atlas pages @c sdf_instances are drawn from. */
+    GlyphIndexVector      glyph_indices;   /**< @b Glyphs of text run being added. */
+
+    TextLayoutCache       layout_cache;  /**< @b Layouts in pixels of glyph cache they use. */
+    TextLayoutGlyphVector layout_glyphs; /**< @b Glyphs of text run being laid out. */
+    CodepointVector       codepoints;    /**< @b Decoded text run being laid out. */
+    LineBreakVector       line_breaks;   /**< @b Break opportunity after each codepoint. */
+} TextBatch2D;
+
+TextBatch2D *text_batch_init_2d (TextBatch2D *batch);
+TextBatch2D *text_batch_deinit_2d (TextBatch2D *batch);
+TextBatch2D *text_batch_add_text_2d (
+    TextBatch2D *batch,
+    XuiText2D   *text,
+    Float32      scale,
+    Uint64      *glyphs_rasterized,
+    Uint64      *text_layouts
+);
+TextBatch2D *text_batch_reset_2d (TextBatch2D *batch);
+TextBatch2D *text_batch_begin_frame_2d (TextBatch2D *batch);
+TextBatch2D *text_batch_upload_to_gpu_2d (TextBatch2D *batch);
+
+NEW_HEAP_VECTOR_STRUCT (Uint8, ByteVector);
+NEW_HEAP_VECTOR_STRUCT (XuiSlot2D, SlotVector);
+
+/**
+ * @b Contents of persistent slots drawing same mesh, or all primitives, packed
+ * together so that they're drawn with one draw call.
+ *
+ * A content is removed by moving last one in it's place, so contents stay
+ * packed, and only range of contents changed since last upload is uploaded.
+ * */
+typedef struct SlotGroup2D {
+    Uint32       slot_type;   /**< @b @c XuiSlotType2D of contents. */
+    Uint32       mesh_type;   /**< @b Mesh drawn by contents of a mesh group. */
+    Size         stride;      /**< @b Size of each content in bytes. */
+    ByteVector   contents;    /**< @b Mesh instances or primitives, @c stride bytes each. */
+    SlotVector   owners;      /**< @b Slot each content belongs to. */
+    Size         dirty_begin; /**< @b First content changed since last upload. */
+    Size         dirty_end;   /**< @b One past last content changed since last upload. */
+    DeviceBuffer device_data;
+} SlotGroup2D;
+
+/**
+ * @b Group a slot draws nothing from.
+ * */
+#define SLOT_GROUP_NONE ((Uint32)-1)
+
+/**
+ * @b Where content of a persistent slot is stored.
+ * */
+typedef struct SlotEntry2D {
+    Uint32 group;   /**< @b Group of content, @c SLOT_GROUP_NONE if slot draws nothing. */
+    Uint32 index;   /**< @b Index of content in group. */
+    Bool   is_used; /**< @b False if slot is free for reuse. */
+} SlotEntry2D;
+
+NEW_HEAP_VECTOR_STRUCT (SlotGroup2D, SlotGroup2DVector);
+NEW_HEAP_VECTOR_STRUCT (SlotEntry2D, SlotEntry2DVector);
+
+/**
+ * @b Persistent slots are never reset, they're drawn in every display until
+ * updated or destroyed. Handle of a slot is one more than it's index in
+ * @c entries.
+ * */
+typedef struct SlotBatch2D {
+    SlotEntry2DVector entries;
+    SlotVector        free_slots;
+    SlotGroup2DVector groups; /**< @b Never removed, so that group of a slot stays valid. */
+} SlotBatch2D;
+
+SlotBatch2D *slot_batch_init_2d (SlotBatch2D *batch);
+SlotBatch2D *slot_batch_deinit_2d (SlotBatch2D *batch);
+XuiSlot2D    slot_batch_create_slot_2d (SlotBatch2D *batch);
+SlotBatch2D *
+    slot_batch_update_slot_2d (SlotBatch2D *batch, XuiSlot2D slot, XuiSlotContent2D *content);
+SlotBatch2D *slot_batch_destroy_slot_2d (SlotBatch2D *batch, XuiSlot2D slot);
+SlotBatch2D *slot_batch_upload_to_gpu_2d (
+    SlotBatch2D *batch,
+    Uint64      *bytes_uploaded,
+    Uint64      *device_allocations
+);
+
+/**
+ * @b Instances of a @c InstanceStaging2D drawn one after other, with same
+ * ordering key.
+ * */
+typedef struct StagingRun2D {
+    Uint32 order;           /**< @b Ordering key instances were drawn with. */
+    Uint32 staging;         /**< @b Index of staging run belongs to, set on merge. */
+    Uint32 sequence;        /**< @b Position among runs of all stagings, set on merge. */
+    Uint32 mesh_begin;      /**< @b First mesh instance of run. */
+    Uint32 mesh_end;        /**< @b One past last mesh instance of run, set on merge. */
+    Uint32 primitive_begin; /**< @b First primitive of run. */
+    Uint32 primitive_end;   /**< @b One past last primitive of run, set on merge. */
+} StagingRun2D;
+
+NEW_HEAP_VECTOR_STRUCT (StagingRun2D, StagingRun2DVector);
+
+/**
+ * @b Mesh instances and primitives drawn by one thread since last display.
+ *
+ * Each thread drawing into a renderer gets a staging of it's own on it's
+ * first draw, so threads never share anything while drawing. Stagings of
+ * all threads are merged into batches by display, run by run, in order of
+ * their ordering keys.
+ * */
+typedef struct InstanceStaging2D {
+    pthread_t            thread;
+    Uint32               order; /**< @b Ordering key of instances drawn next. */
+    MeshInstance2DVector meshes;
+    Primitive2DVector    primitives;
+    StagingRun2DVector   runs;
+} InstanceStaging2D;
+
+InstanceStaging2D *instance_staging_init_2d (InstanceStaging2D *staging);
+InstanceStaging2D *instance_staging_deinit_2d (InstanceStaging2D *staging);
+InstanceStaging2D *
+    instance_staging_add_mesh_instance_2d (InstanceStaging2D *staging, XuiMeshInstance2D *mesh);
+InstanceStaging2D *
+    instance_staging_add_primitive_2d (InstanceStaging2D *staging, XuiPrimitive2D *primitive);
+InstanceStaging2D *instance_staging_reset_2d (InstanceStaging2D *staging);
+
+NEW_HEAP_VECTOR_STRUCT (InstanceStaging2D *, InstanceStaging2DVector);
+NEW_HEAP_VECTOR_STRUCT (Uint64, SortKeyVector);
+NEW_HEAP_VECTOR_STRUCT (Uint32, SortValueVector);
+
 /**
  * @b Batch Renderer works by creating and storing batches of multiple instances
  * of same mesh. A mesh instance is added whenever draw_Nd is called and all the batches
@@ -86,35 +321,122 @@ MeshInstanceBatch2D *mesh_instance_batch_upload_to_gpu_2d (MeshInstanceBatch2D *
  * */
 typedef struct BatchRenderer {
     /**
-     * @b Vector storing batches corresponding to each mesh type.
+     * @b Vector storing batches corresponding to each pass and mesh type.
      * Mesh instance data keeps getting added and removed quite frequently,
      * based on how many times the user issues a gfx_reset, which consequently
      * resets the contents of this vector.
+     *
+     * Batches are kept sorted by their keys in @c batch_keys_2d and drawn in
+     * that order, so all opaque batches are drawn before blended ones.
+     * */
+    MeshInstanceBatch2DVector batches_2d;
+    SortKeyVector             batch_keys_2d; /**< @b Key of each batch, see @c draw_key_batch. */
+
+    /**
+     * @b Primitives drawn after all mesh batches. Reset along with @c batches_2d.
      * */
-    struct {
-        Size                 count;
-        Size                 capacity;
-        MeshInstanceBatch2D *data;
-    } batches_2d;
+    PrimitiveBatch2D primitives_2d;
+
+    /**
+     * @b Lines drawn after primitives. Reset along with @c batches_2d.
+     * */
+    LineBatch2D     lines_2d;
+    PolylineBatch2D polylines_2d;
+
+    /**
+     * @b Text drawn after everything else. Reset along with @c batches_2d,
+     * which also lets glyph cache evict glyphs not used since then.
+     * */
+    TextBatch2D text_2d;
+
+    /**
+     * @b Persistent slots, drawn after mesh batches. Never reset.
+     * */
+    SlotBatch2D slots_2d;
 
     RenderPass default_render_pass;
+
+    /**
+     * @b View used to map 2D instance coordinates to clip space. Instance
+     * coordinates are used as normalized device coordinates while no view is set.
+     * */
+    XuiView2D view_2d;
+    Bool      is_view_2d_set;
+
+    /**
+     * @b Statistics of frames displayed using this renderer.
+     * */
+    RenderStats stats;
+
+    /**
+     * @b Mesh instances and primitives are staged by thread drawing them, and
+     * added to batches only when displayed. Stagings are never removed, so
+     * that a thread can keep using it's staging without any lock.
+     * */
+    InstanceStaging2DVector stagings_2d;
+    StagingRun2DVector      staging_runs_2d; /**< @b Runs of all stagings, sorted on merge. */
+    pthread_mutex_t         staging_mutex;   /**< @b Held while a new staging is added. */
+    Uint64                  id;              /**< @b Unique among all renderers ever created. */
+
+    /**
+     * @b Staged instances are sorted by mesh and depth when merged, instead of
+     * being added in order they were drawn. Memory used for sorting is kept
+     * for next merge.
+     * */
+    Bool                 is_sorting_2d;
+    MeshInstance2DVector sorted_meshes_2d;
+    Primitive2DVector    sorted_primitives_2d;
+    SortKeyVector        sort_keys_2d;
+    SortValueVector      sort_values_2d;
 } BatchRenderer;
 
 BatchRenderer *batch_renderer_init (BatchRenderer *renderer, Swapchain *swapchain);
 BatchRenderer *batch_renderer_deinit (BatchRenderer *renderer);
-MeshInstanceBatch2D *
-    batch_renderer_get_mesh_instance_batch_by_type_2d (BatchRenderer *renderer, Uint32 type);
+MeshInstanceBatch2D *batch_renderer_get_mesh_instance_batch_2d (
+    BatchRenderer *renderer,
+    DrawPass       pass,
+    Uint32         type
+);
 BatchRenderer *
     batch_renderer_add_mesh_instance_2d (BatchRenderer *renderer, XuiMeshInstance2D *mesh_instance);
+InstanceStaging2D *batch_renderer_get_staging_2d (BatchRenderer *renderer);
+BatchRenderer     *batch_renderer_merge_stagings_2d (BatchRenderer *renderer, RenderThread *thread);
+BatchRenderer     *batch_renderer_reset_stagings_2d (BatchRenderer *renderer);
 BatchRenderer  *batch_renderer_reset_batches_2d (BatchRenderer *renderer);
 BatchRenderer  *batch_renderer_upload_batches_to_gpu_2d (BatchRenderer *renderer);
+BatchRenderer  *batch_renderer_set_view_2d (BatchRenderer *renderer, XuiView2D *view);
 XuiRenderStatus batch_renderer_draw_2d (BatchRenderer *renderer, XuiMeshInstance2D *mesh_instance);
+XuiRenderStatus
+    batch_renderer_draw_primitive_2d (BatchRenderer *renderer, XuiPrimitive2D *primitive);
+XuiRenderStatus batch_renderer_draw_line_2d (BatchRenderer *renderer, XuiLineSegment2D *line);
+XuiRenderStatus
+    batch_renderer_draw_polyline_2d (BatchRenderer *renderer, XuiPolyline2D *polyline);
+XuiRenderStatus batch_renderer_draw_text_2d (BatchRenderer *renderer, XuiText2D *text);
+BatchRenderer  *batch_renderer_load_sdf_cache (BatchRenderer *renderer, CString path);
+BatchRenderer  *batch_renderer_save_sdf_cache (BatchRenderer *renderer, CString path);
 XuiRenderStatus
     batch_renderer_display (BatchRenderer *renderer, Swapchain *swapchain, XwWindow *win);
 XuiRenderStatus batch_renderer_clear (BatchRenderer *rederer, Swapchain *swapchain, XwWindow *win);
 
 XuiRenderStatus gfx_draw_2d (XuiGraphicsContext *gctx, XuiMeshInstance2D *mesh_instance);
+XuiRenderStatus gfx_draw_primitive_2d (XuiGraphicsContext *gctx, XuiPrimitive2D *primitive);
+Bool            gfx_set_draw_order_2d (XuiGraphicsContext *gctx, Uint32 order);
+Bool            gfx_set_instance_sort_2d (XuiGraphicsContext *gctx, Bool is_enabled);
+XuiRenderStatus gfx_draw_line_2d (XuiGraphicsContext *gctx, XuiLineSegment2D *line);
+XuiRenderStatus gfx_draw_polyline_2d (XuiGraphicsContext *gctx, XuiPolyline2D *polyline);
+XuiRenderStatus gfx_draw_text_2d (XuiGraphicsContext *gctx, XuiText2D *text);
+Bool            gfx_sdf_cache_load (XuiGraphicsContext *gctx, CString path);
+Bool            gfx_sdf_cache_save (XuiGraphicsContext *gctx, CString path);
 XuiRenderStatus gfx_display (XuiGraphicsContext *gctx, XwWindow *win);
 XuiRenderStatus gfx_clear (XuiGraphicsContext *gctx, XwWindow *win);
+Bool            gfx_reset_2d (XuiGraphicsContext *gctx);
+void           *gfx_frame_scratch_alloc (XuiGraphicsContext *gctx, Size size, Size alignment);
+Bool            gfx_set_view_2d (XuiGraphicsContext *gctx, XuiView2D *view);
+XuiSlot2D       gfx_slot_create_2d (XuiGraphicsContext *gctx);
+Bool
+    gfx_slot_update_2d (XuiGraphicsContext *gctx, XuiSlot2D slot, XuiSlotContent2D *content);
+Bool            gfx_slot_destroy_2d (XuiGraphicsContext *gctx, XuiSlot2D slot);
+Bool            gfx_get_stats (XuiGraphicsContext *gctx, XuiRenderStats *stats);
+void            gfx_reset_stats (XuiGraphicsContext *gctx);
 
 #endif // ANVIE_CROSSGUI_SOURCE_PLUGIN_GRAPHICS_VULKAN_RENDERER_H
@@ -38,6 +38,8 @@
  *      - Renamed file from Surface.c to Swapchain.c
  * */
 
+#define ALLOCATOR_TAG ALLOCATOR_TAG_SWAPCHAIN
+
 /* crosswindow */
 #include <Anvie/CrossWindow/Vulkan.h>
 #include <Anvie/CrossWindow/Window.h>
@@ -55,7 +57,7 @@
 #include <memory.h>
 #include <vulkan/vulkan_core.h>
 
-NEW_VECTOR_TYPE (SwapchainReinitHandlerData, reinit_handler);
+NEW_VECTOR_TYPE (SwapchainReinitHandlerData, SwapchainReinitHandlerVector, reinit_handler);
 
 /**
  * @b Initialize given Swapchain object.
@@ -347,20 +349,6 @@ Swapchain *swapchain_init (Swapchain *swapchain, XwWindow *win) {
         "Failed to create swapchain depth image\n"
     );
 
-    /* create reinit handler data vector with initially 4 entries */
-    if (!swapchain->reinit_handlers) {
-        swapchain->reinit_handlers = reinit_handler_vector_create (
-            4,                                  /* initial count */
-            &swapchain->reinit_handler_capacity /* get capacity */
-        );
-
-        GOTO_HANDLER_IF (
-            !swapchain->reinit_handlers,
-            INIT_FAILED,
-            "Failed to create vector to hold swapchain-reinit-event handlers\n"
-        );
-    }
-
     swapchain->is_reinited = True;
 
     /* name objects in swapchain */
@@ -474,15 +462,7 @@ Swapchain *swapchain_deinit (Swapchain *swapchain) {
     }
 
     /* free event hander data */
-    if (swapchain->reinit_handlers) {
-        memset (
-            swapchain->reinit_handlers,
-            0,
-            sizeof (SwapchainReinitHandlerData) * swapchain->reinit_handler_count
-        );
-
-        reinit_handler_vector_destroy (swapchain->reinit_handlers);
-    }
+    reinit_handler_vector_deinit (&swapchain->reinit_handlers);
 
     /* set all fields to invalid state */
     memset (swapchain, 0, sizeof (Swapchain));
@@ -532,18 +512,17 @@ Swapchain *swapchain_reinit (Swapchain *swapchain, XwWindow *win) {
 
     swapchain->is_reinited = True;
     swapchain->clear_mask  = (1 << swapchain->image_count) - 1;
+    swapchain->reinit_count++;
 
     /* After recreating the swapchain completely, ask registered RenderPass objects
      * to reinit their RenderTargets */
-    if (swapchain->reinit_handlers) {
-        for (Size s = 0; s < swapchain->reinit_handler_count; s++) {
-            SwapchainReinitHandlerData *handler = swapchain->reinit_handlers + s;
-            RETURN_VALUE_IF (
-                !handler->handler (handler->render_pass, swapchain),
-                Null,
-                "One of the render pass(es) failed to handle swapchain-reinit-event.\n"
-            );
-        }
+    SwapchainReinitHandlerData *handlers = reinit_handler_vector_data (&swapchain->reinit_handlers);
+    for (Size s = 0; s < swapchain->reinit_handlers.count; s++) {
+        RETURN_VALUE_IF (
+            !handlers[s].handler (handlers[s].render_pass, swapchain),
+            Null,
+            "One of the render pass(es) failed to handle swapchain-reinit-event.\n"
+        );
     }
 
     return swapchain;
@@ -564,24 +543,15 @@ Bool swapchain_register_reinit_handler (
 ) {
     RETURN_VALUE_IF (!swapchain || !handler || !render_pass, False, ERR_INVALID_ARGUMENTS);
 
-    /* resize/create array if required */
-    if (swapchain->reinit_handler_count >= swapchain->reinit_handler_capacity) {
-        RETURN_VALUE_IF (
-            !reinit_handler_vector_resize (
-                swapchain->reinit_handlers,          /* vector data */
-                swapchain->reinit_handler_count,     /* current count */
-                swapchain->reinit_handler_count + 1, /* new count I want */
-                swapchain->reinit_handler_capacity,  /* current capacity */
-                &swapchain->reinit_handler_capacity  /* get new capacity */
-            ),
-            False,
-            "Failed to resize swapchain-reinit-event handler vector\n"
-        );
-    }
-
     /* insert handler data */
-    swapchain->reinit_handlers[swapchain->reinit_handler_count++] =
-        (SwapchainReinitHandlerData) {.handler = handler, .render_pass = render_pass};
+    RETURN_VALUE_IF (
+        !reinit_handler_vector_push (
+            &swapchain->reinit_handlers,
+            &(SwapchainReinitHandlerData) {.handler = handler, .render_pass = render_pass}
+        ),
+        False,
+        "Failed to insert swapchain-reinit-event handler\n"
+    );
 
     return True;
 }
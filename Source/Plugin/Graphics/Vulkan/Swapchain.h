@@ -49,6 +49,9 @@
 
 #include <Anvie/Types.h>
 
+/* crossgui-utils */
+#include <Anvie/CrossGui/Utils/Vector.h>
+
 /* local includes */
 #include "Device.h"
 
@@ -116,6 +119,9 @@ typedef struct SwapchainReinitHandlerData {
     RenderPass            *render_pass;
 } SwapchainReinitHandlerData;
 
+/* there's usually just one or two render passes per swapchain */
+NEW_VECTOR_STRUCT (SwapchainReinitHandlerData, SwapchainReinitHandlerVector, 2);
+
 /**
  * @b Wrapper over VkSwapchainKHR handle and closely related objects.
  * */
@@ -137,9 +143,7 @@ typedef struct Swapchain {
      * to inform the registered @c RenderPass objects that they need to take proper action
      * for this event.
      * */
-    SwapchainReinitHandlerData *reinit_handlers;
-    Size                        reinit_handler_count;    /**< @b How many have we stored? */
-    Size                        reinit_handler_capacity; /**< @b How many can we store? */
+    SwapchainReinitHandlerVector reinit_handlers;
 
     /**
      * @b @c True if swapchain was reinited recently, @c False otherwise.
@@ -154,6 +158,11 @@ typedef struct Swapchain {
      *    that are already cleared and those that aren't yet.
      * */
     Uint8 clear_mask;
+
+    /**
+     * @b Number of times this swapchain was recreated. Never reset.
+     * */
+    Uint64 reinit_count;
 } Swapchain;
 
 Swapchain *swapchain_init (Swapchain *swapchain, XwWindow *win);
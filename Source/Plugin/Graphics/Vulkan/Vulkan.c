@@ -30,6 +30,8 @@
  * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  * */
 
+#define ALLOCATOR_TAG ALLOCATOR_TAG_PLUGIN
+
 #include <Anvie/Common.h>
 
 /* libc */
@@ -38,12 +40,16 @@
 /* crosswindow */
 #include <Anvie/CrossWindow/Vulkan.h>
 
+/* crossgui-utils */
+#include <Anvie/CrossGui/Utils/Profiler.h>
+
 /* crossgui/plugin */
 #include <Anvie/CrossGui/Plugin/Graphics/Graphics.h>
 #include <Anvie/CrossGui/Plugin/Plugin.h>
 
 /* local includes */
 #include "Device.h"
+#include "FontManager.h"
 #include "GraphicsContext.h"
 #include "MeshManager.h"
 #include "Renderer.h"
@@ -71,6 +77,8 @@ static Bool deinit();
  * @return @c False otherwise.
  * */
 static Bool init() {
+    pthread_mutex_init (&vk.resource_mutex, Null);
+
     /* create vulkan instance */
     {
         /* get names of required layers and their count as well */
@@ -172,6 +180,13 @@ static Bool init() {
         "Failed to initialize the mesh manager\n"
     );
 
+    /* initialize font manager */
+    GOTO_HANDLER_IF (
+        !font_manager_init (&vk.font_manager),
+        INIT_FAILED,
+        "Failed to initialize the font manager\n"
+    );
+
     return True;
 
 INIT_FAILED:
@@ -188,8 +203,9 @@ INIT_FAILED:
  * @return @c False otherwise.
  * */
 static Bool deinit() {
-    /* deinit shapes */
+    /* deinit shapes and fonts */
     mesh_manager_deinit (&vk.mesh_manager);
+    font_manager_deinit (&vk.font_manager);
 
     /* deinit logical device if created */
     if (vk.device.logical) {
@@ -207,15 +223,45 @@ static Bool deinit() {
         vkDestroyInstance (vk.instance, Null);
     }
 
+    pthread_mutex_destroy (&vk.resource_mutex);
+
     /* remove references to any handles and pointers */
     memset (&vk, 0, sizeof (Vulkan));
 
+    /* everything allocated by plugin must be freed by now (opt-in, see Allocator.h) */
+    allocator_report_leaks();
+
     return True;
 }
 
 static Bool mesh_upload_2d (XuiMesh2D *mesh) {
     RETURN_VALUE_IF (!mesh, False, ERR_INVALID_ARGUMENTS);
-    return !!mesh_manager_upload_mesh_2d (&vk.mesh_manager, mesh);
+
+    pthread_mutex_lock (&vk.resource_mutex);
+    Bool is_uploaded = !!mesh_manager_upload_mesh_2d (&vk.mesh_manager, mesh);
+    pthread_mutex_unlock (&vk.resource_mutex);
+
+    return is_uploaded;
+}
+
+static Bool font_load (Uint32 font, CString path) {
+    RETURN_VALUE_IF (!path, False, ERR_INVALID_ARGUMENTS);
+
+    pthread_mutex_lock (&vk.resource_mutex);
+    Bool is_loaded = !!font_manager_load_font (&vk.font_manager, font, path);
+    pthread_mutex_unlock (&vk.resource_mutex);
+
+    return is_loaded;
+}
+
+static Bool set_job_system (JobSystem *jobs) {
+    vk.jobs = jobs;
+    return True;
+}
+
+static Bool profiler_dump (CString file_path, Uint64 window_ns) {
+    RETURN_VALUE_IF (!file_path, False, ERR_INVALID_ARGUMENTS);
+    return profiler_dump_chrome_trace (file_path, window_ns);
 }
 
 /**************************************************************************************************/
@@ -229,13 +275,44 @@ static XuiGraphicsPlugin vulkan_graphics_plugin_data = {
     .context_destroy = graphics_context_destroy,
     .context_resize  = graphics_context_resize,
 
+    .context_start_render_thread = graphics_context_start_render_thread,
+    .context_stop_render_thread  = graphics_context_stop_render_thread,
+
     /* shape methods */
     .mesh_upload_2d = mesh_upload_2d,
 
+    /* font methods */
+    .font_load      = font_load,
+    .sdf_cache_load = gfx_sdf_cache_load,
+    .sdf_cache_save = gfx_sdf_cache_save,
+
     /* drawing methods */
-    .draw_2d = gfx_draw_2d,
-    .display = gfx_display,
-    .clear   = gfx_clear
+    .draw_2d              = gfx_draw_2d,
+    .draw_primitive_2d    = gfx_draw_primitive_2d,
+    .set_draw_order_2d    = gfx_set_draw_order_2d,
+    .set_instance_sort_2d = gfx_set_instance_sort_2d,
+    .draw_line_2d         = gfx_draw_line_2d,
+    .draw_polyline_2d     = gfx_draw_polyline_2d,
+    .draw_text_2d         = gfx_draw_text_2d,
+    .display              = gfx_display,
+    .clear                = gfx_clear,
+    .reset_2d             = gfx_reset_2d,
+
+    .frame_scratch_alloc = gfx_frame_scratch_alloc,
+    .set_view_2d         = gfx_set_view_2d,
+
+    /* persistent slot methods */
+    .slot_create_2d  = gfx_slot_create_2d,
+    .slot_update_2d  = gfx_slot_update_2d,
+    .slot_destroy_2d = gfx_slot_destroy_2d,
+
+    /* job system methods */
+    .set_job_system = set_job_system,
+
+    /* profiling methods */
+    .profiler_dump = profiler_dump,
+    .get_stats     = gfx_get_stats,
+    .reset_stats   = gfx_reset_stats
 };
 
 /**
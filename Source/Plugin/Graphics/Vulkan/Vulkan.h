@@ -35,11 +35,18 @@
 
 #include <Anvie/Types.h>
 
+/* libc */
+#include <pthread.h>
+
 /* vulkan includes */
 #include <vulkan/vulkan.h>
 
+/* crossgui-utils */
+#include <Anvie/CrossGui/Utils/JobSystem.h>
+
 /* local includes */
 #include "Device.h"
+#include "FontManager.h"
 #include "MeshManager.h"
 
 typedef struct Vulkan {
@@ -48,6 +55,16 @@ typedef struct Vulkan {
     Uint32            gpu_count; /**< @b Total number of usable physical devices on host. */
     Device            device;    /**< @b Default device in use by the plugin. */
     MeshManager       mesh_manager; /**< @b Manage different shapes created using this plugin. */
+    FontManager       font_manager; /**< @b Fonts loaded using this plugin. */
+    JobSystem        *jobs;         /**< @b Job system shared by application, can be @c Null. */
+
+    /**
+     * @b Held while graphics queue, meshes or fonts are used, because render
+     * threads of all graphics contexts share them with application thread.
+     * Never held across fence waits, so one context waiting for GPU never
+     * blocks others.
+     * */
+    pthread_mutex_t resource_mutex;
 } Vulkan;
 
 /**
@@ -0,0 +1,518 @@
+/**
+ * @file AabbTree.c
+ * @date Sun, 18th October 2026
+ * @author Siddharth Mishra (admin@brightprogrammer.in)
+ * @copyright Copyright 2024 Siddharth Mishra
+ * @copyright Copyright 2024 Anvie Labs
+ *
+ * Copyright 2024 Siddharth Mishra, Anvie Labs
+ * 
+ * Redistribution and use in source and binary forms, with or without modification, are permitted 
+ * provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+ *    and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions
+ *    and the following disclaimer in the documentation and/or other materials provided with the
+ *    distribution.
+ * 
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse
+ *    or promote products derived from this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND 
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * */
+
+#define ALLOCATOR_TAG ALLOCATOR_TAG_SPATIAL
+
+#include <Anvie/Common.h>
+#include <Anvie/CrossGui/Utils/AabbTree.h>
+
+/* libc */
+#include <memory.h>
+
+NEW_VECTOR_TYPE (AabbTreeNode, AabbTreeNodeVector, aabb_tree_node);
+
+/**************************************************************************************************/
+/********************************** PRIVATE METHOD DECLARATIONS ***********************************/
+/**************************************************************************************************/
+
+static Uint32  aabb_tree_allocate_node (AabbTree *tree);
+static void    aabb_tree_free_node (AabbTree *tree, Uint32 node);
+static Bool    aabb_tree_insert_leaf (AabbTree *tree, Uint32 leaf);
+static void    aabb_tree_remove_leaf (AabbTree *tree, Uint32 leaf);
+static void    aabb_tree_refit (AabbTree *tree, Uint32 node);
+static Uint32  aabb_tree_balance (AabbTree *tree, Uint32 a);
+static void    aabb_tree_replace_child (AabbTree *tree, Uint32 parent, Uint32 old, Uint32 new);
+static void    aabb_node_fit (AabbTreeNode *node, AabbTreeNode *first, AabbTreeNode *second);
+static Float32 aabb_get_perimeter (Vec2f min, Vec2f max);
+static Float32 aabb_get_union_perimeter (AabbTreeNode *first, AabbTreeNode *second);
+static Bool    aabb_contains (Vec2f min, Vec2f max, Vec2f inner_min, Vec2f inner_max);
+
+/**************************************************************************************************/
+/*********************************** PUBLIC METHOD DEFINITIONS ************************************/
+/**************************************************************************************************/
+
+/**
+ * @b Initialize an empty AABB tree.
+ *
+ * @param tree
+ * @param margin Boxes are enlarged by this much on each side, so they can
+ *        move this far without being reinserted.
+ *
+ * @return @c tree on success.
+ * @return @c Null otherwise.
+ * */
+AabbTree *aabb_tree_init (AabbTree *tree, Float32 margin) {
+    RETURN_VALUE_IF (!tree || !(margin >= 0), Null, ERR_INVALID_ARGUMENTS);
+
+    memset (tree, 0, sizeof (AabbTree));
+    tree->root       = AABB_TREE_NULL;
+    tree->free_nodes = AABB_TREE_NULL;
+    tree->margin     = margin;
+
+    return tree;
+}
+
+/**
+ * @b Free all nodes of given tree.
+ *
+ * @param tree
+ *
+ * @return @c tree on success.
+ * @return @c Null otherwise.
+ * */
+AabbTree *aabb_tree_deinit (AabbTree *tree) {
+    RETURN_VALUE_IF (!tree, Null, ERR_INVALID_ARGUMENTS);
+
+    aabb_tree_node_vector_deinit (&tree->nodes);
+    memset (tree, 0, sizeof (AabbTree));
+    tree->root       = AABB_TREE_NULL;
+    tree->free_nodes = AABB_TREE_NULL;
+
+    return tree;
+}
+
+/**
+ * @b Insert a box into tree.
+ *
+ * @param tree
+ * @param min Top left corner of box.
+ * @param max Bottom right corner of box.
+ * @param data Reported by queries overlapping box.
+ *
+ * @return Proxy identifying box in tree on success.
+ * @return @c AABB_TREE_NULL otherwise.
+ * */
+Uint32 aabb_tree_insert (AabbTree *tree, Vec2f min, Vec2f max, Uint64 data) {
+    RETURN_VALUE_IF (
+        !tree || !(min.x <= max.x) || !(min.y <= max.y),
+        AABB_TREE_NULL,
+        ERR_INVALID_ARGUMENTS
+    );
+
+    Uint32 leaf = aabb_tree_allocate_node (tree);
+    RETURN_VALUE_IF (leaf == AABB_TREE_NULL, AABB_TREE_NULL, "Failed to allocate tree node\n");
+
+    AabbTreeNode *node = aabb_tree_node_vector_data (&tree->nodes) + leaf;
+    node->min          = (Vec2f) {.x = min.x - tree->margin, .y = min.y - tree->margin};
+    node->max          = (Vec2f) {.x = max.x + tree->margin, .y = max.y + tree->margin};
+    node->data         = data;
+
+    if (!aabb_tree_insert_leaf (tree, leaf)) {
+        aabb_tree_free_node (tree, leaf);
+        PRINT_ERR ("Failed to insert box into tree\n");
+        return AABB_TREE_NULL;
+    }
+
+    tree->leaf_count++;
+
+    return leaf;
+}
+
+/**
+ * @b Remove a box from tree.
+ *
+ * @param tree
+ * @param proxy Returned when box was inserted. Invalid after this call.
+ *
+ * @return @c tree on success.
+ * @return @c Null otherwise.
+ * */
+AabbTree *aabb_tree_remove (AabbTree *tree, Uint32 proxy) {
+    RETURN_VALUE_IF (!tree, Null, ERR_INVALID_ARGUMENTS);
+    RETURN_VALUE_IF (
+        proxy >= tree->nodes.count || aabb_tree_node_vector_data (&tree->nodes)[proxy].height,
+        Null,
+        "Invalid proxy %u\n",
+        proxy
+    );
+
+    aabb_tree_remove_leaf (tree, proxy);
+    aabb_tree_free_node (tree, proxy);
+    tree->leaf_count--;
+
+    return tree;
+}
+
+/**
+ * @b Change box of given proxy.
+ *
+ * Box is reinserted only if it leaves it's enlarged box, or shrinks so much
+ * that enlarged box is far bigger than it, so small movements cost nothing.
+ *
+ * @param tree
+ * @param proxy
+ * @param min New top left corner.
+ * @param max New bottom right corner.
+ *
+ * @return @c tree on success.
+ * @return @c Null otherwise.
+ * */
+AabbTree *aabb_tree_move (AabbTree *tree, Uint32 proxy, Vec2f min, Vec2f max) {
+    RETURN_VALUE_IF (
+        !tree || !(min.x <= max.x) || !(min.y <= max.y),
+        Null,
+        ERR_INVALID_ARGUMENTS
+    );
+    RETURN_VALUE_IF (
+        proxy >= tree->nodes.count || aabb_tree_node_vector_data (&tree->nodes)[proxy].height,
+        Null,
+        "Invalid proxy %u\n",
+        proxy
+    );
+
+    AabbTreeNode *node  = aabb_tree_node_vector_data (&tree->nodes) + proxy;
+    Float32       slack = 4 * tree->margin;
+    if (aabb_contains (node->min, node->max, min, max) &&
+        aabb_contains (
+            (Vec2f) {.x = min.x - slack, .y = min.y - slack},
+            (Vec2f) {.x = max.x + slack, .y = max.y + slack},
+            node->min,
+            node->max
+        )) {
+        return tree;
+    }
+
+    /* removing a leaf frees it's parent, which is reused by insertion, so it can't fail */
+    aabb_tree_remove_leaf (tree, proxy);
+
+    node      = aabb_tree_node_vector_data (&tree->nodes) + proxy;
+    node->min = (Vec2f) {.x = min.x - tree->margin, .y = min.y - tree->margin};
+    node->max = (Vec2f) {.x = max.x + tree->margin, .y = max.y + tree->margin};
+
+    RETURN_VALUE_IF (!aabb_tree_insert_leaf (tree, proxy), Null, "Failed to reinsert box\n");
+
+    return tree;
+}
+
+/**
+ * @b Report every box overlapping given area, including boxes only touching it.
+ *
+ * A point is queried by giving same point as both corners.
+ *
+ * @param tree
+ * @param min Top left corner of area.
+ * @param max Bottom right corner of area.
+ * @param fn Called with data of each overlapping box, in no particular order.
+ * @param user Passed to @c fn.
+ *
+ * @return @c tree on success.
+ * @return @c Null otherwise.
+ * */
+AabbTree *aabb_tree_query (AabbTree *tree, Vec2f min, Vec2f max, AabbTreeQueryFn fn, void *user) {
+    RETURN_VALUE_IF (!tree || !fn, Null, ERR_INVALID_ARGUMENTS);
+
+    if (tree->root == AABB_TREE_NULL) {
+        return tree;
+    }
+
+    /* stack never holds more entries than height of tree, plus one */
+    Uint32 stack[AABB_TREE_HEIGHT_MAX];
+    Size   top   = 0;
+    stack[top++] = tree->root;
+
+    AabbTreeNode *nodes = aabb_tree_node_vector_data (&tree->nodes);
+    while (top) {
+        AabbTreeNode *node = nodes + stack[--top];
+        if (node->min.x > max.x || node->max.x < min.x || node->min.y > max.y ||
+            node->max.y < min.y) {
+            continue;
+        }
+
+        if (!node->height) {
+            if (!fn (node->data, user)) {
+                break;
+            }
+        } else {
+            RETURN_VALUE_IF (top + 2 > AABB_TREE_HEIGHT_MAX, Null, "AABB tree is too deep\n");
+            stack[top++] = node->children[0];
+            stack[top++] = node->children[1];
+        }
+    }
+
+    return tree;
+}
+
+/**
+ * @b Get height of given tree, zero if it's empty or has a single box.
+ *
+ * @param tree
+ *
+ * @return Height on success.
+ * @return -1 otherwise.
+ * */
+Int32 aabb_tree_get_height (AabbTree *tree) {
+    RETURN_VALUE_IF (!tree, -1, ERR_INVALID_ARGUMENTS);
+
+    if (tree->root == AABB_TREE_NULL) {
+        return 0;
+    }
+
+    return aabb_tree_node_vector_data (&tree->nodes)[tree->root].height;
+}
+
+/**************************************************************************************************/
+/*********************************** PRIVATE METHOD DEFINITIONS ***********************************/
+/**************************************************************************************************/
+
+/**
+ * @b Get a free node, growing node vector if needed. Pointers to nodes are
+ * invalidated.
+ *
+ * @return Index of new leaf node on success.
+ * @return @c AABB_TREE_NULL otherwise.
+ * */
+static Uint32 aabb_tree_allocate_node (AabbTree *tree) {
+    Uint32 index = tree->free_nodes;
+    if (index == AABB_TREE_NULL) {
+        RETURN_VALUE_IF (
+            tree->nodes.count >= AABB_TREE_NULL ||
+                !aabb_tree_node_vector_push (&tree->nodes, Null),
+            AABB_TREE_NULL,
+            "Failed to resize vector to store more tree nodes\n"
+        );
+        index = tree->nodes.count - 1;
+    } else {
+        tree->free_nodes = aabb_tree_node_vector_data (&tree->nodes)[index].parent;
+    }
+
+    aabb_tree_node_vector_data (&tree->nodes)[index] = (AabbTreeNode) {
+        .parent   = AABB_TREE_NULL,
+        .children = {AABB_TREE_NULL, AABB_TREE_NULL},
+    };
+
+    return index;
+}
+
+static void aabb_tree_free_node (AabbTree *tree, Uint32 node) {
+    AabbTreeNode *free = aabb_tree_node_vector_data (&tree->nodes) + node;
+    free->parent       = tree->free_nodes;
+    free->height       = -1;
+    tree->free_nodes   = node;
+}
+
+/**
+ * @b Insert given leaf next to the node whose box grows least by including it.
+ *
+ * Cost of placing leaf below a node is perimeter of new parent it would get,
+ * plus growth of boxes of all ancestors of that node. Descent stops once
+ * making leaf a sibling of current node is cheaper than going further down.
+ *
+ * @return @c True on success.
+ * @return @c False otherwise.
+ * */
+static Bool aabb_tree_insert_leaf (AabbTree *tree, Uint32 leaf) {
+    if (tree->root == AABB_TREE_NULL) {
+        tree->root                                              = leaf;
+        aabb_tree_node_vector_data (&tree->nodes)[leaf].parent = AABB_TREE_NULL;
+        return True;
+    }
+
+    Uint32 parent = aabb_tree_allocate_node (tree);
+    RETURN_VALUE_IF (parent == AABB_TREE_NULL, False, "Failed to allocate tree node\n");
+
+    AabbTreeNode *nodes = aabb_tree_node_vector_data (&tree->nodes);
+    AabbTreeNode *box   = nodes + leaf;
+
+    Uint32 sibling = tree->root;
+    while (nodes[sibling].height) {
+        AabbTreeNode *node     = nodes + sibling;
+        Float32       combined = aabb_get_union_perimeter (node, box);
+
+        /* cost of making leaf a sibling of this node, and growth pushed to it's children */
+        Float32 cost        = 2 * combined;
+        Float32 inheritance = 2 * (combined - aabb_get_perimeter (node->min, node->max));
+
+        Float32 child_cost[2];
+        for (Uint32 c = 0; c < 2; c++) {
+            AabbTreeNode *child = nodes + node->children[c];
+
+            child_cost[c] = aabb_get_union_perimeter (child, box) + inheritance;
+            if (child->height) {
+                child_cost[c] -= aabb_get_perimeter (child->min, child->max);
+            }
+        }
+
+        if (cost < child_cost[0] && cost < child_cost[1]) {
+            break;
+        }
+
+        sibling = node->children[child_cost[0] < child_cost[1] ? 0 : 1];
+    }
+
+    Uint32 old_parent         = nodes[sibling].parent;
+    nodes[parent].parent      = old_parent;
+    nodes[parent].children[0] = sibling;
+    nodes[parent].children[1] = leaf;
+    nodes[sibling].parent     = parent;
+    nodes[leaf].parent        = parent;
+    aabb_node_fit (nodes + parent, nodes + sibling, nodes + leaf);
+
+    if (old_parent == AABB_TREE_NULL) {
+        tree->root = parent;
+    } else {
+        aabb_tree_replace_child (tree, old_parent, sibling, parent);
+    }
+
+    aabb_tree_refit (tree, old_parent);
+
+    return True;
+}
+
+/**
+ * @b Unlink given leaf from tree, and free it's parent. Leaf node itself is not freed.
+ * */
+static void aabb_tree_remove_leaf (AabbTree *tree, Uint32 leaf) {
+    if (leaf == tree->root) {
+        tree->root = AABB_TREE_NULL;
+        return;
+    }
+
+    AabbTreeNode *nodes       = aabb_tree_node_vector_data (&tree->nodes);
+    Uint32        parent      = nodes[leaf].parent;
+    Uint32        grandparent = nodes[parent].parent;
+    Uint32        sibling     = nodes[parent].children[nodes[parent].children[0] == leaf ? 1 : 0];
+
+    nodes[sibling].parent = grandparent;
+    if (grandparent == AABB_TREE_NULL) {
+        tree->root = sibling;
+    } else {
+        aabb_tree_replace_child (tree, grandparent, parent, sibling);
+    }
+
+    aabb_tree_free_node (tree, parent);
+    aabb_tree_refit (tree, grandparent);
+}
+
+/**
+ * @b Balance given node and all it's ancestors, and fit their boxes and heights to children.
+ * */
+static void aabb_tree_refit (AabbTree *tree, Uint32 node) {
+    AabbTreeNode *nodes = aabb_tree_node_vector_data (&tree->nodes);
+
+    while (node != AABB_TREE_NULL) {
+        node = aabb_tree_balance (tree, node);
+
+        AabbTreeNode *n = nodes + node;
+        aabb_node_fit (n, nodes + n->children[0], nodes + n->children[1]);
+
+        node = n->parent;
+    }
+}
+
+/**
+ * @b Rotate taller child of given node up, if heights of it's children differ by more than one.
+ *
+ * Taller grandchild stays below the rotated node, and shorter one takes it's
+ * place below given node.
+ *
+ * @return Index of node now at position of given node.
+ * */
+static Uint32 aabb_tree_balance (AabbTree *tree, Uint32 a) {
+    AabbTreeNode *nodes = aabb_tree_node_vector_data (&tree->nodes);
+    AabbTreeNode *node  = nodes + a;
+    if (node->height < 2) {
+        return a;
+    }
+
+    Int32 balance = nodes[node->children[1]].height - nodes[node->children[0]].height;
+    if (balance >= -1 && balance <= 1) {
+        return a;
+    }
+
+    /* child rotated up, and child staying in place */
+    Uint32 up   = balance > 1 ? 1 : 0;
+    Uint32 b    = node->children[up];
+    Uint32 stay = node->children[1 - up];
+
+    AabbTreeNode *rotated = nodes + b;
+    Uint32        f       = rotated->children[0];
+    Uint32        g       = rotated->children[1];
+    if (nodes[f].height > nodes[g].height) {
+        Uint32 t = f;
+        f        = g;
+        g        = t;
+    }
+
+    /* b takes place of a, a becomes first child of b, and shorter grandchild f moves below a */
+    rotated->parent = node->parent;
+    if (rotated->parent == AABB_TREE_NULL) {
+        tree->root = b;
+    } else {
+        aabb_tree_replace_child (tree, rotated->parent, a, b);
+    }
+
+    rotated->children[0] = a;
+    rotated->children[1] = g;
+    node->parent         = b;
+    node->children[up]   = f;
+    nodes[f].parent      = a;
+
+    aabb_node_fit (node, nodes + stay, nodes + f);
+    aabb_node_fit (rotated, node, nodes + g);
+
+    return b;
+}
+
+static void aabb_tree_replace_child (AabbTree *tree, Uint32 parent, Uint32 old, Uint32 new) {
+    AabbTreeNode *node = aabb_tree_node_vector_data (&tree->nodes) + parent;
+    node->children[node->children[0] == old ? 0 : 1] = new;
+}
+
+/**
+ * @b Set box and height of given internal node from it's children.
+ * */
+static void aabb_node_fit (AabbTreeNode *node, AabbTreeNode *first, AabbTreeNode *second) {
+    node->min.x  = MIN (first->min.x, second->min.x);
+    node->min.y  = MIN (first->min.y, second->min.y);
+    node->max.x  = MAX (first->max.x, second->max.x);
+    node->max.y  = MAX (first->max.y, second->max.y);
+    node->height = 1 + MAX (first->height, second->height);
+}
+
+/**
+ * @b Perimeter is used as cost of a box, since it grows with both width and
+ * height, even if one of them is zero.
+ * */
+static Float32 aabb_get_perimeter (Vec2f min, Vec2f max) {
+    return 2 * ((max.x - min.x) + (max.y - min.y));
+}
+
+static Float32 aabb_get_union_perimeter (AabbTreeNode *first, AabbTreeNode *second) {
+    Float32 width  = MAX (first->max.x, second->max.x) - MIN (first->min.x, second->min.x);
+    Float32 height = MAX (first->max.y, second->max.y) - MIN (first->min.y, second->min.y);
+    return 2 * (width + height);
+}
+
+static Bool aabb_contains (Vec2f min, Vec2f max, Vec2f inner_min, Vec2f inner_max) {
+    return min.x <= inner_min.x && min.y <= inner_min.y && inner_max.x <= max.x &&
+           inner_max.y <= max.y;
+}
@@ -0,0 +1,388 @@
+/**
+ * @file Allocator.c
+ * @date Sun, 18th October 2026
+ * @author Siddharth Mishra (admin@brightprogrammer.in)
+ * @copyright Copyright 2024 Siddharth Mishra
+ * @copyright Copyright 2024 Anvie Labs
+ *
+ * Copyright 2024 Siddharth Mishra, Anvie Labs
+ * 
+ * Redistribution and use in source and binary forms, with or without modification, are permitted 
+ * provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+ *    and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions
+ *    and the following disclaimer in the documentation and/or other materials provided with the
+ *    distribution.
+ * 
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse
+ *    or promote products derived from this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND 
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * */
+
+#include <Anvie/Common.h>
+#include <Anvie/CrossGui/Utils/Allocator.h>
+
+/* libc */
+#include <memory.h>
+#include <stdatomic.h>
+#include <stdint.h>
+
+/**
+ * @b Prepended to every allocation. Size is a multiple of 16 so that memory
+ * returned to user code keeps the alignment guaranteed by the backend.
+ * */
+typedef struct AllocationHeader {
+    Size   size;  /**< @b Size requested by user code (without header). */
+    Uint32 tag;   /**< @b AllocatorTag this allocation is accounted to. */
+    Uint32 magic; /**< @b Used to catch frees of memory not allocated by us. */
+} AllocationHeader;
+
+_Static_assert (sizeof (AllocationHeader) % 16 == 0, "Allocation header breaks alignment");
+
+#define ALLOCATION_MAGIC 0xa110ca7e
+
+typedef struct TagStats {
+    _Atomic (Uint64) live_bytes;
+    _Atomic (Uint64) peak_bytes;
+    _Atomic (Uint64) live_allocations;
+    _Atomic (Uint64) allocation_count;
+} TagStats;
+
+/**************************************************************************************************/
+/********************************** PRIVATE METHOD DECLARATIONS ***********************************/
+/**************************************************************************************************/
+
+static void *allocate_tracked (Size size, AllocatorTag tag);
+static void *libc_allocate (void *user_data, Size size);
+static void *libc_reallocate (void *user_data, void *ptr, Size size);
+static void  libc_free (void *user_data, void *ptr);
+static void  track_allocation (AllocatorTag tag, Size size);
+static void  track_free (AllocatorTag tag, Size size);
+static void  update_peak (TagStats *stats, Uint64 live_bytes);
+
+static AllocatorBackend allocator_backend = {
+    .allocate   = libc_allocate,
+    .reallocate = libc_reallocate,
+    .free       = libc_free,
+    .user_data  = Null
+};
+
+static TagStats tag_stats[ALLOCATOR_TAG_MAX];
+static Bool     is_leak_report_enabled = False;
+
+static const CString tag_names[ALLOCATOR_TAG_MAX] = {
+    [ALLOCATOR_TAG_GENERAL]      = "general",
+    [ALLOCATOR_TAG_MESH_MANAGER] = "mesh manager",
+    [ALLOCATOR_TAG_BATCHES]      = "batches",
+    [ALLOCATOR_TAG_SWAPCHAIN]    = "swapchain",
+    [ALLOCATOR_TAG_PLUGIN]       = "plugin",
+    [ALLOCATOR_TAG_FRAME_ARENA]  = "frame arena",
+    [ALLOCATOR_TAG_PLOT]         = "plot",
+    [ALLOCATOR_TAG_GLYPH_ATLAS]  = "glyph atlas",
+    [ALLOCATOR_TAG_TEXT_LAYOUT]  = "text layout",
+    [ALLOCATOR_TAG_WIDGETS]      = "widgets",
+    [ALLOCATOR_TAG_SPATIAL]      = "spatial",
+};
+
+/**************************************************************************************************/
+/*********************************** PUBLIC METHOD DEFINITIONS ************************************/
+/**************************************************************************************************/
+
+/**
+ * @b Allocate uninitialized memory.
+ *
+ * @param size Number of bytes.
+ * @param tag Subsystem this allocation is accounted to.
+ *
+ * @return Pointer to allocated memory on success.
+ * @return @c Null otherwise.
+ * */
+void *allocator_alloc (Size size, AllocatorTag tag) {
+    RETURN_VALUE_IF (tag >= ALLOCATOR_TAG_MAX, Null, ERR_INVALID_ARGUMENTS);
+    return allocate_tracked (size, tag);
+}
+
+/**
+ * @b Allocate zero-initialized memory for @c count objects of @c size bytes each.
+ *
+ * @param count Number of objects.
+ * @param size Size of each object.
+ * @param tag Subsystem this allocation is accounted to.
+ *
+ * @return Pointer to allocated memory on success.
+ * @return @c Null otherwise.
+ * */
+void *allocator_calloc (Size count, Size size, AllocatorTag tag) {
+    RETURN_VALUE_IF (tag >= ALLOCATOR_TAG_MAX, Null, ERR_INVALID_ARGUMENTS);
+    RETURN_VALUE_IF (size && count > SIZE_MAX / size, Null, ERR_OUT_OF_MEMORY);
+
+    void *mem = allocate_tracked (count * size, tag);
+    if (mem) {
+        memset (mem, 0, count * size);
+    }
+
+    return mem;
+}
+
+/**
+ * @b Resize memory allocated with @c allocator_calloc.
+ *
+ * Unlike @c allocator_calloc, newly added memory region is not zeroed.
+ * A resized allocation stays accounted to the tag it was first allocated with.
+ *
+ * @param ptr Memory to be resized. If @c Null, this behaves like a non-zeroing allocation.
+ * @param size New size in bytes.
+ * @param tag Used only when @c ptr is @c Null.
+ *
+ * @return Pointer to resized memory on success.
+ * @return @c Null otherwise. @c ptr is not freed in this case.
+ * */
+void *allocator_realloc (void *ptr, Size size, AllocatorTag tag) {
+    if (!ptr) {
+        return allocator_alloc (size, tag);
+    }
+
+    RETURN_VALUE_IF (size > SIZE_MAX - sizeof (AllocationHeader), Null, ERR_OUT_OF_MEMORY);
+
+    AllocationHeader *header = (AllocationHeader *)ptr - 1;
+    ABORT_IF (header->magic != ALLOCATION_MAGIC, "Reallocating memory not allocated by allocator\n");
+
+    Size         old_size = header->size;
+    AllocatorTag old_tag  = header->tag;
+
+    header = allocator_backend.reallocate (
+        allocator_backend.user_data,
+        header,
+        sizeof (AllocationHeader) + size
+    );
+    RETURN_VALUE_IF (!header, Null, ERR_OUT_OF_MEMORY);
+
+    header->size = size;
+
+    /* account only the difference, this is still the same allocation */
+    TagStats *stats = tag_stats + old_tag;
+    if (size >= old_size) {
+        Uint64 live = atomic_fetch_add (&stats->live_bytes, size - old_size) + (size - old_size);
+        update_peak (stats, live);
+    } else {
+        atomic_fetch_sub (&stats->live_bytes, old_size - size);
+    }
+
+    return header + 1;
+}
+
+/**
+ * @b Free memory allocated with @c allocator_calloc or @c allocator_realloc.
+ *
+ * @param ptr Freeing @c Null is a no-op.
+ * */
+void allocator_free (void *ptr) {
+    if (!ptr) {
+        return;
+    }
+
+    AllocationHeader *header = (AllocationHeader *)ptr - 1;
+    ABORT_IF (header->magic != ALLOCATION_MAGIC, "Freeing memory not allocated by allocator\n");
+
+    track_free (header->tag, header->size);
+
+    /* catch double frees */
+    header->magic = 0;
+
+    allocator_backend.free (allocator_backend.user_data, header);
+}
+
+/**
+ * @b Replace the backend providing memory.
+ *
+ * Backend can only be changed while there are no live allocations, otherwise
+ * memory allocated by one backend would be freed by another.
+ *
+ * @param backend New backend. @c Null restores the default libc backend.
+ *
+ * @return @c True on success.
+ * @return @c False otherwise.
+ * */
+Bool allocator_set_backend (const AllocatorBackend *backend) {
+    RETURN_VALUE_IF (
+        backend && (!backend->allocate || !backend->reallocate || !backend->free),
+        False,
+        ERR_INVALID_ARGUMENTS
+    );
+
+    for (Size s = 0; s < ALLOCATOR_TAG_MAX; s++) {
+        RETURN_VALUE_IF (
+            atomic_load (&tag_stats[s].live_allocations),
+            False,
+            "Cannot change allocator backend while \"%s\" has live allocations\n",
+            tag_names[s]
+        );
+    }
+
+    if (backend) {
+        allocator_backend = *backend;
+    } else {
+        allocator_backend = (AllocatorBackend) {
+            .allocate   = libc_allocate,
+            .reallocate = libc_reallocate,
+            .free       = libc_free,
+            .user_data  = Null
+        };
+    }
+
+    return True;
+}
+
+/**
+ * @b Get allocation statistics of given tag.
+ *
+ * @param tag
+ * @param stats Where statistics will be stored.
+ *
+ * @return @c True on success.
+ * @return @c False otherwise.
+ * */
+Bool allocator_get_stats (AllocatorTag tag, AllocatorStats *stats) {
+    RETURN_VALUE_IF (tag >= ALLOCATOR_TAG_MAX || !stats, False, ERR_INVALID_ARGUMENTS);
+
+    TagStats *ts            = tag_stats + tag;
+    stats->live_bytes       = atomic_load (&ts->live_bytes);
+    stats->peak_bytes       = atomic_load (&ts->peak_bytes);
+    stats->live_allocations = atomic_load (&ts->live_allocations);
+    stats->allocation_count = atomic_load (&ts->allocation_count);
+
+    return True;
+}
+
+/**
+ * @b Get human readable name of given tag.
+ *
+ * @param tag
+ *
+ * @return Name of tag on success.
+ * @return @c Null otherwise.
+ * */
+CString allocator_tag_name (AllocatorTag tag) {
+    RETURN_VALUE_IF (tag >= ALLOCATOR_TAG_MAX, Null, ERR_INVALID_ARGUMENTS);
+    return tag_names[tag];
+}
+
+/**
+ * @b Enable or disable leak report. Leak report can also be enabled by setting
+ * @c CROSSGUI_LEAK_REPORT environment variable.
+ *
+ * @param enable
+ * */
+void allocator_set_leak_report (Bool enable) {
+    is_leak_report_enabled = enable;
+}
+
+/**
+ * @b Print live allocations of each tag to stderr, if leak report is enabled.
+ *
+ * This is meant to be called when a subsystem is torn down (eg: plugin deinit),
+ * at which point its tags are expected to have no live allocations.
+ *
+ * @return @c True if any tag has live allocations.
+ * @return @c False otherwise, or if leak report is disabled.
+ * */
+Bool allocator_report_leaks() {
+    if (!is_leak_report_enabled && !getenv ("CROSSGUI_LEAK_REPORT")) {
+        return False;
+    }
+
+    Bool has_leaks = False;
+    for (Size s = 0; s < ALLOCATOR_TAG_MAX; s++) {
+        AllocatorStats stats;
+        allocator_get_stats (s, &stats);
+
+        if (stats.live_allocations) {
+            PRINT_ERR (
+                "\"%s\" : %zu bytes in %zu allocations still live (peak %zu bytes, %zu allocations "
+                "made)\n",
+                tag_names[s],
+                (Size)stats.live_bytes,
+                (Size)stats.live_allocations,
+                (Size)stats.peak_bytes,
+                (Size)stats.allocation_count
+            );
+            has_leaks = True;
+        }
+    }
+
+    return has_leaks;
+}
+
+/**************************************************************************************************/
+/*********************************** PRIVATE METHOD DEFINITIONS ***********************************/
+/**************************************************************************************************/
+
+static void *allocate_tracked (Size size, AllocatorTag tag) {
+    RETURN_VALUE_IF (size > SIZE_MAX - sizeof (AllocationHeader), Null, ERR_OUT_OF_MEMORY);
+
+    AllocationHeader *header =
+        allocator_backend.allocate (allocator_backend.user_data, sizeof (AllocationHeader) + size);
+    RETURN_VALUE_IF (!header, Null, ERR_OUT_OF_MEMORY);
+
+    header->size  = size;
+    header->tag   = tag;
+    header->magic = ALLOCATION_MAGIC;
+
+    track_allocation (tag, size);
+
+    return header + 1;
+}
+
+static void *libc_allocate (void *user_data, Size size) {
+    UNUSED (user_data);
+    return malloc (size);
+}
+
+static void *libc_reallocate (void *user_data, void *ptr, Size size) {
+    UNUSED (user_data);
+    return realloc (ptr, size);
+}
+
+static void libc_free (void *user_data, void *ptr) {
+    UNUSED (user_data);
+    free (ptr);
+}
+
+static void track_allocation (AllocatorTag tag, Size size) {
+    TagStats *stats = tag_stats + tag;
+
+    atomic_fetch_add_explicit (&stats->allocation_count, 1, memory_order_relaxed);
+    atomic_fetch_add_explicit (&stats->live_allocations, 1, memory_order_relaxed);
+
+    Uint64 live = atomic_fetch_add_explicit (&stats->live_bytes, size, memory_order_relaxed) + size;
+    update_peak (stats, live);
+}
+
+static void track_free (AllocatorTag tag, Size size) {
+    TagStats *stats = tag_stats + tag;
+
+    atomic_fetch_sub_explicit (&stats->live_allocations, 1, memory_order_relaxed);
+    atomic_fetch_sub_explicit (&stats->live_bytes, size, memory_order_relaxed);
+}
+
+static void update_peak (TagStats *stats, Uint64 live_bytes) {
+    Uint64 peak = atomic_load_explicit (&stats->peak_bytes, memory_order_relaxed);
+    while (peak < live_bytes && !atomic_compare_exchange_weak_explicit (
+                                    &stats->peak_bytes,
+                                    &peak,
+                                    live_bytes,
+                                    memory_order_relaxed,
+                                    memory_order_relaxed
+                                )) {}
+}
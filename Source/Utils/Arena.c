@@ -0,0 +1,200 @@
+/**
+ * @file Arena.c
+ * @date Sun, 18th October 2026
+ * @author Siddharth Mishra (admin@brightprogrammer.in)
+ * @copyright Copyright 2024 Siddharth Mishra
+ * @copyright Copyright 2024 Anvie Labs
+ *
+ * Copyright 2024 Siddharth Mishra, Anvie Labs
+ * 
+ * Redistribution and use in source and binary forms, with or without modification, are permitted 
+ * provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+ *    and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions
+ *    and the following disclaimer in the documentation and/or other materials provided with the
+ *    distribution.
+ * 
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse
+ *    or promote products derived from this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND 
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * */
+
+#include <Anvie/Common.h>
+#include <Anvie/CrossGui/Utils/Arena.h>
+
+/* libc */
+#include <memory.h>
+#include <stdalign.h>
+#include <stddef.h>
+#include <stdint.h>
+
+struct ArenaBlock {
+    ArenaBlock *next;     /**< @b Previously filled block. */
+    Size        capacity; /**< @b Usable bytes after the header. */
+    Size        offset;   /**< @b Bytes used in this block. */
+    alignas (max_align_t) Uint8 data[];
+};
+
+/**************************************************************************************************/
+/********************************** PRIVATE METHOD DECLARATIONS ***********************************/
+/**************************************************************************************************/
+
+static ArenaBlock *arena_block_create (Size capacity, AllocatorTag tag);
+static void        arena_free_blocks (Arena *arena);
+
+/**************************************************************************************************/
+/*********************************** PUBLIC METHOD DEFINITIONS ************************************/
+/**************************************************************************************************/
+
+/**
+ * @b Initialize an empty arena. No memory is allocated until first allocation.
+ *
+ * @param arena
+ * @param block_size Minimum size of blocks the arena allocates memory in.
+ * @param tag Tag that block allocations are accounted to.
+ *
+ * @return @c arena on success.
+ * @return @c Null otherwise.
+ * */
+Arena *arena_init (Arena *arena, Size block_size, AllocatorTag tag) {
+    RETURN_VALUE_IF (!arena || !block_size || tag >= ALLOCATOR_TAG_MAX, Null, ERR_INVALID_ARGUMENTS);
+
+    memset (arena, 0, sizeof (Arena));
+    arena->block_size = block_size;
+    arena->tag        = tag;
+
+    return arena;
+}
+
+/**
+ * @b Free all memory owned by given arena.
+ *
+ * @param arena
+ *
+ * @return @c arena on success.
+ * @return @c Null otherwise.
+ * */
+Arena *arena_deinit (Arena *arena) {
+    RETURN_VALUE_IF (!arena, Null, ERR_INVALID_ARGUMENTS);
+
+    arena_free_blocks (arena);
+    memset (arena, 0, sizeof (Arena));
+
+    return arena;
+}
+
+/**
+ * @b Allocate uninitialized memory from arena.
+ *
+ * @param arena
+ * @param size Number of bytes.
+ * @param alignment Required alignment, must be a power of two and at most
+ *        @c alignof(max_align_t).
+ *
+ * @return Pointer to memory valid until next reset on success.
+ * @return @c Null otherwise.
+ * */
+void *arena_alloc (Arena *arena, Size size, Size alignment) {
+    RETURN_VALUE_IF (
+        !arena || !alignment || (alignment & (alignment - 1)) ||
+            alignment > alignof (max_align_t),
+        Null,
+        ERR_INVALID_ARGUMENTS
+    );
+
+    ArenaBlock *block = arena->blocks;
+
+    if (block) {
+        Size offset = (block->offset + alignment - 1) & ~(alignment - 1);
+        if (offset <= block->capacity && size <= block->capacity - offset) {
+            arena->used   += offset - block->offset + size;
+            arena->peak    = MAX (arena->peak, arena->used);
+            block->offset  = offset + size;
+            return block->data + offset;
+        }
+    }
+
+    /* current block is full, start a new one that's at least as big as the previous one */
+    Size capacity = MAX (arena->block_size, block ? block->capacity * 2 : 0);
+    capacity      = MAX (capacity, size);
+
+    block = arena_block_create (capacity, arena->tag);
+    RETURN_VALUE_IF (!block, Null, ERR_OUT_OF_MEMORY);
+
+    block->next   = arena->blocks;
+    arena->blocks = block;
+
+    block->offset  = size;
+    arena->used   += size;
+    arena->peak    = MAX (arena->peak, arena->used);
+
+    return block->data;
+}
+
+/**
+ * @b Make all memory allocated from arena available again.
+ *
+ * If the arena had to grow into multiple blocks, those are replaced with a
+ * single block that can hold the peak usage, so steady state use of the arena
+ * makes no heap allocations.
+ *
+ * @param arena
+ *
+ * @return @c arena on success.
+ * @return @c Null otherwise.
+ * */
+Arena *arena_reset (Arena *arena) {
+    RETURN_VALUE_IF (!arena, Null, ERR_INVALID_ARGUMENTS);
+
+    if (arena->blocks && arena->blocks->next) {
+        arena_free_blocks (arena);
+
+        /* failing here is not fatal, arena will just grow again on next allocation */
+        arena->blocks = arena_block_create (MAX (arena->peak, arena->block_size), arena->tag);
+    }
+
+    if (arena->blocks) {
+        arena->blocks->offset = 0;
+    }
+    arena->used = 0;
+
+    return arena;
+}
+
+/**************************************************************************************************/
+/*********************************** PRIVATE METHOD DEFINITIONS ***********************************/
+/**************************************************************************************************/
+
+static ArenaBlock *arena_block_create (Size capacity, AllocatorTag tag) {
+    RETURN_VALUE_IF (capacity > SIZE_MAX - sizeof (ArenaBlock), Null, ERR_OUT_OF_MEMORY);
+
+    ArenaBlock *block = allocator_alloc (sizeof (ArenaBlock) + capacity, tag);
+    RETURN_VALUE_IF (!block, Null, ERR_OUT_OF_MEMORY);
+
+    block->next     = Null;
+    block->capacity = capacity;
+    block->offset   = 0;
+
+    return block;
+}
+
+static void arena_free_blocks (Arena *arena) {
+    ArenaBlock *block = arena->blocks;
+    while (block) {
+        ArenaBlock *next = block->next;
+        FREE (block);
+        block = next;
+    }
+    arena->blocks = Null;
+}
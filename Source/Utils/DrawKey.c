@@ -0,0 +1,96 @@
+/**
+ * @file DrawKey.c
+ * @date Sun, 18th October 2026
+ * @author Siddharth Mishra (admin@brightprogrammer.in)
+ * @copyright Copyright 2024 Siddharth Mishra
+ * @copyright Copyright 2024 Anvie Labs
+ *
+ * Copyright 2024 Siddharth Mishra, Anvie Labs
+ * 
+ * Redistribution and use in source and binary forms, with or without modification, are permitted 
+ * provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+ *    and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions
+ *    and the following disclaimer in the documentation and/or other materials provided with the
+ *    distribution.
+ * 
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse
+ *    or promote products derived from this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND 
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * */
+
+#include <Anvie/Common.h>
+#include <Anvie/CrossGui/Utils/DrawKey.h>
+
+/**************************************************************************************************/
+/*********************************** PUBLIC METHOD DEFINITIONS ************************************/
+/**************************************************************************************************/
+
+/**
+ * @b Pack a key that sorts instances into batches, and each batch front to back.
+ *
+ * Opaque instances are sorted front to back, so depth test rejects what they
+ * hide before it's shaded, and blended ones back to front, so they blend
+ * over what's behind them.
+ *
+ * @param pass Pass instance is drawn in.
+ * @param is_primitive Whether instance is drawn by primitive pipeline.
+ * @param mesh_type Mesh type of instance, zero for primitives.
+ * @param depth Depth of instance, smaller is nearer, quantized to 24 bits.
+ *
+ * @return Draw key of instance.
+ * */
+Uint64 draw_key_pack_2d (DrawPass pass, Bool is_primitive, Uint32 mesh_type, Float32 depth) {
+    /* anything outside depth range is clipped anyway, and rounding is done in
+     * double, since in float depth 1 rounds to one past largest depth */
+    Float64 clamped = depth > 0.f ? MIN (depth, 1.f) : 0.f;
+    Uint64  z       = (Uint64)(clamped * DRAW_KEY_DEPTH_MAX + 0.5);
+    if (pass == DRAW_PASS_BLENDED) {
+        z = DRAW_KEY_DEPTH_MAX - z;
+    }
+
+    return ((Uint64)(pass == DRAW_PASS_BLENDED) << DRAW_KEY_PASS_SHIFT) |
+           ((Uint64)!!is_primitive << DRAW_KEY_PIPELINE_SHIFT) |
+           (((Uint64)mesh_type & DRAW_KEY_MESH_TYPE_MASK) << DRAW_KEY_MESH_TYPE_SHIFT) | z;
+}
+
+/**
+ * @b Find where a batch is in given batch keys, sorted in increasing order.
+ *
+ * Batches kept in order of their keys are drawn in order, one after another,
+ * so that all opaque batches are drawn before blended ones.
+ *
+ * @param batch_keys Keys of batches, see @c draw_key_batch.
+ * @param count Number of batch keys.
+ * @param batch_key Key of batch to find.
+ *
+ * @return Index of batch with given key, if there's one.
+ * @return Index new batch must be inserted at to keep keys sorted otherwise.
+ * */
+Size draw_key_find_batch (const Uint64 *batch_keys, Size count, Uint64 batch_key) {
+    RETURN_VALUE_IF (!batch_keys && count, 0, ERR_INVALID_ARGUMENTS);
+
+    Size begin = 0;
+    Size end   = count;
+    while (begin < end) {
+        Size middle = begin + (end - begin) / 2;
+        if (batch_keys[middle] < batch_key) {
+            begin = middle + 1;
+        } else {
+            end = middle;
+        }
+    }
+
+    return begin;
+}
@@ -0,0 +1,942 @@
+/**
+ * @file GlyphAtlas.c
+ * @date Sun, 18th October 2026
+ * @author Siddharth Mishra (admin@brightprogrammer.in)
+ * @copyright Copyright 2024 Siddharth Mishra
+ * @copyright Copyright 2024 Anvie Labs
+ *
+ * Copyright 2024 Siddharth Mishra, Anvie Labs
+ * 
+ * Redistribution and use in source and binary forms, with or without modification, are permitted 
+ * provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+ *    and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions
+ *    and the following disclaimer in the documentation and/or other materials provided with the
+ *    distribution.
+ * 
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse
+ *    or promote products derived from this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND 
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * */
+
+#define ALLOCATOR_TAG ALLOCATOR_TAG_GLYPH_ATLAS
+
+#include <Anvie/Common.h>
+#include <Anvie/CrossGui/Utils/GlyphAtlas.h>
+
+/* libc */
+#include <memory.h>
+#include <stdint.h>
+#include <stdio.h>
+
+NEW_VECTOR_TYPE (GlyphAtlasSkylineNode, GlyphAtlasSkyline, glyph_atlas_skyline_node);
+NEW_VECTOR_TYPE (GlyphAtlasEntry, GlyphAtlasEntryVector, glyph_atlas_entry);
+NEW_VECTOR_TYPE (Uint32, GlyphAtlasIndexVector, glyph_atlas_index);
+NEW_VECTOR_TYPE (GlyphAtlasRect, GlyphAtlasRectVector, glyph_atlas_rect);
+
+/**
+ * @b Identifies a glyph atlas file, "XGAT" when read as bytes on a little endian machine.
+ * */
+#define GLYPH_ATLAS_FILE_MAGIC   0x54414758
+#define GLYPH_ATLAS_FILE_VERSION 1
+
+/**
+ * @b Glyph atlas file starts with this header, followed by skyline of each page
+ * (node count and nodes), followed by glyphs, followed by pixels. Everything is
+ * stored in native byte order, since file is only a cache to speed up startup.
+ * */
+typedef struct GlyphAtlasFileHeader {
+    Uint32 magic;
+    Uint32 version;
+    Uint32 width;
+    Uint32 height;
+    Uint32 page_count;
+    Uint32 glyph_count;
+} GlyphAtlasFileHeader;
+
+/**
+ * @b Glyph as stored in a glyph atlas file.
+ * */
+typedef struct GlyphAtlasFileGlyph {
+    GlyphKey       key;
+    GlyphAtlasRect rect;
+    Float32        bearing_x;
+    Float32        bearing_y;
+    Float32        advance;
+    Uint32         page;
+} GlyphAtlasFileGlyph;
+
+/**************************************************************************************************/
+/********************************** PRIVATE METHOD DECLARATIONS ***********************************/
+/**************************************************************************************************/
+
+static inline Uint32 glyph_key_hash (GlyphKey *key);
+static inline Bool   glyph_key_equal (GlyphKey *a, GlyphKey *b);
+static Uint32       *glyph_atlas_find_slot (GlyphAtlas *atlas, GlyphKey *key);
+static GlyphAtlas   *glyph_atlas_grow_slots (GlyphAtlas *atlas);
+static void          glyph_atlas_remove_slot (GlyphAtlas *atlas, Uint32 *slot);
+static Bool          glyph_atlas_pack (GlyphAtlas *atlas, Uint32 w, Uint32 h, GlyphAtlasRect *rect);
+static Bool          glyph_atlas_evict_lru_page (GlyphAtlas *atlas);
+static GlyphAtlas   *glyph_atlas_add_dirty_rect (GlyphAtlas *atlas, GlyphAtlasRect rect);
+static Int32
+    skyline_fit (GlyphAtlasSkyline *skyline, Size node, Uint32 w, Uint32 h, Uint32 max_h);
+static Bool          skyline_add (GlyphAtlasSkyline *skyline, Size node, Uint32 w, Uint32 y);
+static Bool          glyph_atlas_read_file (GlyphAtlas *atlas, FILE *file);
+static Bool          glyph_atlas_rect_is_valid (GlyphAtlas *atlas, GlyphAtlasFileGlyph *glyph);
+
+/**************************************************************************************************/
+/*********************************** PUBLIC METHOD DEFINITIONS ************************************/
+/**************************************************************************************************/
+
+/**
+ * @b Initialize an empty glyph atlas.
+ *
+ * Whole atlas starts out dirty, so that it's GPU copy starts out cleared too.
+ *
+ * @param atlas
+ * @param width Width of atlas in pixels.
+ * @param height Height of atlas in pixels.
+ * @param pages Number of pages to split atlas into. Fewer pages pack better,
+ *        more pages evict less at a time.
+ *
+ * @return @c atlas on success.
+ * @return @c Null otherwise.
+ * */
+GlyphAtlas *glyph_atlas_init (GlyphAtlas *atlas, Uint32 width, Uint32 height, Uint32 pages) {
+    RETURN_VALUE_IF (
+        !atlas || !width || !height || width > UINT16_MAX || height > UINT16_MAX || !pages ||
+            pages > GLYPH_ATLAS_PAGE_MAX || height < pages,
+        Null,
+        ERR_INVALID_ARGUMENTS
+    );
+
+    memset (atlas, 0, sizeof (GlyphAtlas));
+
+    atlas->width       = width;
+    atlas->height      = height;
+    atlas->page_count  = pages;
+    atlas->page_height = height / pages;
+    atlas->frame       = 1;
+
+    atlas->pixels = ALLOCATE (Uint8, (Size)width * height);
+    GOTO_HANDLER_IF (!atlas->pixels, INIT_FAILED, ERR_OUT_OF_MEMORY);
+
+    GlyphAtlasSkylineNode empty_page = {.x = 0, .y = 0, .width = width};
+    for (Uint32 p = 0; p < pages; p++) {
+        GOTO_HANDLER_IF (
+            !glyph_atlas_skyline_node_vector_push (&atlas->pages[p].skyline, &empty_page),
+            INIT_FAILED,
+            "Failed to create skyline of atlas page\n"
+        );
+    }
+
+    GOTO_HANDLER_IF (
+        !glyph_atlas_grow_slots (atlas),
+        INIT_FAILED,
+        "Failed to create glyph hash table\n"
+    );
+
+    GlyphAtlasRect whole_atlas = {.x = 0, .y = 0, .width = width, .height = height};
+    GOTO_HANDLER_IF (
+        !glyph_atlas_add_dirty_rect (atlas, whole_atlas),
+        INIT_FAILED,
+        "Failed to mark atlas dirty\n"
+    );
+
+    return atlas;
+
+INIT_FAILED:
+    glyph_atlas_deinit (atlas);
+    return Null;
+}
+
+/**
+ * @b Free all memory owned by given glyph atlas.
+ *
+ * @param atlas
+ *
+ * @return @c atlas on success.
+ * @return @c Null otherwise.
+ * */
+GlyphAtlas *glyph_atlas_deinit (GlyphAtlas *atlas) {
+    RETURN_VALUE_IF (!atlas, Null, ERR_INVALID_ARGUMENTS);
+
+    if (atlas->pixels) {
+        FREE (atlas->pixels);
+    }
+
+    if (atlas->slots) {
+        FREE (atlas->slots);
+    }
+
+    for (Uint32 p = 0; p < GLYPH_ATLAS_PAGE_MAX; p++) {
+        glyph_atlas_skyline_node_vector_deinit (&atlas->pages[p].skyline);
+    }
+
+    glyph_atlas_entry_vector_deinit (&atlas->entries);
+    glyph_atlas_index_vector_deinit (&atlas->free_entries);
+    glyph_atlas_rect_vector_deinit (&atlas->dirty_rects);
+
+    memset (atlas, 0, sizeof (GlyphAtlas));
+
+    return atlas;
+}
+
+/**
+ * @b Start a new frame. Glyphs used before this call can be evicted again.
+ *
+ * @param atlas
+ *
+ * @return @c atlas on success.
+ * @return @c Null otherwise.
+ * */
+GlyphAtlas *glyph_atlas_begin_frame (GlyphAtlas *atlas) {
+    RETURN_VALUE_IF (!atlas, Null, ERR_INVALID_ARGUMENTS);
+
+    atlas->frame++;
+
+    return atlas;
+}
+
+/**
+ * @b Mark given pages used in current frame, so they're not evicted before
+ * next call to @c glyph_atlas_begin_frame.
+ *
+ * Glyphs of text drawn in earlier frames, and still drawn without being looked
+ * up again, are kept in atlas by keeping their pages after each new frame.
+ *
+ * @param atlas
+ * @param pages Pages to keep.
+ *
+ * @return @c atlas on success.
+ * @return @c Null otherwise.
+ * */
+GlyphAtlas *glyph_atlas_keep_pages (GlyphAtlas *atlas, GlyphAtlasPageMask pages) {
+    RETURN_VALUE_IF (!atlas, Null, ERR_INVALID_ARGUMENTS);
+
+    for (Uint32 p = 0; p < atlas->page_count; p++) {
+        if (pages & ((GlyphAtlasPageMask)1 << p)) {
+            atlas->pages[p].last_used = atlas->frame;
+        }
+    }
+
+    return atlas;
+}
+
+/**
+ * @b Find glyph with given key in atlas, and mark it used in current frame.
+ *
+ * @param atlas
+ * @param key
+ *
+ * @return Glyph entry if it's cached. Valid until next call to @c glyph_atlas_insert.
+ * @return @c Null otherwise.
+ * */
+GlyphAtlasEntry *glyph_atlas_find (GlyphAtlas *atlas, GlyphKey *key) {
+    RETURN_VALUE_IF (!atlas || !key, Null, ERR_INVALID_ARGUMENTS);
+
+    Uint32 *slot = glyph_atlas_find_slot (atlas, key);
+    if (!*slot) {
+        return Null;
+    }
+
+    GlyphAtlasEntry *entry = glyph_atlas_entry_vector_data (&atlas->entries) + (*slot - 1);
+    entry->last_used       = atlas->frame;
+    if (entry->page != GLYPH_ATLAS_PAGE_NONE) {
+        atlas->pages[entry->page].last_used = atlas->frame;
+    }
+
+    return entry;
+}
+
+/**
+ * @b Pack glyph bitmap into atlas and cache it with given key.
+ *
+ * If there's no space left, least recently used pages are evicted, unless
+ * they're used in current frame. Glyphs with zero width or height (eg: space)
+ * take no space in atlas, but are still cached for their metrics.
+ *
+ * Caller is expected to fill metrics of returned entry. If key is already
+ * cached, then existing entry is returned as it is.
+ *
+ * @param atlas
+ * @param key
+ * @param width Width of bitmap in pixels.
+ * @param height Height of bitmap in pixels.
+ * @param bitmap Pointer to top row of 8 bit coverage values.
+ * @param pitch Bytes from one row to next, negative if rows are stored bottom up.
+ *
+ * @return Glyph entry on success. Valid until next call to @c glyph_atlas_insert.
+ * @return @c Null otherwise.
+ * */
+GlyphAtlasEntry *glyph_atlas_insert (
+    GlyphAtlas *atlas,
+    GlyphKey   *key,
+    Uint32      width,
+    Uint32      height,
+    Uint8      *bitmap,
+    Int32       pitch
+) {
+    RETURN_VALUE_IF (!atlas || !key || (width && height && !bitmap), Null, ERR_INVALID_ARGUMENTS);
+
+    GlyphAtlasEntry *entry = glyph_atlas_find (atlas, key);
+    if (entry) {
+        return entry;
+    }
+
+    Bool   is_blank = !width || !height;
+    Uint32 padded_w = width + 2 * GLYPH_ATLAS_PADDING;
+    Uint32 padded_h = height + 2 * GLYPH_ATLAS_PADDING;
+    RETURN_VALUE_IF (
+        !is_blank && (padded_w > atlas->width || padded_h > atlas->page_height),
+        Null,
+        "Glyph of size %ux%u does not fit in an atlas page\n",
+        width,
+        height
+    );
+
+    /* keep load factor of hash table at most half */
+    if (2 * (atlas->glyph_count + 1) > atlas->slot_count) {
+        RETURN_VALUE_IF (
+            !glyph_atlas_grow_slots (atlas),
+            Null,
+            "Failed to grow glyph hash table\n"
+        );
+    }
+
+    /* get an entry before taking space in atlas, so that failure leaves atlas untouched */
+    Uint32 index;
+    if (atlas->free_entries.count) {
+        index = glyph_atlas_index_vector_data (&atlas->free_entries)[--atlas->free_entries.count];
+    } else {
+        RETURN_VALUE_IF (
+            !glyph_atlas_entry_vector_push (&atlas->entries, Null),
+            Null,
+            "Failed to resize vector to store more glyphs\n"
+        );
+        index = atlas->entries.count - 1;
+    }
+
+    /* find space in atlas, evicting pages until glyph fits */
+    GlyphAtlasRect padded = {0};
+    Uint32         page   = GLYPH_ATLAS_PAGE_NONE;
+    if (!is_blank) {
+        while (!glyph_atlas_pack (atlas, padded_w, padded_h, &padded)) {
+            if (!glyph_atlas_evict_lru_page (atlas)) {
+                glyph_atlas_index_vector_push (&atlas->free_entries, &index);
+                PRINT_ERR ("Glyph atlas is too small for glyphs used in a single frame\n");
+                return Null;
+            }
+        }
+
+        page = padded.y / atlas->page_height;
+
+        /* whole padded rect is written, so stale pixels of evicted glyphs never bleed in */
+        for (Uint32 r = 0; r < padded_h; r++) {
+            Uint8 *row = atlas->pixels + (Size)(padded.y + r) * atlas->width + padded.x;
+            memset (row, 0, padded_w);
+
+            if (r >= GLYPH_ATLAS_PADDING && r < GLYPH_ATLAS_PADDING + height) {
+                Uint8 *src = bitmap + (Int64)(r - GLYPH_ATLAS_PADDING) * pitch;
+                memcpy (row + GLYPH_ATLAS_PADDING, src, width);
+            }
+        }
+
+        /* dirty rects can't fail to record changes, they're merged when out of memory */
+        glyph_atlas_add_dirty_rect (atlas, padded);
+
+        atlas->pages[page].glyph_count++;
+        atlas->pages[page].last_used = atlas->frame;
+    }
+
+    entry  = glyph_atlas_entry_vector_data (&atlas->entries) + index;
+    *entry = (GlyphAtlasEntry) {
+        .key       = *key,
+        .rect      = {.x      = is_blank ? 0 : padded.x + GLYPH_ATLAS_PADDING,
+                      .y      = is_blank ? 0 : padded.y + GLYPH_ATLAS_PADDING,
+                      .width  = is_blank ? 0 : width,
+                      .height = is_blank ? 0 : height},
+        .page      = page,
+        .last_used = atlas->frame,
+        .is_used   = True
+    };
+
+    /* eviction might have moved slots around, so look for an empty slot only now */
+    *glyph_atlas_find_slot (atlas, key) = index + 1;
+    atlas->glyph_count++;
+
+    return entry;
+}
+
+/**
+ * @b Forget all dirty rectangles, after they've been uploaded.
+ *
+ * @param atlas
+ *
+ * @return @c atlas on success.
+ * @return @c Null otherwise.
+ * */
+GlyphAtlas *glyph_atlas_clear_dirty_rects (GlyphAtlas *atlas) {
+    RETURN_VALUE_IF (!atlas, Null, ERR_INVALID_ARGUMENTS);
+
+    glyph_atlas_rect_vector_clear (&atlas->dirty_rects);
+
+    return atlas;
+}
+
+/**
+ * @b Write glyph atlas to a file, to be loaded back with @c glyph_atlas_load.
+ *
+ * Pixels, packing state and metrics of all cached glyphs are written, so a
+ * loaded atlas can keep packing glyphs where this one left off.
+ *
+ * @param atlas
+ * @param path Path of file to write to.
+ *
+ * @return @c atlas on success.
+ * @return @c Null otherwise.
+ * */
+GlyphAtlas *glyph_atlas_save (GlyphAtlas *atlas, CString path) {
+    RETURN_VALUE_IF (!atlas || !atlas->pixels || !path, Null, ERR_INVALID_ARGUMENTS);
+
+    FILE *file = fopen (path, "wb");
+    RETURN_VALUE_IF (!file, Null, ERR_FILE_OPEN_FAILED);
+
+    GlyphAtlasFileHeader header = {
+        .magic       = GLYPH_ATLAS_FILE_MAGIC,
+        .version     = GLYPH_ATLAS_FILE_VERSION,
+        .width       = atlas->width,
+        .height      = atlas->height,
+        .page_count  = atlas->page_count,
+        .glyph_count = atlas->glyph_count
+    };
+
+    Bool is_written = fwrite (&header, sizeof (header), 1, file) == 1;
+
+    for (Uint32 p = 0; p < atlas->page_count && is_written; p++) {
+        GlyphAtlasSkyline     *skyline    = &atlas->pages[p].skyline;
+        GlyphAtlasSkylineNode *nodes      = glyph_atlas_skyline_node_vector_data (skyline);
+        Uint32                 node_count = skyline->count;
+
+        is_written = fwrite (&node_count, sizeof (node_count), 1, file) == 1 &&
+                     fwrite (nodes, sizeof (GlyphAtlasSkylineNode), node_count, file) == node_count;
+    }
+
+    for (Size e = 0; e < atlas->entries.count && is_written; e++) {
+        GlyphAtlasEntry *entry = glyph_atlas_entry_vector_data (&atlas->entries) + e;
+        if (!entry->is_used) {
+            continue;
+        }
+
+        GlyphAtlasFileGlyph glyph = {
+            .key       = entry->key,
+            .rect      = entry->rect,
+            .bearing_x = entry->bearing_x,
+            .bearing_y = entry->bearing_y,
+            .advance   = entry->advance,
+            .page      = entry->page
+        };
+        is_written = fwrite (&glyph, sizeof (glyph), 1, file) == 1;
+    }
+
+    Size pixel_count = (Size)atlas->width * atlas->height;
+    is_written = is_written && fwrite (atlas->pixels, 1, pixel_count, file) == pixel_count;
+
+    is_written = !fclose (file) && is_written;
+    RETURN_VALUE_IF (!is_written, Null, "Failed to write glyph atlas to \"%s\"\n", path);
+
+    return atlas;
+}
+
+/**
+ * @b Replace contents of glyph atlas with those saved to a file by @c glyph_atlas_save.
+ *
+ * File must have been saved from an atlas of same size and page count. Loaded
+ * glyphs count as least recently used, and whole atlas is marked dirty. Any
+ * entry previously returned by atlas becomes invalid. On failure atlas is left
+ * untouched.
+ *
+ * @param atlas
+ * @param path Path of file to read from.
+ *
+ * @return @c atlas on success.
+ * @return @c Null otherwise.
+ * */
+GlyphAtlas *glyph_atlas_load (GlyphAtlas *atlas, CString path) {
+    RETURN_VALUE_IF (!atlas || !atlas->pixels || !path, Null, ERR_INVALID_ARGUMENTS);
+
+    FILE *file = fopen (path, "rb");
+    RETURN_VALUE_IF (!file, Null, ERR_FILE_OPEN_FAILED);
+
+    /* build into a separate atlas, so that a bad file leaves this one as it is */
+    GlyphAtlas loaded = {0};
+    GOTO_HANDLER_IF (
+        !glyph_atlas_init (&loaded, atlas->width, atlas->height, atlas->page_count),
+        INIT_FAILED,
+        "Failed to create glyph atlas to load file into\n"
+    );
+
+    GOTO_HANDLER_IF (
+        !glyph_atlas_read_file (&loaded, file),
+        READ_FAILED,
+        "Failed to load glyph atlas from \"%s\"\n",
+        path
+    );
+
+    fclose (file);
+
+    loaded.frame     = atlas->frame;
+    loaded.evictions = atlas->evictions;
+
+    glyph_atlas_deinit (atlas);
+    *atlas = loaded;
+
+    return atlas;
+
+READ_FAILED:
+    glyph_atlas_deinit (&loaded);
+INIT_FAILED:
+    fclose (file);
+    return Null;
+}
+
+/**************************************************************************************************/
+/*********************************** PRIVATE METHOD DEFINITIONS ***********************************/
+/**************************************************************************************************/
+
+static inline Uint32 glyph_key_hash (GlyphKey *key) {
+    Uint64 h  = ((Uint64)key->font << 32 | key->glyph) * 0x9e3779b97f4a7c15ull;
+    h        ^= (h >> 29) + key->size * 0xbf58476d1ce4e5b9ull;
+    h        *= 0x94d049bb133111ebull;
+    return (Uint32)(h ^ (h >> 32));
+}
+
+static inline Bool glyph_key_equal (GlyphKey *a, GlyphKey *b) {
+    return a->font == b->font && a->glyph == b->glyph && a->size == b->size;
+}
+
+/**
+ * @b Find slot of hash table holding given key, using linear probing.
+ *
+ * @return Slot holding entry with given key, if there's one.
+ * @return Empty slot where key should be inserted otherwise.
+ * */
+static Uint32 *glyph_atlas_find_slot (GlyphAtlas *atlas, GlyphKey *key) {
+    GlyphAtlasEntry *entries = glyph_atlas_entry_vector_data (&atlas->entries);
+    Uint32           mask    = atlas->slot_count - 1;
+
+    for (Uint32 s = glyph_key_hash (key) & mask;; s = (s + 1) & mask) {
+        Uint32 *slot = atlas->slots + s;
+        if (!*slot || glyph_key_equal (&entries[*slot - 1].key, key)) {
+            return slot;
+        }
+    }
+}
+
+/**
+ * @b Double capacity of hash table, and reinsert all glyphs.
+ * */
+static GlyphAtlas *glyph_atlas_grow_slots (GlyphAtlas *atlas) {
+    Uint32  old_count = atlas->slot_count;
+    Uint32 *old_slots = atlas->slots;
+
+    Uint32  new_count = old_count ? 2 * old_count : 64;
+    Uint32 *new_slots = ALLOCATE (Uint32, new_count);
+    RETURN_VALUE_IF (!new_slots, Null, ERR_OUT_OF_MEMORY);
+
+    atlas->slots      = new_slots;
+    atlas->slot_count = new_count;
+
+    GlyphAtlasEntry *entries = glyph_atlas_entry_vector_data (&atlas->entries);
+    for (Uint32 s = 0; s < old_count; s++) {
+        if (old_slots[s]) {
+            *glyph_atlas_find_slot (atlas, &entries[old_slots[s] - 1].key) = old_slots[s];
+        }
+    }
+
+    if (old_slots) {
+        FREE (old_slots);
+    }
+
+    return atlas;
+}
+
+/**
+ * @b Empty given slot, moving back entries of same probe sequence that follow
+ * it, so that lookups never stop early at a hole.
+ * */
+static void glyph_atlas_remove_slot (GlyphAtlas *atlas, Uint32 *slot) {
+    GlyphAtlasEntry *entries = glyph_atlas_entry_vector_data (&atlas->entries);
+    Uint32           mask    = atlas->slot_count - 1;
+    Uint32           hole    = slot - atlas->slots;
+
+    atlas->slots[hole] = 0;
+    for (Uint32 s = (hole + 1) & mask; atlas->slots[s]; s = (s + 1) & mask) {
+        Uint32 home = glyph_key_hash (&entries[atlas->slots[s] - 1].key) & mask;
+
+        /* entry stays if it's home is cyclically within (hole, s] */
+        Bool stays = hole <= s ? (home > hole && home <= s) : (home > hole || home <= s);
+        if (!stays) {
+            atlas->slots[hole] = atlas->slots[s];
+            atlas->slots[s]    = 0;
+            hole               = s;
+        }
+    }
+}
+
+/**
+ * @b Find space for a rectangle of given size in some page, and take it.
+ *
+ * In each page, rectangle is placed on skyline where it's top edge ends up
+ * lowest (bottom-left rule), and first page where it fits is used.
+ *
+ * @param atlas
+ * @param w Width of rectangle.
+ * @param h Height of rectangle.
+ * @param rect Where position of rectangle in atlas is stored.
+ *
+ * @return @c True if rectangle was placed.
+ * @return @c False if it does not fit in any page.
+ * */
+static Bool glyph_atlas_pack (GlyphAtlas *atlas, Uint32 w, Uint32 h, GlyphAtlasRect *rect) {
+    for (Uint32 p = 0; p < atlas->page_count; p++) {
+        GlyphAtlasSkyline     *skyline = &atlas->pages[p].skyline;
+        GlyphAtlasSkylineNode *nodes   = glyph_atlas_skyline_node_vector_data (skyline);
+
+        Size   best_node  = (Size)-1;
+        Uint32 best_y     = 0;
+        Uint32 best_top   = UINT32_MAX;
+        Uint32 best_width = UINT32_MAX;
+        for (Size n = 0; n < skyline->count; n++) {
+            Int32 y = skyline_fit (skyline, n, w, h, atlas->page_height);
+            if (y < 0) {
+                continue;
+            }
+
+            /* prefer lowest top edge, then narrowest node to leave wide gaps for wide glyphs */
+            Uint32 top = y + h;
+            if (top < best_top || (top == best_top && nodes[n].width < best_width)) {
+                best_node  = n;
+                best_y     = y;
+                best_top   = top;
+                best_width = nodes[n].width;
+            }
+        }
+
+        if (best_node == (Size)-1) {
+            continue;
+        }
+
+        Uint32 x = nodes[best_node].x;
+        if (!skyline_add (skyline, best_node, w, best_top)) {
+            return False;
+        }
+
+        *rect = (GlyphAtlasRect) {
+            .x      = x,
+            .y      = p * atlas->page_height + best_y,
+            .width  = w,
+            .height = h
+        };
+
+        return True;
+    }
+
+    return False;
+}
+
+/**
+ * @b Evict all glyphs of least recently used page not used in current frame.
+ *
+ * @return @c True if a page was evicted.
+ * @return @c False if all pages are in use.
+ * */
+static Bool glyph_atlas_evict_lru_page (GlyphAtlas *atlas) {
+    Uint32 lru = GLYPH_ATLAS_PAGE_NONE;
+    for (Uint32 p = 0; p < atlas->page_count; p++) {
+        GlyphAtlasPage *page = atlas->pages + p;
+        if (!page->glyph_count || page->last_used >= atlas->frame) {
+            continue;
+        }
+
+        if (lru == GLYPH_ATLAS_PAGE_NONE || page->last_used < atlas->pages[lru].last_used) {
+            lru = p;
+        }
+    }
+
+    if (lru == GLYPH_ATLAS_PAGE_NONE) {
+        return False;
+    }
+
+    GlyphAtlasEntry *entries = glyph_atlas_entry_vector_data (&atlas->entries);
+    for (Uint32 e = 0; e < atlas->entries.count; e++) {
+        if (!entries[e].is_used || entries[e].page != lru) {
+            continue;
+        }
+
+        glyph_atlas_remove_slot (atlas, glyph_atlas_find_slot (atlas, &entries[e].key));
+        entries[e].is_used = False;
+        atlas->glyph_count--;
+
+        /* free list never needs more space than entries vector, so reserve failure is benign */
+        if (!glyph_atlas_index_vector_push (&atlas->free_entries, &e)) {
+            PRINT_ERR ("Failed to record free glyph entry, entry is leaked until deinit\n");
+        }
+    }
+
+    GlyphAtlasPage        *page = atlas->pages + lru;
+    GlyphAtlasSkylineNode *root = glyph_atlas_skyline_node_vector_data (&page->skyline);
+
+    *root               = (GlyphAtlasSkylineNode) {.x = 0, .y = 0, .width = atlas->width};
+    page->skyline.count = 1;
+    page->glyph_count   = 0;
+    page->last_used     = 0;
+
+    atlas->evictions++;
+
+    return True;
+}
+
+/**
+ * @b Record a changed rectangle of pixels, merging all rectangles into their
+ * bounding box when too many are pending or memory runs out.
+ * */
+static GlyphAtlas *glyph_atlas_add_dirty_rect (GlyphAtlas *atlas, GlyphAtlasRect rect) {
+    GlyphAtlasRectVector *rects = &atlas->dirty_rects;
+
+    if (rects->count < GLYPH_ATLAS_DIRTY_RECT_MAX && glyph_atlas_rect_vector_push (rects, &rect)) {
+        return atlas;
+    }
+
+    /* without any pending rect, there's no storage to merge into either */
+    RETURN_VALUE_IF (!rects->count, Null, "Failed to record dirty rectangle of glyph atlas\n");
+
+    Uint32 x0 = rect.x, y0 = rect.y, x1 = rect.x + rect.width, y1 = rect.y + rect.height;
+    for (Size r = 0; r < rects->count; r++) {
+        GlyphAtlasRect *d = glyph_atlas_rect_vector_data (rects) + r;
+        x0 = MIN (x0, d->x);
+        y0 = MIN (y0, d->y);
+        x1 = MAX (x1, (Uint32)d->x + d->width);
+        y1 = MAX (y1, (Uint32)d->y + d->height);
+    }
+
+    GlyphAtlasRect *bounds = glyph_atlas_rect_vector_data (rects);
+    *bounds       = (GlyphAtlasRect) {.x = x0, .y = y0, .width = x1 - x0, .height = y1 - y0};
+    rects->count  = 1;
+
+    return atlas;
+}
+
+/**
+ * @b Find height at which a rectangle placed at left edge of given node rests on skyline.
+ *
+ * @return Y coordinate of bottom edge of rectangle, if it fits in page.
+ * @return -1 otherwise.
+ * */
+static Int32 skyline_fit (GlyphAtlasSkyline *skyline, Size node, Uint32 w, Uint32 h, Uint32 max_h) {
+    GlyphAtlasSkylineNode *nodes = glyph_atlas_skyline_node_vector_data (skyline);
+
+    /* skyline always spans whole width, so running out of nodes means running out of width */
+    Uint32 y         = 0;
+    Uint32 remaining = w;
+    for (Size n = node; remaining; n++) {
+        if (n >= skyline->count) {
+            return -1;
+        }
+
+        y = MAX (y, nodes[n].y);
+        if (y + h > max_h) {
+            return -1;
+        }
+
+        remaining -= MIN (remaining, nodes[n].width);
+    }
+
+    return y;
+}
+
+/**
+ * @b Raise skyline to @p top over @p w pixels starting at left edge of given node.
+ * */
+static Bool skyline_add (GlyphAtlasSkyline *skyline, Size node, Uint32 w, Uint32 top) {
+    Uint16 x = glyph_atlas_skyline_node_vector_data (skyline)[node].x;
+
+    /* insert new node before given node */
+    RETURN_VALUE_IF (
+        !glyph_atlas_skyline_node_vector_push (skyline, Null),
+        False,
+        "Failed to resize skyline of glyph atlas page\n"
+    );
+
+    GlyphAtlasSkylineNode *nodes = glyph_atlas_skyline_node_vector_data (skyline);
+    memmove (nodes + node + 1, nodes + node, (skyline->count - node - 1) * sizeof (nodes[0]));
+    nodes[node] = (GlyphAtlasSkylineNode) {.x = x, .y = top, .width = w};
+
+    /* shrink or remove nodes now covered by new node */
+    Uint32 right = x + w;
+    Size   next  = node + 1;
+    while (next < skyline->count && nodes[next].x < right) {
+        Uint32 covered = right - nodes[next].x;
+        if (covered < nodes[next].width) {
+            nodes[next].x     += covered;
+            nodes[next].width -= covered;
+            break;
+        }
+
+        memmove (nodes + next, nodes + next + 1, (skyline->count - next - 1) * sizeof (nodes[0]));
+        skyline->count--;
+    }
+
+    /* merge neighbours at same height */
+    for (Size n = 0; n + 1 < skyline->count;) {
+        if (nodes[n].y == nodes[n + 1].y) {
+            nodes[n].width += nodes[n + 1].width;
+            memmove (nodes + n + 1, nodes + n + 2, (skyline->count - n - 2) * sizeof (nodes[0]));
+            skyline->count--;
+        } else {
+            n++;
+        }
+    }
+
+    return True;
+}
+
+/**
+ * @b Read contents of a glyph atlas file into a freshly initialized atlas of
+ * same size, validating everything that's read.
+ * */
+static Bool glyph_atlas_read_file (GlyphAtlas *atlas, FILE *file) {
+    GlyphAtlasFileHeader header = {0};
+    RETURN_VALUE_IF (fread (&header, sizeof (header), 1, file) != 1, False, ERR_FILE_READ_FAILED);
+    RETURN_VALUE_IF (
+        header.magic != GLYPH_ATLAS_FILE_MAGIC || header.version != GLYPH_ATLAS_FILE_VERSION,
+        False,
+        ERR_UNSUPPORTED_FILE_FORMAT
+    );
+    RETURN_VALUE_IF (
+        header.width != atlas->width || header.height != atlas->height ||
+            header.page_count != atlas->page_count,
+        False,
+        "Glyph atlas file is of a different size\n"
+    );
+
+    for (Uint32 p = 0; p < atlas->page_count; p++) {
+        GlyphAtlasSkyline *skyline    = &atlas->pages[p].skyline;
+        Uint32             node_count = 0;
+
+        RETURN_VALUE_IF (
+            fread (&node_count, sizeof (node_count), 1, file) != 1,
+            False,
+            ERR_FILE_READ_FAILED
+        );
+        RETURN_VALUE_IF (
+            !node_count || node_count > atlas->width,
+            False,
+            ERR_UNSUPPORTED_FILE_FORMAT
+        );
+        RETURN_VALUE_IF (
+            !glyph_atlas_skyline_node_vector_resize (skyline, node_count, False),
+            False,
+            ERR_OUT_OF_MEMORY
+        );
+        GlyphAtlasSkylineNode *nodes = glyph_atlas_skyline_node_vector_data (skyline);
+        RETURN_VALUE_IF (
+            fread (nodes, sizeof (GlyphAtlasSkylineNode), node_count, file) != node_count,
+            False,
+            ERR_FILE_READ_FAILED
+        );
+
+        /* nodes must cover page from left to right, without going below it */
+        Uint32 x = 0;
+        for (Uint32 n = 0; n < node_count; n++) {
+            GlyphAtlasSkylineNode *node = nodes + n;
+            RETURN_VALUE_IF (
+                node->x != x || !node->width || node->y > atlas->page_height,
+                False,
+                ERR_UNSUPPORTED_FILE_FORMAT
+            );
+            x += node->width;
+        }
+        RETURN_VALUE_IF (x != atlas->width, False, ERR_UNSUPPORTED_FILE_FORMAT);
+    }
+
+    for (Uint32 g = 0; g < header.glyph_count; g++) {
+        GlyphAtlasFileGlyph glyph = {0};
+        RETURN_VALUE_IF (fread (&glyph, sizeof (glyph), 1, file) != 1, False, ERR_FILE_READ_FAILED);
+        RETURN_VALUE_IF (
+            !glyph_atlas_rect_is_valid (atlas, &glyph),
+            False,
+            ERR_UNSUPPORTED_FILE_FORMAT
+        );
+
+        if (2 * (atlas->glyph_count + 1) > atlas->slot_count) {
+            RETURN_VALUE_IF (!glyph_atlas_grow_slots (atlas), False, ERR_OUT_OF_MEMORY);
+        }
+
+        Uint32 *slot = glyph_atlas_find_slot (atlas, &glyph.key);
+        RETURN_VALUE_IF (*slot, False, "Glyph atlas file contains a glyph twice\n");
+
+        GlyphAtlasEntry entry = {
+            .key       = glyph.key,
+            .rect      = glyph.rect,
+            .bearing_x = glyph.bearing_x,
+            .bearing_y = glyph.bearing_y,
+            .advance   = glyph.advance,
+            .page      = glyph.page,
+            .last_used = 0,
+            .is_used   = True
+        };
+        RETURN_VALUE_IF (
+            !glyph_atlas_entry_vector_push (&atlas->entries, &entry),
+            False,
+            ERR_OUT_OF_MEMORY
+        );
+
+        *slot = atlas->entries.count;
+        atlas->glyph_count++;
+
+        if (glyph.page != GLYPH_ATLAS_PAGE_NONE) {
+            atlas->pages[glyph.page].glyph_count++;
+        }
+    }
+
+    Size pixel_count = (Size)atlas->width * atlas->height;
+    RETURN_VALUE_IF (
+        fread (atlas->pixels, 1, pixel_count, file) != pixel_count,
+        False,
+        ERR_FILE_READ_FAILED
+    );
+
+    return True;
+}
+
+/**
+ * @b Check that rect of a glyph read from file lies in it's page, padding included.
+ * */
+static Bool glyph_atlas_rect_is_valid (GlyphAtlas *atlas, GlyphAtlasFileGlyph *glyph) {
+    GlyphAtlasRect *rect = &glyph->rect;
+
+    if (glyph->page == GLYPH_ATLAS_PAGE_NONE) {
+        return !rect->x && !rect->y && !rect->width && !rect->height;
+    }
+
+    Uint32 page_top    = glyph->page * atlas->page_height;
+    Uint32 page_bottom = page_top + atlas->page_height;
+
+    return glyph->page < atlas->page_count && rect->width && rect->height &&
+           rect->x >= GLYPH_ATLAS_PADDING &&
+           (Uint32)rect->x + rect->width + GLYPH_ATLAS_PADDING <= atlas->width &&
+           rect->y >= page_top + GLYPH_ATLAS_PADDING &&
+           (Uint32)rect->y + rect->height + GLYPH_ATLAS_PADDING <= page_bottom;
+}
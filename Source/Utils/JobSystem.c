@@ -0,0 +1,568 @@
+/**
+ * @file JobSystem.c
+ * @date Sun, 18th October 2026
+ * @author Siddharth Mishra (admin@brightprogrammer.in)
+ * @copyright Copyright 2024 Siddharth Mishra
+ * @copyright Copyright 2024 Anvie Labs
+ *
+ * Copyright 2024 Siddharth Mishra, Anvie Labs
+ * 
+ * Redistribution and use in source and binary forms, with or without modification, are permitted 
+ * provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+ *    and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions
+ *    and the following disclaimer in the documentation and/or other materials provided with the
+ *    distribution.
+ * 
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse
+ *    or promote products derived from this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND 
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * */
+
+#include <Anvie/Common.h>
+#include <Anvie/CrossGui/Utils/JobSystem.h>
+
+/* libc */
+#include <memory.h>
+#include <sched.h>
+#include <unistd.h>
+
+/* failed attempts to find a job, before an idle worker goes to sleep */
+#define JOB_SYSTEM_SPIN_COUNT 64
+
+/**
+ * @b Job as seen by threads running it, copied out of a deque slot.
+ * */
+typedef struct Job {
+    JobFn       fn;
+    void       *data;
+    JobCounter *counter;
+} Job;
+
+/* worker of calling thread, set only on threads started by a job system */
+static _Thread_local JobWorker *this_thread_worker = Null;
+
+/**************************************************************************************************/
+/********************************** PRIVATE METHOD DECLARATIONS ***********************************/
+/**************************************************************************************************/
+
+static void      *job_system_thread_main (void *arg);
+static JobWorker *job_system_get_worker (JobSystem *jobs);
+static Bool       job_system_find_job (JobSystem *jobs, JobWorker *worker, Job *job);
+static void       job_system_run_job (JobSystem *jobs, Job *job);
+static void       job_system_complete (JobSystem *jobs, JobCounter *counter);
+static void       job_system_sleep (JobSystem *jobs);
+static void       job_system_help (JobSystem *jobs, JobWorker *worker, JobCounter *counter);
+static void       job_system_block (JobSystem *jobs, JobCounter *counter);
+static Bool       job_system_inject (JobSystem *jobs, Job *job);
+static Bool       job_system_take_injected (JobSystem *jobs, Job *job);
+static Bool       job_deque_push (JobDeque *deque, Job *job);
+static Bool       job_deque_pop (JobDeque *deque, Job *job);
+static Bool       job_deque_steal (JobDeque *deque, Job *job);
+static void       job_slot_read (JobSlot *slot, Job *job);
+
+/**************************************************************************************************/
+/*********************************** PUBLIC METHOD DEFINITIONS ************************************/
+/**************************************************************************************************/
+
+/**
+ * @b Create a job system and start it's threads. Calling thread becomes
+ * owner of job system, and only it can destroy it.
+ *
+ * @param jobs
+ * @param thread_count Number of threads to start. Zero to use number of
+ *        online CPUs, less one if calling thread participates.
+ * @param is_main_participating Run jobs on calling thread too, when it waits.
+ *
+ * @return @c jobs on success.
+ * @return @c Null otherwise.
+ * */
+JobSystem *job_system_init (JobSystem *jobs, Uint32 thread_count, Bool is_main_participating) {
+    RETURN_VALUE_IF (!jobs || thread_count >= JOB_SYSTEM_THREAD_MAX, Null, ERR_INVALID_ARGUMENTS);
+
+    memset (jobs, 0, sizeof (JobSystem));
+
+    if (!thread_count) {
+        long cpu_count = sysconf (_SC_NPROCESSORS_ONLN) - !!is_main_participating;
+        thread_count   = cpu_count > 1 ? (Uint32)MIN (cpu_count, JOB_SYSTEM_THREAD_MAX - 1) : 1;
+    }
+
+    jobs->owner                 = pthread_self();
+    jobs->is_main_participating = is_main_participating;
+
+    pthread_mutex_init (&jobs->mutex, Null);
+    pthread_cond_init (&jobs->job_available, Null);
+    pthread_cond_init (&jobs->jobs_done, Null);
+    pthread_mutex_init (&jobs->inject_mutex, Null);
+
+    jobs->injected_jobs = ALLOCATE (JobSlot, JOB_SYSTEM_INJECT_CAPACITY);
+    GOTO_HANDLER_IF (!jobs->injected_jobs, INIT_FAILED, ERR_OUT_OF_MEMORY);
+
+    jobs->workers = ALLOCATE (JobWorker, thread_count + 1);
+    GOTO_HANDLER_IF (!jobs->workers, INIT_FAILED, ERR_OUT_OF_MEMORY);
+
+    /* all deques must exist before first thread starts stealing */
+    for (Uint32 w = 0; w <= thread_count; w++) {
+        JobWorker *worker = jobs->workers + w;
+        worker->system    = jobs;
+        worker->index     = w;
+        worker->random    = 0x9e3779b97f4a7c15ull * (w + 1);
+
+        worker->deque.jobs = ALLOCATE (JobSlot, JOB_SYSTEM_DEQUE_CAPACITY);
+        GOTO_HANDLER_IF (!worker->deque.jobs, INIT_FAILED, ERR_OUT_OF_MEMORY);
+        jobs->worker_count++;
+    }
+
+    for (Uint32 t = 1; t <= thread_count; t++) {
+        JobWorker *worker = jobs->workers + t;
+        GOTO_HANDLER_IF (
+            pthread_create (&worker->thread, Null, job_system_thread_main, worker),
+            INIT_FAILED,
+            "Failed to create job system thread\n"
+        );
+        jobs->thread_count++;
+    }
+
+    return jobs;
+
+INIT_FAILED:
+    job_system_deinit (jobs);
+    return Null;
+}
+
+/**
+ * @b Stop all threads of job system, after they finish jobs already submitted.
+ * Must be called from thread that created job system.
+ *
+ * @param jobs
+ *
+ * @return @c jobs on success.
+ * @return @c Null otherwise.
+ * */
+JobSystem *job_system_deinit (JobSystem *jobs) {
+    RETURN_VALUE_IF (!jobs, Null, ERR_INVALID_ARGUMENTS);
+    RETURN_VALUE_IF (
+        !pthread_equal (pthread_self(), jobs->owner),
+        Null,
+        "Job system can only be destroyed by thread that created it\n"
+    );
+
+    /* jobs left over are run here, in case there's no thread to run them */
+    if (jobs->workers) {
+        job_system_help (jobs, jobs->workers, &jobs->pending);
+    }
+
+    pthread_mutex_lock (&jobs->mutex);
+    atomic_store (&jobs->is_stopping, True);
+    pthread_cond_broadcast (&jobs->job_available);
+    pthread_mutex_unlock (&jobs->mutex);
+
+    for (Uint32 t = 1; t <= jobs->thread_count; t++) {
+        pthread_join (jobs->workers[t].thread, Null);
+    }
+
+    if (jobs->workers) {
+        for (Uint32 w = 0; w < jobs->worker_count; w++) {
+            FREE (jobs->workers[w].deque.jobs);
+        }
+        FREE (jobs->workers);
+    }
+
+    if (jobs->injected_jobs) {
+        FREE (jobs->injected_jobs);
+    }
+
+    pthread_mutex_destroy (&jobs->inject_mutex);
+    pthread_cond_destroy (&jobs->jobs_done);
+    pthread_cond_destroy (&jobs->job_available);
+    pthread_mutex_destroy (&jobs->mutex);
+
+    memset (jobs, 0, sizeof (JobSystem));
+
+    return jobs;
+}
+
+/**
+ * @b Queue a job to be run on any thread of job system.
+ *
+ * Job goes to deque of calling thread, or to injection queue if calling
+ * thread is not part of job system. If that is full, job is run right away
+ * instead, so submitting never fails for lack of space.
+ *
+ * @param jobs
+ * @param fn Job to run.
+ * @param data Passed to @p fn as it is.
+ * @param counter Counter to wait on for this job, can be @c Null.
+ *
+ * @return @c jobs on success.
+ * @return @c Null otherwise.
+ * */
+JobSystem *job_system_submit (JobSystem *jobs, JobFn fn, void *data, JobCounter *counter) {
+    RETURN_VALUE_IF (!jobs || !fn, Null, ERR_INVALID_ARGUMENTS);
+
+    Job job = {.fn = fn, .data = data, .counter = counter};
+
+    if (counter) {
+        atomic_fetch_add_explicit (&counter->value, 1, memory_order_relaxed);
+    }
+    atomic_fetch_add_explicit (&jobs->pending.value, 1, memory_order_relaxed);
+
+    /* counted before push, so a worker going to sleep either sees it or is woken up */
+    atomic_fetch_add (&jobs->queued, 1);
+
+    JobWorker *worker   = job_system_get_worker (jobs);
+    Bool       is_queued = worker ? job_deque_push (&worker->deque, &job) :
+                                   job_system_inject (jobs, &job);
+    if (!is_queued) {
+        atomic_fetch_sub (&jobs->queued, 1);
+        job_system_run_job (jobs, &job);
+        return jobs;
+    }
+
+    if (atomic_load (&jobs->sleeping)) {
+        pthread_mutex_lock (&jobs->mutex);
+        pthread_cond_signal (&jobs->job_available);
+        pthread_mutex_unlock (&jobs->mutex);
+    }
+
+    return jobs;
+}
+
+/**
+ * @b Wait for all jobs submitted with a counter to complete.
+ *
+ * Inside a job, and on thread that created job system if it participates,
+ * other jobs are run while waiting. Other threads block until jobs complete.
+ *
+ * @param jobs
+ * @param counter Counter to wait on. @c Null to wait for all jobs submitted
+ *        so far, only from thread that created job system.
+ *
+ * @return @c jobs on success.
+ * @return @c Null otherwise.
+ * */
+JobSystem *job_system_wait (JobSystem *jobs, JobCounter *counter) {
+    RETURN_VALUE_IF (!jobs, Null, ERR_INVALID_ARGUMENTS);
+
+    JobWorker *worker = job_system_get_worker (jobs);
+
+    /* a job is itself pending, so it can never see all jobs complete */
+    RETURN_VALUE_IF (
+        !counter && (!worker || worker->index),
+        Null,
+        "Only thread that created job system can wait without a counter\n"
+    );
+
+    if (!counter) {
+        counter = &jobs->pending;
+    }
+
+    if (worker && (worker->index || jobs->is_main_participating)) {
+        job_system_help (jobs, worker, counter);
+    } else {
+        job_system_block (jobs, counter);
+    }
+
+    return jobs;
+}
+
+/**************************************************************************************************/
+/*********************************** PRIVATE METHOD DEFINITIONS ***********************************/
+/**************************************************************************************************/
+
+static void *job_system_thread_main (void *arg) {
+    JobWorker *worker  = arg;
+    JobSystem *jobs    = worker->system;
+    Uint32     misses  = 0;
+    this_thread_worker = worker;
+
+    while (!atomic_load_explicit (&jobs->is_stopping, memory_order_relaxed)) {
+        Job job;
+        if (job_system_find_job (jobs, worker, &job)) {
+            job_system_run_job (jobs, &job);
+            misses = 0;
+        } else if (++misses < JOB_SYSTEM_SPIN_COUNT) {
+            sched_yield();
+        } else {
+            job_system_sleep (jobs);
+            misses = 0;
+        }
+    }
+
+    return Null;
+}
+
+/**
+ * @b Get worker of calling thread.
+ *
+ * @return Worker on success.
+ * @return @c Null if calling thread is not part of job system.
+ * */
+static JobWorker *job_system_get_worker (JobSystem *jobs) {
+    if (this_thread_worker && this_thread_worker->system == jobs) {
+        return this_thread_worker;
+    }
+
+    if (jobs->workers && pthread_equal (pthread_self(), jobs->owner)) {
+        return jobs->workers;
+    }
+
+    return Null;
+}
+
+/**
+ * @b Take a job from deque of given worker, or from injection queue, or steal
+ * one from another worker, starting at a random one so thieves spread out
+ * over victims.
+ *
+ * @return @c True if a job was found.
+ * @return @c False otherwise.
+ * */
+static Bool job_system_find_job (JobSystem *jobs, JobWorker *worker, Job *job) {
+    Bool is_found = job_deque_pop (&worker->deque, job) || job_system_take_injected (jobs, job);
+
+    if (!is_found) {
+        /* xorshift64 */
+        worker->random ^= worker->random << 13;
+        worker->random ^= worker->random >> 7;
+        worker->random ^= worker->random << 17;
+
+        Uint32 start = worker->random % jobs->worker_count;
+        for (Uint32 v = 0; v < jobs->worker_count && !is_found; v++) {
+            Uint32 victim = (start + v) % jobs->worker_count;
+            if (victim != worker->index) {
+                is_found = job_deque_steal (&jobs->workers[victim].deque, job);
+            }
+        }
+    }
+
+    if (is_found) {
+        atomic_fetch_sub (&jobs->queued, 1);
+    }
+
+    return is_found;
+}
+
+static void job_system_run_job (JobSystem *jobs, Job *job) {
+    job->fn (job->data);
+
+    /* counter may go out of scope as soon as it reaches zero, so it's released first */
+    if (job->counter) {
+        job_system_complete (jobs, job->counter);
+    }
+    job_system_complete (jobs, &jobs->pending);
+}
+
+/**
+ * @b Count a job of given counter as complete, and wake up threads blocked
+ * on a counter, because this one might be it.
+ * */
+static void job_system_complete (JobSystem *jobs, JobCounter *counter) {
+    if (atomic_fetch_sub (&counter->value, 1) == 1 && atomic_load (&jobs->blocked)) {
+        pthread_mutex_lock (&jobs->mutex);
+        pthread_cond_broadcast (&jobs->jobs_done);
+        pthread_mutex_unlock (&jobs->mutex);
+    }
+}
+
+/**
+ * @b Put an idle worker to sleep, until a job is submitted or job system stops.
+ * */
+static void job_system_sleep (JobSystem *jobs) {
+    pthread_mutex_lock (&jobs->mutex);
+
+    /* announced before checking for jobs, so a submit either is seen or wakes us up */
+    atomic_fetch_add (&jobs->sleeping, 1);
+    while (!atomic_load (&jobs->queued) && !atomic_load (&jobs->is_stopping)) {
+        pthread_cond_wait (&jobs->job_available, &jobs->mutex);
+    }
+    atomic_fetch_sub (&jobs->sleeping, 1);
+
+    pthread_mutex_unlock (&jobs->mutex);
+}
+
+/**
+ * @b Run jobs until given counter reaches zero.
+ * */
+static void job_system_help (JobSystem *jobs, JobWorker *worker, JobCounter *counter) {
+    while (atomic_load_explicit (&counter->value, memory_order_acquire)) {
+        Job job;
+        if (job_system_find_job (jobs, worker, &job)) {
+            job_system_run_job (jobs, &job);
+        } else {
+            sched_yield();
+        }
+    }
+}
+
+/**
+ * @b Block calling thread until given counter reaches zero, without running any job.
+ * */
+static void job_system_block (JobSystem *jobs, JobCounter *counter) {
+    pthread_mutex_lock (&jobs->mutex);
+
+    /* announced before checking counter, so completion either is seen or wakes us up */
+    atomic_fetch_add (&jobs->blocked, 1);
+    while (atomic_load (&counter->value)) {
+        pthread_cond_wait (&jobs->jobs_done, &jobs->mutex);
+    }
+    atomic_fetch_sub (&jobs->blocked, 1);
+
+    pthread_mutex_unlock (&jobs->mutex);
+}
+
+/**
+ * @b Add a job submitted from outside of job system to injection queue.
+ *
+ * @return @c True on success.
+ * @return @c False if injection queue is full.
+ * */
+static Bool job_system_inject (JobSystem *jobs, Job *job) {
+    pthread_mutex_lock (&jobs->inject_mutex);
+
+    Bool is_full = jobs->inject_tail - jobs->inject_head >= JOB_SYSTEM_INJECT_CAPACITY;
+    if (!is_full) {
+        Size     index = jobs->inject_tail++ & (JOB_SYSTEM_INJECT_CAPACITY - 1);
+        JobSlot *slot  = jobs->injected_jobs + index;
+        atomic_store_explicit (&slot->fn, job->fn, memory_order_relaxed);
+        atomic_store_explicit (&slot->data, job->data, memory_order_relaxed);
+        atomic_store_explicit (&slot->counter, job->counter, memory_order_relaxed);
+        atomic_fetch_add (&jobs->injected, 1);
+    }
+
+    pthread_mutex_unlock (&jobs->inject_mutex);
+
+    return !is_full;
+}
+
+/**
+ * @b Take oldest job out of injection queue. Lock is taken only if queue
+ * looks non-empty, so workers can poll it on every miss.
+ *
+ * @return @c True on success.
+ * @return @c False if injection queue is empty.
+ * */
+static Bool job_system_take_injected (JobSystem *jobs, Job *job) {
+    if (!atomic_load_explicit (&jobs->injected, memory_order_relaxed)) {
+        return False;
+    }
+
+    pthread_mutex_lock (&jobs->inject_mutex);
+
+    Bool is_found = jobs->inject_head != jobs->inject_tail;
+    if (is_found) {
+        job_slot_read (
+            jobs->injected_jobs + (jobs->inject_head++ & (JOB_SYSTEM_INJECT_CAPACITY - 1)),
+            job
+        );
+        atomic_fetch_sub (&jobs->injected, 1);
+    }
+
+    pthread_mutex_unlock (&jobs->inject_mutex);
+
+    return is_found;
+}
+
+/**
+ * @b Push a job at bottom of deque, only by owner of deque.
+ *
+ * @return @c True on success.
+ * @return @c False if deque is full.
+ * */
+static Bool job_deque_push (JobDeque *deque, Job *job) {
+    Int64 bottom = atomic_load_explicit (&deque->bottom, memory_order_relaxed);
+    Int64 top    = atomic_load_explicit (&deque->top, memory_order_acquire);
+
+    if (bottom - top >= JOB_SYSTEM_DEQUE_CAPACITY) {
+        return False;
+    }
+
+    JobSlot *slot = deque->jobs + (bottom & (JOB_SYSTEM_DEQUE_CAPACITY - 1));
+    atomic_store_explicit (&slot->fn, job->fn, memory_order_relaxed);
+    atomic_store_explicit (&slot->data, job->data, memory_order_relaxed);
+    atomic_store_explicit (&slot->counter, job->counter, memory_order_relaxed);
+
+    /* publishes slot, and everything job's data points to */
+    atomic_store_explicit (&deque->bottom, bottom + 1, memory_order_release);
+
+    return True;
+}
+
+/**
+ * @b Pop most recently pushed job at bottom of deque, only by owner of deque.
+ * Races with thieves only for last job left.
+ *
+ * @return @c True on success.
+ * @return @c False if deque is empty.
+ * */
+static Bool job_deque_pop (JobDeque *deque, Job *job) {
+    Int64 bottom = atomic_load_explicit (&deque->bottom, memory_order_relaxed) - 1;
+    atomic_store_explicit (&deque->bottom, bottom, memory_order_release);
+    atomic_thread_fence (memory_order_seq_cst);
+    Int64 top = atomic_load_explicit (&deque->top, memory_order_relaxed);
+
+    if (top > bottom) {
+        atomic_store_explicit (&deque->bottom, bottom + 1, memory_order_release);
+        return False;
+    }
+
+    job_slot_read (deque->jobs + (bottom & (JOB_SYSTEM_DEQUE_CAPACITY - 1)), job);
+
+    if (top == bottom) {
+        Bool is_won = atomic_compare_exchange_strong_explicit (
+            &deque->top,
+            &top,
+            top + 1,
+            memory_order_seq_cst,
+            memory_order_relaxed
+        );
+        atomic_store_explicit (&deque->bottom, bottom + 1, memory_order_release);
+        return is_won;
+    }
+
+    return True;
+}
+
+/**
+ * @b Steal oldest job at top of deque, by any thread other than owner.
+ *
+ * @return @c True on success.
+ * @return @c False if deque is empty, or another thread took the job first.
+ * */
+static Bool job_deque_steal (JobDeque *deque, Job *job) {
+    Int64 top = atomic_load_explicit (&deque->top, memory_order_acquire);
+    atomic_thread_fence (memory_order_seq_cst);
+    Int64 bottom = atomic_load_explicit (&deque->bottom, memory_order_acquire);
+
+    if (top >= bottom) {
+        return False;
+    }
+
+    /* slot may be overwritten right after this, which only a failed exchange can tell */
+    job_slot_read (deque->jobs + (top & (JOB_SYSTEM_DEQUE_CAPACITY - 1)), job);
+
+    return atomic_compare_exchange_strong_explicit (
+        &deque->top,
+        &top,
+        top + 1,
+        memory_order_seq_cst,
+        memory_order_relaxed
+    );
+}
+
+static void job_slot_read (JobSlot *slot, Job *job) {
+    job->fn      = atomic_load_explicit (&slot->fn, memory_order_relaxed);
+    job->data    = atomic_load_explicit (&slot->data, memory_order_relaxed);
+    job->counter = atomic_load_explicit (&slot->counter, memory_order_relaxed);
+}
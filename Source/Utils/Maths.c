@@ -690,7 +690,7 @@ Mat4f *mat4f_invert (Mat4f *res, Mat4f *mat) {
                                 vec3f_cross (&T0, &B32, &COL (mat, 0)->xyz),
                                 vec3f_mul_f32 (&T1, &C23, COL (mat, 0)->w)
                             ),
-                     ._ignore_w = -vec3f_dot (&COL (mat, 0)->xyz, &C23)
+                     ._ignore_w = vec3f_dot (&COL (mat, 0)->xyz, &C23)
                 },
                 {
                     .xyz = *vec3f_add (
@@ -701,12 +701,12 @@ Mat4f *mat4f_invert (Mat4f *res, Mat4f *mat) {
                      ._ignore_w = -vec3f_dot (&COL (mat, 3)->xyz, &C01)
                 },
                 {
-                    .xyz = *vec3f_add (
+                    .xyz = *vec3f_sub (
                                 &T0,
                                 vec3f_cross (&T0, &B10, &COL (mat, 2)->xyz),
-                                vec3f_mul_f32 (&T1, &C23, COL (mat, 2)->w)
+                                vec3f_mul_f32 (&T1, &C01, COL (mat, 2)->w)
                             ),
-                     ._ignore_w = -vec3f_dot (&COL (mat, 2)->xyz, &C01)
+                     ._ignore_w = vec3f_dot (&COL (mat, 2)->xyz, &C01)
                 },
             }
         }
@@ -771,12 +771,13 @@ Float32 mat4f_det (Mat4f *mat) {
         {COL (mat, 1)->xyz, COL (mat, 2)->xyz, COL (mat, 3)->xyz}
     };
 
+    /* cofactor expansion along first column, signs alternate as (-1)^(i+j) */
     return vec4f_dot (
         COL (mat, 0),
         &(Vec4f
         ) {.x = mat3f_det (&M11),
-           .y = mat3f_det (&M21),
+           .y = -mat3f_det (&M21),
            .z = mat3f_det (&M31),
-           .w = mat3f_det (&M41)}
+           .w = -mat3f_det (&M41)}
     );
 }
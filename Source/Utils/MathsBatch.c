@@ -0,0 +1,586 @@
+/**
+ * @file MathsBatch.c
+ * @date Sun, 18th October 2026
+ * @author Siddharth Mishra (admin@brightprogrammer.in)
+ * @copyright Copyright 2024 Siddharth Mishra
+ * @copyright Copyright 2024 Anvie Labs
+ *
+ * Copyright 2024 Siddharth Mishra, Anvie Labs
+ * 
+ * Redistribution and use in source and binary forms, with or without modification, are permitted 
+ * provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+ *    and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions
+ *    and the following disclaimer in the documentation and/or other materials provided with the
+ *    distribution.
+ * 
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse
+ *    or promote products derived from this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND 
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * */
+
+#include <Anvie/Common.h>
+#include <Anvie/CrossGui/Utils/Maths.h>
+
+/* libc */
+#include <math.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#    define MATHS_HAVE_X86 1
+#    include <immintrin.h>
+#elif defined(__aarch64__)
+#    define MATHS_HAVE_NEON 1
+#    include <arm_neon.h>
+#endif
+
+/**
+ * @b Set of batch kernels implemented for one instruction set.
+ * */
+typedef struct MathsKernels {
+    void (*vec2f_transform) (Vec2f *res, Mat3f *mat, Vec2f *vecs, Size count);
+    void (*vec4f_transform) (Vec4f *res, Mat4f *mat, Vec4f *vecs, Size count);
+    Aabb2f (*aabb2f_union) (Aabb2f *boxes, Size count);
+    void (*aabb2f_intersect) (Aabb2f *res, Aabb2f *boxes, Aabb2f *clip, Size count);
+} MathsKernels;
+
+/**************************************************************************************************/
+/********************************** PRIVATE METHOD DECLARATIONS ***********************************/
+/**************************************************************************************************/
+
+static void   vec2f_transform_scalar (Vec2f *res, Mat3f *mat, Vec2f *vecs, Size count);
+static void   vec4f_transform_scalar (Vec4f *res, Mat4f *mat, Vec4f *vecs, Size count);
+static Aabb2f aabb2f_union_scalar (Aabb2f *boxes, Size count);
+static void   aabb2f_intersect_scalar (Aabb2f *res, Aabb2f *boxes, Aabb2f *clip, Size count);
+
+#if MATHS_HAVE_X86
+static void   vec2f_transform_sse2 (Vec2f *res, Mat3f *mat, Vec2f *vecs, Size count);
+static void   vec4f_transform_sse2 (Vec4f *res, Mat4f *mat, Vec4f *vecs, Size count);
+static Aabb2f aabb2f_union_sse2 (Aabb2f *boxes, Size count);
+static void   aabb2f_intersect_sse2 (Aabb2f *res, Aabb2f *boxes, Aabb2f *clip, Size count);
+
+static void   vec2f_transform_avx2 (Vec2f *res, Mat3f *mat, Vec2f *vecs, Size count);
+static void   vec4f_transform_avx2 (Vec4f *res, Mat4f *mat, Vec4f *vecs, Size count);
+static Aabb2f aabb2f_union_avx2 (Aabb2f *boxes, Size count);
+static void   aabb2f_intersect_avx2 (Aabb2f *res, Aabb2f *boxes, Aabb2f *clip, Size count);
+#endif
+
+#if MATHS_HAVE_NEON
+static void   vec2f_transform_neon (Vec2f *res, Mat3f *mat, Vec2f *vecs, Size count);
+static void   vec4f_transform_neon (Vec4f *res, Mat4f *mat, Vec4f *vecs, Size count);
+static Aabb2f aabb2f_union_neon (Aabb2f *boxes, Size count);
+static void   aabb2f_intersect_neon (Aabb2f *res, Aabb2f *boxes, Aabb2f *clip, Size count);
+#endif
+
+static Bool isa_is_supported (MathsIsa isa);
+
+/* clang-format off */
+static const MathsKernels kernels[MATHS_ISA_MAX] = {
+    [MATHS_ISA_SCALAR] = {
+        .vec2f_transform  = vec2f_transform_scalar,
+        .vec4f_transform  = vec4f_transform_scalar,
+        .aabb2f_union     = aabb2f_union_scalar,
+        .aabb2f_intersect = aabb2f_intersect_scalar
+    },
+#if MATHS_HAVE_X86
+    [MATHS_ISA_SSE2] = {
+        .vec2f_transform  = vec2f_transform_sse2,
+        .vec4f_transform  = vec4f_transform_sse2,
+        .aabb2f_union     = aabb2f_union_sse2,
+        .aabb2f_intersect = aabb2f_intersect_sse2
+    },
+    [MATHS_ISA_AVX2] = {
+        .vec2f_transform  = vec2f_transform_avx2,
+        .vec4f_transform  = vec4f_transform_avx2,
+        .aabb2f_union     = aabb2f_union_avx2,
+        .aabb2f_intersect = aabb2f_intersect_avx2
+    },
+#endif
+#if MATHS_HAVE_NEON
+    [MATHS_ISA_NEON] = {
+        .vec2f_transform  = vec2f_transform_neon,
+        .vec4f_transform  = vec4f_transform_neon,
+        .aabb2f_union     = aabb2f_union_neon,
+        .aabb2f_intersect = aabb2f_intersect_neon
+    },
+#endif
+};
+/* clang-format on */
+
+static MathsIsa            active_isa     = MATHS_ISA_SCALAR;
+static const MathsKernels *active_kernels = &kernels[MATHS_ISA_SCALAR];
+
+/**
+ * @b Select the best instruction set supported by host CPU when library is loaded.
+ * */
+CONSTRUCTOR static void select_best_isa() {
+#if MATHS_HAVE_X86
+    __builtin_cpu_init();
+#endif
+
+    for (MathsIsa isa = MATHS_ISA_MAX - 1; isa > MATHS_ISA_SCALAR; isa--) {
+        if (maths_set_isa (isa)) {
+            return;
+        }
+    }
+}
+
+/**************************************************************************************************/
+/*********************************** PUBLIC METHOD DEFINITIONS ************************************/
+/**************************************************************************************************/
+
+/**
+ * @b Transform given 2D points by affine part of given matrix.
+ *
+ * Each point is treated as @c (x,y,1), and last row of @c mat is ignored.
+ *
+ * @param res Array to store transformed points into.
+ * @param mat Transformation matrix.
+ * @param vecs Array of points to be transformed.
+ * @param count Number of points in @c vecs.
+ *
+ * @return @c res on success.
+ * @return @c Null otherwise.
+ * */
+Vec2f *vec2f_transform_batch (Vec2f *res, Mat3f *mat, Vec2f *vecs, Size count) {
+    RETURN_VALUE_IF (!res || !mat || !vecs, Null, ERR_INVALID_ARGUMENTS);
+
+    active_kernels->vec2f_transform (res, mat, vecs, count);
+    return res;
+}
+
+/**
+ * @b Multiply each of given vectors with given matrix.
+ *
+ * @param res Array to store transformed vectors into.
+ * @param mat Transformation matrix.
+ * @param vecs Array of vectors to be transformed.
+ * @param count Number of vectors in @c vecs.
+ *
+ * @return @c res on success.
+ * @return @c Null otherwise.
+ * */
+Vec4f *vec4f_transform_batch (Vec4f *res, Mat4f *mat, Vec4f *vecs, Size count) {
+    RETURN_VALUE_IF (!res || !mat || !vecs, Null, ERR_INVALID_ARGUMENTS);
+
+    active_kernels->vec4f_transform (res, mat, vecs, count);
+    return res;
+}
+
+/**
+ * @b Compute smallest box containing all given boxes.
+ *
+ * Union of zero boxes is an empty box (+inf min, -inf max), which is also the
+ * identity of union operation. Result is unspecified if any box has a NaN.
+ *
+ * @param res Where union will be stored.
+ * @param boxes Array of boxes.
+ * @param count Number of boxes in @c boxes.
+ *
+ * @return @c res on success.
+ * @return @c Null otherwise.
+ * */
+Aabb2f *aabb2f_union_batch (Aabb2f *res, Aabb2f *boxes, Size count) {
+    RETURN_VALUE_IF (!res || (!boxes && count), Null, ERR_INVALID_ARGUMENTS);
+
+    *res = active_kernels->aabb2f_union (boxes, count);
+    return res;
+}
+
+/**
+ * @b Clip each of given boxes against @c clip box.
+ *
+ * Boxes not overlapping @c clip become empty (min greater than max).
+ *
+ * @param res Array to store clipped boxes into.
+ * @param boxes Array of boxes to be clipped.
+ * @param clip Box to clip against.
+ * @param count Number of boxes in @c boxes.
+ *
+ * @return @c res on success.
+ * @return @c Null otherwise.
+ * */
+Aabb2f *aabb2f_intersect_batch (Aabb2f *res, Aabb2f *boxes, Aabb2f *clip, Size count) {
+    RETURN_VALUE_IF (!res || !boxes || !clip, Null, ERR_INVALID_ARGUMENTS);
+
+    active_kernels->aabb2f_intersect (res, boxes, clip, count);
+    return res;
+}
+
+/**
+ * @b Get instruction set currently used by batch kernels.
+ * */
+MathsIsa maths_get_isa() {
+    return active_isa;
+}
+
+/**
+ * @b Force batch kernels to use given instruction set.
+ *
+ * Best supported instruction set is already selected when library is loaded.
+ * This is meant for tests and benchmarks, and must not be called while another
+ * thread is running a batch kernel.
+ *
+ * @param isa
+ *
+ * @return @c True on success.
+ * @return @c False if @c isa is not supported by this build or host CPU.
+ * */
+Bool maths_set_isa (MathsIsa isa) {
+    RETURN_VALUE_IF (isa >= MATHS_ISA_MAX, False, ERR_INVALID_ARGUMENTS);
+
+    if (!kernels[isa].vec2f_transform || !isa_is_supported (isa)) {
+        return False;
+    }
+
+    active_isa     = isa;
+    active_kernels = &kernels[isa];
+
+    return True;
+}
+
+/**
+ * @b Get printable name of given instruction set.
+ * */
+CString maths_isa_name (MathsIsa isa) {
+    static CString names[MATHS_ISA_MAX] = {
+        [MATHS_ISA_SCALAR] = "scalar",
+        [MATHS_ISA_SSE2]   = "sse2",
+        [MATHS_ISA_AVX2]   = "avx2",
+        [MATHS_ISA_NEON]   = "neon",
+    };
+
+    return isa < MATHS_ISA_MAX ? names[isa] : "unknown";
+}
+
+/**************************************************************************************************/
+/*********************************** PRIVATE METHOD DEFINITIONS ***********************************/
+/**************************************************************************************************/
+
+static Bool isa_is_supported (MathsIsa isa) {
+    switch (isa) {
+        case MATHS_ISA_SCALAR :
+            return True;
+#if MATHS_HAVE_X86
+        case MATHS_ISA_SSE2 :
+            return !!__builtin_cpu_supports ("sse2");
+        case MATHS_ISA_AVX2 :
+            return !!__builtin_cpu_supports ("avx2");
+#endif
+#if MATHS_HAVE_NEON
+        case MATHS_ISA_NEON :
+            return True;
+#endif
+        default :
+            return False;
+    }
+}
+
+/* NOTE:
+ * All kernels evaluate in the same order as the scalar ones and never use FMA,
+ * so every instruction set produces bit-identical results. This file is built
+ * with -ffp-contract=off, so compiler does not fuse scalar kernels either. */
+
+/*********************************************************************************************/
+/*************************************** SCALAR *********************************************/
+/*********************************************************************************************/
+
+static void vec2f_transform_scalar (Vec2f *res, Mat3f *mat, Vec2f *vecs, Size count) {
+    Float32 m00 = mat->elem[0][0], m10 = mat->elem[0][1];
+    Float32 m01 = mat->elem[1][0], m11 = mat->elem[1][1];
+    Float32 m02 = mat->elem[2][0], m12 = mat->elem[2][1];
+
+    for (Size s = 0; s < count; s++) {
+        Float32 x = vecs[s].x, y = vecs[s].y;
+        res[s] = (Vec2f) {.x = m00 * x + m01 * y + m02, .y = m10 * x + m11 * y + m12};
+    }
+}
+
+static void vec4f_transform_scalar (Vec4f *res, Mat4f *mat, Vec4f *vecs, Size count) {
+    Mat4f m = *mat;
+
+    for (Size s = 0; s < count; s++) {
+        Vec4f v = vecs[s];
+        for (Size r = 0; r < 4; r++) {
+            res[s].data[r] = m.elem[0][r] * v.x + m.elem[1][r] * v.y + m.elem[2][r] * v.z +
+                             m.elem[3][r] * v.w;
+        }
+    }
+}
+
+static Aabb2f aabb2f_union_scalar (Aabb2f *boxes, Size count) {
+    Aabb2f acc = {
+        .min = {.x = INFINITY, .y = INFINITY},
+        .max = {.x = -INFINITY, .y = -INFINITY}
+    };
+
+    for (Size s = 0; s < count; s++) {
+        acc.min.x = MIN (acc.min.x, boxes[s].min.x);
+        acc.min.y = MIN (acc.min.y, boxes[s].min.y);
+        acc.max.x = MAX (acc.max.x, boxes[s].max.x);
+        acc.max.y = MAX (acc.max.y, boxes[s].max.y);
+    }
+
+    return acc;
+}
+
+static void aabb2f_intersect_scalar (Aabb2f *res, Aabb2f *boxes, Aabb2f *clip, Size count) {
+    Aabb2f c = *clip;
+
+    for (Size s = 0; s < count; s++) {
+        Aabb2f b = boxes[s];
+        res[s]   = (Aabb2f) {
+              .min = {.x = MAX (b.min.x, c.min.x), .y = MAX (b.min.y, c.min.y)},
+              .max = {.x = MIN (b.max.x, c.max.x), .y = MIN (b.max.y, c.max.y)}
+        };
+    }
+}
+
+#if MATHS_HAVE_X86
+
+/*********************************************************************************************/
+/**************************************** SSE2 **********************************************/
+/*********************************************************************************************/
+
+__attribute__ ((target ("sse2"))) static void
+    vec2f_transform_sse2 (Vec2f *res, Mat3f *mat, Vec2f *vecs, Size count) {
+    /* two points per register : (x0, y0, x1, y1) */
+    __m128 c0 = _mm_setr_ps (mat->elem[0][0], mat->elem[0][1], mat->elem[0][0], mat->elem[0][1]);
+    __m128 c1 = _mm_setr_ps (mat->elem[1][0], mat->elem[1][1], mat->elem[1][0], mat->elem[1][1]);
+    __m128 c2 = _mm_setr_ps (mat->elem[2][0], mat->elem[2][1], mat->elem[2][0], mat->elem[2][1]);
+
+    Size s = 0;
+    for (; s + 2 <= count; s += 2) {
+        __m128 v  = _mm_loadu_ps (vecs[s].data);
+        __m128 xs = _mm_shuffle_ps (v, v, _MM_SHUFFLE (2, 2, 0, 0));
+        __m128 ys = _mm_shuffle_ps (v, v, _MM_SHUFFLE (3, 3, 1, 1));
+        __m128 r  = _mm_add_ps (_mm_mul_ps (c0, xs), _mm_mul_ps (c1, ys));
+        _mm_storeu_ps (res[s].data, _mm_add_ps (r, c2));
+    }
+
+    vec2f_transform_scalar (res + s, mat, vecs + s, count - s);
+}
+
+__attribute__ ((target ("sse2"))) static void
+    vec4f_transform_sse2 (Vec4f *res, Mat4f *mat, Vec4f *vecs, Size count) {
+    __m128 c0 = _mm_load_ps (mat->column[0].data);
+    __m128 c1 = _mm_load_ps (mat->column[1].data);
+    __m128 c2 = _mm_load_ps (mat->column[2].data);
+    __m128 c3 = _mm_load_ps (mat->column[3].data);
+
+    for (Size s = 0; s < count; s++) {
+        __m128 v = _mm_loadu_ps (vecs[s].data);
+        __m128 r = _mm_mul_ps (c0, _mm_shuffle_ps (v, v, _MM_SHUFFLE (0, 0, 0, 0)));
+        r        = _mm_add_ps (r, _mm_mul_ps (c1, _mm_shuffle_ps (v, v, _MM_SHUFFLE (1, 1, 1, 1))));
+        r        = _mm_add_ps (r, _mm_mul_ps (c2, _mm_shuffle_ps (v, v, _MM_SHUFFLE (2, 2, 2, 2))));
+        r        = _mm_add_ps (r, _mm_mul_ps (c3, _mm_shuffle_ps (v, v, _MM_SHUFFLE (3, 3, 3, 3))));
+        _mm_storeu_ps (res[s].data, r);
+    }
+}
+
+__attribute__ ((target ("sse2"))) static Aabb2f aabb2f_union_sse2 (Aabb2f *boxes, Size count) {
+    __m128 mn = _mm_set1_ps (INFINITY);
+    __m128 mx = _mm_set1_ps (-INFINITY);
+
+    for (Size s = 0; s < count; s++) {
+        __m128 b = _mm_loadu_ps (&boxes[s].min.x);
+        mn       = _mm_min_ps (mn, b);
+        mx       = _mm_max_ps (mx, b);
+    }
+
+    Aabb2f acc;
+    _mm_store_ps (&acc.min.x, _mm_shuffle_ps (mn, mx, _MM_SHUFFLE (3, 2, 1, 0)));
+    return acc;
+}
+
+__attribute__ ((target ("sse2"))) static void
+    aabb2f_intersect_sse2 (Aabb2f *res, Aabb2f *boxes, Aabb2f *clip, Size count) {
+    __m128 c = _mm_loadu_ps (&clip->min.x);
+
+    for (Size s = 0; s < count; s++) {
+        __m128 b = _mm_loadu_ps (&boxes[s].min.x);
+        /* (max, max, min, min) */
+        __m128 r = _mm_shuffle_ps (_mm_max_ps (b, c), _mm_min_ps (b, c), _MM_SHUFFLE (3, 2, 1, 0));
+        _mm_storeu_ps (&res[s].min.x, r);
+    }
+}
+
+/*********************************************************************************************/
+/**************************************** AVX2 **********************************************/
+/*********************************************************************************************/
+
+__attribute__ ((target ("avx2"))) static void
+    vec2f_transform_avx2 (Vec2f *res, Mat3f *mat, Vec2f *vecs, Size count) {
+    /* four points per register, two in each 128 bit lane */
+    __m256 c0 = _mm256_setr_ps (
+        mat->elem[0][0], mat->elem[0][1], mat->elem[0][0], mat->elem[0][1],
+        mat->elem[0][0], mat->elem[0][1], mat->elem[0][0], mat->elem[0][1]
+    );
+    __m256 c1 = _mm256_setr_ps (
+        mat->elem[1][0], mat->elem[1][1], mat->elem[1][0], mat->elem[1][1],
+        mat->elem[1][0], mat->elem[1][1], mat->elem[1][0], mat->elem[1][1]
+    );
+    __m256 c2 = _mm256_setr_ps (
+        mat->elem[2][0], mat->elem[2][1], mat->elem[2][0], mat->elem[2][1],
+        mat->elem[2][0], mat->elem[2][1], mat->elem[2][0], mat->elem[2][1]
+    );
+
+    Size s = 0;
+    for (; s + 4 <= count; s += 4) {
+        __m256 v  = _mm256_loadu_ps (vecs[s].data);
+        __m256 xs = _mm256_permute_ps (v, _MM_SHUFFLE (2, 2, 0, 0));
+        __m256 ys = _mm256_permute_ps (v, _MM_SHUFFLE (3, 3, 1, 1));
+        __m256 r  = _mm256_add_ps (_mm256_mul_ps (c0, xs), _mm256_mul_ps (c1, ys));
+        _mm256_storeu_ps (res[s].data, _mm256_add_ps (r, c2));
+    }
+
+    vec2f_transform_sse2 (res + s, mat, vecs + s, count - s);
+}
+
+__attribute__ ((target ("avx2"))) static void
+    vec4f_transform_avx2 (Vec4f *res, Mat4f *mat, Vec4f *vecs, Size count) {
+    /* two vectors per register, one in each 128 bit lane */
+    __m256 c0 = _mm256_broadcast_ps ((__m128 *)mat->column[0].data);
+    __m256 c1 = _mm256_broadcast_ps ((__m128 *)mat->column[1].data);
+    __m256 c2 = _mm256_broadcast_ps ((__m128 *)mat->column[2].data);
+    __m256 c3 = _mm256_broadcast_ps ((__m128 *)mat->column[3].data);
+
+    Size s = 0;
+    for (; s + 2 <= count; s += 2) {
+        __m256 v = _mm256_loadu_ps (vecs[s].data);
+        __m256 r = _mm256_mul_ps (c0, _mm256_permute_ps (v, _MM_SHUFFLE (0, 0, 0, 0)));
+        r = _mm256_add_ps (r, _mm256_mul_ps (c1, _mm256_permute_ps (v, _MM_SHUFFLE (1, 1, 1, 1))));
+        r = _mm256_add_ps (r, _mm256_mul_ps (c2, _mm256_permute_ps (v, _MM_SHUFFLE (2, 2, 2, 2))));
+        r = _mm256_add_ps (r, _mm256_mul_ps (c3, _mm256_permute_ps (v, _MM_SHUFFLE (3, 3, 3, 3))));
+        _mm256_storeu_ps (res[s].data, r);
+    }
+
+    vec4f_transform_sse2 (res + s, mat, vecs + s, count - s);
+}
+
+__attribute__ ((target ("avx2"))) static Aabb2f aabb2f_union_avx2 (Aabb2f *boxes, Size count) {
+    __m256 mn = _mm256_set1_ps (INFINITY);
+    __m256 mx = _mm256_set1_ps (-INFINITY);
+
+    Size s = 0;
+    for (; s + 2 <= count; s += 2) {
+        __m256 b = _mm256_loadu_ps (&boxes[s].min.x);
+        mn       = _mm256_min_ps (mn, b);
+        mx       = _mm256_max_ps (mx, b);
+    }
+
+    /* fold both lanes, and the remaining box if any */
+    __m128 mn4 = _mm_min_ps (_mm256_castps256_ps128 (mn), _mm256_extractf128_ps (mn, 1));
+    __m128 mx4 = _mm_max_ps (_mm256_castps256_ps128 (mx), _mm256_extractf128_ps (mx, 1));
+    if (s < count) {
+        __m128 b = _mm_loadu_ps (&boxes[s].min.x);
+        mn4      = _mm_min_ps (mn4, b);
+        mx4      = _mm_max_ps (mx4, b);
+    }
+
+    Aabb2f acc;
+    _mm_store_ps (&acc.min.x, _mm_shuffle_ps (mn4, mx4, _MM_SHUFFLE (3, 2, 1, 0)));
+    return acc;
+}
+
+__attribute__ ((target ("avx2"))) static void
+    aabb2f_intersect_avx2 (Aabb2f *res, Aabb2f *boxes, Aabb2f *clip, Size count) {
+    __m256 c = _mm256_broadcast_ps ((__m128 *)&clip->min.x);
+
+    Size s = 0;
+    for (; s + 2 <= count; s += 2) {
+        __m256 b = _mm256_loadu_ps (&boxes[s].min.x);
+        __m256 r = _mm256_shuffle_ps (
+            _mm256_max_ps (b, c),
+            _mm256_min_ps (b, c),
+            _MM_SHUFFLE (3, 2, 1, 0)
+        );
+        _mm256_storeu_ps (&res[s].min.x, r);
+    }
+
+    aabb2f_intersect_sse2 (res + s, boxes + s, clip, count - s);
+}
+
+#endif // MATHS_HAVE_X86
+
+#if MATHS_HAVE_NEON
+
+/*********************************************************************************************/
+/**************************************** NEON **********************************************/
+/*********************************************************************************************/
+
+static void vec2f_transform_neon (Vec2f *res, Mat3f *mat, Vec2f *vecs, Size count) {
+    float32x2_t c0 = vld1_f32 (mat->column[0].data);
+    float32x2_t c1 = vld1_f32 (mat->column[1].data);
+    float32x2_t c2 = vld1_f32 (mat->column[2].data);
+
+    /* two points per iteration, de-interleaved into xs and ys */
+    float32x4_t c0q = vcombine_f32 (c0, c0);
+    float32x4_t c1q = vcombine_f32 (c1, c1);
+    float32x4_t c2q = vcombine_f32 (c2, c2);
+
+    Size s = 0;
+    for (; s + 2 <= count; s += 2) {
+        float32x4_t v  = vld1q_f32 (vecs[s].data);
+        float32x4_t xs = vtrn1q_f32 (v, v);
+        float32x4_t ys = vtrn2q_f32 (v, v);
+        float32x4_t r  = vaddq_f32 (vmulq_f32 (c0q, xs), vmulq_f32 (c1q, ys));
+        vst1q_f32 (res[s].data, vaddq_f32 (r, c2q));
+    }
+
+    vec2f_transform_scalar (res + s, mat, vecs + s, count - s);
+}
+
+static void vec4f_transform_neon (Vec4f *res, Mat4f *mat, Vec4f *vecs, Size count) {
+    float32x4_t c0 = vld1q_f32 (mat->column[0].data);
+    float32x4_t c1 = vld1q_f32 (mat->column[1].data);
+    float32x4_t c2 = vld1q_f32 (mat->column[2].data);
+    float32x4_t c3 = vld1q_f32 (mat->column[3].data);
+
+    for (Size s = 0; s < count; s++) {
+        float32x4_t v = vld1q_f32 (vecs[s].data);
+        float32x4_t r = vmulq_laneq_f32 (c0, v, 0);
+        r             = vaddq_f32 (r, vmulq_laneq_f32 (c1, v, 1));
+        r             = vaddq_f32 (r, vmulq_laneq_f32 (c2, v, 2));
+        r             = vaddq_f32 (r, vmulq_laneq_f32 (c3, v, 3));
+        vst1q_f32 (res[s].data, r);
+    }
+}
+
+static Aabb2f aabb2f_union_neon (Aabb2f *boxes, Size count) {
+    float32x4_t mn = vdupq_n_f32 (INFINITY);
+    float32x4_t mx = vdupq_n_f32 (-INFINITY);
+
+    for (Size s = 0; s < count; s++) {
+        float32x4_t b = vld1q_f32 (&boxes[s].min.x);
+        mn            = vminq_f32 (mn, b);
+        mx            = vmaxq_f32 (mx, b);
+    }
+
+    Aabb2f acc;
+    vst1q_f32 (&acc.min.x, vcombine_f32 (vget_low_f32 (mn), vget_high_f32 (mx)));
+    return acc;
+}
+
+static void aabb2f_intersect_neon (Aabb2f *res, Aabb2f *boxes, Aabb2f *clip, Size count) {
+    float32x4_t c = vld1q_f32 (&clip->min.x);
+
+    for (Size s = 0; s < count; s++) {
+        float32x4_t b  = vld1q_f32 (&boxes[s].min.x);
+        float32x2_t lo = vget_low_f32 (vmaxq_f32 (b, c));
+        float32x2_t hi = vget_high_f32 (vminq_f32 (b, c));
+        vst1q_f32 (&res[s].min.x, vcombine_f32 (lo, hi));
+    }
+}
+
+#endif // MATHS_HAVE_NEON
@@ -0,0 +1,351 @@
+/**
+ * @file Plot.c
+ * @date Sun, 18th October 2026
+ * @author Siddharth Mishra (admin@brightprogrammer.in)
+ * @copyright Copyright 2024 Siddharth Mishra
+ * @copyright Copyright 2024 Anvie Labs
+ *
+ * Copyright 2024 Siddharth Mishra, Anvie Labs
+ * 
+ * Redistribution and use in source and binary forms, with or without modification, are permitted 
+ * provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+ *    and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions
+ *    and the following disclaimer in the documentation and/or other materials provided with the
+ *    distribution.
+ * 
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse
+ *    or promote products derived from this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND 
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * */
+
+#define ALLOCATOR_TAG ALLOCATOR_TAG_PLOT
+
+#include <Anvie/Common.h>
+#include <Anvie/CrossGui/Utils/Plot.h>
+
+/* libc */
+#include <math.h>
+#include <memory.h>
+
+NEW_VECTOR_TYPE (Float32, PlotSampleVector, plot_sample);
+NEW_VECTOR_TYPE (PlotExtremes, PlotExtremesVector, plot_extremes);
+
+/**************************************************************************************************/
+/********************************** PRIVATE METHOD DECLARATIONS ***********************************/
+/**************************************************************************************************/
+
+static inline PlotExtremes plot_extremes_merge (PlotExtremes a, PlotExtremes b);
+static Bool                plot_series_update_levels (PlotSeries *series, Size old_count);
+
+/**************************************************************************************************/
+/*********************************** PUBLIC METHOD DEFINITIONS ************************************/
+/**************************************************************************************************/
+
+/**
+ * @b Initialize an empty plot series.
+ *
+ * @param series
+ * @param x_origin X coordinate of first sample.
+ * @param x_step Distance between consecutive samples. Must be positive.
+ *
+ * @return @c series on success.
+ * @return @c Null otherwise.
+ * */
+PlotSeries *plot_series_init (PlotSeries *series, Float64 x_origin, Float64 x_step) {
+    RETURN_VALUE_IF (!series || !(x_step > 0), Null, ERR_INVALID_ARGUMENTS);
+
+    memset (series, 0, sizeof (PlotSeries));
+    series->x_origin = x_origin;
+    series->x_step   = x_step;
+
+    return series;
+}
+
+/**
+ * @b Free all memory owned by given plot series.
+ *
+ * @param series
+ *
+ * @return @c series on success.
+ * @return @c Null otherwise.
+ * */
+PlotSeries *plot_series_deinit (PlotSeries *series) {
+    RETURN_VALUE_IF (!series, Null, ERR_INVALID_ARGUMENTS);
+
+    plot_sample_vector_deinit (&series->samples);
+    for (Size s = 0; s < PLOT_LOD_LEVEL_MAX; s++) {
+        plot_extremes_vector_deinit (series->levels + s);
+    }
+
+    memset (series, 0, sizeof (PlotSeries));
+
+    return series;
+}
+
+/**
+ * @b Append samples to end of series, updating the level of detail pyramid.
+ *
+ * @param series
+ * @param samples Array of samples to be copied.
+ * @param count Number of samples.
+ *
+ * @return @c series on success.
+ * @return @c Null otherwise.
+ * */
+PlotSeries *plot_series_append (PlotSeries *series, Float32 *samples, Size count) {
+    RETURN_VALUE_IF (!series || (count && !samples), Null, ERR_INVALID_ARGUMENTS);
+
+    if (!count) {
+        return series;
+    }
+
+    Size old_count = series->samples.count;
+
+    RETURN_VALUE_IF (
+        !plot_sample_vector_append (&series->samples, samples, count),
+        Null,
+        "Failed to resize vector to store more samples\n"
+    );
+
+    if (!plot_series_update_levels (series, old_count)) {
+        /* drop new samples and rebuild pyramid, so it stays consistent with samples */
+        series->samples.count = old_count;
+        for (Size s = 0; s < series->level_count; s++) {
+            plot_extremes_vector_clear (series->levels + s);
+        }
+        series->level_count = 0;
+        plot_series_update_levels (series, 0);
+        PRINT_ERR ("Failed to update level of detail pyramid\n");
+        return Null;
+    }
+
+    return series;
+}
+
+/**
+ * @b Remove all samples from series, keeping allocated memory for reuse.
+ *
+ * @param series
+ *
+ * @return @c series on success.
+ * @return @c Null otherwise.
+ * */
+PlotSeries *plot_series_clear (PlotSeries *series) {
+    RETURN_VALUE_IF (!series, Null, ERR_INVALID_ARGUMENTS);
+
+    plot_sample_vector_clear (&series->samples);
+    for (Size s = 0; s < series->level_count; s++) {
+        plot_extremes_vector_clear (series->levels + s);
+    }
+    series->level_count = 0;
+
+    return series;
+}
+
+/**
+ * @b Compute points of polyline to draw given X range of series in given number of pixels.
+ *
+ * X coordinate of each point is in pixels from left edge of plot (@c x_begin
+ * maps to 0 and @c x_end to @p pixel_width), and Y coordinate is the sample
+ * value, to be mapped to screen by caller. Samples just outside the range are
+ * included too, so that the polyline reaches the edges of the plot.
+ *
+ * When there are more than two samples per pixel column, each column gets the
+ * extremes of it's samples, in the order they occur, taken from the level of
+ * the pyramid where a bucket is at most one column wide. So, cost of this is
+ * proportional to @p pixel_width, no matter how many samples are in the range.
+ *
+ * @param series
+ * @param x_begin X coordinate at left edge of plot.
+ * @param x_end X coordinate at right edge of plot. Must be greater than @p x_begin.
+ * @param pixel_width Width of plot in pixels.
+ * @param points Where points will be stored.
+ * @param max_points Capacity of @p points. Use @c PLOT_SERIES_DECIMATE_MAX_POINTS
+ *        to never run out of space.
+ *
+ * @return Number of points stored in @p points.
+ * */
+Size plot_series_decimate (
+    PlotSeries *series,
+    Float64     x_begin,
+    Float64     x_end,
+    Uint32      pixel_width,
+    Vec2f      *points,
+    Size        max_points
+) {
+    RETURN_VALUE_IF (
+        !series || !points || !pixel_width || !(x_end > x_begin),
+        0,
+        ERR_INVALID_ARGUMENTS
+    );
+
+    Size     sample_count = series->samples.count;
+    Float32 *samples      = plot_sample_vector_data (&series->samples);
+
+    /* visible range in sample index space */
+    Float64 index_begin = (x_begin - series->x_origin) / series->x_step;
+    Float64 index_end   = (x_end - series->x_origin) / series->x_step;
+    if (!sample_count || index_end < 0 || index_begin > (Float64)(sample_count - 1)) {
+        return 0;
+    }
+
+    Size first = index_begin > 0 ? (Size)floor (index_begin) : 0;
+    Size last  = (Size)fmin (ceil (index_end), (Float64)(sample_count - 1));
+
+    Float64 pixels_per_sample = pixel_width / (index_end - index_begin);
+    Size    point_count       = 0;
+
+    /* zoomed in enough to draw samples as they are */
+    if (last - first + 1 <= 2 * (Size)pixel_width) {
+        for (Size s = first; s <= last && point_count < max_points; s++) {
+            points[point_count++] = (Vec2f) {
+                .x = (Float32)((s - index_begin) * pixels_per_sample),
+                .y = samples[s]
+            };
+        }
+        return point_count;
+    }
+
+    /* largest bucket size (2^(level+1)) not larger than a pixel column */
+    Float64 samples_per_pixel = 1 / pixels_per_sample;
+    Int32   level             = (Int32)floor (log2 (samples_per_pixel)) - 1;
+    level                     = CLAMP (level, 0, (Int32)series->level_count - 1);
+
+    Size          bucket_size  = (Size)1 << (level + 1);
+    PlotExtremes *buckets      = plot_extremes_vector_data (series->levels + level);
+    Size          bucket_first = first / bucket_size;
+    Size          bucket_last  = last / bucket_size;
+
+    /* merge buckets starting in same pixel column, and emit extremes of each column */
+    PlotExtremes column_extremes = buckets[bucket_first];
+    Int64        column          = -1;
+    for (Size b = bucket_first; b <= bucket_last + 1; b++) {
+        Int64 bucket_column = -1;
+        if (b <= bucket_last) {
+            Float64 x     = (b * bucket_size - index_begin) * pixels_per_sample;
+            bucket_column = CLAMP ((Int64)floor (x), 0, (Int64)pixel_width - 1);
+        }
+
+        if (bucket_column == column) {
+            column_extremes = plot_extremes_merge (column_extremes, buckets[b]);
+            continue;
+        }
+
+        /* column complete, emit it's extremes at center of column */
+        if (column >= 0) {
+            Float32 x = column + 0.5f;
+
+            if (point_count < max_points) {
+                points[point_count++] = (Vec2f) {.x = x, .y = column_extremes.first};
+            }
+            if (column_extremes.second != column_extremes.first && point_count < max_points) {
+                points[point_count++] = (Vec2f) {.x = x, .y = column_extremes.second};
+            }
+        }
+
+        if (b <= bucket_last) {
+            column          = bucket_column;
+            column_extremes = buckets[b];
+        }
+    }
+
+    return point_count;
+}
+
+/**************************************************************************************************/
+/*********************************** PRIVATE METHOD DEFINITIONS ***********************************/
+/**************************************************************************************************/
+
+/**
+ * @b Extremes of two consecutive ranges, where @p a comes before @p b.
+ * */
+static inline PlotExtremes plot_extremes_merge (PlotExtremes a, PlotExtremes b) {
+    Float32 values[4] = {a.first, a.second, b.first, b.second};
+
+    /* indices of values give their order of occurrence */
+    Size min = 0, max = 0;
+    for (Size s = 1; s < ARRAY_SIZE (values); s++) {
+        if (values[s] < values[min]) {
+            min = s;
+        }
+        if (values[s] > values[max]) {
+            max = s;
+        }
+    }
+
+    return min <= max ? (PlotExtremes) {.first = values[min], .second = values[max]} :
+                        (PlotExtremes) {.first = values[max], .second = values[min]};
+}
+
+/**
+ * @b Recompute buckets of all levels affected by samples after @p old_count.
+ *
+ * Level @c k has one bucket per two entries of level below it (samples for level 0),
+ * and levels are added until a level has a single bucket. Only buckets with a
+ * changed entry below them are recomputed, which is the last (possibly partial)
+ * bucket and new buckets of each level.
+ *
+ * @param series
+ * @param old_count Number of samples that were already accounted in pyramid.
+ *
+ * @return @c True on success.
+ * @return @c False otherwise.
+ * */
+static Bool plot_series_update_levels (PlotSeries *series, Size old_count) {
+    Float32 *samples = plot_sample_vector_data (&series->samples);
+
+    Size below_count   = series->samples.count; /* entries in level below */
+    Size below_changed = old_count;             /* first changed entry in level below */
+
+    Uint32 level = 0;
+    for (; level < PLOT_LOD_LEVEL_MAX && below_count > 1; level++) {
+        PlotExtremesVector *vec     = series->levels + level;
+        Size                count   = (below_count + 1) / 2;
+        Size                changed = below_changed / 2;
+
+        RETURN_VALUE_IF (
+            !plot_extremes_vector_resize (vec, count, False),
+            False,
+            "Failed to resize level of detail pyramid\n"
+        );
+
+        PlotExtremes *buckets = plot_extremes_vector_data (vec);
+        PlotExtremes *below   = level ? plot_extremes_vector_data (vec - 1) : Null;
+
+        for (Size b = changed; b < count; b++) {
+            Size l = 2 * b, r = 2 * b + 1;
+
+            if (!below) {
+                buckets[b] = (PlotExtremes) {
+                    .first  = samples[l],
+                    .second = samples[r < below_count ? r : l]
+                };
+            } else {
+                buckets[b] = r < below_count ? plot_extremes_merge (below[l], below[r]) : below[l];
+            }
+        }
+
+        below_changed = changed;
+        below_count   = count;
+    }
+
+    /* levels above are empty after a series shrinks */
+    for (Uint32 s = level; s < series->level_count; s++) {
+        plot_extremes_vector_clear (series->levels + s);
+    }
+    series->level_count = level;
+
+    return True;
+}
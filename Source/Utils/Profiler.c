@@ -0,0 +1,354 @@
+/**
+ * @file Profiler.c
+ * @date Sun, 18th October 2026
+ * @author Siddharth Mishra (admin@brightprogrammer.in)
+ * @copyright Copyright 2024 Siddharth Mishra
+ * @copyright Copyright 2024 Anvie Labs
+ *
+ * Copyright 2024 Siddharth Mishra, Anvie Labs
+ * 
+ * Redistribution and use in source and binary forms, with or without modification, are permitted 
+ * provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+ *    and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions
+ *    and the following disclaimer in the documentation and/or other materials provided with the
+ *    distribution.
+ * 
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse
+ *    or promote products derived from this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND 
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * */
+
+#include <Anvie/Common.h>
+#include <Anvie/CrossGui/Utils/Profiler.h>
+
+/* libc */
+#include <memory.h>
+#include <stdatomic.h>
+#include <time.h>
+
+/**
+ * @b Number of events each thread can hold before oldest events get overwritten.
+ * Must be a power of two.
+ * */
+#define PROFILER_RING_CAPACITY (1 << 14)
+#define PROFILER_RING_MASK     (PROFILER_RING_CAPACITY - 1)
+
+typedef enum ProfilerEventType {
+    PROFILER_EVENT_TYPE_ZONE = 0, /**< @b Complete event with begin and end time. */
+    PROFILER_EVENT_TYPE_MARK,     /**< @b Instant event, end time is ignored. */
+} ProfilerEventType;
+
+typedef struct ProfilerEvent {
+    CString           name;
+    CString           category;
+    Uint64            begin_ns;
+    Uint64            end_ns;
+    ProfilerEventType type;
+} ProfilerEvent;
+
+/**
+ * @b Single-producer ring buffer owned by exactly one thread.
+ *
+ * Only the owning thread writes events and advances @c head. A dump reads
+ * @c head with acquire semantics and discards whatever might have been
+ * overwritten while it was reading, so recording never takes a lock.
+ * */
+typedef struct ProfilerThreadBuffer {
+    struct ProfilerThreadBuffer *next; /**< @b Next buffer in the global list. */
+    Uint32                       tid;  /**< @b Small sequential id, used as tid in traces. */
+    _Atomic (CString)            name; /**< @b Thread name shown in trace viewer. */
+    _Atomic (Uint64)             head; /**< @b Total number of events ever written. */
+    ProfilerEvent                events[PROFILER_RING_CAPACITY];
+} ProfilerThreadBuffer;
+
+/* list of all thread buffers ever created, buffers are never removed from here */
+static _Atomic (ProfilerThreadBuffer *) thread_buffers  = Null;
+static _Atomic (Uint32)                 thread_id_count = 0;
+
+/* buffer of calling thread, created lazily on first event */
+static _Thread_local ProfilerThreadBuffer *this_thread_buffer = Null;
+
+/**************************************************************************************************/
+/********************************** PRIVATE METHOD DECLARATIONS ***********************************/
+/**************************************************************************************************/
+
+static ProfilerThreadBuffer *get_thread_buffer();
+static void                  push_event (ProfilerEvent *event);
+static void                  write_json_string (FILE *file, CString str);
+static void                  free_thread_buffers();
+
+/**************************************************************************************************/
+/*********************************** PUBLIC METHOD DEFINITIONS ************************************/
+/**************************************************************************************************/
+
+/**
+ * @b Get current time from a monotonic clock.
+ *
+ * @return Time in nanoseconds.
+ * */
+Uint64 profiler_now_ns() {
+    struct timespec ts;
+    clock_gettime (CLOCK_MONOTONIC, &ts);
+    return (Uint64)ts.tv_sec * 1000000000ull + (Uint64)ts.tv_nsec;
+}
+
+/**
+ * @b Open a new profiling zone. Prefer using the @c PROFILE_ZONE macros
+ * over calling this directly.
+ *
+ * @param name Name of zone. Must have static storage duration.
+ * @param category Category of zone. Must have static storage duration.
+ *
+ * @return @c ProfilerZone that must be closed with @c profiler_zone_end.
+ * */
+ProfilerZone profiler_zone_begin (CString name, CString category) {
+    return (ProfilerZone) {.name = name, .category = category, .begin_ns = profiler_now_ns()};
+}
+
+/**
+ * @b Close given zone and record it into ring buffer of calling thread.
+ *
+ * @param zone
+ * */
+void profiler_zone_end (ProfilerZone *zone) {
+    if (!zone || !zone->name) {
+        return;
+    }
+
+    ProfilerEvent event = {
+        .name     = zone->name,
+        .category = zone->category ? zone->category : PROFILER_CATEGORY_CPU,
+        .begin_ns = zone->begin_ns,
+        .end_ns   = profiler_now_ns(),
+        .type     = PROFILER_EVENT_TYPE_ZONE
+    };
+
+    push_event (&event);
+}
+
+/**
+ * @b Record an instant event, used to mark frame boundaries in trace.
+ *
+ * @param name Name of mark. Must have static storage duration.
+ * */
+void profiler_frame_mark (CString name) {
+    if (!name) {
+        return;
+    }
+
+    Uint64        now   = profiler_now_ns();
+    ProfilerEvent event = {
+        .name     = name,
+        .category = "frame",
+        .begin_ns = now,
+        .end_ns   = now,
+        .type     = PROFILER_EVENT_TYPE_MARK
+    };
+
+    push_event (&event);
+}
+
+/**
+ * @b Set name of calling thread, as shown in the trace viewer.
+ *
+ * @param name Must have static storage duration.
+ * */
+void profiler_set_thread_name (CString name) {
+    ProfilerThreadBuffer *buffer = get_thread_buffer();
+    RETURN_IF (!buffer, "Failed to get profiler buffer for calling thread\n");
+
+    atomic_store_explicit (&buffer->name, name, memory_order_relaxed);
+}
+
+/**
+ * @b Dump recorded events of all threads in Chrome trace event format (JSON).
+ * The generated file can be loaded in chrome://tracing or https://ui.perfetto.dev
+ *
+ * Recording threads are never stopped, events that get overwritten while
+ * the dump is in progress are simply skipped.
+ *
+ * @param file_path Path of file to write trace to.
+ * @param window_ns Only events that ended in last @c window_ns nanoseconds
+ *        are dumped. Zero dumps everything still present in ring buffers.
+ *
+ * @return @c True on success.
+ * @return @c False otherwise.
+ * */
+Bool profiler_dump_chrome_trace (CString file_path, Uint64 window_ns) {
+    RETURN_VALUE_IF (!file_path, False, ERR_INVALID_ARGUMENTS);
+
+    FILE *file = fopen (file_path, "w");
+    RETURN_VALUE_IF (!file, False, ERR_FILE_OPEN_FAILED);
+
+    Uint64 now         = profiler_now_ns();
+    Uint64 window_from = (window_ns && window_ns < now) ? now - window_ns : 0;
+    Bool   first       = True;
+
+    fputs ("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[", file);
+
+    ProfilerThreadBuffer *buffer = atomic_load_explicit (&thread_buffers, memory_order_acquire);
+    for (; buffer; buffer = buffer->next) {
+        /* thread name metadata */
+        CString thread_name = atomic_load_explicit (&buffer->name, memory_order_relaxed);
+        if (thread_name) {
+            fprintf (
+                file,
+                "%s\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,"
+                "\"args\":{\"name\":",
+                first ? "" : ",",
+                buffer->tid
+            );
+            write_json_string (file, thread_name);
+            fputs ("}}", file);
+            first = False;
+        }
+
+        Uint64 head = atomic_load_explicit (&buffer->head, memory_order_acquire);
+        Uint64 tail = head > PROFILER_RING_CAPACITY ? head - PROFILER_RING_CAPACITY : 0;
+
+        for (Uint64 i = tail; i < head; i++) {
+            ProfilerEvent event = buffer->events[i & PROFILER_RING_MASK];
+
+            /* the owner thread might have lapped us while we were copying */
+            Uint64 cur_head = atomic_load_explicit (&buffer->head, memory_order_acquire);
+            if (cur_head - i > PROFILER_RING_CAPACITY - 1) {
+                continue;
+            }
+
+            if (event.end_ns < window_from) {
+                continue;
+            }
+
+            fprintf (file, "%s\n{\"name\":", first ? "" : ",");
+            write_json_string (file, event.name);
+            fputs (",\"cat\":", file);
+            write_json_string (file, event.category);
+
+            /* chrome trace timestamps are in microseconds */
+            if (event.type == PROFILER_EVENT_TYPE_MARK) {
+                fprintf (
+                    file,
+                    ",\"ph\":\"i\",\"s\":\"p\",\"ts\":%.3f,\"pid\":1,\"tid\":%u}",
+                    event.begin_ns / 1e3,
+                    buffer->tid
+                );
+            } else {
+                fprintf (
+                    file,
+                    ",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":%u}",
+                    event.begin_ns / 1e3,
+                    (event.end_ns - event.begin_ns) / 1e3,
+                    buffer->tid
+                );
+            }
+
+            first = False;
+        }
+    }
+
+    fputs ("\n]}\n", file);
+
+    Bool ok = !ferror (file);
+    fclose (file);
+    RETURN_VALUE_IF (!ok, False, "Failed to write profiler trace to \"%s\"\n", file_path);
+
+    return True;
+}
+
+/**************************************************************************************************/
+/*********************************** PRIVATE METHOD DEFINITIONS ***********************************/
+/**************************************************************************************************/
+
+/**
+ * @b Get ring buffer of calling thread, create and register a new one if
+ * this is the first event recorded by calling thread.
+ *
+ * @return @c ProfilerThreadBuffer on success.
+ * @return @c Null otherwise.
+ * */
+static ProfilerThreadBuffer *get_thread_buffer() {
+    if (this_thread_buffer) {
+        return this_thread_buffer;
+    }
+
+    ProfilerThreadBuffer *buffer = NEW (ProfilerThreadBuffer);
+    RETURN_VALUE_IF (!buffer, Null, ERR_OUT_OF_MEMORY);
+
+    buffer->tid = atomic_fetch_add_explicit (&thread_id_count, 1, memory_order_relaxed) + 1;
+
+    /* lock-free push to front of global list */
+    ProfilerThreadBuffer *head = atomic_load_explicit (&thread_buffers, memory_order_relaxed);
+    do {
+        buffer->next = head;
+    } while (!atomic_compare_exchange_weak_explicit (
+        &thread_buffers,
+        &head,
+        buffer,
+        memory_order_release,
+        memory_order_relaxed
+    ));
+
+    return this_thread_buffer = buffer;
+}
+
+/**
+ * @b Write event to ring buffer of calling thread, overwriting oldest
+ * event if ring buffer is full.
+ *
+ * @param event
+ * */
+static void push_event (ProfilerEvent *event) {
+    ProfilerThreadBuffer *buffer = get_thread_buffer();
+    if (!buffer) {
+        return;
+    }
+
+    Uint64 head = atomic_load_explicit (&buffer->head, memory_order_relaxed);
+    buffer->events[head & PROFILER_RING_MASK] = *event;
+    atomic_store_explicit (&buffer->head, head + 1, memory_order_release);
+}
+
+/**
+ * @b Write given string as a quoted and escaped JSON string.
+ *
+ * @param file
+ * @param str
+ * */
+static void write_json_string (FILE *file, CString str) {
+    fputc ('"', file);
+    for (; str && *str; str++) {
+        if (*str == '"' || *str == '\\') {
+            fputc ('\\', file);
+            fputc (*str, file);
+        } else if ((Uint8)*str < 0x20) {
+            fprintf (file, "\\u%04x", (Uint8)*str);
+        } else {
+            fputc (*str, file);
+        }
+    }
+    fputc ('"', file);
+}
+
+/**
+ * @b Free all thread buffers when library gets unloaded.
+ * */
+DESTRUCTOR static void free_thread_buffers() {
+    ProfilerThreadBuffer *buffer = atomic_exchange (&thread_buffers, Null);
+    while (buffer) {
+        ProfilerThreadBuffer *next = buffer->next;
+        FREE (buffer);
+        buffer = next;
+    }
+}
@@ -0,0 +1,132 @@
+/**
+ * @file RadixSort.c
+ * @date Sun, 18th October 2026
+ * @author Siddharth Mishra (admin@brightprogrammer.in)
+ * @copyright Copyright 2024 Siddharth Mishra
+ * @copyright Copyright 2024 Anvie Labs
+ *
+ * Copyright 2024 Siddharth Mishra, Anvie Labs
+ * 
+ * Redistribution and use in source and binary forms, with or without modification, are permitted 
+ * provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+ *    and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions
+ *    and the following disclaimer in the documentation and/or other materials provided with the
+ *    distribution.
+ * 
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse
+ *    or promote products derived from this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND 
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * */
+
+#include <Anvie/Common.h>
+#include <Anvie/CrossGui/Utils/RadixSort.h>
+
+/* libc */
+#include <memory.h>
+
+/**************************************************************************************************/
+/*********************************** PUBLIC METHOD DEFINITIONS ************************************/
+/**************************************************************************************************/
+
+/**
+ * @b Sort keys in increasing order, moving values along with them. Keys that
+ * are equal keep the order they were given in (LSD radix sort).
+ *
+ * Histograms of all passes are counted in a single pass over keys, with no
+ * branches, and passes in which all keys have the same digit are skipped,
+ * so keys using only a few bits (eg: packed sort keys) take only a few passes.
+ *
+ * @param keys Keys to sort.
+ * @param values Value of each key, @c Null if there are none.
+ * @param key_scratch Memory for @c count keys, contents are overwritten.
+ * @param value_scratch Memory for @c count values, @c Null if @c values is @c Null.
+ * @param count Number of keys.
+ *
+ * @return @c keys on success, sorted in place.
+ * @return @c Null otherwise.
+ * */
+Uint64 *radix_sort_u64 (
+    Uint64 *keys,
+    Uint32 *values,
+    Uint64 *key_scratch,
+    Uint32 *value_scratch,
+    Size    count
+) {
+    RETURN_VALUE_IF (
+        !keys || !key_scratch || (values && !value_scratch),
+        Null,
+        ERR_INVALID_ARGUMENTS
+    );
+
+    if (count < 2) {
+        return keys;
+    }
+
+    Size histograms[RADIX_SORT_PASS_COUNT][RADIX_SORT_BUCKET_COUNT] = {0};
+    for (Size k = 0; k < count; k++) {
+        Uint64 key = keys[k];
+        for (Size p = 0; p < RADIX_SORT_PASS_COUNT; p++) {
+            histograms[p][(key >> (p * RADIX_SORT_BITS)) & (RADIX_SORT_BUCKET_COUNT - 1)]++;
+        }
+    }
+
+    Uint64 *src_keys   = keys;
+    Uint32 *src_values = values;
+    Uint64 *dst_keys   = key_scratch;
+    Uint32 *dst_values = value_scratch;
+
+    for (Size p = 0; p < RADIX_SORT_PASS_COUNT; p++) {
+        Size  shift     = p * RADIX_SORT_BITS;
+        Size *histogram = histograms[p];
+
+        /* all keys have same digit, so this pass would not move anything */
+        if (histogram[(src_keys[0] >> shift) & (RADIX_SORT_BUCKET_COUNT - 1)] == count) {
+            continue;
+        }
+
+        /* histogram becomes index of first key of each digit */
+        Size offset = 0;
+        for (Size b = 0; b < RADIX_SORT_BUCKET_COUNT; b++) {
+            Size bucket_count = histogram[b];
+            histogram[b]      = offset;
+            offset           += bucket_count;
+        }
+
+        for (Size k = 0; k < count; k++) {
+            Size index      = histogram[(src_keys[k] >> shift) & (RADIX_SORT_BUCKET_COUNT - 1)]++;
+            dst_keys[index] = src_keys[k];
+            if (values) {
+                dst_values[index] = src_values[k];
+            }
+        }
+
+        Uint64 *keys_swap   = src_keys;
+        Uint32 *values_swap = src_values;
+        src_keys            = dst_keys;
+        src_values          = dst_values;
+        dst_keys            = keys_swap;
+        dst_values          = values_swap;
+    }
+
+    /* an odd number of passes leaves sorted keys in scratch memory */
+    if (src_keys != keys) {
+        memcpy (keys, src_keys, count * sizeof (Uint64));
+        if (values) {
+            memcpy (values, src_values, count * sizeof (Uint32));
+        }
+    }
+
+    return keys;
+}
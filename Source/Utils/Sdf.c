@@ -0,0 +1,280 @@
+/**
+ * @file Sdf.c
+ * @date Sun, 18th October 2026
+ * @author Siddharth Mishra (admin@brightprogrammer.in)
+ * @copyright Copyright 2024 Siddharth Mishra
+ * @copyright Copyright 2024 Anvie Labs
+ *
+ * Copyright 2024 Siddharth Mishra, Anvie Labs
+ * 
+ * Redistribution and use in source and binary forms, with or without modification, are permitted 
+ * provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+ *    and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions
+ *    and the following disclaimer in the documentation and/or other materials provided with the
+ *    distribution.
+ * 
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse
+ *    or promote products derived from this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND 
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * */
+
+#define ALLOCATOR_TAG ALLOCATOR_TAG_GLYPH_ATLAS
+
+#include <Anvie/Common.h>
+#include <Anvie/CrossGui/Utils/Allocator.h>
+#include <Anvie/CrossGui/Utils/Sdf.h>
+
+/* libc */
+#include <math.h>
+
+/**
+ * @b Squared distance used for pixels with no feature pixel in range yet.
+ * */
+#define SDF_INF 1e20f
+
+/**************************************************************************************************/
+/********************************** PRIVATE METHOD DECLARATIONS ***********************************/
+/**************************************************************************************************/
+
+static void sdf_edt_1d (
+    Float32 *grid,
+    Uint32   offset,
+    Uint32   stride,
+    Uint32   length,
+    Float32 *f,
+    Float32 *z,
+    Uint32  *v
+);
+static void sdf_edt_2d (
+    Float32 *grid,
+    Uint32   width,
+    Uint32   height,
+    Float32 *f,
+    Float32 *z,
+    Uint32  *v
+);
+
+/**************************************************************************************************/
+/*********************************** PUBLIC METHOD DEFINITIONS ************************************/
+/**************************************************************************************************/
+
+/**
+ * @b Generate a single channel signed distance field from an 8 bit coverage bitmap.
+ *
+ * Pixels with coverage of at least half are inside. Exact euclidean distance
+ * to nearest pixel on the other side is computed at source resolution, and
+ * then averaged over each @p downscale x @p downscale block, so a bitmap
+ * rasterized at a larger size gives a more accurate field.
+ *
+ * Distances are encoded as @c 0.5 - d/(2*spread), clamped to [0, 1] and
+ * stored as bytes, where @c d is distance in field pixels, negative inside.
+ * So edge lies at 128 and values increase towards inside.
+ *
+ * Makes no use of any global state, and can be called from multiple threads.
+ *
+ * @param sdf Field of @p sdf_width x @p sdf_height tightly packed bytes.
+ * @param sdf_width Must be @c sdf_size(width, downscale, padding).
+ * @param sdf_height Must be @c sdf_size(height, downscale, padding).
+ * @param coverage Top row of source bitmap.
+ * @param width Width of source bitmap.
+ * @param height Height of source bitmap.
+ * @param pitch Bytes from one row of source bitmap to next, can be negative.
+ * @param downscale Number of source pixels per field pixel, along each axis.
+ * @param padding Field pixels left around source bitmap on each side.
+ * @param spread Distance in field pixels, mapped to 0 (outside) or 255 (inside).
+ *
+ * @return @c sdf on success.
+ * @return @c Null otherwise.
+ * */
+Uint8 *sdf_generate (
+    Uint8       *sdf,
+    Uint32       sdf_width,
+    Uint32       sdf_height,
+    const Uint8 *coverage,
+    Uint32       width,
+    Uint32       height,
+    Int32        pitch,
+    Uint32       downscale,
+    Uint32       padding,
+    Float32      spread
+) {
+    RETURN_VALUE_IF (
+        !sdf || (!coverage && width && height) || !downscale || spread <= 0,
+        Null,
+        ERR_INVALID_ARGUMENTS
+    );
+    RETURN_VALUE_IF (
+        sdf_width != sdf_size (width, downscale, padding) ||
+            sdf_height != sdf_size (height, downscale, padding),
+        Null,
+        ERR_INVALID_ARGUMENTS
+    );
+
+    Uint32 grid_width  = sdf_width * downscale;
+    Uint32 grid_height = sdf_height * downscale;
+    Size   grid_size   = (Size)grid_width * grid_height;
+    Uint32 max_side    = MAX (grid_width, grid_height);
+    Uint32 offset      = padding * downscale;
+
+    Float32 *outer = ALLOCATE (Float32, grid_size);
+    Float32 *inner = ALLOCATE (Float32, grid_size);
+    Float32 *f     = ALLOCATE (Float32, max_side);
+    Float32 *z     = ALLOCATE (Float32, max_side + 1);
+    Uint32  *v     = ALLOCATE (Uint32, max_side);
+    GOTO_HANDLER_IF (!outer || !inner || !f || !z || !v, GENERATE_FAILED, ERR_OUT_OF_MEMORY);
+
+    /* outer gets distance to nearest inside pixel, inner to nearest outside pixel */
+    for (Size i = 0; i < grid_size; i++) {
+        outer[i] = SDF_INF;
+        inner[i] = 0;
+    }
+
+    for (Uint32 y = 0; y < height; y++) {
+        const Uint8 *row = coverage + (Int64)pitch * y;
+        Size         dst = (Size)(offset + y) * grid_width + offset;
+
+        for (Uint32 x = 0; x < width; x++) {
+            if (row[x] >= 128) {
+                outer[dst + x] = 0;
+                inner[dst + x] = SDF_INF;
+            }
+        }
+    }
+
+    sdf_edt_2d (outer, grid_width, grid_height, f, z, v);
+    sdf_edt_2d (inner, grid_width, grid_height, f, z, v);
+
+    /* distance is measured to pixel centers, edge lies half a pixel before that */
+    Float32 block_scale = 1.f / ((Float32)downscale * downscale * downscale);
+    for (Uint32 sy = 0; sy < sdf_height; sy++) {
+        for (Uint32 sx = 0; sx < sdf_width; sx++) {
+            Float32 sum = 0;
+
+            for (Uint32 by = 0; by < downscale; by++) {
+                Size row = (Size)(sy * downscale + by) * grid_width + sx * downscale;
+
+                for (Uint32 bx = 0; bx < downscale; bx++) {
+                    Size i = row + bx;
+                    sum += inner[i] ? -(sqrtf (inner[i]) - 0.5f) : sqrtf (outer[i]) - 0.5f;
+                }
+            }
+
+            Float32 d     = sum * block_scale;
+            Float32 value = CLAMP (0.5f - d / (2 * spread), 0.f, 1.f);
+
+            sdf[(Size)sy * sdf_width + sx] = (Uint8)(value * 255.f + 0.5f);
+        }
+    }
+
+    FREE (v);
+    FREE (z);
+    FREE (f);
+    FREE (inner);
+    FREE (outer);
+
+    return sdf;
+
+GENERATE_FAILED:
+    if (v) {
+        FREE (v);
+    }
+    if (z) {
+        FREE (z);
+    }
+    if (f) {
+        FREE (f);
+    }
+    if (inner) {
+        FREE (inner);
+    }
+    if (outer) {
+        FREE (outer);
+    }
+    return Null;
+}
+
+/**************************************************************************************************/
+/*********************************** PRIVATE METHOD DEFINITIONS ***********************************/
+/**************************************************************************************************/
+
+/**
+ * @b Squared euclidean distance transform of a grid, in place.
+ *
+ * Each cell holds zero for feature pixels and @c SDF_INF otherwise, and gets
+ * squared distance to nearest feature pixel. Transform is separable, so it's
+ * done on columns and then on rows, in linear time (Felzenszwalb & Huttenlocher).
+ *
+ * @param f, z, v Scratch space for @c max(width,height) (+1 for z) elements.
+ * */
+static void sdf_edt_2d (
+    Float32 *grid,
+    Uint32   width,
+    Uint32   height,
+    Float32 *f,
+    Float32 *z,
+    Uint32  *v
+) {
+    for (Uint32 x = 0; x < width; x++) {
+        sdf_edt_1d (grid, x, width, height, f, z, v);
+    }
+    for (Uint32 y = 0; y < height; y++) {
+        sdf_edt_1d (grid, y * width, 1, width, f, z, v);
+    }
+}
+
+/**
+ * @b One dimensional squared distance transform, lower envelope of parabolas
+ * rooted at each sample.
+ * */
+static void sdf_edt_1d (
+    Float32 *grid,
+    Uint32   offset,
+    Uint32   stride,
+    Uint32   length,
+    Float32 *f,
+    Float32 *z,
+    Uint32  *v
+) {
+    for (Uint32 q = 0; q < length; q++) {
+        f[q] = grid[offset + q * stride];
+    }
+
+    Uint32 k = 0;
+    v[0]     = 0;
+    z[0]     = -SDF_INF;
+    z[1]     = SDF_INF;
+
+    for (Uint32 q = 1; q < length; q++) {
+        Float32 s;
+        do {
+            Uint32 r = v[k];
+            s        = ((f[q] + (Float32)q * q) - (f[r] + (Float32)r * r)) / (2.f * (q - r));
+        } while (s <= z[k] && k-- > 0);
+
+        k++;
+        v[k]     = q;
+        z[k]     = s;
+        z[k + 1] = SDF_INF;
+    }
+
+    k = 0;
+    for (Uint32 q = 0; q < length; q++) {
+        while (z[k + 1] < q) {
+            k++;
+        }
+        Uint32 r                  = v[k];
+        grid[offset + q * stride] = ((Float32)q - r) * ((Float32)q - r) + f[r];
+    }
+}
@@ -0,0 +1,458 @@
+/**
+ * @file TextLayoutCache.c
+ * @date Sun, 18th October 2026
+ * @author Siddharth Mishra (admin@brightprogrammer.in)
+ * @copyright Copyright 2024 Siddharth Mishra
+ * @copyright Copyright 2024 Anvie Labs
+ *
+ * Copyright 2024 Siddharth Mishra, Anvie Labs
+ * 
+ * Redistribution and use in source and binary forms, with or without modification, are permitted 
+ * provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+ *    and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions
+ *    and the following disclaimer in the documentation and/or other materials provided with the
+ *    distribution.
+ * 
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse
+ *    or promote products derived from this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND 
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * */
+
+#define ALLOCATOR_TAG ALLOCATOR_TAG_TEXT_LAYOUT
+
+#include <Anvie/Common.h>
+#include <Anvie/CrossGui/Utils/TextLayoutCache.h>
+
+/* libc */
+#include <memory.h>
+#include <stdlib.h>
+
+NEW_VECTOR_TYPE (TextLayout, TextLayoutVector, text_layout);
+NEW_VECTOR_TYPE (Uint32, TextLayoutIndexVector, text_layout_index);
+
+/**
+ * @b Layout considered for eviction, sorted by generation it was last used in.
+ * */
+typedef struct TextLayoutAge {
+    Uint64 last_used;
+    Uint32 index;
+} TextLayoutAge;
+
+/**************************************************************************************************/
+/********************************** PRIVATE METHOD DECLARATIONS ***********************************/
+/**************************************************************************************************/
+
+static Uint32           text_layout_key_hash (TextLayoutKey *key);
+static inline Bool      text_layout_key_equal (TextLayout *layout, TextLayoutKey *key, Uint32 hash);
+static Uint32          *text_layout_cache_find_slot (
+    TextLayoutCache *cache,
+    TextLayoutKey   *key,
+    Uint32           hash
+);
+static TextLayoutCache *text_layout_cache_grow_slots (TextLayoutCache *cache);
+static void             text_layout_cache_remove_slot (TextLayoutCache *cache, Uint32 *slot);
+static void             text_layout_cache_evict (TextLayoutCache *cache, Uint32 index);
+static int              text_layout_age_compare (const void *a, const void *b);
+
+/**************************************************************************************************/
+/*********************************** PUBLIC METHOD DEFINITIONS ************************************/
+/**************************************************************************************************/
+
+/**
+ * @b Initialize an empty text layout cache.
+ *
+ * @param cache
+ * @param budget Memory in bytes that cached layouts may take. Layouts used in
+ *        current frame are kept even if they take more than this.
+ *
+ * @return @c cache on success.
+ * @return @c Null otherwise.
+ * */
+TextLayoutCache *text_layout_cache_init (TextLayoutCache *cache, Size budget) {
+    RETURN_VALUE_IF (!cache || !budget, Null, ERR_INVALID_ARGUMENTS);
+
+    memset (cache, 0, sizeof (TextLayoutCache));
+
+    cache->budget     = budget;
+    cache->generation = 1;
+
+    GOTO_HANDLER_IF (
+        !text_layout_cache_grow_slots (cache),
+        INIT_FAILED,
+        "Failed to create text layout hash table\n"
+    );
+
+    return cache;
+
+INIT_FAILED:
+    text_layout_cache_deinit (cache);
+    return Null;
+}
+
+/**
+ * @b Free all memory owned by given text layout cache.
+ *
+ * @param cache
+ *
+ * @return @c cache on success.
+ * @return @c Null otherwise.
+ * */
+TextLayoutCache *text_layout_cache_deinit (TextLayoutCache *cache) {
+    RETURN_VALUE_IF (!cache, Null, ERR_INVALID_ARGUMENTS);
+
+    for (Size l = 0; l < cache->layouts.count; l++) {
+        TextLayout *layout = text_layout_vector_data (&cache->layouts) + l;
+        if (layout->text) {
+            FREE (layout->text);
+        }
+        if (layout->glyphs) {
+            FREE (layout->glyphs);
+        }
+    }
+
+    if (cache->slots) {
+        FREE (cache->slots);
+    }
+
+    text_layout_vector_deinit (&cache->layouts);
+    text_layout_index_vector_deinit (&cache->free_layouts);
+
+    memset (cache, 0, sizeof (TextLayoutCache));
+
+    return cache;
+}
+
+/**
+ * @b Start a new generation, usually once per frame.
+ *
+ * If layouts take more memory than budget, then layouts used in oldest
+ * generations are evicted first, until cache fits in budget again. Only
+ * layouts used in ended generation or before can be evicted.
+ *
+ * @param cache
+ *
+ * @return @c cache on success.
+ * @return @c Null otherwise.
+ * */
+TextLayoutCache *text_layout_cache_begin_frame (TextLayoutCache *cache) {
+    RETURN_VALUE_IF (!cache, Null, ERR_INVALID_ARGUMENTS);
+
+    cache->generation++;
+
+    if (cache->bytes <= cache->budget) {
+        return cache;
+    }
+
+    TextLayoutAge *ages = ALLOCATE (TextLayoutAge, cache->layout_count);
+    RETURN_VALUE_IF (!ages, Null, ERR_OUT_OF_MEMORY);
+
+    TextLayout *layouts   = text_layout_vector_data (&cache->layouts);
+    Size        age_count = 0;
+    for (Size l = 0; l < cache->layouts.count; l++) {
+        if (layouts[l].is_used) {
+            ages[age_count++] = (TextLayoutAge) {
+                .last_used = layouts[l].last_used,
+                .index     = (Uint32)l
+            };
+        }
+    }
+
+    qsort (ages, age_count, sizeof (TextLayoutAge), text_layout_age_compare);
+
+    for (Size a = 0; a < age_count && cache->bytes > cache->budget; a++) {
+        text_layout_cache_evict (cache, ages[a].index);
+    }
+
+    FREE (ages);
+
+    return cache;
+}
+
+/**
+ * @b Find layout with given key in cache, and mark it used in current generation.
+ *
+ * @param cache
+ * @param key
+ *
+ * @return Layout if it's cached. Valid until next call to @c text_layout_cache_insert
+ *         or @c text_layout_cache_begin_frame.
+ * @return @c Null otherwise.
+ * */
+TextLayout *text_layout_cache_find (TextLayoutCache *cache, TextLayoutKey *key) {
+    RETURN_VALUE_IF (!cache || !key || (key->length && !key->text), Null, ERR_INVALID_ARGUMENTS);
+
+    Uint32 *slot = text_layout_cache_find_slot (cache, key, text_layout_key_hash (key));
+    if (!*slot) {
+        cache->misses++;
+        return Null;
+    }
+
+    TextLayout *layout = text_layout_vector_data (&cache->layouts) + (*slot - 1);
+    layout->last_used  = cache->generation;
+    cache->hits++;
+
+    return layout;
+}
+
+/**
+ * @b Cache a copy of given glyphs, laid out with given key.
+ *
+ * Caller is expected to fill metrics (width and height) of returned layout. If
+ * key is already cached, then existing layout is returned as it is. Nothing is
+ * evicted here, so that layouts found earlier in a frame stay valid.
+ *
+ * @param cache
+ * @param key
+ * @param glyphs Positioned glyphs to be copied into cache.
+ * @param glyph_count Number of glyphs.
+ *
+ * @return Layout on success. Valid until next call to @c text_layout_cache_insert
+ *         or @c text_layout_cache_begin_frame.
+ * @return @c Null otherwise.
+ * */
+TextLayout *text_layout_cache_insert (
+    TextLayoutCache *cache,
+    TextLayoutKey   *key,
+    TextLayoutGlyph *glyphs,
+    Uint32           glyph_count
+) {
+    RETURN_VALUE_IF (
+        !cache || !key || (key->length && !key->text) || (glyph_count && !glyphs),
+        Null,
+        ERR_INVALID_ARGUMENTS
+    );
+
+    Uint32  hash = text_layout_key_hash (key);
+    Uint32 *slot = text_layout_cache_find_slot (cache, key, hash);
+    if (*slot) {
+        TextLayout *layout = text_layout_vector_data (&cache->layouts) + (*slot - 1);
+        layout->last_used  = cache->generation;
+        return layout;
+    }
+
+    /* keep load factor of hash table at most half */
+    if (2 * (cache->layout_count + 1) > cache->slot_count) {
+        RETURN_VALUE_IF (
+            !text_layout_cache_grow_slots (cache),
+            Null,
+            "Failed to grow text layout hash table\n"
+        );
+    }
+
+    /* text is NUL terminated so that it can be printed while debugging */
+    Char            *text        = ALLOCATE (Char, key->length + 1);
+    TextLayoutGlyph *glyphs_copy = glyph_count ? ALLOCATE (TextLayoutGlyph, glyph_count) : Null;
+    GOTO_HANDLER_IF (!text || (glyph_count && !glyphs_copy), INSERT_FAILED, ERR_OUT_OF_MEMORY);
+
+    memcpy (text, key->text, key->length);
+    if (glyph_count) {
+        memcpy (glyphs_copy, glyphs, sizeof (TextLayoutGlyph) * glyph_count);
+    }
+
+    Uint32 index;
+    if (cache->free_layouts.count) {
+        Uint32 *free_layouts = text_layout_index_vector_data (&cache->free_layouts);
+        index                = free_layouts[--cache->free_layouts.count];
+    } else {
+        GOTO_HANDLER_IF (
+            !text_layout_vector_push (&cache->layouts, Null),
+            INSERT_FAILED,
+            "Failed to resize vector to store more text layouts\n"
+        );
+        index = cache->layouts.count - 1;
+    }
+
+    Size bytes = sizeof (TextLayout) + key->length + 1 + sizeof (TextLayoutGlyph) * glyph_count;
+
+    TextLayout *layout = text_layout_vector_data (&cache->layouts) + index;
+    *layout            = (TextLayout) {
+        .hash        = hash,
+        .text        = text,
+        .length      = key->length,
+        .font        = key->font,
+        .size        = key->size,
+        .max_width   = key->max_width,
+        .flags       = key->flags,
+        .glyphs      = glyphs_copy,
+        .glyph_count = glyph_count,
+        .last_used   = cache->generation,
+        .bytes       = bytes,
+        .is_used     = True
+    };
+
+    /* growing hash table moves slots around, so look for an empty slot again */
+    *text_layout_cache_find_slot (cache, key, hash) = index + 1;
+    cache->layout_count++;
+    cache->bytes += bytes;
+
+    return layout;
+
+INSERT_FAILED:
+    if (text) {
+        FREE (text);
+    }
+    if (glyphs_copy) {
+        FREE (glyphs_copy);
+    }
+    return Null;
+}
+
+/**************************************************************************************************/
+/*********************************** PRIVATE METHOD DEFINITIONS ***********************************/
+/**************************************************************************************************/
+
+/**
+ * @b FNV-1a hash of text, followed by rest of the key.
+ * */
+static Uint32 text_layout_key_hash (TextLayoutKey *key) {
+    Uint32 h = 0x811c9dc5;
+    for (Uint32 c = 0; c < key->length; c++) {
+        h = (h ^ (Uint8)key->text[c]) * 0x01000193;
+    }
+
+    Uint32 rest[4] = {key->font, 0, 0, key->flags};
+    memcpy (rest + 1, &key->size, sizeof (Float32));
+    memcpy (rest + 2, &key->max_width, sizeof (Float32));
+    for (Uint32 r = 0; r < 4; r++) {
+        h = (h ^ rest[r]) * 0x01000193;
+    }
+
+    return h;
+}
+
+/**
+ * @b Sizes are compared bitwise, to agree with hash.
+ * */
+static inline Bool text_layout_key_equal (TextLayout *layout, TextLayoutKey *key, Uint32 hash) {
+    return layout->hash == hash && layout->length == key->length && layout->font == key->font &&
+           layout->flags == key->flags && !memcmp (&layout->size, &key->size, sizeof (Float32)) &&
+           !memcmp (&layout->max_width, &key->max_width, sizeof (Float32)) &&
+           !memcmp (layout->text, key->text, key->length);
+}
+
+/**
+ * @b Find slot of hash table holding given key, using linear probing.
+ *
+ * @return Slot holding layout with given key, if there's one.
+ * @return Empty slot where key should be inserted otherwise.
+ * */
+static Uint32 *text_layout_cache_find_slot (
+    TextLayoutCache *cache,
+    TextLayoutKey   *key,
+    Uint32           hash
+) {
+    TextLayout *layouts = text_layout_vector_data (&cache->layouts);
+    Uint32      mask    = cache->slot_count - 1;
+
+    for (Uint32 s = hash & mask;; s = (s + 1) & mask) {
+        Uint32 *slot = cache->slots + s;
+        if (!*slot || text_layout_key_equal (layouts + (*slot - 1), key, hash)) {
+            return slot;
+        }
+    }
+}
+
+/**
+ * @b Double capacity of hash table, and reinsert all layouts.
+ *
+ * Layouts never compare equal to each other, so they're reinserted at first
+ * empty slot of their probe sequence, without looking at keys.
+ * */
+static TextLayoutCache *text_layout_cache_grow_slots (TextLayoutCache *cache) {
+    Uint32  old_count = cache->slot_count;
+    Uint32 *old_slots = cache->slots;
+
+    Uint32  new_count = old_count ? 2 * old_count : 64;
+    Uint32 *new_slots = ALLOCATE (Uint32, new_count);
+    RETURN_VALUE_IF (!new_slots, Null, ERR_OUT_OF_MEMORY);
+
+    cache->slots      = new_slots;
+    cache->slot_count = new_count;
+
+    TextLayout *layouts = text_layout_vector_data (&cache->layouts);
+    Uint32      mask    = new_count - 1;
+    for (Uint32 s = 0; s < old_count; s++) {
+        if (old_slots[s]) {
+            Uint32 n = layouts[old_slots[s] - 1].hash & mask;
+            while (new_slots[n]) {
+                n = (n + 1) & mask;
+            }
+            new_slots[n] = old_slots[s];
+        }
+    }
+
+    if (old_slots) {
+        FREE (old_slots);
+    }
+
+    return cache;
+}
+
+/**
+ * @b Empty given slot, moving back layouts of same probe sequence that follow
+ * it, so that lookups never stop early at a hole.
+ * */
+static void text_layout_cache_remove_slot (TextLayoutCache *cache, Uint32 *slot) {
+    TextLayout *layouts = text_layout_vector_data (&cache->layouts);
+    Uint32      mask    = cache->slot_count - 1;
+    Uint32      hole    = slot - cache->slots;
+
+    cache->slots[hole] = 0;
+    for (Uint32 s = (hole + 1) & mask; cache->slots[s]; s = (s + 1) & mask) {
+        Uint32 home = layouts[cache->slots[s] - 1].hash & mask;
+
+        /* layout stays if it's home is cyclically within (hole, s] */
+        Bool stays = hole <= s ? (home > hole && home <= s) : (home > hole || home <= s);
+        if (!stays) {
+            cache->slots[hole] = cache->slots[s];
+            cache->slots[s]    = 0;
+            hole               = s;
+        }
+    }
+}
+
+/**
+ * @b Remove layout at given index from cache, and free it's memory.
+ * */
+static void text_layout_cache_evict (TextLayoutCache *cache, Uint32 index) {
+    TextLayout *layout = text_layout_vector_data (&cache->layouts) + index;
+
+    /* slot of layout is found by index, since it's key is about to be freed */
+    Uint32 mask = cache->slot_count - 1;
+    Uint32 s    = layout->hash & mask;
+    while (cache->slots[s] != index + 1) {
+        s = (s + 1) & mask;
+    }
+    text_layout_cache_remove_slot (cache, cache->slots + s);
+
+    cache->bytes -= layout->bytes;
+    cache->layout_count--;
+    cache->evictions++;
+
+    FREE (layout->text);
+    if (layout->glyphs) {
+        FREE (layout->glyphs);
+    }
+    memset (layout, 0, sizeof (TextLayout));
+
+    /* failing to remember a free entry only wastes it, cache stays consistent */
+    text_layout_index_vector_push (&cache->free_layouts, &index);
+}
+
+static int text_layout_age_compare (const void *a, const void *b) {
+    Uint64 x = ((const TextLayoutAge *)a)->last_used;
+    Uint64 y = ((const TextLayoutAge *)b)->last_used;
+    return (x > y) - (x < y);
+}
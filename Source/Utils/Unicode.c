@@ -0,0 +1,784 @@
+/**
+ * @file Unicode.c
+ * @date Sun, 18th October 2026
+ * @author Siddharth Mishra (admin@brightprogrammer.in)
+ * @copyright Copyright 2024 Siddharth Mishra
+ * @copyright Copyright 2024 Anvie Labs
+ *
+ * Copyright 2024 Siddharth Mishra, Anvie Labs
+ * 
+ * Redistribution and use in source and binary forms, with or without modification, are permitted 
+ * provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+ *    and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions
+ *    and the following disclaimer in the documentation and/or other materials provided with the
+ *    distribution.
+ * 
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse
+ *    or promote products derived from this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND 
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * */
+
+#include <Anvie/Common.h>
+#include <Anvie/CrossGui/Utils/Unicode.h>
+
+/* libc */
+#include <memory.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#    define UNICODE_HAVE_X86 1
+#    include <immintrin.h>
+#endif
+
+/**
+ * @b Set of UTF-8 kernels implemented for one instruction set.
+ * */
+typedef struct UnicodeKernels {
+    Bool (*utf8_validate) (const Uint8 *bytes, Size length);
+    Size (*utf8_decode) (Uint32 *codepoints, const Uint8 *bytes, Size length);
+} UnicodeKernels;
+
+/**
+ * @b Codepoints from @c first to @c last (inclusive) have line breaking class @c cls.
+ * */
+typedef struct LineBreakRange {
+    Uint32 first;
+    Uint32 last;
+    Uint8  cls;
+} LineBreakRange;
+
+/**************************************************************************************************/
+/********************************** PRIVATE METHOD DECLARATIONS ***********************************/
+/**************************************************************************************************/
+
+static inline Uint32 utf8_decode_one (const Uint8 *bytes, Size length, Size *pos);
+static Bool          utf8_validate_scalar (const Uint8 *bytes, Size length);
+static Size          utf8_decode_scalar (Uint32 *codepoints, const Uint8 *bytes, Size length);
+
+#if UNICODE_HAVE_X86
+static Bool utf8_validate_sse2 (const Uint8 *bytes, Size length);
+static Size utf8_decode_sse2 (Uint32 *codepoints, const Uint8 *bytes, Size length);
+
+static Bool utf8_validate_avx2 (const Uint8 *bytes, Size length);
+static Size utf8_decode_avx2 (Uint32 *codepoints, const Uint8 *bytes, Size length);
+#endif
+
+static Bool isa_is_supported (MathsIsa isa);
+
+/* clang-format off */
+static const UnicodeKernels kernels[MATHS_ISA_MAX] = {
+    [MATHS_ISA_SCALAR] = {
+        .utf8_validate = utf8_validate_scalar,
+        .utf8_decode   = utf8_decode_scalar
+    },
+#if UNICODE_HAVE_X86
+    [MATHS_ISA_SSE2] = {
+        .utf8_validate = utf8_validate_sse2,
+        .utf8_decode   = utf8_decode_sse2
+    },
+    [MATHS_ISA_AVX2] = {
+        .utf8_validate = utf8_validate_avx2,
+        .utf8_decode   = utf8_decode_avx2
+    },
+#endif
+};
+/* clang-format on */
+
+static MathsIsa              active_isa     = MATHS_ISA_SCALAR;
+static const UnicodeKernels *active_kernels = &kernels[MATHS_ISA_SCALAR];
+
+/**
+ * @b Select the best instruction set supported by host CPU when library is loaded.
+ * */
+CONSTRUCTOR static void select_best_isa() {
+#if UNICODE_HAVE_X86
+    __builtin_cpu_init();
+#endif
+
+    for (MathsIsa isa = MATHS_ISA_MAX - 1; isa > MATHS_ISA_SCALAR; isa--) {
+        if (unicode_set_isa (isa)) {
+            return;
+        }
+    }
+}
+
+/* shorthands for line breaking classes, only to keep tables readable */
+#define OP LINE_BREAK_CLASS_OP
+#define CL LINE_BREAK_CLASS_CL
+#define QU LINE_BREAK_CLASS_QU
+#define GL LINE_BREAK_CLASS_GL
+#define NS LINE_BREAK_CLASS_NS
+#define EX LINE_BREAK_CLASS_EX
+#define SY LINE_BREAK_CLASS_SY
+#define IS LINE_BREAK_CLASS_IS
+#define PR LINE_BREAK_CLASS_PR
+#define PO LINE_BREAK_CLASS_PO
+#define NU LINE_BREAK_CLASS_NU
+#define AL LINE_BREAK_CLASS_AL
+#define ID LINE_BREAK_CLASS_ID
+#define IN LINE_BREAK_CLASS_IN
+#define HY LINE_BREAK_CLASS_HY
+#define BA LINE_BREAK_CLASS_BA
+#define BB LINE_BREAK_CLASS_BB
+#define B2 LINE_BREAK_CLASS_B2
+#define ZW LINE_BREAK_CLASS_ZW
+#define WJ LINE_BREAK_CLASS_WJ
+#define CM LINE_BREAK_CLASS_CM
+#define SP LINE_BREAK_CLASS_SP
+#define BK LINE_BREAK_CLASS_BK
+#define CR LINE_BREAK_CLASS_CR
+#define LF LINE_BREAK_CLASS_LF
+
+/* clang-format off */
+static const Uint8 ascii_classes[128] = {
+    /* controls, with tab breaking after and vertical tab and form feed breaking lines */
+    CM, CM, CM, CM, CM, CM, CM, CM, CM, BA, LF, BK, BK, CR, CM, CM,
+    CM, CM, CM, CM, CM, CM, CM, CM, CM, CM, CM, CM, CM, CM, CM, CM,
+    /*  !   "   #   $   %   &   '   (   )   *   +   ,   -   .   / */
+    SP, EX, QU, AL, PR, PO, AL, QU, OP, CL, AL, PR, IS, HY, IS, SY,
+    /* 0   1   2   3   4   5   6   7   8   9   :   ;   <   =   >   ? */
+    NU, NU, NU, NU, NU, NU, NU, NU, NU, NU, IS, IS, AL, AL, AL, EX,
+    /* @   A - O */
+    AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL,
+    /* P - Z                                    [   \   ]   ^   _ */
+    AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, OP, PR, CL, AL, AL,
+    /* `   a - o */
+    AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL,
+    /* p - z                                    {   |   }   ~  DEL */
+    AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, OP, BA, CL, AL, CM,
+};
+
+/**
+ * @b Classes of non-ASCII codepoints that are not alphabetic, sorted by codepoint.
+ *
+ * This covers combining marks, punctuation, spaces, digits and ideographs of
+ * commonly used scripts, not the whole Unicode character database.
+ * */
+static const LineBreakRange line_break_ranges[] = {
+    {0x0080, 0x0084, CM}, {0x0085, 0x0085, BK}, {0x0086, 0x009f, CM}, {0x00a0, 0x00a0, GL},
+    {0x00a1, 0x00a1, OP}, {0x00a2, 0x00a2, PO}, {0x00a3, 0x00a5, PR}, {0x00ab, 0x00ab, QU},
+    {0x00ad, 0x00ad, BA}, {0x00b0, 0x00b0, PO}, {0x00b1, 0x00b1, PR}, {0x00b4, 0x00b4, BB},
+    {0x00bb, 0x00bb, QU}, {0x00bf, 0x00bf, OP}, {0x0300, 0x036f, CM}, {0x0483, 0x0489, CM},
+    {0x0591, 0x05bd, CM}, {0x05be, 0x05be, BA}, {0x05bf, 0x05bf, CM}, {0x05c1, 0x05c2, CM},
+    {0x05c4, 0x05c5, CM}, {0x05c7, 0x05c7, CM}, {0x060c, 0x060d, IS}, {0x0610, 0x061a, CM},
+    {0x061f, 0x061f, EX}, {0x064b, 0x065f, CM}, {0x0660, 0x0669, NU}, {0x066a, 0x066a, PO},
+    {0x066b, 0x066c, NU}, {0x0670, 0x0670, CM}, {0x06d6, 0x06dc, CM}, {0x06df, 0x06e4, CM},
+    {0x06e7, 0x06e8, CM}, {0x06ea, 0x06ed, CM}, {0x06f0, 0x06f9, NU}, {0x0900, 0x0903, CM},
+    {0x093a, 0x093c, CM}, {0x093e, 0x094f, CM}, {0x0951, 0x0957, CM}, {0x0962, 0x0963, CM},
+    {0x0964, 0x0965, BA}, {0x0966, 0x096f, NU}, {0x0e31, 0x0e31, CM}, {0x0e34, 0x0e3a, CM},
+    {0x0e47, 0x0e4e, CM}, {0x0e50, 0x0e59, NU}, {0x0e5a, 0x0e5b, BA}, {0x0f0b, 0x0f0b, BA},
+    {0x1100, 0x115f, ID}, {0x1680, 0x1680, BA}, {0x17d4, 0x17d5, BA}, {0x1806, 0x1806, BB},
+    {0x1ab0, 0x1aff, CM}, {0x1dc0, 0x1dff, CM}, {0x2000, 0x2006, BA}, {0x2007, 0x2007, GL},
+    {0x2008, 0x200a, BA}, {0x200b, 0x200b, ZW}, {0x200c, 0x200d, CM}, {0x2010, 0x2010, BA},
+    {0x2011, 0x2011, GL}, {0x2012, 0x2013, BA}, {0x2014, 0x2014, B2}, {0x2018, 0x2019, QU},
+    {0x201a, 0x201a, OP}, {0x201b, 0x201d, QU}, {0x201e, 0x201e, OP}, {0x201f, 0x201f, QU},
+    {0x2024, 0x2026, IN}, {0x2027, 0x2027, BA}, {0x2028, 0x2029, BK}, {0x202f, 0x202f, GL},
+    {0x2030, 0x2037, PO}, {0x2039, 0x203a, QU}, {0x203c, 0x203d, NS}, {0x2044, 0x2044, IS},
+    {0x2045, 0x2045, OP}, {0x2046, 0x2046, CL}, {0x2047, 0x2049, NS}, {0x2060, 0x2060, WJ},
+    {0x20a0, 0x20cf, PR}, {0x20d0, 0x20ff, CM}, {0x2103, 0x2103, PO}, {0x2116, 0x2116, PR},
+    {0x2e80, 0x2fff, ID}, {0x3000, 0x3000, BA}, {0x3001, 0x3002, CL}, {0x3003, 0x3004, ID},
+    {0x3005, 0x3005, NS}, {0x3006, 0x3007, ID}, {0x3008, 0x3008, OP}, {0x3009, 0x3009, CL},
+    {0x300a, 0x300a, OP}, {0x300b, 0x300b, CL}, {0x300c, 0x300c, OP}, {0x300d, 0x300d, CL},
+    {0x300e, 0x300e, OP}, {0x300f, 0x300f, CL}, {0x3010, 0x3010, OP}, {0x3011, 0x3011, CL},
+    {0x3012, 0x3013, ID}, {0x3014, 0x3014, OP}, {0x3015, 0x3015, CL}, {0x3016, 0x3016, OP},
+    {0x3017, 0x3017, CL}, {0x3018, 0x3018, OP}, {0x3019, 0x3019, CL}, {0x301a, 0x301a, OP},
+    {0x301b, 0x301b, CL}, {0x301c, 0x301c, NS}, {0x301d, 0x301d, OP}, {0x301e, 0x301f, CL},
+    {0x3020, 0x3029, ID}, {0x302a, 0x302f, CM}, {0x3030, 0x3098, ID}, {0x3099, 0x309a, CM},
+    {0x309b, 0x309f, ID}, {0x30a0, 0x30a0, NS}, {0x30a1, 0x30fa, ID}, {0x30fb, 0x30fb, NS},
+    {0x30fc, 0x4dbf, ID}, {0x4e00, 0x9fff, ID}, {0xa000, 0xa4cf, ID}, {0xac00, 0xd7a3, ID},
+    {0xf900, 0xfaff, ID}, {0xfe00, 0xfe0f, CM}, {0xfe20, 0xfe2f, CM}, {0xfe30, 0xfe4f, ID},
+    {0xfeff, 0xfeff, WJ}, {0xff01, 0xff01, EX}, {0xff02, 0xff03, ID}, {0xff04, 0xff04, PR},
+    {0xff05, 0xff05, PO}, {0xff06, 0xff07, ID}, {0xff08, 0xff08, OP}, {0xff09, 0xff09, CL},
+    {0xff0a, 0xff0b, ID}, {0xff0c, 0xff0c, CL}, {0xff0d, 0xff0d, ID}, {0xff0e, 0xff0e, CL},
+    {0xff0f, 0xff19, ID}, {0xff1a, 0xff1b, NS}, {0xff1c, 0xff1e, ID}, {0xff1f, 0xff1f, EX},
+    {0xff20, 0xff3a, ID}, {0xff3b, 0xff3b, OP}, {0xff3c, 0xff3c, ID}, {0xff3d, 0xff3d, CL},
+    {0xff3e, 0xff5a, ID}, {0xff5b, 0xff5b, OP}, {0xff5c, 0xff5c, ID}, {0xff5d, 0xff5d, CL},
+    {0xff5e, 0xff60, ID}, {0xff61, 0xff61, CL}, {0xff62, 0xff62, OP}, {0xff63, 0xff64, CL},
+    {0xff65, 0xff65, NS}, {0xffe0, 0xffe0, PO}, {0xffe1, 0xffe1, PR}, {0xffe5, 0xffe6, PR},
+    {0x1f000, 0x1faff, ID}, {0x20000, 0x2fffd, ID}, {0x30000, 0x3fffd, ID},
+    {0xe0001, 0xe007f, CM}, {0xe0100, 0xe01ef, CM},
+};
+
+/**
+ * @b Break actions of pair table.
+ * */
+#define D 0 /* direct : break allowed, even without spaces in between */
+#define I 1 /* indirect : break allowed only if there are spaces in between */
+#define P 2 /* prohibited : break not allowed, even if there are spaces in between */
+
+/**
+ * @b What to do between a character of row class, followed by (possibly
+ * spaces and then) a character of column class. Derived from rules LB7 to
+ * LB31 of UAX #14, for the classes listed here.
+ * */
+static const Uint8 pair_table[WJ + 1][WJ + 1] = {
+    /*     OP CL QU GL NS EX SY IS PR PO NU AL ID IN HY BA BB B2 ZW WJ */
+    [OP] = {P, P, P, I, P, P, P, P, P, P, P, P, P, P, P, P, P, P, P, P},
+    [CL] = {D, P, I, I, P, P, P, P, I, I, I, I, D, I, I, I, D, D, P, P},
+    [QU] = {P, P, I, I, I, P, P, P, I, I, I, I, I, I, I, I, I, I, P, P},
+    [GL] = {I, I, I, I, I, I, I, I, I, I, I, I, I, I, I, I, I, I, P, P},
+    [NS] = {D, P, I, I, I, P, P, P, D, D, D, D, D, I, I, I, D, D, P, P},
+    [EX] = {D, P, I, I, I, P, P, P, D, D, D, D, D, I, I, I, D, D, P, P},
+    [SY] = {D, P, I, I, I, P, P, P, D, D, I, D, D, I, I, I, D, D, P, P},
+    [IS] = {D, P, I, I, I, P, P, P, D, D, I, I, D, I, I, I, D, D, P, P},
+    [PR] = {I, P, I, I, I, P, P, P, D, D, I, I, I, I, I, I, D, D, P, P},
+    [PO] = {I, P, I, I, I, P, P, P, D, D, I, I, D, I, I, I, D, D, P, P},
+    [NU] = {I, P, I, I, I, P, P, P, I, I, I, I, D, I, I, I, D, D, P, P},
+    [AL] = {I, P, I, I, I, P, P, P, I, I, I, I, D, I, I, I, D, D, P, P},
+    [ID] = {D, P, I, I, I, P, P, P, D, I, D, D, D, I, I, I, D, D, P, P},
+    [IN] = {D, P, I, I, I, P, P, P, D, D, D, D, D, I, I, I, D, D, P, P},
+    [HY] = {D, P, I, D, I, P, P, P, D, D, I, D, D, I, I, I, D, D, P, P},
+    [BA] = {D, P, I, D, I, P, P, P, D, D, D, D, D, I, I, I, D, D, P, P},
+    [BB] = {I, P, I, I, I, P, P, P, I, I, I, I, I, I, I, I, I, I, P, P},
+    [B2] = {D, P, I, I, I, P, P, P, D, D, D, D, D, I, I, I, D, P, P, P},
+    [ZW] = {D, D, D, D, D, D, D, D, D, D, D, D, D, D, D, D, D, D, P, D},
+    [WJ] = {P, P, P, P, P, P, P, P, P, P, P, P, P, P, P, P, P, P, P, P},
+};
+/* clang-format on */
+
+/**************************************************************************************************/
+/*********************************** PUBLIC METHOD DEFINITIONS ************************************/
+/**************************************************************************************************/
+
+/**
+ * @b Check whether given text is well formed UTF-8.
+ *
+ * Overlong encodings, encoded surrogates, codepoints above U+10FFFF and
+ * truncated sequences are all rejected.
+ *
+ * @param text
+ * @param length Length of @p text in bytes.
+ *
+ * @return @c True if @p text is valid UTF-8.
+ * @return @c False otherwise.
+ * */
+Bool utf8_validate (const Char *text, Size length) {
+    RETURN_VALUE_IF (!text && length, False, ERR_INVALID_ARGUMENTS);
+
+    return active_kernels->utf8_validate ((const Uint8 *)text, length);
+}
+
+/**
+ * @b Decode given UTF-8 text into codepoints.
+ *
+ * Each byte of an ill formed sequence decodes to U+FFFD, so decoding never
+ * fails, and never produces more codepoints than there are bytes. Runs of
+ * ASCII are widened many bytes at a time.
+ *
+ * @param codepoints Where decoded codepoints are stored, must have space for
+ *        @p length codepoints.
+ * @param text
+ * @param length Length of @p text in bytes.
+ *
+ * @return Number of codepoints decoded.
+ * */
+Size utf8_decode (Uint32 *codepoints, const Char *text, Size length) {
+    RETURN_VALUE_IF ((!codepoints || !text) && length, 0, ERR_INVALID_ARGUMENTS);
+
+    return active_kernels->utf8_decode (codepoints, (const Uint8 *)text, length);
+}
+
+/**
+ * @b Get line breaking class of given codepoint.
+ * */
+LineBreakClass line_break_class (Uint32 codepoint) {
+    if (codepoint < 128) {
+        return ascii_classes[codepoint];
+    }
+
+    Size lo = 0;
+    Size hi = sizeof (line_break_ranges) / sizeof (line_break_ranges[0]);
+    while (lo < hi) {
+        Size mid = lo + (hi - lo) / 2;
+        if (codepoint > line_break_ranges[mid].last) {
+            lo = mid + 1;
+        } else if (codepoint < line_break_ranges[mid].first) {
+            hi = mid;
+        } else {
+            return line_break_ranges[mid].cls;
+        }
+    }
+
+    return AL;
+}
+
+/**
+ * @b Find break opportunity after each of given codepoints.
+ *
+ * Implements pair table based line breaking of UAX #14 : hard line breaks and
+ * spaces are handled by explicit rules, combining marks take class of
+ * character they're attached to, and everything else is looked up in pair table.
+ * Spaces at the start of text or of a line never end a line, so indentation
+ * always stays with the line it indents.
+ *
+ * @param breaks Where @c LineBreak after each codepoint is stored, must have
+ *        space for @p count entries. Last entry is always mandatory.
+ * @param codepoints
+ * @param count Number of codepoints.
+ *
+ * @return @p breaks on success.
+ * @return @c Null otherwise.
+ * */
+Uint8 *line_break_find (Uint8 *breaks, const Uint32 *codepoints, Size count) {
+    RETURN_VALUE_IF ((!breaks || !codepoints) && count, Null, ERR_INVALID_ARGUMENTS);
+
+    if (!count) {
+        return breaks;
+    }
+
+    /* class of last character, and class pair table is looked up with */
+    LineBreakClass prev        = line_break_class (codepoints[0]);
+    LineBreakClass before      = prev == CM ? AL : prev > WJ ? WJ : prev;
+    Bool           after_space = False;
+
+    for (Size c = 1; c < count; c++) {
+        LineBreakClass cur = line_break_class (codepoints[c]);
+        Uint8         *brk = breaks + c - 1;
+
+        /* LB4, LB5 : always break after hard line breaks, except between CR and LF */
+        if (prev == BK || prev == LF || (prev == CR && cur != LF)) {
+            *brk        = LINE_BREAK_MANDATORY;
+            prev        = cur;
+            before      = cur == CM ? AL : cur > WJ ? WJ : cur;
+            after_space = False;
+            continue;
+        }
+
+        prev = cur;
+
+        /* LB6, LB7 : never break before hard line breaks or spaces */
+        if (cur == BK || cur == CR || cur == LF || cur == SP) {
+            *brk         = LINE_BREAK_NONE;
+            after_space |= cur == SP;
+            continue;
+        }
+
+        /* LB9, LB10 : combining marks attach to previous character, unless it's a space */
+        if (cur == CM) {
+            if (!after_space && before != ZW) {
+                *brk = LINE_BREAK_NONE;
+                continue;
+            }
+            cur = AL;
+        }
+
+        Uint8 action = pair_table[before][cur];
+        *brk = action == D || (action == I && after_space) ? LINE_BREAK_ALLOWED : LINE_BREAK_NONE;
+
+        before      = cur;
+        after_space = False;
+    }
+
+    /* LB3 : always break at end of text */
+    breaks[count - 1] = LINE_BREAK_MANDATORY;
+
+    return breaks;
+}
+
+/**
+ * @b Get instruction set currently used by UTF-8 kernels.
+ * */
+MathsIsa unicode_get_isa() {
+    return active_isa;
+}
+
+/**
+ * @b Force UTF-8 kernels to use given instruction set.
+ *
+ * Best supported instruction set is already selected when library is loaded.
+ * This is meant for tests and benchmarks, and must not be called while another
+ * thread is running a UTF-8 kernel.
+ *
+ * @param isa
+ *
+ * @return @c True on success.
+ * @return @c False if @c isa is not supported by this build or host CPU.
+ * */
+Bool unicode_set_isa (MathsIsa isa) {
+    RETURN_VALUE_IF (isa >= MATHS_ISA_MAX, False, ERR_INVALID_ARGUMENTS);
+
+    if (!kernels[isa].utf8_decode || !isa_is_supported (isa)) {
+        return False;
+    }
+
+    active_isa     = isa;
+    active_kernels = &kernels[isa];
+
+    return True;
+}
+
+/**************************************************************************************************/
+/*********************************** PRIVATE METHOD DEFINITIONS ***********************************/
+/**************************************************************************************************/
+
+static Bool isa_is_supported (MathsIsa isa) {
+    switch (isa) {
+        case MATHS_ISA_SCALAR :
+            return True;
+#if UNICODE_HAVE_X86
+        case MATHS_ISA_SSE2 :
+            return !!__builtin_cpu_supports ("sse2");
+        case MATHS_ISA_AVX2 :
+            return !!__builtin_cpu_supports ("avx2");
+#endif
+        default :
+            return False;
+    }
+}
+
+/*********************************************************************************************/
+/*************************************** SCALAR *********************************************/
+/*********************************************************************************************/
+
+/**
+ * @b Decode a single codepoint from UTF-8 encoded text.
+ *
+ * Invalid, overlong and truncated sequences, and encoded surrogates decode to
+ * U+FFFD, consuming a single byte, so decoding always makes progress.
+ *
+ * @param bytes Text to decode from.
+ * @param length Number of bytes left in text, must be non-zero.
+ * @param pos Advanced by number of bytes consumed.
+ *
+ * @return Decoded codepoint.
+ * */
+static inline Uint32 utf8_decode_one (const Uint8 *bytes, Size length, Size *pos) {
+    Uint8 lead = bytes[0];
+
+    Size   count;
+    Uint32 codepoint;
+    Uint32 min_codepoint;
+    if (lead < 0x80) {
+        *pos += 1;
+        return lead;
+    } else if ((lead & 0xe0) == 0xc0) {
+        count         = 2;
+        codepoint     = lead & 0x1f;
+        min_codepoint = 0x80;
+    } else if ((lead & 0xf0) == 0xe0) {
+        count         = 3;
+        codepoint     = lead & 0x0f;
+        min_codepoint = 0x800;
+    } else if ((lead & 0xf8) == 0xf0) {
+        count         = 4;
+        codepoint     = lead & 0x07;
+        min_codepoint = 0x10000;
+    } else {
+        *pos += 1;
+        return 0xfffd;
+    }
+
+    if (count > length) {
+        *pos += 1;
+        return 0xfffd;
+    }
+
+    for (Size s = 1; s < count; s++) {
+        if ((bytes[s] & 0xc0) != 0x80) {
+            *pos += 1;
+            return 0xfffd;
+        }
+        codepoint = (codepoint << 6) | (bytes[s] & 0x3f);
+    }
+
+    if (codepoint < min_codepoint || codepoint > 0x10ffff ||
+        (codepoint >= 0xd800 && codepoint <= 0xdfff)) {
+        *pos += 1;
+        return 0xfffd;
+    }
+
+    *pos += count;
+    return codepoint;
+}
+
+static Bool utf8_validate_scalar (const Uint8 *bytes, Size length) {
+    for (Size pos = 0; pos < length;) {
+        Size start = pos;
+
+        /* a well formed U+FFFD takes 3 bytes, ill formed sequences consume 1 */
+        if (utf8_decode_one (bytes + pos, length - pos, &pos) == 0xfffd && pos - start == 1) {
+            return False;
+        }
+    }
+
+    return True;
+}
+
+static Size utf8_decode_scalar (Uint32 *codepoints, const Uint8 *bytes, Size length) {
+    Size count = 0;
+
+    for (Size pos = 0; pos < length;) {
+        codepoints[count++] = utf8_decode_one (bytes + pos, length - pos, &pos);
+    }
+
+    return count;
+}
+
+#if UNICODE_HAVE_X86
+
+/*********************************************************************************************/
+/**************************************** SSE2 **********************************************/
+/*********************************************************************************************/
+
+/* NOTE:
+ * SSE2 has no byte shuffle, so only runs of ASCII are vectorized here, and
+ * everything else is handed to scalar decoder one sequence at a time. */
+
+__attribute__ ((target ("sse2"))) static Bool utf8_validate_sse2 (const Uint8 *bytes, Size length) {
+    Size pos = 0;
+
+    while (pos + 16 <= length) {
+        Uint32 mask = _mm_movemask_epi8 (_mm_loadu_si128 ((const __m128i *)(bytes + pos)));
+        if (!mask) {
+            pos += 16;
+            continue;
+        }
+
+        pos += __builtin_ctz (mask);
+
+        Size start = pos;
+        if (utf8_decode_one (bytes + pos, length - pos, &pos) == 0xfffd && pos - start == 1) {
+            return False;
+        }
+    }
+
+    return utf8_validate_scalar (bytes + pos, length - pos);
+}
+
+__attribute__ ((target ("sse2"))) static Size
+    utf8_decode_sse2 (Uint32 *codepoints, const Uint8 *bytes, Size length) {
+    __m128i zero  = _mm_setzero_si128();
+    Size    count = 0;
+    Size    pos   = 0;
+
+    while (pos + 16 <= length) {
+        __m128i v    = _mm_loadu_si128 ((const __m128i *)(bytes + pos));
+        Uint32  mask = _mm_movemask_epi8 (v);
+
+        /* whole block is ASCII, zero extend bytes to codepoints */
+        if (!mask) {
+            __m128i lo = _mm_unpacklo_epi8 (v, zero);
+            __m128i hi = _mm_unpackhi_epi8 (v, zero);
+            _mm_storeu_si128 ((__m128i *)(codepoints + count), _mm_unpacklo_epi16 (lo, zero));
+            _mm_storeu_si128 ((__m128i *)(codepoints + count + 4), _mm_unpackhi_epi16 (lo, zero));
+            _mm_storeu_si128 ((__m128i *)(codepoints + count + 8), _mm_unpacklo_epi16 (hi, zero));
+            _mm_storeu_si128 ((__m128i *)(codepoints + count + 12), _mm_unpackhi_epi16 (hi, zero));
+            count += 16;
+            pos   += 16;
+            continue;
+        }
+
+        /* copy ASCII prefix of block, and decode first sequence after it */
+        for (Uint32 a = __builtin_ctz (mask); a; a--) {
+            codepoints[count++] = bytes[pos++];
+        }
+        codepoints[count++] = utf8_decode_one (bytes + pos, length - pos, &pos);
+    }
+
+    return count + utf8_decode_scalar (codepoints + count, bytes + pos, length - pos);
+}
+
+/*********************************************************************************************/
+/**************************************** AVX2 **********************************************/
+/*********************************************************************************************/
+
+/* NOTE:
+ * Validation classifies each byte by high nibble of previous byte, low nibble
+ * of previous byte and high nibble of itself, with three table lookups whose
+ * results are ANDed together (Keiser and Lemire, "Validating UTF-8 In Less
+ * Than One Instruction Per Byte"). Each bit of a lookup result stands for one
+ * kind of error, which is reported only if all three lookups agree on it. */
+
+#    define UTF8_TOO_SHORT      (1 << 0) /* lead byte not followed by continuation */
+#    define UTF8_TOO_LONG       (1 << 1) /* ASCII followed by continuation */
+#    define UTF8_OVERLONG_3     (1 << 2) /* 3 byte sequence encoding less than U+0800 */
+#    define UTF8_TOO_LARGE      (1 << 3) /* codepoint above U+10FFFF */
+#    define UTF8_SURROGATE      (1 << 4) /* codepoint between U+D800 and U+DFFF */
+#    define UTF8_OVERLONG_2     (1 << 5) /* 2 byte sequence encoding less than U+0080 */
+#    define UTF8_TOO_LARGE_1000 (1 << 6) /* codepoint at or above U+110000 */
+#    define UTF8_OVERLONG_4     (1 << 6) /* 4 byte sequence encoding less than U+10000 */
+#    define UTF8_TWO_CONTS      (1 << 7) /* two continuations in a row */
+#    define UTF8_CARRY          (UTF8_TOO_SHORT | UTF8_TOO_LONG | UTF8_TWO_CONTS)
+
+/**
+ * @b Find errors in a block of 32 bytes, that can only be seen by looking at
+ * previous 3 bytes too, which come from end of previous block for first bytes.
+ *
+ * @return Non-zero bytes where there's an error.
+ * */
+__attribute__ ((target ("avx2"))) static inline __m256i
+    utf8_check_block_avx2 (__m256i input, __m256i prev_input) {
+    /* clang-format off */
+    const __m256i byte_1_high_table = _mm256_setr_epi8 (
+        UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG,
+        UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG,
+        UTF8_TWO_CONTS, UTF8_TWO_CONTS, UTF8_TWO_CONTS, UTF8_TWO_CONTS,
+        UTF8_TOO_SHORT | UTF8_OVERLONG_2,
+        UTF8_TOO_SHORT,
+        UTF8_TOO_SHORT | UTF8_OVERLONG_3 | UTF8_SURROGATE,
+        UTF8_TOO_SHORT | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000 | UTF8_OVERLONG_4,
+        UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG,
+        UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG,
+        UTF8_TWO_CONTS, UTF8_TWO_CONTS, UTF8_TWO_CONTS, UTF8_TWO_CONTS,
+        UTF8_TOO_SHORT | UTF8_OVERLONG_2,
+        UTF8_TOO_SHORT,
+        UTF8_TOO_SHORT | UTF8_OVERLONG_3 | UTF8_SURROGATE,
+        UTF8_TOO_SHORT | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000 | UTF8_OVERLONG_4
+    );
+    const __m256i byte_1_low_table = _mm256_setr_epi8 (
+        UTF8_CARRY | UTF8_OVERLONG_3 | UTF8_OVERLONG_2 | UTF8_OVERLONG_4,
+        UTF8_CARRY | UTF8_OVERLONG_2,
+        UTF8_CARRY,
+        UTF8_CARRY,
+        UTF8_CARRY | UTF8_TOO_LARGE,
+        UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+        UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+        UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+        UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+        UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+        UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+        UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+        UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+        UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000 | UTF8_SURROGATE,
+        UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+        UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+        UTF8_CARRY | UTF8_OVERLONG_3 | UTF8_OVERLONG_2 | UTF8_OVERLONG_4,
+        UTF8_CARRY | UTF8_OVERLONG_2,
+        UTF8_CARRY,
+        UTF8_CARRY,
+        UTF8_CARRY | UTF8_TOO_LARGE,
+        UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+        UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+        UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+        UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+        UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+        UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+        UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+        UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+        UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000 | UTF8_SURROGATE,
+        UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+        UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000
+    );
+    const __m256i byte_2_high_table = _mm256_setr_epi8 (
+        UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT,
+        UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT,
+        UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS | UTF8_OVERLONG_3 |
+            UTF8_TOO_LARGE_1000 | UTF8_OVERLONG_4,
+        UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS | UTF8_OVERLONG_3 | UTF8_TOO_LARGE,
+        UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS | UTF8_SURROGATE | UTF8_TOO_LARGE,
+        UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS | UTF8_SURROGATE | UTF8_TOO_LARGE,
+        UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT,
+        UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT,
+        UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT,
+        UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS | UTF8_OVERLONG_3 |
+            UTF8_TOO_LARGE_1000 | UTF8_OVERLONG_4,
+        UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS | UTF8_OVERLONG_3 | UTF8_TOO_LARGE,
+        UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS | UTF8_SURROGATE | UTF8_TOO_LARGE,
+        UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS | UTF8_SURROGATE | UTF8_TOO_LARGE,
+        UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT
+    );
+    /* clang-format on */
+
+    __m256i nibble = _mm256_set1_epi8 (0x0f);
+
+    /* previous 1, 2 and 3 bytes of each byte, crossing 128 bit lanes and blocks */
+    __m256i prev_lanes = _mm256_permute2x128_si256 (prev_input, input, 0x21);
+    __m256i prev1      = _mm256_alignr_epi8 (input, prev_lanes, 15);
+    __m256i prev2      = _mm256_alignr_epi8 (input, prev_lanes, 14);
+    __m256i prev3      = _mm256_alignr_epi8 (input, prev_lanes, 13);
+
+    __m256i byte_1_high = _mm256_shuffle_epi8 (
+        byte_1_high_table,
+        _mm256_and_si256 (_mm256_srli_epi16 (prev1, 4), nibble)
+    );
+    __m256i byte_1_low  = _mm256_shuffle_epi8 (byte_1_low_table, _mm256_and_si256 (prev1, nibble));
+    __m256i byte_2_high = _mm256_shuffle_epi8 (
+        byte_2_high_table,
+        _mm256_and_si256 (_mm256_srli_epi16 (input, 4), nibble)
+    );
+    __m256i special = _mm256_and_si256 (_mm256_and_si256 (byte_1_high, byte_1_low), byte_2_high);
+
+    /* third and fourth bytes of 3 and 4 byte sequences must be continuations,
+     * which look like TWO_CONTS errors above, so both must agree */
+    __m256i is_third  = _mm256_subs_epu8 (prev2, _mm256_set1_epi8 (0xe0 - 0x80));
+    __m256i is_fourth = _mm256_subs_epu8 (prev3, _mm256_set1_epi8 ((Int8)(0xf0 - 0x80)));
+    __m256i must_cont = _mm256_and_si256 (
+        _mm256_or_si256 (is_third, is_fourth),
+        _mm256_set1_epi8 ((Int8)0x80)
+    );
+
+    return _mm256_xor_si256 (must_cont, special);
+}
+
+__attribute__ ((target ("avx2"))) static Bool utf8_validate_avx2 (const Uint8 *bytes, Size length) {
+    __m256i error      = _mm256_setzero_si256();
+    __m256i prev_input = _mm256_setzero_si256();
+
+    Size pos = 0;
+    for (; pos + 32 <= length; pos += 32) {
+        __m256i input = _mm256_loadu_si256 ((const __m256i *)(bytes + pos));
+
+        /* ASCII block can only be wrong if previous block ended in a truncated sequence */
+        if (!_mm256_movemask_epi8 (input) && !_mm256_movemask_epi8 (prev_input)) {
+            prev_input = input;
+            continue;
+        }
+
+        error      = _mm256_or_si256 (error, utf8_check_block_avx2 (input, prev_input));
+        prev_input = input;
+    }
+
+    /* zero padding of last block also catches a sequence truncated by end of text */
+    Uint8 tail[32] = {0};
+    memcpy (tail, bytes + pos, length - pos);
+    __m256i input = _mm256_loadu_si256 ((const __m256i *)tail);
+    error         = _mm256_or_si256 (error, utf8_check_block_avx2 (input, prev_input));
+
+    return !!_mm256_testz_si256 (error, error);
+}
+
+__attribute__ ((target ("avx2"))) static Size
+    utf8_decode_avx2 (Uint32 *codepoints, const Uint8 *bytes, Size length) {
+    Size count = 0;
+    Size pos   = 0;
+
+    while (pos + 32 <= length) {
+        __m256i v    = _mm256_loadu_si256 ((const __m256i *)(bytes + pos));
+        Uint32  mask = _mm256_movemask_epi8 (v);
+
+        /* whole block is ASCII, zero extend bytes to codepoints, 8 at a time */
+        if (!mask) {
+            for (Size e = 0; e < 32; e += 8) {
+                __m128i eight = _mm_loadl_epi64 ((const __m128i *)(bytes + pos + e));
+                _mm256_storeu_si256 (
+                    (__m256i *)(codepoints + count + e),
+                    _mm256_cvtepu8_epi32 (eight)
+                );
+            }
+            count += 32;
+            pos   += 32;
+            continue;
+        }
+
+        /* copy ASCII prefix of block, and decode first sequence after it */
+        for (Uint32 a = __builtin_ctz (mask); a; a--) {
+            codepoints[count++] = bytes[pos++];
+        }
+        codepoints[count++] = utf8_decode_one (bytes + pos, length - pos, &pos);
+    }
+
+    return count + utf8_decode_sse2 (codepoints + count, bytes + pos, length - pos);
+}
+
+#endif // UNICODE_HAVE_X86
@@ -6,88 +6,134 @@
 #include <memory.h>
 
 /**
- * @b Allocate memory for dynamic array (aka vector).
+ * @b Compute capacity a vector must grow to, to be able to store @c required entries.
  *
- * @param entry_size Size of each entry in the vector.
- * @param entry_count Total number of entries to allocate space for.
- * @param capacity Pointer to @c Size variable where vector capacity will be stored.
+ * Capacity is always rounded up to a power of two, with a minimum of 4, so that
+ * a series of single element insertions cost amortized constant time.
  *
- * @return Pointer to new vector data on success.
- * @return @c Null otherwise.
+ * @param capacity Current capacity of vector.
+ * @param required Number of entries vector must be able to hold.
+ *
+ * @return New capacity, never less than @c capacity.
  * */
-void *vector_create (Size entry_size, Size entry_count, Size *capacity) {
-    RETURN_VALUE_IF (!entry_size || !capacity, Null, ERR_INVALID_ARGUMENTS);
-
-    /* default cap to 4 */
-    Size cap = entry_count ? entry_count : 4;
-
-    void *vec = calloc (entry_size, cap);
-    RETURN_VALUE_IF (!vec, Null, ERR_OUT_OF_MEMORY);
+Size vector_grow_capacity (Size capacity, Size required) {
+    if (required <= capacity) {
+        return capacity;
+    }
 
-    /* store cap */
-    *capacity = cap;
+    if (required <= 4) {
+        return 4;
+    }
 
-    return vec;
+    /* next power of two */
+    return (Size)1 << (sizeof (Size) * 8 - __builtin_clzl (required - 1));
 }
 
 /**
- * @b Destroy given vector memory region.
+ * @b Make sure given vector storage can hold at least @c required entries.
+ *
+ * Newly reserved memory is not initialized. When required capacity fits in
+ * inline storage, no memory is allocated at all. When vector moves from inline
+ * storage to heap storage, first @c count entries are copied over.
  *
- * @param vec Vector to be freed.
+ * @param heap Pointer to heap storage of vector. Updated on reallocation.
+ * @param capacity Pointer to capacity of vector. Updated on success.
+ * @param count Number of entries currently in use.
+ * @param inline_data Inline storage of vector. Can be @c Null if @c inline_capacity is zero.
+ * @param inline_capacity Number of entries that fit in @c inline_data.
+ * @param entry_size Size of each entry in vector.
+ * @param required Minimum number of entries vector must be able to hold.
+ * @param tag Subsystem vector memory is accounted to.
+ *
+ * @return @c True on success.
+ * @return @c False otherwise.
  * */
-void vector_destroy (void *vec) {
-    RETURN_IF (!vec, ERR_INVALID_ARGUMENTS);
+Bool vector_reserve (
+    void       **heap,
+    Size        *capacity,
+    Size         count,
+    void        *inline_data,
+    Size         inline_capacity,
+    Size         entry_size,
+    Size         required,
+    AllocatorTag tag
+) {
+    RETURN_VALUE_IF (!heap || !capacity || !entry_size, False, ERR_INVALID_ARGUMENTS);
+
+    /* inline storage is always available */
+    if (!*heap && *capacity < inline_capacity) {
+        *capacity = inline_capacity;
+    }
 
-    FREE (vec);
+    if (required <= *capacity) {
+        return True;
+    }
+
+    RETURN_VALUE_IF (required > SIZE_MAX / entry_size, False, ERR_OUT_OF_MEMORY);
+
+    void *mem = allocator_realloc (*heap, entry_size * required, tag);
+    RETURN_VALUE_IF (!mem, False, ERR_OUT_OF_MEMORY);
+
+    /* moving from inline storage to heap */
+    if (!*heap && count) {
+        memcpy (mem, inline_data, entry_size * count);
+    }
+
+    *heap     = mem;
+    *capacity = required;
+
+    return True;
 }
 
 /**
- * @b Resize given vector memory region.
+ * @b Release memory not being used by entries of given vector storage.
  *
- * Old count and new count is required to memset the new allocated
- * region to 0. This memset operation can be skipped by setting
- * @c old_count = @c new_count.
+ * If entries fit in inline storage, heap memory is released completely.
  *
- * @param vec Pointer to vector memory region to be resized.
+ * @param heap Pointer to heap storage of vector. Updated on reallocation.
+ * @param capacity Pointer to capacity of vector. Updated on success.
+ * @param count Number of entries currently in use.
+ * @param inline_data Inline storage of vector. Can be @c Null if @c inline_capacity is zero.
+ * @param inline_capacity Number of entries that fit in @c inline_data.
  * @param entry_size Size of each entry in vector.
- * @param old_count Previous number of elements in vector.
- * @param new_count Number of elements new vector must hold. 
- * @param old_capacity Old capacity of given vector.
- * @param new_capacity Pointer to @c Size variable, where new capacity of
- *        vector will be stored. This value is not read from but only stored into.
+ * @param tag Subsystem vector memory is accounted to.
  *
- * @return Pointer to new vector memory region if reallocated,
- *         otherwise @c vec will be returned.
- * @return @c Null otherwise. This includes resize failure.
+ * @return @c True on success.
+ * @return @c False otherwise.
  * */
-void *vector_resize (
-    void *vec,
-    Size  entry_size,
-    Size  old_count,
-    Size  new_count,
-    Size  old_capacity,
-    Size *new_capacity
+Bool vector_shrink_to_fit (
+    void       **heap,
+    Size        *capacity,
+    Size         count,
+    void        *inline_data,
+    Size         inline_capacity,
+    Size         entry_size,
+    AllocatorTag tag
 ) {
-    RETURN_VALUE_IF (!entry_size || !new_count || !new_capacity, Null, ERR_INVALID_ARGUMENTS);
+    RETURN_VALUE_IF (!heap || !capacity || !entry_size, False, ERR_INVALID_ARGUMENTS);
 
-    if (new_count == old_count) {
-        return vec;
+    if (!*heap || count == *capacity) {
+        return True;
     }
 
-    /* by default, new capacty will be 4 */
-    Size new_cap = old_capacity ? old_capacity : 4;
-    while (new_cap < new_count) {
-        new_cap *= 2;
-    }
+    /* move back to inline storage */
+    if (count <= inline_capacity) {
+        if (count) {
+            memcpy (inline_data, *heap, entry_size * count);
+        }
 
-    vec = realloc (vec, entry_size * new_cap);
-    RETURN_VALUE_IF (!vec, Null, ERR_OUT_OF_MEMORY);
+        allocator_free (*heap);
+        *heap     = Null;
+        *capacity = inline_capacity;
+
+        return True;
+    }
 
-    /* zero-out new memory region */
-    memset (vec + entry_size * old_count, 0, entry_size * (new_cap - old_count));
+    void *mem = allocator_realloc (*heap, entry_size * count, tag);
+    RETURN_VALUE_IF (!mem, False, ERR_OUT_OF_MEMORY);
 
-    /* store new capacity */
-    *new_capacity = new_cap;
+    *heap     = mem;
+    *capacity = count;
 
-    return vec;
+    return True;
 }
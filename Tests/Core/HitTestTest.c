@@ -0,0 +1,338 @@
+/**
+ * @file HitTestTest.c
+ * @date Sun, 18th October 2026
+ * @author Siddharth Mishra (admin@brightprogrammer.in)
+ * @copyright Copyright 2024 Siddharth Mishra
+ * @copyright Copyright 2024 Anvie Labs
+ *
+ * Copyright 2024 Siddharth Mishra, Anvie Labs
+ * 
+ * Redistribution and use in source and binary forms, with or without modification, are permitted 
+ * provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+ *    and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions
+ *    and the following disclaimer in the documentation and/or other materials provided with the
+ *    distribution.
+ * 
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse
+ *    or promote products derived from this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND 
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * */
+
+/**
+ * @b Tests for hit testing of widget tree, queries through spatial index must
+ * find exactly what a scan of all widgets does, in same order.
+ * */
+
+#include <Anvie/Common.h>
+#include <Anvie/Types.h>
+
+/* crossgui-core */
+#include <Anvie/CrossGui/Core/HitTest.h>
+#include <Anvie/CrossGui/Core/WidgetTree.h>
+
+/* crossgui-utils */
+#include <Anvie/CrossGui/Utils/Allocator.h>
+
+/* libc */
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/* local includes */
+#include "../Utils/Test.h"
+
+#define PANEL_COLUMNS   20
+#define PANEL_ROWS      10
+#define CELL_COLUMNS    40
+#define CELL_ROWS       25
+#define CELL_SIZE       5.f
+#define PANEL_WIDTH     (CELL_COLUMNS * CELL_SIZE)
+#define PANEL_HEIGHT    (CELL_ROWS * CELL_SIZE)
+#define WORLD_WIDTH     (PANEL_COLUMNS * PANEL_WIDTH)
+#define WORLD_HEIGHT    (PANEL_ROWS * PANEL_HEIGHT)
+#define POINT_QUERIES   1000
+#define RECT_QUERIES    50
+#define TIMED_QUERIES   100000
+#define MAX_HITS        16
+
+static Size test_failures = 0;
+
+static XuiSlot2D fake_slot_create_2d (XuiGraphicsContext *gctx) {
+    static XuiSlot2D next = 0;
+    (void)gctx;
+    return ++next;
+}
+
+static Bool
+    fake_slot_update_2d (XuiGraphicsContext *gctx, XuiSlot2D slot, XuiSlotContent2D *content) {
+    (void)gctx, (void)slot, (void)content;
+    return True;
+}
+
+static Bool fake_slot_destroy_2d (XuiGraphicsContext *gctx, XuiSlot2D slot) {
+    (void)gctx, (void)slot;
+    return True;
+}
+
+static XuiGraphicsPlugin fake_plugin = {
+    .slot_create_2d  = fake_slot_create_2d,
+    .slot_update_2d  = fake_slot_update_2d,
+    .slot_destroy_2d = fake_slot_destroy_2d,
+};
+
+static Uint64 rng_state = 0x2545f4914f6cdd1dull;
+
+static Float32 random_float (Float32 max) {
+    rng_state = rng_state * 6364136223846793005ull + 1442695040888963407ull;
+    return (Float32)(rng_state >> 40) / (Float32)(1 << 24) * max;
+}
+
+static Vec2f vec2 (Float32 x, Float32 y) {
+    return (Vec2f) {.x = x, .y = y};
+}
+
+static Float64 now_us() {
+    struct timespec ts;
+    clock_gettime (CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+}
+
+static int compare_descending (const void *a, const void *b) {
+    Uint64 x = *(const Uint64 *)a;
+    Uint64 y = *(const Uint64 *)b;
+    return (x < y) - (x > y);
+}
+
+/**
+ * @b Find widgets matching a query by scanning all of them, topmost first.
+ *
+ * @return Number of widgets found.
+ * */
+static Size scan (XuiWidgetTree *tree, Vec2f min, Vec2f max, Int32 mode, Uint64 *keys) {
+    Size count = 0;
+    for (XuiWidgetId id = 1; id <= tree->widgets.count; id++) {
+        XuiWidget *w = xui_widget_get (tree, id);
+        if (!w || !w->is_drawn || !(w->world_size.x > 0) || !(w->world_size.y > 0)) {
+            continue;
+        }
+
+        Vec2f wmin = w->world_position;
+        Vec2f wmax = vec2 (wmin.x + w->world_size.x, wmin.y + w->world_size.y);
+
+        Bool is_match;
+        if (mode == 0) {
+            is_match = wmin.x <= min.x && min.x < wmax.x && wmin.y <= min.y && min.y < wmax.y;
+        } else if (mode == 1) {
+            is_match = wmin.x <= max.x && min.x <= wmax.x && wmin.y <= max.y && min.y <= wmax.y;
+        } else {
+            is_match = min.x <= wmin.x && wmax.x <= max.x && min.y <= wmin.y && wmax.y <= max.y;
+        }
+
+        if (is_match) {
+            keys[count++] = ((Uint64)w->depth << 32) | id;
+        }
+    }
+
+    qsort (keys, count, sizeof (Uint64), compare_descending);
+    return count;
+}
+
+/**
+ * @b Compare a query against a scan, mode 0 is a point, 1 overlapping and 2 inside a rectangle.
+ * */
+static void check_query (XuiWidgetTree *tree, Vec2f min, Vec2f max, Int32 mode) {
+    static Uint64 keys[PANEL_COLUMNS * PANEL_ROWS * (CELL_COLUMNS * CELL_ROWS + 1) + 16];
+    static XuiWidgetId hits[PANEL_COLUMNS * PANEL_ROWS * (CELL_COLUMNS * CELL_ROWS + 1) + 16];
+
+    Size expected = scan (tree, min, max, mode, keys);
+    Size found    = mode ? xui_widget_tree_query_rect (tree, min, max, mode == 2, hits, expected) :
+                           xui_widget_tree_query_point (tree, min, hits, expected);
+
+    TEST_CHECK (found == expected, "query found %zu widgets, scan %zu\n", found, expected);
+
+    Size mismatches = 0;
+    for (Size h = 0; h < MIN (found, expected); h++) {
+        mismatches += hits[h] != (XuiWidgetId)keys[h];
+    }
+    TEST_CHECK (!mismatches, "%zu widgets found out of order\n", mismatches);
+
+    if (!mode) {
+        XuiWidgetId top = xui_widget_tree_hit_test (tree, min);
+        TEST_CHECK (
+            top == (expected ? (XuiWidgetId)keys[0] : XUI_WIDGET_NONE),
+            "hit test at (%g, %g) found %u\n",
+            min.x,
+            min.y,
+            top
+        );
+    }
+}
+
+static void check_random_queries (XuiWidgetTree *tree) {
+    for (Size q = 0; q < POINT_QUERIES; q++) {
+        Vec2f point = vec2 (random_float (WORLD_WIDTH), random_float (WORLD_HEIGHT));
+        check_query (tree, point, point, 0);
+    }
+
+    /* corners of cells lie on shared edges */
+    for (Size q = 0; q < POINT_QUERIES; q++) {
+        Vec2f point = vec2 (
+            (Uint32)random_float (WORLD_WIDTH / CELL_SIZE) * CELL_SIZE,
+            (Uint32)random_float (WORLD_HEIGHT / CELL_SIZE) * CELL_SIZE
+        );
+        check_query (tree, point, point, 0);
+    }
+
+    for (Size q = 0; q < RECT_QUERIES; q++) {
+        Vec2f min = vec2 (random_float (WORLD_WIDTH), random_float (WORLD_HEIGHT));
+        Vec2f max = vec2 (min.x + random_float (400), min.y + random_float (300));
+        check_query (tree, min, max, 1);
+        check_query (tree, min, max, 2);
+    }
+}
+
+static void test_hit_test() {
+    XuiWidgetTree tree;
+    TEST_CHECK (xui_widget_tree_init (&tree, &fake_plugin, (XuiGraphicsContext *)&tree), "init\n");
+    xui_widget_set_bounds (&tree, tree.root, vec2 (0, 0), vec2 (WORLD_WIDTH, WORLD_HEIGHT));
+
+    XuiWidgetId panels[PANEL_COLUMNS * PANEL_ROWS];
+    for (Size p = 0; p < PANEL_COLUMNS * PANEL_ROWS; p++) {
+        panels[p] = xui_widget_create (&tree, tree.root);
+        xui_widget_set_bounds (
+            &tree,
+            panels[p],
+            vec2 ((p % PANEL_COLUMNS) * PANEL_WIDTH, (p / PANEL_COLUMNS) * PANEL_HEIGHT),
+            vec2 (PANEL_WIDTH, PANEL_HEIGHT)
+        );
+
+        for (Size c = 0; c < CELL_COLUMNS * CELL_ROWS; c++) {
+            XuiWidgetId cell = xui_widget_create (&tree, panels[p]);
+            xui_widget_set_bounds (
+                &tree,
+                cell,
+                vec2 ((c % CELL_COLUMNS) * CELL_SIZE, (c / CELL_COLUMNS) * CELL_SIZE),
+                vec2 (CELL_SIZE, CELL_SIZE)
+            );
+        }
+    }
+
+    /* a panel sized overlay over first panel, created last so it's above other panels */
+    XuiWidgetId overlay = xui_widget_create (&tree, tree.root);
+    xui_widget_set_bounds (&tree, overlay, vec2 (0, 0), vec2 (PANEL_WIDTH, PANEL_HEIGHT));
+
+    TEST_CHECK (xui_widget_tree_update (&tree), "update\n");
+    TEST_CHECK (
+        tree.spatial.leaf_count == tree.widgets.count,
+        "%u of %zu widgets indexed\n",
+        tree.spatial.leaf_count,
+        (Size)tree.widgets.count
+    );
+
+    /* events bubble from cell to overlay, to panel it covers, to root */
+    XuiWidgetId hits[MAX_HITS];
+    Size        count = xui_widget_tree_query_point (&tree, vec2 (1, 1), hits, MAX_HITS);
+    TEST_CHECK (
+        count == 4 && hits[1] == overlay && hits[2] == panels[0] && hits[3] == tree.root,
+        "wrong widgets under first cell\n"
+    );
+    TEST_CHECK (
+        xui_widget_tree_hit_test (&tree, vec2 (-1, -1)) == XUI_WIDGET_NONE,
+        "hit outside of window\n"
+    );
+
+    check_random_queries (&tree);
+
+    /* hiding, moving and destroying take effect after update */
+    XuiWidgetId hidden = panels[PANEL_COLUMNS + 1];
+    XuiWidgetId moved  = panels[2];
+    xui_widget_set_visible (&tree, hidden, False);
+    xui_widget_set_bounds (
+        &tree,
+        moved,
+        vec2 (PANEL_WIDTH * 3.5f, PANEL_HEIGHT * 0.5f),
+        vec2 (PANEL_WIDTH, PANEL_HEIGHT)
+    );
+    xui_widget_destroy (&tree, panels[3]);
+    TEST_CHECK (xui_widget_tree_update (&tree), "update\n");
+
+    TEST_CHECK (
+        xui_widget_tree_hit_test (&tree, vec2 (PANEL_WIDTH * 1.5f, PANEL_HEIGHT * 1.5f)) ==
+            tree.root,
+        "hidden panel was hit\n"
+    );
+    /* moved panel now covers where destroyed one was */
+    XuiWidgetId top = xui_widget_tree_hit_test (&tree, vec2 (PANEL_WIDTH * 3.6f, PANEL_HEIGHT / 2));
+    TEST_CHECK (
+        top && xui_widget_get (&tree, top)->parent == moved,
+        "moved panel was not hit at it's new position\n"
+    );
+
+    /* resizing takes effect after update too, until then what's drawn is hit */
+    Vec2f outside = vec2 (PANEL_WIDTH * 0.75f, 1);
+    xui_widget_set_bounds (&tree, overlay, vec2 (0, 0), vec2 (PANEL_WIDTH / 2, PANEL_HEIGHT));
+    count = xui_widget_tree_query_point (&tree, outside, hits, MAX_HITS);
+    TEST_CHECK (count == 4 && hits[1] == overlay, "shrunk overlay was not hit before update\n");
+    check_random_queries (&tree);
+
+    TEST_CHECK (xui_widget_tree_update (&tree), "update\n");
+    count = xui_widget_tree_query_point (&tree, outside, hits, MAX_HITS);
+    TEST_CHECK (
+        count == 3 && hits[1] == panels[0] && hits[2] == tree.root,
+        "shrunk overlay was hit after update\n"
+    );
+
+    check_random_queries (&tree);
+
+    /* pointer moving at 1000 Hz must cost a tiny fraction of a millisecond */
+    Float64 start = now_us();
+    Size    found = 0;
+    for (Size q = 0; q < TIMED_QUERIES; q++) {
+        found += !!xui_widget_tree_hit_test (
+            &tree,
+            vec2 (random_float (WORLD_WIDTH), random_float (WORLD_HEIGHT))
+        );
+    }
+    Float64 per_query = (now_us() - start) / TIMED_QUERIES;
+    TEST_CHECK (found == TIMED_QUERIES, "%zu hit tests found something\n", found);
+    TEST_CHECK (per_query < 100, "hit test took %.2f us\n", per_query);
+
+    printf (
+        "%zu widgets, index height %d : %.2f us per hit test\n",
+        (Size)tree.widgets.count,
+        aabb_tree_get_height (&tree.spatial),
+        per_query
+    );
+
+    TEST_CHECK (xui_widget_tree_deinit (&tree), "deinit\n");
+}
+
+int main() {
+    test_hit_test();
+
+    AllocatorStats stats = {0};
+    allocator_get_stats (ALLOCATOR_TAG_WIDGETS, &stats);
+    TEST_CHECK (!stats.live_allocations, "widget tree leaked memory\n");
+    allocator_get_stats (ALLOCATOR_TAG_SPATIAL, &stats);
+    TEST_CHECK (!stats.live_allocations, "spatial index leaked memory\n");
+
+    if (test_failures) {
+        fprintf (stderr, "%zu checks failed\n", test_failures);
+        return EXIT_FAILURE;
+    }
+
+    printf ("all hit test checks passed\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,515 @@
+/**
+ * @file LayoutTest.c
+ * @date Sun, 18th October 2026
+ * @author Siddharth Mishra (admin@brightprogrammer.in)
+ * @copyright Copyright 2024 Siddharth Mishra
+ * @copyright Copyright 2024 Anvie Labs
+ *
+ * Copyright 2024 Siddharth Mishra, Anvie Labs
+ * 
+ * Redistribution and use in source and binary forms, with or without modification, are permitted 
+ * provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+ *    and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions
+ *    and the following disclaimer in the documentation and/or other materials provided with the
+ *    distribution.
+ * 
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse
+ *    or promote products derived from this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND 
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * */
+
+/**
+ * @b Tests for flex layout of widget tree, and how much of it is redone after a change.
+ *
+ * Slots are given by a fake graphics plugin that draws nothing, since only
+ * bounds of widgets and counters of tree are checked here.
+ * */
+
+#include <Anvie/Common.h>
+#include <Anvie/Types.h>
+
+/* crossgui-core */
+#include <Anvie/CrossGui/Core/Layout.h>
+#include <Anvie/CrossGui/Core/WidgetTree.h>
+
+/* crossgui-utils */
+#include <Anvie/CrossGui/Utils/Allocator.h>
+
+/* libc */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* local includes */
+#include "../Utils/Test.h"
+
+#define ROW_COUNT       100
+#define LABELS_PER_ROW  199
+#define GLYPH_WIDTH     8.f
+#define LINE_HEIGHT     16.f
+#define WINDOW_WIDTH    1920.f
+#define WINDOW_HEIGHT   1080.f
+#define PANEL_ROWS      8
+#define PANELS_PER_ROW  8
+#define LINES_PER_PANEL 30
+#define LABELS_PER_LINE 10
+#define THREAD_COUNT    4
+
+static Size test_failures = 0;
+
+/**
+ * @b Width of a glyph, changed by a theme change.
+ * */
+static Float32 glyph_width = GLYPH_WIDTH;
+
+static XuiSlot2D fake_slot_create_2d (XuiGraphicsContext *gctx) {
+    static XuiSlot2D next = 0;
+    (void)gctx;
+    return ++next;
+}
+
+static Bool
+    fake_slot_update_2d (XuiGraphicsContext *gctx, XuiSlot2D slot, XuiSlotContent2D *content) {
+    (void)gctx, (void)slot, (void)content;
+    return True;
+}
+
+static Bool fake_slot_destroy_2d (XuiGraphicsContext *gctx, XuiSlot2D slot) {
+    (void)gctx, (void)slot;
+    return True;
+}
+
+static XuiGraphicsPlugin fake_plugin = {
+    .slot_create_2d  = fake_slot_create_2d,
+    .slot_update_2d  = fake_slot_update_2d,
+    .slot_destroy_2d = fake_slot_destroy_2d,
+};
+
+static Uint64 live_allocations() {
+    AllocatorStats stats = {0};
+    allocator_get_stats (ALLOCATOR_TAG_WIDGETS, &stats);
+    return stats.live_allocations;
+}
+
+static Vec2f vec2 (Float32 x, Float32 y) {
+    return (Vec2f) {.x = x, .y = y};
+}
+
+static Float64 now_us() {
+    struct timespec ts;
+    clock_gettime (CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+}
+
+/**
+ * @b Measure a label, whose data is number of glyphs in it's text.
+ *
+ * Text wraps to fit available width, like text layout does.
+ * */
+static Vec2f measure_label (XuiWidgetTree *tree, XuiWidgetId id, Vec2f available, void *data) {
+    (void)tree, (void)id;
+
+    Float32 width = *(Uint32 *)data * glyph_width;
+    if (width <= available.x) {
+        return vec2 (width, LINE_HEIGHT);
+    }
+
+    Uint32 glyphs_per_line = MAX ((Uint32)(available.x / glyph_width), 1);
+    Uint32 lines           = (*(Uint32 *)data + glyphs_per_line - 1) / glyphs_per_line;
+    return vec2 (glyphs_per_line * glyph_width, lines * LINE_HEIGHT);
+}
+
+static XuiWidgetId add_widget (XuiWidgetTree *tree, XuiWidgetId parent, XuiWidgetLayout layout) {
+    XuiWidgetId id = xui_widget_create (tree, parent);
+    TEST_CHECK (id && xui_widget_set_layout (tree, id, &layout), "failed to add widget\n");
+    return id;
+}
+
+static void check_bounds (
+    XuiWidgetTree *tree,
+    XuiWidgetId    id,
+    Float32        x,
+    Float32        y,
+    Float32        w,
+    Float32        h
+) {
+    XuiWidget *widget = xui_widget_get (tree, id);
+    TEST_CHECK (
+        widget->world_position.x == x && widget->world_position.y == y && widget->size.x == w &&
+            widget->size.y == h,
+        "widget %u at (%g, %g) of size (%g, %g), expected (%g, %g) of size (%g, %g)\n",
+        id,
+        widget->world_position.x,
+        widget->world_position.y,
+        widget->size.x,
+        widget->size.y,
+        x,
+        y,
+        w,
+        h
+    );
+}
+
+/**
+ * @b Panels of demo application: a fixed sidebar, a growing column split in
+ * two, and a narrow toolbar, with padding, gaps and margins.
+ * */
+static void test_flex() {
+    XuiWidgetTree tree;
+    TEST_CHECK (xui_widget_tree_init (&tree, &fake_plugin, (XuiGraphicsContext *)&tree), "init\n");
+
+    XuiWidgetLayout root_layout = {
+        .direction = XUI_LAYOUT_DIRECTION_ROW,
+        .padding   = {.x = 10, .y = 10, .z = 10, .w = 10},
+        .gap       = 10
+    };
+    TEST_CHECK (xui_widget_set_layout (&tree, tree.root, &root_layout), "root layout\n");
+
+    XuiWidgetId left  = add_widget (&tree, tree.root, (XuiWidgetLayout) {.size = {.x = 100}});
+    XuiWidgetId right = add_widget (
+        &tree,
+        tree.root,
+        (XuiWidgetLayout) {.direction = XUI_LAYOUT_DIRECTION_COLUMN, .grow = 1, .gap = 10}
+    );
+    XuiWidgetId top    = add_widget (&tree, right, (XuiWidgetLayout) {.grow = 1});
+    XuiWidgetId bottom = add_widget (&tree, right, (XuiWidgetLayout) {.grow = 2});
+    XuiWidgetId tools  = add_widget (
+        &tree,
+        tree.root,
+        (XuiWidgetLayout) {
+            .size   = {.x = 40},
+            .margin = {.y = 20, .w = 20}
+    }
+    );
+
+    TEST_CHECK (xui_widget_tree_layout (&tree, vec2 (400, 330)), "layout\n");
+    TEST_CHECK (xui_widget_tree_update (&tree), "update\n");
+
+    check_bounds (&tree, left, 10, 10, 100, 310);
+    check_bounds (&tree, right, 120, 10, 220, 310);
+    check_bounds (&tree, top, 120, 10, 220, 100);
+    check_bounds (&tree, bottom, 120, 120, 220, 200);
+    check_bounds (&tree, tools, 350, 30, 40, 270);
+
+    /* fixed children overflowing their parent are shrunk in proportion to their size */
+    XuiWidgetLayout shrink = {.size = {.x = 0}, .shrink = 1};
+    root_layout.direction  = XUI_LAYOUT_DIRECTION_COLUMN;
+    root_layout.align      = XUI_LAYOUT_ALIGN_CENTER;
+    root_layout.justify    = XUI_LAYOUT_JUSTIFY_END;
+    TEST_CHECK (xui_widget_set_layout (&tree, tree.root, &root_layout), "root layout\n");
+    TEST_CHECK (xui_widget_destroy (&tree, right), "destroy\n");
+
+    Uint32 text[2] = {10, 30};
+    shrink.margin  = (Vec4f) {0};
+    TEST_CHECK (xui_widget_set_layout (&tree, left, &shrink), "left layout\n");
+    TEST_CHECK (xui_widget_set_layout (&tree, tools, &shrink), "tools layout\n");
+    TEST_CHECK (xui_widget_set_measure (&tree, left, measure_label, text), "left measure\n");
+    TEST_CHECK (xui_widget_set_measure (&tree, tools, measure_label, text + 1), "tools measure\n");
+
+    TEST_CHECK (xui_widget_tree_layout (&tree, vec2 (300, 200)), "layout\n");
+    TEST_CHECK (xui_widget_tree_update (&tree), "update\n");
+
+    /* labels are centered across, and pushed to bottom since they fit along column */
+    check_bounds (&tree, left, 110, 148, 80, 16);
+    check_bounds (&tree, tools, 30, 174, 240, 16);
+
+    /* narrow window wraps the long label, making column overflow, which is taken from both */
+    TEST_CHECK (xui_widget_tree_layout (&tree, vec2 (100, 50)), "layout\n");
+    TEST_CHECK (xui_widget_tree_update (&tree), "update\n");
+
+    XuiWidget *a = xui_widget_get (&tree, left);
+    XuiWidget *b = xui_widget_get (&tree, tools);
+    TEST_CHECK (a->size.x == 80 && b->size.x == 80, "labels not wrapped to 80\n");
+    TEST_CHECK (
+        fabsf (a->size.y + 10 + b->size.y - 30) < 1e-4f && b->size.y > a->size.y,
+        "column of height %g + %g does not fit in 30\n",
+        a->size.y,
+        b->size.y
+    );
+
+    TEST_CHECK (xui_widget_tree_deinit (&tree), "deinit\n");
+}
+
+/**
+ * @b Rows of labels, where one label changes, and then window is resized.
+ * */
+static void test_incremental() {
+    static Uint32 text[ROW_COUNT][LABELS_PER_ROW];
+    XuiWidgetTree tree;
+    TEST_CHECK (xui_widget_tree_init (&tree, &fake_plugin, (XuiGraphicsContext *)&tree), "init\n");
+
+    TEST_CHECK (
+        xui_widget_set_layout (
+            &tree,
+            tree.root,
+            &(XuiWidgetLayout) {.direction = XUI_LAYOUT_DIRECTION_COLUMN, .gap = 2}
+        ),
+        "root layout\n"
+    );
+
+    XuiWidgetId labels[ROW_COUNT][LABELS_PER_ROW];
+    for (Size r = 0; r < ROW_COUNT; r++) {
+        XuiWidgetId row = add_widget (
+            &tree,
+            tree.root,
+            (XuiWidgetLayout) {
+                .direction = XUI_LAYOUT_DIRECTION_ROW,
+                .padding   = {.x = 4, .y = 1, .z = 4, .w = 1},
+                .gap       = 1
+        }
+        );
+
+        for (Size l = 0; l < LABELS_PER_ROW; l++) {
+            text[r][l]   = 1;
+            labels[r][l] = add_widget (&tree, row, (XuiWidgetLayout) {.shrink = 1});
+            TEST_CHECK (
+                xui_widget_set_measure (&tree, labels[r][l], measure_label, &text[r][l]) &&
+                    xui_widget_set_shape (&tree, labels[r][l], XUI_WIDGET_KIND_MESH, 0),
+                "set measure\n"
+            );
+        }
+    }
+
+    Size widget_count = 1 + ROW_COUNT * (1 + LABELS_PER_ROW);
+    TEST_CHECK (widget_count > 20000, "tree has only %zu widgets\n", widget_count);
+
+    Float64 start = now_us();
+    TEST_CHECK (xui_widget_tree_layout (&tree, vec2 (WINDOW_WIDTH, WINDOW_HEIGHT)), "layout\n");
+    Float64 full = now_us() - start;
+    TEST_CHECK (tree.laid_out == widget_count, "first layout visited %zu\n", (Size)tree.laid_out);
+    TEST_CHECK (xui_widget_tree_update (&tree), "update\n");
+
+    /* nothing changed */
+    TEST_CHECK (xui_widget_tree_layout (&tree, vec2 (WINDOW_WIDTH, WINDOW_HEIGHT)), "layout\n");
+    TEST_CHECK (
+        tree.laid_out == 0 && tree.measured == 0,
+        "idle layout visited %zu, measured %zu\n",
+        (Size)tree.laid_out,
+        (Size)tree.measured
+    );
+
+    /* one label changes: root, it's row and label itself are laid out, and only row and
+     * label are measured again (label once by row, once by it's own layout), siblings
+     * come from cache */
+    XuiWidgetId changed = labels[ROW_COUNT / 2][LABELS_PER_ROW / 2];
+    XuiWidgetId next    = labels[ROW_COUNT / 2][LABELS_PER_ROW / 2 + 1];
+    Float32     next_x  = xui_widget_get (&tree, next)->position.x;
+
+    text[ROW_COUNT / 2][LABELS_PER_ROW / 2] += 2;
+    start = now_us();
+    TEST_CHECK (xui_widget_invalidate_layout (&tree, changed), "invalidate\n");
+    TEST_CHECK (xui_widget_tree_layout (&tree, vec2 (WINDOW_WIDTH, WINDOW_HEIGHT)), "layout\n");
+    Float64 incremental = now_us() - start;
+    TEST_CHECK (
+        tree.laid_out == 3 && tree.measured == 3,
+        "label change laid out %zu, measured %zu\n",
+        (Size)tree.laid_out,
+        (Size)tree.measured
+    );
+    TEST_CHECK (
+        xui_widget_get (&tree, changed)->size.x == 3 * GLYPH_WIDTH,
+        "changed label not resized\n"
+    );
+    TEST_CHECK (
+        xui_widget_get (&tree, next)->position.x == next_x + 2 * GLYPH_WIDTH,
+        "next label not moved\n"
+    );
+
+    /* only label and it's siblings after it moved, so only they are emitted */
+    TEST_CHECK (xui_widget_tree_update (&tree), "update\n");
+    TEST_CHECK (
+        tree.emitted == LABELS_PER_ROW - LABELS_PER_ROW / 2,
+        "label change emitted %zu\n",
+        (Size)tree.emitted
+    );
+
+    /* resize lays out every widget once, and measures only rows, since labels are
+     * measured without a limit along row and find themselves in cache */
+    start = now_us();
+    TEST_CHECK (xui_widget_tree_layout (&tree, vec2 (WINDOW_WIDTH / 2, WINDOW_HEIGHT)), "layout\n");
+    Float64 resize = now_us() - start;
+    TEST_CHECK (tree.laid_out == widget_count, "resize laid out %zu\n", (Size)tree.laid_out);
+    TEST_CHECK (
+        tree.measured == ROW_COUNT,
+        "resize measured %zu of %zu widgets\n",
+        (Size)tree.measured,
+        widget_count
+    );
+
+    /* rows are wider than half window, so labels are shrunk */
+    XuiWidget *row  = xui_widget_get (&tree, xui_widget_get (&tree, changed)->parent);
+    XuiWidget *last = xui_widget_get (&tree, row->last_child);
+    TEST_CHECK (
+        fabsf (last->position.x + last->size.x + 4 - WINDOW_WIDTH / 2) < 0.5f,
+        "row overflows to %g\n",
+        last->position.x + last->size.x + 4
+    );
+
+    printf (
+        "%zu widgets : full layout %.1f us, one label %.1f us, resize %.1f us\n",
+        widget_count,
+        full,
+        incremental,
+        resize
+    );
+
+    TEST_CHECK (xui_widget_tree_deinit (&tree), "deinit\n");
+}
+
+/**
+ * @b Dashboard of fixed size panels full of wrapping labels, in rows of fixed
+ * size too, so panels are nested subtrees split off by jobs of rows.
+ * */
+static void build_dashboard (XuiWidgetTree *tree, Uint32 *text) {
+    TEST_CHECK (xui_widget_tree_init (tree, &fake_plugin, (XuiGraphicsContext *)tree), "init\n");
+    TEST_CHECK (
+        xui_widget_set_layout (
+            tree,
+            tree->root,
+            &(XuiWidgetLayout) {.direction = XUI_LAYOUT_DIRECTION_COLUMN, .gap = 4}
+        ),
+        "root layout\n"
+    );
+
+    for (Size r = 0; r < PANEL_ROWS; r++) {
+        XuiWidgetId row = add_widget (
+            tree,
+            tree->root,
+            (XuiWidgetLayout) {
+                .direction = XUI_LAYOUT_DIRECTION_ROW,
+                .justify   = XUI_LAYOUT_JUSTIFY_SPACE_BETWEEN,
+                .size      = {.x = WINDOW_WIDTH, .y = 128},
+                .grow      = 1
+        }
+        );
+
+        for (Size p = 0; p < PANELS_PER_ROW; p++) {
+            XuiWidgetId panel = add_widget (
+                tree,
+                row,
+                (XuiWidgetLayout) {
+                    .direction = XUI_LAYOUT_DIRECTION_COLUMN,
+                    .size      = {.x = 220, .y = 120},
+                    .padding   = {.x = 2, .y = 2, .z = 2, .w = 2}
+            }
+            );
+
+            for (Size l = 0; l < LINES_PER_PANEL; l++) {
+                XuiWidgetId line = add_widget (
+                    tree,
+                    panel,
+                    (XuiWidgetLayout) {.direction = XUI_LAYOUT_DIRECTION_ROW, .gap = 2}
+                );
+
+                for (Size g = 0; g < LABELS_PER_LINE; g++) {
+                    XuiWidgetId label = add_widget (tree, line, (XuiWidgetLayout) {.shrink = 1});
+                    TEST_CHECK (
+                        xui_widget_set_measure (tree, label, measure_label, text + g),
+                        "set measure\n"
+                    );
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @b Theme change of a dashboard, laid out on one thread and on a job system, must
+ * give exactly same bounds.
+ * */
+static void test_parallel() {
+    Uint32 text[LABELS_PER_LINE];
+    for (Size g = 0; g < LABELS_PER_LINE; g++) {
+        text[g] = 1 + g % 4;
+    }
+
+    JobSystem     jobs;
+    XuiWidgetTree serial;
+    XuiWidgetTree parallel;
+    TEST_CHECK (job_system_init (&jobs, THREAD_COUNT, True), "failed to create job system\n");
+    build_dashboard (&serial, text);
+    build_dashboard (&parallel, text);
+
+    Vec2f window = vec2 (WINDOW_WIDTH, WINDOW_HEIGHT);
+    TEST_CHECK (xui_widget_tree_layout (&serial, window), "layout\n");
+    TEST_CHECK (xui_widget_tree_layout_parallel (&parallel, window, &jobs), "parallel layout\n");
+
+    /* theme change makes every label measure again */
+    glyph_width = GLYPH_WIDTH * 1.5f;
+    for (XuiWidgetId id = 1; id <= serial.widgets.count; id++) {
+        if (xui_widget_get (&serial, id)->measure) {
+            xui_widget_invalidate_layout (&serial, id);
+            xui_widget_invalidate_layout (&parallel, id);
+        }
+    }
+
+    Float64 start = now_us();
+    TEST_CHECK (xui_widget_tree_layout (&serial, window), "layout\n");
+    Float64 serial_time = now_us() - start;
+
+    start = now_us();
+    TEST_CHECK (xui_widget_tree_layout_parallel (&parallel, window, &jobs), "parallel layout\n");
+    Float64 parallel_time = now_us() - start;
+
+    TEST_CHECK (
+        serial.laid_out == parallel.laid_out && serial.measured == parallel.measured,
+        "serial laid out %zu and measured %zu, parallel %zu and %zu\n",
+        (Size)serial.laid_out,
+        (Size)serial.measured,
+        (Size)parallel.laid_out,
+        (Size)parallel.measured
+    );
+
+    TEST_CHECK (xui_widget_tree_update (&serial) && xui_widget_tree_update (&parallel), "update\n");
+    TEST_CHECK (serial.emitted == parallel.emitted, "emitted counts differ\n");
+
+    Size mismatches = 0;
+    for (XuiWidgetId id = 1; id <= serial.widgets.count; id++) {
+        XuiWidget *a = xui_widget_get (&serial, id);
+        XuiWidget *b = xui_widget_get (&parallel, id);
+        mismatches  += memcmp (&a->world_position, &b->world_position, sizeof (Vec2f)) ||
+                      memcmp (&a->size, &b->size, sizeof (Vec2f));
+    }
+    TEST_CHECK (!mismatches, "%zu widgets laid out differently in parallel\n", mismatches);
+
+    printf (
+        "%zu widgets : theme change %.1f us serial, %.1f us on %u threads\n",
+        (Size)serial.widgets.count,
+        serial_time,
+        parallel_time,
+        THREAD_COUNT
+    );
+
+    glyph_width = GLYPH_WIDTH;
+    TEST_CHECK (xui_widget_tree_deinit (&serial) && xui_widget_tree_deinit (&parallel), "deinit\n");
+    TEST_CHECK (job_system_deinit (&jobs), "failed to destroy job system\n");
+}
+
+int main() {
+    test_flex();
+    test_incremental();
+    test_parallel();
+
+    TEST_CHECK (!live_allocations(), "%zu allocations leaked\n", (Size)live_allocations());
+
+    if (test_failures) {
+        fprintf (stderr, "%zu checks failed\n", test_failures);
+        return EXIT_FAILURE;
+    }
+
+    printf ("all layout checks passed\n");
+    return EXIT_SUCCESS;
+}
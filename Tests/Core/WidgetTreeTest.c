@@ -0,0 +1,290 @@
+/**
+ * @file WidgetTreeTest.c
+ * @date Sun, 18th October 2026
+ * @author Siddharth Mishra (admin@brightprogrammer.in)
+ * @copyright Copyright 2024 Siddharth Mishra
+ * @copyright Copyright 2024 Anvie Labs
+ *
+ * Copyright 2024 Siddharth Mishra, Anvie Labs
+ * 
+ * Redistribution and use in source and binary forms, with or without modification, are permitted 
+ * provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+ *    and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions
+ *    and the following disclaimer in the documentation and/or other materials provided with the
+ *    distribution.
+ * 
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse
+ *    or promote products derived from this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND 
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * */
+
+/**
+ * @b Tests for dirty propagation of retained widget tree.
+ *
+ * Tree is drawn through a fake graphics plugin that only remembers content
+ * of each slot, so that what tree emits can be compared with what it should
+ * draw, and counters of tree show how much work each update did.
+ * */
+
+#include <Anvie/Common.h>
+#include <Anvie/Types.h>
+
+/* crossgui-core */
+#include <Anvie/CrossGui/Core/WidgetTree.h>
+
+/* crossgui-utils */
+#include <Anvie/CrossGui/Utils/Allocator.h>
+
+/* libc */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* local includes */
+#include "../Utils/Test.h"
+
+#define PANEL_COUNT     10
+#define CELLS_PER_PANEL 100
+#define SLOT_MAX        2048
+#define MESH_TYPE_CELL  7
+
+static Size test_failures = 0;
+
+/**
+ * @b State of fake plugin, content of each slot and number of slots in use.
+ * */
+static struct {
+    XuiSlotContent2D contents[SLOT_MAX];
+    Bool             is_used[SLOT_MAX];
+    Size             live_slots;
+} fake;
+
+static XuiSlot2D fake_slot_create_2d (XuiGraphicsContext *gctx) {
+    (void)gctx;
+    for (XuiSlot2D s = 1; s < SLOT_MAX; s++) {
+        if (!fake.is_used[s]) {
+            fake.is_used[s]  = True;
+            fake.contents[s] = (XuiSlotContent2D) {.type = XUI_SLOT_TYPE_2D_NONE};
+            fake.live_slots++;
+            return s;
+        }
+    }
+    return 0;
+}
+
+static Bool
+    fake_slot_update_2d (XuiGraphicsContext *gctx, XuiSlot2D slot, XuiSlotContent2D *content) {
+    (void)gctx;
+    if (slot >= SLOT_MAX || !fake.is_used[slot]) {
+        return False;
+    }
+    fake.contents[slot] = *content;
+    return True;
+}
+
+static Bool fake_slot_destroy_2d (XuiGraphicsContext *gctx, XuiSlot2D slot) {
+    (void)gctx;
+    if (slot >= SLOT_MAX || !fake.is_used[slot]) {
+        return False;
+    }
+    fake.is_used[slot] = False;
+    fake.live_slots--;
+    return True;
+}
+
+static XuiGraphicsPlugin fake_plugin = {
+    .slot_create_2d  = fake_slot_create_2d,
+    .slot_update_2d  = fake_slot_update_2d,
+    .slot_destroy_2d = fake_slot_destroy_2d,
+};
+
+static Uint64 live_allocations() {
+    AllocatorStats stats = {0};
+    allocator_get_stats (ALLOCATOR_TAG_WIDGETS, &stats);
+    return stats.live_allocations;
+}
+
+static Vec2f vec2 (Float32 x, Float32 y) {
+    return (Vec2f) {.x = x, .y = y};
+}
+
+/**
+ * @b Content of slot of given widget, as last emitted.
+ * */
+static XuiSlotContent2D *slot_of (XuiWidgetTree *tree, XuiWidgetId id) {
+    XuiSlot2D slot = xui_widget_get (tree, id)->slot;
+    return slot ? fake.contents + slot : Null;
+}
+
+/**
+ * @b Check that a cell mesh is drawn over bounds given in window coordinates.
+ * */
+static void check_cell (XuiWidgetTree *tree, XuiWidgetId cell, Float32 x, Float32 y) {
+    XuiSlotContent2D *content = slot_of (tree, cell);
+    TEST_CHECK (content && content->type == XUI_SLOT_TYPE_2D_MESH, "cell %u has no mesh\n", cell);
+    if (!content) {
+        return;
+    }
+
+    XuiMeshInstance2D *mesh = &content->mesh;
+    TEST_CHECK (mesh->type == MESH_TYPE_CELL, "cell %u draws mesh %u\n", cell, mesh->type);
+    TEST_CHECK (
+        mesh->position.x == x + 5.f && mesh->position.y == y + 2.f && mesh->scale.x == 5.f &&
+            mesh->scale.y == 2.f,
+        "cell %u centered at (%f, %f), expected (%f, %f)\n",
+        cell,
+        mesh->position.x,
+        mesh->position.y,
+        x + 5.f,
+        y + 2.f
+    );
+}
+
+/**
+ * @b Panels of cells : only widgets that changed must be emitted, and only
+ * paths leading to them visited.
+ * */
+static void test_dirty_propagation() {
+    Uint64 allocations = live_allocations();
+
+    XuiWidgetTree tree;
+    TEST_CHECK (
+        xui_widget_tree_init (&tree, &fake_plugin, (XuiGraphicsContext *)&fake),
+        "failed to init widget tree\n"
+    );
+
+    XuiWidgetStyle panel_style = {.color = {.r = 0.3f, .g = 0.3f, .b = 0.2f, .a = 1.f}};
+    XuiWidgetStyle cell_style  = {.color = {.r = 0.5f, .g = 0.5f, .b = 0.4f, .a = 1.f}};
+
+    XuiWidgetId panels[PANEL_COUNT];
+    XuiWidgetId cells[PANEL_COUNT][CELLS_PER_PANEL];
+    for (Uint32 p = 0; p < PANEL_COUNT; p++) {
+        panels[p] = xui_widget_create (&tree, tree.root);
+        xui_widget_set_shape (&tree, panels[p], XUI_WIDGET_KIND_PRIMITIVE, 0);
+        xui_widget_set_style (&tree, panels[p], &panel_style);
+        xui_widget_set_bounds (&tree, panels[p], vec2 (p * 100.f, 0.f), vec2 (100.f, 400.f));
+
+        for (Uint32 c = 0; c < CELLS_PER_PANEL; c++) {
+            cells[p][c] = xui_widget_create (&tree, panels[p]);
+            xui_widget_set_shape (&tree, cells[p][c], XUI_WIDGET_KIND_MESH, MESH_TYPE_CELL);
+            xui_widget_set_style (&tree, cells[p][c], &cell_style);
+            xui_widget_set_bounds (&tree, cells[p][c], vec2 (0.f, c * 4.f), vec2 (10.f, 4.f));
+        }
+    }
+
+    Size drawn = PANEL_COUNT * (CELLS_PER_PANEL + 1);
+    xui_widget_tree_update (&tree);
+    TEST_CHECK (tree.emitted == drawn, "first update emitted %zu slots\n", (Size)tree.emitted);
+    TEST_CHECK (fake.live_slots == drawn, "%zu slots created\n", fake.live_slots);
+    check_cell (&tree, cells[3][7], 300.f, 28.f);
+
+    /* widget deeper in tree is drawn over it's parent */
+    Float32 cell_z  = slot_of (&tree, cells[0][0])->mesh.position.z;
+    Float32 panel_z = slot_of (&tree, panels[0])->primitive.position.z;
+    TEST_CHECK (cell_z < panel_z, "cell is not drawn over it's panel\n");
+
+    /* nothing changed, nothing visited */
+    xui_widget_tree_update (&tree);
+    TEST_CHECK (!tree.visited && !tree.emitted, "idle update visited %zu\n", (Size)tree.visited);
+
+    /* setting same values again changes nothing */
+    xui_widget_set_bounds (&tree, cells[5][5], vec2 (0.f, 20.f), vec2 (10.f, 4.f));
+    xui_widget_set_style (&tree, cells[5][5], &cell_style);
+    xui_widget_tree_update (&tree);
+    TEST_CHECK (!tree.visited && !tree.emitted, "no-op set visited %zu\n", (Size)tree.visited);
+
+    /* restyling one cell visits just that cell */
+    XuiWidgetStyle hover_style = cell_style;
+    hover_style.color.r        = 1.f;
+    xui_widget_set_style (&tree, cells[5][5], &hover_style);
+    xui_widget_tree_update (&tree);
+    TEST_CHECK (
+        tree.visited == 1 && tree.emitted == 1,
+        "restyle visited %zu and emitted %zu\n",
+        (Size)tree.visited,
+        (Size)tree.emitted
+    );
+    TEST_CHECK (slot_of (&tree, cells[5][5])->mesh.color.r == 1.f, "restyle not emitted\n");
+
+    /* moving a panel moves all of it's cells */
+    xui_widget_set_bounds (&tree, panels[2], vec2 (250.f, 50.f), vec2 (100.f, 400.f));
+    xui_widget_tree_update (&tree);
+    TEST_CHECK (
+        tree.visited == CELLS_PER_PANEL + 1 && tree.emitted == CELLS_PER_PANEL + 1,
+        "move visited %zu and emitted %zu\n",
+        (Size)tree.visited,
+        (Size)tree.emitted
+    );
+    check_cell (&tree, cells[2][10], 250.f, 90.f);
+    check_cell (&tree, cells[1][10], 100.f, 40.f);
+
+    /* hiding a panel hides it's cells, and keeps their slots */
+    xui_widget_set_visible (&tree, panels[4], False);
+    xui_widget_tree_update (&tree);
+    TEST_CHECK (
+        slot_of (&tree, cells[4][9])->type == XUI_SLOT_TYPE_2D_NONE &&
+            slot_of (&tree, panels[4])->type == XUI_SLOT_TYPE_2D_NONE,
+        "hidden panel still drawn\n"
+    );
+    TEST_CHECK (fake.live_slots == drawn, "hiding changed number of slots\n");
+
+    /* cells changed while hidden are drawn correctly once shown */
+    xui_widget_set_bounds (&tree, cells[4][9], vec2 (1.f, 2.f), vec2 (10.f, 4.f));
+    xui_widget_tree_update (&tree);
+    TEST_CHECK (slot_of (&tree, cells[4][9])->type == XUI_SLOT_TYPE_2D_NONE, "cell drawn\n");
+    xui_widget_set_visible (&tree, panels[4], True);
+    xui_widget_tree_update (&tree);
+    check_cell (&tree, cells[4][9], 401.f, 2.f);
+
+    /* destroying a panel destroys slots of it's cells, and frees widgets for reuse */
+    xui_widget_destroy (&tree, panels[6]);
+    TEST_CHECK (
+        fake.live_slots == drawn - CELLS_PER_PANEL - 1,
+        "%zu slots live after destroy\n",
+        fake.live_slots
+    );
+    TEST_CHECK (!xui_widget_get (&tree, cells[6][0]), "destroyed cell still exists\n");
+
+    XuiWidgetId reused = xui_widget_create (&tree, panels[7]);
+    TEST_CHECK (
+        reused && reused <= PANEL_COUNT * (CELLS_PER_PANEL + 1) + 1,
+        "widget %u not reused\n",
+        reused
+    );
+
+    /* siblings of destroyed panel are still linked */
+    Size panel_count = 0;
+    for (XuiWidgetId p = xui_widget_get (&tree, tree.root)->first_child; p;) {
+        panel_count++;
+        p = xui_widget_get (&tree, p)->next_sibling;
+    }
+    TEST_CHECK (panel_count == PANEL_COUNT - 1, "%zu panels linked to root\n", panel_count);
+
+    xui_widget_tree_deinit (&tree);
+    TEST_CHECK (!fake.live_slots, "%zu slots leaked\n", fake.live_slots);
+    TEST_CHECK (live_allocations() == allocations, "widget tree leaked memory\n");
+}
+
+int main() {
+    test_dirty_propagation();
+
+    if (test_failures) {
+        fprintf (stderr, "%zu checks failed\n", test_failures);
+        return EXIT_FAILURE;
+    }
+
+    printf ("all widget tree checks passed\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,232 @@
+/**
+ * @file AabbTreeTest.c
+ * @date Sun, 18th October 2026
+ * @author Siddharth Mishra (admin@brightprogrammer.in)
+ * @copyright Copyright 2024 Siddharth Mishra
+ * @copyright Copyright 2024 Anvie Labs
+ *
+ * Copyright 2024 Siddharth Mishra, Anvie Labs
+ * 
+ * Redistribution and use in source and binary forms, with or without modification, are permitted 
+ * provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+ *    and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions
+ *    and the following disclaimer in the documentation and/or other materials provided with the
+ *    distribution.
+ * 
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse
+ *    or promote products derived from this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND 
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * */
+
+/**
+ * @b Tests for AABB tree, queries must find exactly what a linear scan does,
+ * and tree must stay consistent and shallow through insertions, moves and removals.
+ * */
+
+#include <Anvie/Common.h>
+#include <Anvie/Types.h>
+
+/* crossgui-utils */
+#include <Anvie/CrossGui/Utils/AabbTree.h>
+#include <Anvie/CrossGui/Utils/Allocator.h>
+
+/* libc */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* local includes */
+#include "Test.h"
+
+static Size test_failures = 0;
+
+#define BOX_COUNT   10000
+#define QUERY_COUNT 2000
+#define WORLD_SIZE  4096.f
+#define MARGIN      4.f
+
+typedef struct Box {
+    Vec2f  min;
+    Vec2f  max;
+    Uint32 proxy;
+    Bool   is_inserted;
+} Box;
+
+static Box    boxes[BOX_COUNT];
+static Uint8  found[BOX_COUNT];
+static Uint64 rng_state = 0x9e3779b97f4a7c15ull;
+
+static Float32 random_float (Float32 max) {
+    rng_state = rng_state * 6364136223846793005ull + 1442695040888963407ull;
+    return (Float32)(rng_state >> 40) / (Float32)(1 << 24) * max;
+}
+
+/**
+ * @b Mostly small boxes, with a few large ones, like widgets of a UI.
+ * */
+static void random_box (Box *box) {
+    Float32 size = random_float (1) < 0.05f ? random_float (WORLD_SIZE / 2) : random_float (64);
+    box->min     = (Vec2f) {.x = random_float (WORLD_SIZE), .y = random_float (WORLD_SIZE)};
+    box->max     = (Vec2f) {.x = box->min.x + size, .y = box->min.y + random_float (64)};
+}
+
+static Bool record (Uint64 data, void *user) {
+    (void)user;
+    found[data]++;
+    return True;
+}
+
+static Bool overlaps (Box *box, Vec2f min, Vec2f max, Float32 margin) {
+    return box->min.x - margin <= max.x && box->max.x + margin >= min.x &&
+           box->min.y - margin <= max.y && box->max.y + margin >= min.y;
+}
+
+/**
+ * @b Query an area, every inserted box overlapping it must be reported once,
+ * and every reported box must overlap it within margin.
+ * */
+static void check_query (AabbTree *tree, Vec2f min, Vec2f max) {
+    memset (found, 0, sizeof (found));
+    TEST_CHECK (aabb_tree_query (tree, min, max, record, Null), "query failed\n");
+
+    for (Size b = 0; b < BOX_COUNT; b++) {
+        Box *box = boxes + b;
+        if (box->is_inserted && overlaps (box, min, max, 0)) {
+            TEST_CHECK (found[b] == 1, "box %zu reported %u times\n", b, found[b]);
+        } else if (found[b]) {
+            TEST_CHECK (
+                box->is_inserted && overlaps (box, min, max, 5 * MARGIN),
+                "box %zu reported but does not overlap\n",
+                b
+            );
+        }
+    }
+}
+
+/**
+ * @b Check links, boxes and heights of every node reachable from root.
+ *
+ * @return Number of leaves.
+ * */
+static Size check_node (AabbTree *tree, Uint32 index, Uint32 parent) {
+    AabbTreeNode *nodes = tree->nodes.heap;
+    AabbTreeNode *node  = nodes + index;
+    TEST_CHECK (node->parent == parent, "node %u has wrong parent\n", index);
+
+    if (!node->height) {
+        return 1;
+    }
+
+    AabbTreeNode *first  = nodes + node->children[0];
+    AabbTreeNode *second = nodes + node->children[1];
+    TEST_CHECK (
+        node->height == 1 + MAX (first->height, second->height),
+        "node %u has wrong height\n",
+        index
+    );
+    TEST_CHECK (
+        node->min.x == MIN (first->min.x, second->min.x) &&
+            node->max.y == MAX (first->max.y, second->max.y),
+        "box of node %u does not fit it's children\n",
+        index
+    );
+
+    return check_node (tree, node->children[0], index) +
+           check_node (tree, node->children[1], index);
+}
+
+static void check_tree (AabbTree *tree) {
+    Size leaves = tree->root == AABB_TREE_NULL ? 0 : check_node (tree, tree->root, AABB_TREE_NULL);
+    TEST_CHECK (
+        leaves == tree->leaf_count,
+        "%zu leaves linked, %u inserted\n",
+        leaves,
+        tree->leaf_count
+    );
+}
+
+static void test_aabb_tree() {
+    AabbTree tree;
+    TEST_CHECK (aabb_tree_init (&tree, MARGIN), "failed to create tree\n");
+    TEST_CHECK (aabb_tree_get_height (&tree) == 0, "empty tree has height\n");
+    check_query (&tree, (Vec2f) {0}, (Vec2f) {.x = WORLD_SIZE, .y = WORLD_SIZE});
+
+    for (Size b = 0; b < BOX_COUNT; b++) {
+        random_box (boxes + b);
+        boxes[b].proxy       = aabb_tree_insert (&tree, boxes[b].min, boxes[b].max, b);
+        boxes[b].is_inserted = boxes[b].proxy != AABB_TREE_NULL;
+        TEST_CHECK (boxes[b].is_inserted, "failed to insert box %zu\n", b);
+    }
+    check_tree (&tree);
+
+    /* rotations keep tree close to balanced, log2 (10000) is about 13.3 */
+    Int32 height = aabb_tree_get_height (&tree);
+    TEST_CHECK (height <= 20, "tree of %d boxes is %d high\n", BOX_COUNT, height);
+
+    for (Size q = 0; q < QUERY_COUNT; q++) {
+        Vec2f point = {.x = random_float (WORLD_SIZE), .y = random_float (WORLD_SIZE)};
+        check_query (&tree, point, point);
+    }
+
+    /* move some a little (within margin), some far, remove some */
+    for (Size b = 0; b < BOX_COUNT; b++) {
+        Box *box = boxes + b;
+        if (b % 3 == 0) {
+            Float32 dx  = random_float (2 * MARGIN) - MARGIN;
+            box->min.x += dx;
+            box->max.x += dx;
+        } else if (b % 3 == 1) {
+            random_box (box);
+        } else if (b % 6 == 2) {
+            TEST_CHECK (aabb_tree_remove (&tree, box->proxy), "failed to remove box %zu\n", b);
+            box->is_inserted = False;
+            continue;
+        }
+        TEST_CHECK (aabb_tree_move (&tree, box->proxy, box->min, box->max), "move %zu\n", b);
+    }
+    check_tree (&tree);
+
+    for (Size q = 0; q < QUERY_COUNT; q++) {
+        Vec2f min = {.x = random_float (WORLD_SIZE), .y = random_float (WORLD_SIZE)};
+        Vec2f max = {.x = min.x + random_float (256), .y = min.y + random_float (256)};
+        check_query (&tree, min, max);
+    }
+
+    /* removed proxies are reused, and invalid ones are rejected */
+    Uint32 proxy = aabb_tree_insert (&tree, (Vec2f) {0}, (Vec2f) {.x = 1, .y = 1}, 0);
+    TEST_CHECK (proxy < BOX_COUNT * 2, "free node was not reused\n");
+    TEST_CHECK (aabb_tree_remove (&tree, proxy), "failed to remove box\n");
+    TEST_CHECK (!aabb_tree_remove (&tree, proxy), "removed a free node\n");
+    TEST_CHECK (!aabb_tree_move (&tree, tree.root, (Vec2f) {0}, (Vec2f) {0}), "moved root\n");
+    check_tree (&tree);
+
+    TEST_CHECK (aabb_tree_deinit (&tree), "failed to destroy tree\n");
+}
+
+int main() {
+    test_aabb_tree();
+
+    AllocatorStats stats = {0};
+    allocator_get_stats (ALLOCATOR_TAG_SPATIAL, &stats);
+    TEST_CHECK (!stats.live_allocations, "AABB tree leaked memory\n");
+
+    if (test_failures) {
+        fprintf (stderr, "%zu checks failed\n", test_failures);
+        return EXIT_FAILURE;
+    }
+
+    printf ("all AABB tree checks passed\n");
+    return EXIT_SUCCESS;
+}
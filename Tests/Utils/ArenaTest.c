@@ -0,0 +1,247 @@
+/**
+ * @file ArenaTest.c
+ * @date Sun, 18th October 2026
+ * @author Siddharth Mishra (admin@brightprogrammer.in)
+ * @copyright Copyright 2024 Siddharth Mishra
+ * @copyright Copyright 2024 Anvie Labs
+ *
+ * Copyright 2024 Siddharth Mishra, Anvie Labs
+ * 
+ * Redistribution and use in source and binary forms, with or without modification, are permitted 
+ * provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+ *    and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions
+ *    and the following disclaimer in the documentation and/or other materials provided with the
+ *    distribution.
+ * 
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse
+ *    or promote products derived from this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND 
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * */
+
+/**
+ * @b Tests for linear arena allocator.
+ *
+ * Covers alignment padding, growth into new blocks when current one is full,
+ * and reset coalescing multiple blocks into a single block sized for peak usage.
+ * */
+
+#include <Anvie/Common.h>
+#include <Anvie/Types.h>
+
+/* crossgui-utils */
+#include <Anvie/CrossGui/Utils/Allocator.h>
+#include <Anvie/CrossGui/Utils/Arena.h>
+
+/* libc */
+#include <stdalign.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* local includes */
+#include "Test.h"
+
+#define TEST_TAG ALLOCATOR_TAG_FRAME_ARENA
+
+static Size test_failures = 0;
+
+static AllocatorStats arena_stats() {
+    AllocatorStats stats = {0};
+    allocator_get_stats (TEST_TAG, &stats);
+    return stats;
+}
+
+/**
+ * @b Fill given memory with a pattern, and check later that it's still intact,
+ * so allocations that overlap are caught.
+ * */
+static void fill (Uint8 *mem, Size size, Uint8 pattern) {
+    memset (mem, pattern, size);
+}
+
+static Bool is_filled (Uint8 *mem, Size size, Uint8 pattern) {
+    for (Size s = 0; s < size; s++) {
+        if (mem[s] != pattern) {
+            return False;
+        }
+    }
+
+    return True;
+}
+
+static void test_invalid_arguments() {
+    Arena arena = {0};
+
+    TEST_CHECK (!arena_init (Null, 64, TEST_TAG), "init must fail without arena\n");
+    TEST_CHECK (!arena_init (&arena, 0, TEST_TAG), "init must fail with zero block size\n");
+    TEST_CHECK (!arena_init (&arena, 64, ALLOCATOR_TAG_MAX), "init must fail with invalid tag\n");
+
+    TEST_CHECK (arena_init (&arena, 64, TEST_TAG), "init failed\n");
+    TEST_CHECK (!arena_alloc (&arena, 8, 0), "zero alignment must fail\n");
+    TEST_CHECK (!arena_alloc (&arena, 8, 3), "non power of two alignment must fail\n");
+    TEST_CHECK (
+        !arena_alloc (&arena, 8, alignof (max_align_t) * 2),
+        "alignment above max_align_t must fail\n"
+    );
+    TEST_CHECK (!arena.blocks, "failed allocations must not allocate blocks\n");
+
+    arena_deinit (&arena);
+}
+
+static void test_alignment() {
+    AllocatorStats before = arena_stats();
+    Arena          arena;
+    arena_init (&arena, 256, TEST_TAG);
+
+    /* odd sized allocations force padding before every aligned one */
+    for (Size align = 1; align <= alignof (max_align_t); align *= 2) {
+        Uint8 *odd = arena_alloc (&arena, 1, 1);
+        void  *mem = arena_alloc (&arena, 3, align);
+        TEST_CHECK (odd && mem, "allocation failed\n");
+        TEST_CHECK (!((uintptr_t)mem % align), "%zu byte alignment not respected\n", align);
+        TEST_CHECK ((Uint8 *)mem > odd, "aligned allocation overlaps previous one\n");
+    }
+
+    /* padding is accounted to usage, 1 + 3 bytes at alignment 1, then padded up to alignment */
+    Size expected = 0;
+    for (Size align = 1; align <= alignof (max_align_t); align *= 2) {
+        expected  = expected + 1;
+        expected  = (expected + align - 1) & ~(align - 1);
+        expected += 3;
+    }
+    TEST_CHECK (arena.used == expected, "used %zu, expected %zu\n", arena.used, expected);
+    TEST_CHECK (arena.peak == expected, "peak must follow usage\n");
+    TEST_CHECK (arena_stats().live_allocations == before.live_allocations + 1, "one block\n");
+
+    /* typed allocations are aligned for their type */
+    Float64 *values = ARENA_ALLOCATE (&arena, Float64, 4);
+    TEST_CHECK (values && !((uintptr_t)values % alignof (Float64)), "typed alloc misaligned\n");
+
+    arena_deinit (&arena);
+    TEST_CHECK (arena_stats().live_allocations == before.live_allocations, "arena leaked\n");
+}
+
+static void test_growth() {
+    AllocatorStats before = arena_stats();
+    Arena          arena;
+    arena_init (&arena, 64, TEST_TAG);
+
+    TEST_CHECK (!arena.blocks, "arena must not allocate before first allocation\n");
+
+    /* 64 byte block, then 128 bytes, at least twice as big as previous one */
+    Uint8 *a = arena_alloc (&arena, 48, 1);
+    Uint8 *b = arena_alloc (&arena, 48, 1);
+    Uint8 *c = arena_alloc (&arena, 64, 1);
+    TEST_CHECK (a && b && c, "allocation failed\n");
+    TEST_CHECK (
+        arena_stats().live_allocations == before.live_allocations + 2,
+        "expected a 64 byte and a 128 byte block\n"
+    );
+
+    /* an allocation that still fits comes from the newest block */
+    AllocatorStats grown = arena_stats();
+    Uint8         *d     = arena_alloc (&arena, 16, 1);
+    TEST_CHECK (d == c + 64, "allocation must follow previous one in same block\n");
+    TEST_CHECK (arena_stats().allocation_count == grown.allocation_count, "must not grow\n");
+
+    /* allocations bigger than block size get a block of their own size */
+    Uint8 *e = arena_alloc (&arena, 1000, 1);
+    TEST_CHECK (e, "allocation failed\n");
+    TEST_CHECK (
+        arena_stats().live_allocations == before.live_allocations + 3,
+        "oversized allocation must add exactly one block\n"
+    );
+    TEST_CHECK (arena.used == 48 + 48 + 64 + 16 + 1000, "used %zu\n", arena.used);
+
+    fill (a, 48, 0xa1);
+    fill (b, 48, 0xb2);
+    fill (c, 64, 0xc3);
+    fill (d, 16, 0xd4);
+    fill (e, 1000, 0xe5);
+
+    TEST_CHECK (is_filled (a, 48, 0xa1), "allocation overwritten\n");
+    TEST_CHECK (is_filled (b, 48, 0xb2), "allocation overwritten\n");
+    TEST_CHECK (is_filled (c, 64, 0xc3), "allocation overwritten\n");
+    TEST_CHECK (is_filled (d, 16, 0xd4), "allocation overwritten\n");
+    TEST_CHECK (is_filled (e, 1000, 0xe5), "allocation overwritten\n");
+
+    arena_deinit (&arena);
+    TEST_CHECK (arena_stats().live_allocations == before.live_allocations, "arena leaked\n");
+}
+
+static void test_reset() {
+    AllocatorStats before = arena_stats();
+    Arena          arena;
+    arena_init (&arena, 64, TEST_TAG);
+
+    /* resetting a single block arena keeps it's block */
+    arena_alloc (&arena, 16, 1);
+    ArenaBlock *block = arena.blocks;
+    arena_reset (&arena);
+    TEST_CHECK (arena.blocks == block && !arena.used, "single block must be reused\n");
+    TEST_CHECK (arena.peak == 16, "reset must keep peak\n");
+
+    /* grow over several blocks, reset must replace them with one peak sized block */
+    for (Size s = 0; s < 20; s++) {
+        fill (arena_alloc (&arena, 50, 1), 50, (Uint8)s);
+    }
+    Size peak = arena.peak;
+    TEST_CHECK (peak == 20 * 50, "peak %zu\n", peak);
+    TEST_CHECK (arena_stats().live_allocations > before.live_allocations + 1, "must grow\n");
+
+    arena_reset (&arena);
+    AllocatorStats coalesced = arena_stats();
+    TEST_CHECK (!arena.used && arena.peak == peak, "reset must clear usage and keep peak\n");
+    TEST_CHECK (
+        coalesced.live_allocations == before.live_allocations + 1,
+        "reset must coalesce into a single block\n"
+    );
+
+    /* same usage as before fits in coalesced block, without touching the heap */
+    for (Size frame = 0; frame < 4; frame++) {
+        for (Size s = 0; s < 20; s++) {
+            Uint8 *mem = arena_alloc (&arena, 50, 1);
+            TEST_CHECK (mem, "allocation failed\n");
+            fill (mem, 50, (Uint8)s);
+        }
+        arena_reset (&arena);
+    }
+    AllocatorStats steady = arena_stats();
+    TEST_CHECK (
+        steady.allocation_count == coalesced.allocation_count,
+        "steady state must not allocate, made %llu allocations\n",
+        (unsigned long long)(steady.allocation_count - coalesced.allocation_count)
+    );
+
+    arena_deinit (&arena);
+    TEST_CHECK (arena_stats().live_allocations == before.live_allocations, "arena leaked\n");
+}
+
+int main() {
+    test_invalid_arguments();
+    test_alignment();
+    test_growth();
+    test_reset();
+
+    if (test_failures) {
+        fprintf (stderr, "%zu checks failed\n", test_failures);
+        return EXIT_FAILURE;
+    }
+
+    printf ("all arena checks passed\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,408 @@
+/**
+ * @file Benchmark.c
+ * @date Sun, 18th October 2026
+ * @author Siddharth Mishra (admin@brightprogrammer.in)
+ * @copyright Copyright 2024 Siddharth Mishra
+ * @copyright Copyright 2024 Anvie Labs
+ *
+ * Copyright 2024 Siddharth Mishra, Anvie Labs
+ * 
+ * Redistribution and use in source and binary forms, with or without modification, are permitted 
+ * provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+ *    and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions
+ *    and the following disclaimer in the documentation and/or other materials provided with the
+ *    distribution.
+ * 
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse
+ *    or promote products derived from this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND 
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * */
+
+/**
+ * @b Micro-benchmarks for Maths.h, MathsInline.h, batch math kernels and vectors.
+ *
+ * Each benchmark is repeated with doubling iteration counts until it runs for
+ * at least @c BENCH_MIN_NS, and time per operation and throughput are reported.
+ * Build in Release mode for meaningful numbers. A substring can be passed as
+ * first argument to run only matching benchmarks :
+ *
+ *     bin/bench_utils mat4f
+ * */
+
+#define ALLOCATOR_TAG ALLOCATOR_TAG_GENERAL
+
+#include <Anvie/Common.h>
+#include <Anvie/Types.h>
+
+/* crossgui-utils */
+#include <Anvie/CrossGui/Utils/Maths.h>
+#include <Anvie/CrossGui/Utils/MathsInline.h>
+#include <Anvie/CrossGui/Utils/Profiler.h>
+#include <Anvie/CrossGui/Utils/Vector.h>
+
+/* libc */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* local includes */
+#include "Test.h"
+
+#define BENCH_MIN_NS  (200ull * 1000 * 1000)
+#define DATA_COUNT    256
+#define BATCH_COUNT   4096
+#define GROWTH_COUNT  10000
+#define INLINE_COUNT  3
+
+typedef void (*BenchFn) (Size iters);
+
+NEW_HEAP_VECTOR_STRUCT (Vec4f, Vec4fVector);
+NEW_VECTOR_STRUCT (Vec4f, InlineVec4fVector, 4);
+NEW_VECTOR_TYPE (Vec4f, Vec4fVector, vec4f);
+NEW_VECTOR_TYPE (Vec4f, InlineVec4fVector, inline_vec4f);
+
+/* results are accumulated here so compiler cannot optimize benchmarked code away */
+static volatile Float32 sink;
+
+static Mat3f  mat3[DATA_COUNT];
+static Mat4f  mat4[DATA_COUNT];
+static Vec4f  vec4[DATA_COUNT];
+static Vec2f  points[BATCH_COUNT], points_res[BATCH_COUNT];
+static Vec4f  vecs[BATCH_COUNT], vecs_res[BATCH_COUNT];
+static Aabb2f boxes[BATCH_COUNT], boxes_res[BATCH_COUNT];
+
+/**
+ * @b Run given benchmark until it takes long enough to be measured reliably.
+ *
+ * @param name Name of benchmark.
+ * @param fn Benchmark function, runs benchmarked code @c iters times.
+ * @param ops_per_iter Number of operations (items processed) in one iteration.
+ * @param filter Run benchmark only if it's name contains this. Can be @c Null.
+ * */
+static void bench_run (CString name, BenchFn fn, Size ops_per_iter, CString filter) {
+    if (filter && !strstr (name, filter)) {
+        return;
+    }
+
+    /* warm up caches and branch predictors */
+    fn (1);
+
+    Size   iters = 1;
+    Uint64 elapsed;
+    for (;;) {
+        Uint64 begin = profiler_now_ns();
+        fn (iters);
+        elapsed = profiler_now_ns() - begin;
+
+        if (elapsed >= BENCH_MIN_NS) {
+            break;
+        }
+        iters *= 2;
+    }
+
+    Float64 ops = (Float64)iters * ops_per_iter;
+    printf ("%-40s %10.3f ns/op %10.2f Mop/s\n", name, elapsed / ops, ops * 1e3 / elapsed);
+    fflush (stdout);
+}
+
+/**************************************************************************************************/
+/********************************************** MATHS *********************************************/
+/**************************************************************************************************/
+
+static void bench_vec4f_dot (Size iters) {
+    Float32 acc = 0;
+    for (Size s = 0; s < iters; s++) {
+        acc += vec4f_dot (vec4 + (s % DATA_COUNT), vec4 + ((s + 1) % DATA_COUNT));
+    }
+    sink = acc;
+}
+
+static void bench_vec4f_dot_inline (Size iters) {
+    Float32 acc = 0;
+    for (Size s = 0; s < iters; s++) {
+        acc += vec4f_dot_inline (vec4[s % DATA_COUNT], vec4[(s + 1) % DATA_COUNT]);
+    }
+    sink = acc;
+}
+
+static void bench_mat4f_mul (Size iters) {
+    Mat4f res;
+    for (Size s = 0; s < iters; s++) {
+        mat4f_mul (&res, mat4 + (s % DATA_COUNT), mat4 + ((s + 1) % DATA_COUNT));
+        sink = res.elem[0][0];
+    }
+}
+
+static void bench_mat4f_mul_inline (Size iters) {
+    for (Size s = 0; s < iters; s++) {
+        sink = mat4f_mul_inline (mat4[s % DATA_COUNT], mat4[(s + 1) % DATA_COUNT]).elem[0][0];
+    }
+}
+
+static void bench_mat4f_mul_vec (Size iters) {
+    Vec4f res;
+    for (Size s = 0; s < iters; s++) {
+        mat4f_mul_vec (&res, mat4 + (s % DATA_COUNT), vec4 + (s % DATA_COUNT));
+        sink = res.x;
+    }
+}
+
+static void bench_mat4f_mul_vec_inline (Size iters) {
+    for (Size s = 0; s < iters; s++) {
+        sink = mat4f_mul_vec_inline (mat4[s % DATA_COUNT], vec4[s % DATA_COUNT]).x;
+    }
+}
+
+static void bench_mat3f_invert (Size iters) {
+    Mat3f res;
+    for (Size s = 0; s < iters; s++) {
+        mat3f_invert (&res, mat3 + (s % DATA_COUNT));
+        sink = res.elem[0][0];
+    }
+}
+
+static void bench_mat3f_invert_inline (Size iters) {
+    for (Size s = 0; s < iters; s++) {
+        sink = mat3f_invert_inline (mat3[s % DATA_COUNT]).elem[0][0];
+    }
+}
+
+static void bench_mat4f_invert (Size iters) {
+    Mat4f res;
+    for (Size s = 0; s < iters; s++) {
+        mat4f_invert (&res, mat4 + (s % DATA_COUNT));
+        sink = res.elem[0][0];
+    }
+}
+
+static void bench_mat4f_invert_inline (Size iters) {
+    for (Size s = 0; s < iters; s++) {
+        sink = mat4f_invert_inline (mat4[s % DATA_COUNT]).elem[0][0];
+    }
+}
+
+static void bench_mat4f_det (Size iters) {
+    Float32 acc = 0;
+    for (Size s = 0; s < iters; s++) {
+        acc += mat4f_det (mat4 + (s % DATA_COUNT));
+    }
+    sink = acc;
+}
+
+static void bench_mat4f_det_inline (Size iters) {
+    Float32 acc = 0;
+    for (Size s = 0; s < iters; s++) {
+        acc += mat4f_det_inline (mat4[s % DATA_COUNT]);
+    }
+    sink = acc;
+}
+
+static void bench_vec2f_transform_batch (Size iters) {
+    for (Size s = 0; s < iters; s++) {
+        vec2f_transform_batch (points_res, mat3 + (s % DATA_COUNT), points, BATCH_COUNT);
+    }
+    sink = points_res[0].x;
+}
+
+static void bench_vec4f_transform_batch (Size iters) {
+    for (Size s = 0; s < iters; s++) {
+        vec4f_transform_batch (vecs_res, mat4 + (s % DATA_COUNT), vecs, BATCH_COUNT);
+    }
+    sink = vecs_res[0].x;
+}
+
+static void bench_aabb2f_union_batch (Size iters) {
+    Aabb2f res;
+    for (Size s = 0; s < iters; s++) {
+        aabb2f_union_batch (&res, boxes, BATCH_COUNT);
+        sink = res.min.x;
+    }
+}
+
+static void bench_aabb2f_intersect_batch (Size iters) {
+    for (Size s = 0; s < iters; s++) {
+        aabb2f_intersect_batch (boxes_res, boxes, boxes + (s % BATCH_COUNT), BATCH_COUNT);
+    }
+    sink = boxes_res[0].min.x;
+}
+
+/**************************************************************************************************/
+/********************************************* VECTORS ********************************************/
+/**************************************************************************************************/
+
+/* grow from empty one entry at a time, relying on geometric growth */
+static void bench_vector_push (Size iters) {
+    for (Size s = 0; s < iters; s++) {
+        Vec4fVector vec = {0};
+        for (Size i = 0; i < GROWTH_COUNT; i++) {
+            vec4f_vector_push (&vec, vec4 + (i % DATA_COUNT));
+        }
+        sink = vec.heap->x;
+        vec4f_vector_deinit (&vec);
+    }
+}
+
+/* same as above, but exact size is known beforehand */
+static void bench_vector_push_reserved (Size iters) {
+    for (Size s = 0; s < iters; s++) {
+        Vec4fVector vec;
+        vec4f_vector_init (&vec, GROWTH_COUNT);
+        for (Size i = 0; i < GROWTH_COUNT; i++) {
+            vec4f_vector_push (&vec, vec4 + (i % DATA_COUNT));
+        }
+        sink = vec.heap->x;
+        vec4f_vector_deinit (&vec);
+    }
+}
+
+/* grow one entry at a time through resize, zeroing each new entry */
+static void bench_vector_resize (Size iters) {
+    for (Size s = 0; s < iters; s++) {
+        Vec4fVector vec = {0};
+        for (Size i = 0; i < GROWTH_COUNT; i++) {
+            vec4f_vector_resize (&vec, i + 1, True);
+        }
+        sink = vec.heap->x;
+        vec4f_vector_deinit (&vec);
+    }
+}
+
+/* grow in chunks of data array at a time */
+static void bench_vector_append (Size iters) {
+    for (Size s = 0; s < iters; s++) {
+        Vec4fVector vec = {0};
+        for (Size i = 0; i < GROWTH_COUNT; i += DATA_COUNT) {
+            vec4f_vector_append (&vec, vec4, MIN (DATA_COUNT, GROWTH_COUNT - i));
+        }
+        sink = vec.heap->x;
+        vec4f_vector_deinit (&vec);
+    }
+}
+
+/* reuse memory of a vector across iterations, like per-frame lists do */
+static void bench_vector_clear_reuse (Size iters) {
+    Vec4fVector vec = {0};
+    for (Size s = 0; s < iters; s++) {
+        vec4f_vector_clear (&vec);
+        for (Size i = 0; i < GROWTH_COUNT; i++) {
+            vec4f_vector_push (&vec, vec4 + (i % DATA_COUNT));
+        }
+        sink = vec.heap->x;
+    }
+    vec4f_vector_deinit (&vec);
+}
+
+/* many short lived small vectors, with and without inline storage */
+static void bench_vector_small (Size iters) {
+    for (Size s = 0; s < iters; s++) {
+        Vec4fVector vec = {0};
+        for (Size i = 0; i < INLINE_COUNT; i++) {
+            vec4f_vector_push (&vec, vec4 + ((s + i) % DATA_COUNT));
+        }
+        sink = vec.heap->x;
+        vec4f_vector_deinit (&vec);
+    }
+}
+
+static void bench_vector_small_inline (Size iters) {
+    for (Size s = 0; s < iters; s++) {
+        InlineVec4fVector vec = {0};
+        for (Size i = 0; i < INLINE_COUNT; i++) {
+            inline_vec4f_vector_push (&vec, vec4 + ((s + i) % DATA_COUNT));
+        }
+        sink = inline_vec4f_vector_data (&vec)->x;
+        inline_vec4f_vector_deinit (&vec);
+    }
+}
+
+/**************************************************************************************************/
+/********************************************** MAIN **********************************************/
+/**************************************************************************************************/
+
+static void init_data() {
+    Uint64 rng = 0x853c49e6748fea9bull;
+
+    for (Size s = 0; s < DATA_COUNT; s++) {
+        for (Size c = 0; c < 3; c++) {
+            for (Size r = 0; r < 3; r++) {
+                mat3[s].elem[c][r] = test_rand_f32 (&rng, -1.f, 1.f) + (r == c ? 3.f : 0.f);
+            }
+        }
+        for (Size c = 0; c < 4; c++) {
+            for (Size r = 0; r < 4; r++) {
+                mat4[s].elem[c][r] = test_rand_f32 (&rng, -1.f, 1.f) + (r == c ? 4.f : 0.f);
+            }
+        }
+        vec4[s] = (Vec4f) {.x = test_rand_f32 (&rng, -1.f, 1.f), .y = 1.f, .z = 2.f, .w = 1.f};
+    }
+
+    for (Size s = 0; s < BATCH_COUNT; s++) {
+        points[s] = (Vec2f) {.x = test_rand_f32 (&rng, -100, 100), .y = (Float32)s};
+        vecs[s]   = (Vec4f) {.x = points[s].x, .y = points[s].y, .z = 0.f, .w = 1.f};
+        boxes[s]  = (Aabb2f) {
+             .min = points[s],
+             .max = {.x = points[s].x + 10.f, .y = points[s].y + 10.f}
+        };
+    }
+}
+
+int main (int argc, char **argv) {
+    CString filter = argc > 1 ? argv[1] : Null;
+
+    init_data();
+
+    bench_run ("vec4f_dot", bench_vec4f_dot, 1, filter);
+    bench_run ("vec4f_dot_inline", bench_vec4f_dot_inline, 1, filter);
+    bench_run ("mat4f_mul", bench_mat4f_mul, 1, filter);
+    bench_run ("mat4f_mul_inline", bench_mat4f_mul_inline, 1, filter);
+    bench_run ("mat4f_mul_vec", bench_mat4f_mul_vec, 1, filter);
+    bench_run ("mat4f_mul_vec_inline", bench_mat4f_mul_vec_inline, 1, filter);
+    bench_run ("mat3f_invert", bench_mat3f_invert, 1, filter);
+    bench_run ("mat3f_invert_inline", bench_mat3f_invert_inline, 1, filter);
+    bench_run ("mat4f_invert", bench_mat4f_invert, 1, filter);
+    bench_run ("mat4f_invert_inline", bench_mat4f_invert_inline, 1, filter);
+    bench_run ("mat4f_det", bench_mat4f_det, 1, filter);
+    bench_run ("mat4f_det_inline", bench_mat4f_det_inline, 1, filter);
+
+    /* batch kernels are measured per item, for every isa host supports */
+    MathsIsa best = maths_get_isa();
+    for (MathsIsa isa = MATHS_ISA_SCALAR; isa < MATHS_ISA_MAX; isa++) {
+        if (!maths_set_isa (isa)) {
+            continue;
+        }
+
+        Char name[64];
+        snprintf (name, sizeof (name), "vec2f_transform_batch[%s]", maths_isa_name (isa));
+        bench_run (name, bench_vec2f_transform_batch, BATCH_COUNT, filter);
+        snprintf (name, sizeof (name), "vec4f_transform_batch[%s]", maths_isa_name (isa));
+        bench_run (name, bench_vec4f_transform_batch, BATCH_COUNT, filter);
+        snprintf (name, sizeof (name), "aabb2f_union_batch[%s]", maths_isa_name (isa));
+        bench_run (name, bench_aabb2f_union_batch, BATCH_COUNT, filter);
+        snprintf (name, sizeof (name), "aabb2f_intersect_batch[%s]", maths_isa_name (isa));
+        bench_run (name, bench_aabb2f_intersect_batch, BATCH_COUNT, filter);
+    }
+    maths_set_isa (best);
+
+    /* vector benchmarks are measured per entry added */
+    bench_run ("vector_push", bench_vector_push, GROWTH_COUNT, filter);
+    bench_run ("vector_push_reserved", bench_vector_push_reserved, GROWTH_COUNT, filter);
+    bench_run ("vector_resize", bench_vector_resize, GROWTH_COUNT, filter);
+    bench_run ("vector_append", bench_vector_append, GROWTH_COUNT, filter);
+    bench_run ("vector_clear_reuse", bench_vector_clear_reuse, GROWTH_COUNT, filter);
+    bench_run ("vector_small", bench_vector_small, INLINE_COUNT, filter);
+    bench_run ("vector_small_inline", bench_vector_small_inline, INLINE_COUNT, filter);
+
+    return EXIT_SUCCESS;
+}
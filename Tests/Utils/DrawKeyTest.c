@@ -0,0 +1,361 @@
+/**
+ * @file DrawKeyTest.c
+ * @date Sun, 18th October 2026
+ * @author Siddharth Mishra (admin@brightprogrammer.in)
+ * @copyright Copyright 2024 Siddharth Mishra
+ * @copyright Copyright 2024 Anvie Labs
+ *
+ * Copyright 2024 Siddharth Mishra, Anvie Labs
+ * 
+ * Redistribution and use in source and binary forms, with or without modification, are permitted 
+ * provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+ *    and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions
+ *    and the following disclaimer in the documentation and/or other materials provided with the
+ *    distribution.
+ * 
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse
+ *    or promote products derived from this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND 
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * */
+
+/**
+ * @b Tests for draw keys, instances must be drawn in order of their keys
+ * when they're batched the way batch renderer does it : all opaque instances
+ * before blended ones, and each batch sorted by depth once sorted.
+ * */
+
+#include <Anvie/Common.h>
+#include <Anvie/Types.h>
+
+/* crossgui-utils */
+#include <Anvie/CrossGui/Utils/DrawKey.h>
+#include <Anvie/CrossGui/Utils/RadixSort.h>
+
+/* libc */
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* local includes */
+#include "Test.h"
+
+static Size test_failures = 0;
+
+#define INSTANCE_COUNT  20000
+#define MESH_TYPE_COUNT 6
+#define BATCH_MAX       (2 * MESH_TYPE_COUNT)
+
+typedef struct Instance {
+    DrawPass pass;
+    Bool     is_primitive;
+    Uint32   mesh_type;
+    Float32  depth;
+} Instance;
+
+/**
+ * @b Batches of a frame, as batch renderer keeps them : mesh batches in order
+ * of their keys, and all primitives in a single batch drawn after them.
+ * */
+typedef struct Frame {
+    Uint64  batch_keys[BATCH_MAX];
+    Uint32 *batches[BATCH_MAX];
+    Size    batch_counts[BATCH_MAX];
+    Size    batch_count;
+    Uint32 *primitives;
+    Size    primitive_count;
+} Frame;
+
+static Uint64 instance_key (Instance *instance) {
+    return draw_key_pack_2d (
+        instance->pass,
+        instance->is_primitive,
+        instance->mesh_type,
+        instance->depth
+    );
+}
+
+static void frame_add (Frame *frame, Instance *instances, Uint32 index) {
+    Instance *instance = instances + index;
+    if (instance->is_primitive) {
+        frame->primitives[frame->primitive_count++] = index;
+        return;
+    }
+
+    Uint64 key = draw_key_batch (instance_key (instance));
+    Size   b   = draw_key_find_batch (frame->batch_keys, frame->batch_count, key);
+
+    if (b == frame->batch_count || frame->batch_keys[b] != key) {
+        Size move = frame->batch_count - b;
+        memmove (frame->batch_keys + b + 1, frame->batch_keys + b, move * sizeof (Uint64));
+        memmove (frame->batches + b + 1, frame->batches + b, move * sizeof (Uint32 *));
+        memmove (frame->batch_counts + b + 1, frame->batch_counts + b, move * sizeof (Size));
+
+        frame->batch_keys[b]   = key;
+        frame->batches[b]      = malloc (INSTANCE_COUNT * sizeof (Uint32));
+        frame->batch_counts[b] = 0;
+        frame->batch_count++;
+    }
+
+    frame->batches[b][frame->batch_counts[b]++] = index;
+}
+
+/**
+ * @b Draw batches of given frame one after another, like display does, and
+ * get order instances are drawn in.
+ * */
+static Size frame_draw (Frame *frame, Uint32 *order) {
+    Size count = 0;
+    for (Size b = 0; b < frame->batch_count; b++) {
+        memcpy (order + count, frame->batches[b], frame->batch_counts[b] * sizeof (Uint32));
+        count += frame->batch_counts[b];
+    }
+
+    memcpy (order + count, frame->primitives, frame->primitive_count * sizeof (Uint32));
+    return count + frame->primitive_count;
+}
+
+static void frame_deinit (Frame *frame) {
+    for (Size b = 0; b < frame->batch_count; b++) {
+        free (frame->batches[b]);
+    }
+    free (frame->primitives);
+}
+
+/**
+ * @b Batch given instances in given order, draw them and check order they're
+ * drawn in.
+ *
+ * @param is_sorted Whether @c submitted is sorted by draw key, in which case
+ *        instances must be drawn in order of their draw keys.
+ * */
+static void check_draw_order (
+    CString   name,
+    Instance *instances,
+    Uint32   *submitted,
+    Size      count,
+    Bool      is_sorted
+) {
+    Frame frame      = {0};
+    frame.primitives = malloc (MAX (count, 1) * sizeof (Uint32));
+
+    for (Size s = 0; s < count; s++) {
+        frame_add (&frame, instances, submitted[s]);
+    }
+
+    Uint32 *order       = malloc (MAX (count, 1) * sizeof (Uint32));
+    Bool   *drawn       = calloc (MAX (count, 1), sizeof (Bool));
+    Size    drawn_count = frame_draw (&frame, order);
+    TEST_CHECK (drawn_count == count, "%s : drew %zu of %zu instances\n", name, drawn_count, count);
+
+    Size batches_out_of_order = 0;
+    for (Size b = 1; b < frame.batch_count; b++) {
+        batches_out_of_order += frame.batch_keys[b - 1] >= frame.batch_keys[b];
+    }
+    TEST_CHECK (!batches_out_of_order, "%s : batches are not in order of keys\n", name);
+
+    Size redrawn         = 0;
+    Size opaque_on_top   = 0;
+    Size keys_descending = 0;
+    Bool is_blending     = False;
+    for (Size d = 0; d < drawn_count; d++) {
+        Instance *instance  = instances + order[d];
+        redrawn            += drawn[order[d]];
+        drawn[order[d]]     = True;
+
+        /* an opaque instance drawn after a blended one depth-rejects what's behind it */
+        opaque_on_top += is_blending && instance->pass == DRAW_PASS_OPAQUE;
+        is_blending   |= instance->pass == DRAW_PASS_BLENDED;
+
+        if (d) {
+            keys_descending += instance_key (instances + order[d - 1]) > instance_key (instance);
+        }
+    }
+
+    TEST_CHECK (!redrawn, "%s : %zu instances drawn more than once\n", name, redrawn);
+    TEST_CHECK (
+        !opaque_on_top,
+        "%s : %zu opaque instances drawn after blended ones\n",
+        name,
+        opaque_on_top
+    );
+    if (is_sorted) {
+        TEST_CHECK (
+            !keys_descending,
+            "%s : %zu instances drawn out of order of their keys\n",
+            name,
+            keys_descending
+        );
+    }
+
+    free (drawn);
+    free (order);
+    frame_deinit (&frame);
+}
+
+static void test_pack() {
+    for (Uint32 a = 0; a < MESH_TYPE_COUNT; a++) {
+        for (Uint32 b = 0; b < MESH_TYPE_COUNT; b++) {
+            TEST_CHECK (
+                draw_key_pack_2d (DRAW_PASS_OPAQUE, False, a, 1.f) <
+                    draw_key_pack_2d (DRAW_PASS_BLENDED, False, b, 0.f),
+                "opaque mesh %u is not drawn before blended mesh %u\n",
+                a,
+                b
+            );
+        }
+    }
+
+    TEST_CHECK (
+        draw_key_pack_2d (DRAW_PASS_BLENDED, False, DRAW_KEY_MESH_TYPE_MASK, 0.f) <
+            draw_key_pack_2d (DRAW_PASS_BLENDED, True, 0, 1.f),
+        "primitives are not drawn after blended meshes\n"
+    );
+
+    /* opaque front to back, blended back to front */
+    TEST_CHECK (
+        draw_key_pack_2d (DRAW_PASS_OPAQUE, False, 1, 0.25f) <
+            draw_key_pack_2d (DRAW_PASS_OPAQUE, False, 1, 0.75f),
+        "opaque instances are not sorted front to back\n"
+    );
+    TEST_CHECK (
+        draw_key_pack_2d (DRAW_PASS_BLENDED, False, 1, 0.75f) <
+            draw_key_pack_2d (DRAW_PASS_BLENDED, False, 1, 0.25f),
+        "blended instances are not sorted back to front\n"
+    );
+
+    TEST_CHECK (
+        draw_key_pack_2d (DRAW_PASS_OPAQUE, False, 2, -1.f) ==
+                draw_key_pack_2d (DRAW_PASS_OPAQUE, False, 2, 0.f) &&
+            draw_key_pack_2d (DRAW_PASS_OPAQUE, False, 2, 2.f) ==
+                draw_key_pack_2d (DRAW_PASS_OPAQUE, False, 2, 1.f),
+        "depth outside of depth range is not clamped\n"
+    );
+
+    /* far plane, and what rounds to it, must not carry out of depth bits */
+    Uint64  opaque_batch  = draw_key_batch (draw_key_pack_2d (DRAW_PASS_OPAQUE, False, 2, 0.f));
+    Uint64  blended_batch = draw_key_batch (draw_key_pack_2d (DRAW_PASS_BLENDED, True, 0, 0.f));
+    Float32 far_depths[]  = {1.f, 0.99999998f, 1.5f, INFINITY};
+    for (Size d = 0; d < ARRAY_SIZE (far_depths); d++) {
+        Uint64 opaque  = draw_key_pack_2d (DRAW_PASS_OPAQUE, False, 2, far_depths[d]);
+        Uint64 blended = draw_key_pack_2d (DRAW_PASS_BLENDED, True, 0, far_depths[d]);
+        TEST_CHECK (
+            draw_key_batch (opaque) == opaque_batch,
+            "opaque depth %g carries into mesh type\n",
+            far_depths[d]
+        );
+        TEST_CHECK (
+            blended == blended_batch,
+            "blended depth %g is not drawn first, key is %zx\n",
+            far_depths[d],
+            (Size)blended
+        );
+    }
+
+    Uint64 near = draw_key_pack_2d (DRAW_PASS_BLENDED, False, 3, 0.1f);
+    Uint64 far  = draw_key_pack_2d (DRAW_PASS_BLENDED, False, 3, 0.9f);
+    TEST_CHECK (near != far, "depth is not part of draw key\n");
+    TEST_CHECK (draw_key_batch (near) == draw_key_batch (far), "same batch has different keys\n");
+    TEST_CHECK (draw_key_pass (near) == DRAW_PASS_BLENDED, "pass of draw key is lost\n");
+    TEST_CHECK (
+        draw_key_pass (draw_key_pack_2d (DRAW_PASS_OPAQUE, False, 3, 0.5f)) == DRAW_PASS_OPAQUE,
+        "pass of draw key is lost\n"
+    );
+}
+
+static void test_find_batch() {
+    Uint64 keys[] = {10, 20, 30};
+
+    TEST_CHECK (draw_key_find_batch (Null, 0, 10) == 0, "empty batches\n");
+    TEST_CHECK (draw_key_find_batch (keys, 3, 5) == 0, "key before all batches\n");
+    TEST_CHECK (draw_key_find_batch (keys, 3, 20) == 1, "existing batch not found\n");
+    TEST_CHECK (draw_key_find_batch (keys, 3, 25) == 2, "key between batches\n");
+    TEST_CHECK (draw_key_find_batch (keys, 3, 40) == 3, "key after all batches\n");
+}
+
+static void test_draw_order() {
+    /* blended mesh drawn before an opaque mesh of another type it's in front of */
+    Instance pair[] = {
+        {.pass = DRAW_PASS_BLENDED, .mesh_type = 0, .depth = 0.2f},
+        {.pass = DRAW_PASS_OPAQUE, .mesh_type = 1, .depth = 0.8f},
+    };
+    Uint32 pair_order[] = {0, 1};
+    check_draw_order ("blended first", pair, pair_order, 2, False);
+
+    Frame frame      = {0};
+    frame.primitives = malloc (sizeof (Uint32));
+    frame_add (&frame, pair, 0);
+    frame_add (&frame, pair, 1);
+    Uint32 drawn[2];
+    frame_draw (&frame, drawn);
+    TEST_CHECK (drawn[0] == 1 && drawn[1] == 0, "opaque mesh is not drawn first\n");
+    frame_deinit (&frame);
+
+    Uint64    state     = 0x853c49e6748fea9bull;
+    Instance *instances = malloc (INSTANCE_COUNT * sizeof (Instance));
+    Uint32   *submitted = malloc (INSTANCE_COUNT * sizeof (Uint32));
+    for (Size i = 0; i < INSTANCE_COUNT; i++) {
+        Uint64 r     = test_rand_u64 (&state);
+        instances[i] = (Instance) {
+            .pass         = r % 3 ? DRAW_PASS_OPAQUE : DRAW_PASS_BLENDED,
+            .is_primitive = (r >> 8) % 10 == 0,
+            .mesh_type    = (r >> 16) % MESH_TYPE_COUNT,
+            .depth        = test_rand_f32 (&state, 0.f, 1.f)
+        };
+
+        /* primitives are anti-aliased, so they're always blended and have no mesh */
+        if (instances[i].is_primitive) {
+            instances[i].pass      = DRAW_PASS_BLENDED;
+            instances[i].mesh_type = 0;
+        }
+        submitted[i] = i;
+    }
+
+    /* in order instances were drawn in */
+    check_draw_order ("unsorted", instances, submitted, INSTANCE_COUNT, False);
+
+    /* after being sorted by draw keys, as merge of staged instances does */
+    Uint64 *keys          = malloc (INSTANCE_COUNT * sizeof (Uint64));
+    Uint64 *key_scratch   = malloc (INSTANCE_COUNT * sizeof (Uint64));
+    Uint32 *value_scratch = malloc (INSTANCE_COUNT * sizeof (Uint32));
+    for (Size i = 0; i < INSTANCE_COUNT; i++) {
+        keys[i] = instance_key (instances + i);
+    }
+    TEST_CHECK (
+        radix_sort_u64 (keys, submitted, key_scratch, value_scratch, INSTANCE_COUNT),
+        "failed to sort draw keys\n"
+    );
+    check_draw_order ("sorted", instances, submitted, INSTANCE_COUNT, True);
+
+    free (keys);
+    free (key_scratch);
+    free (value_scratch);
+    free (submitted);
+    free (instances);
+}
+
+int main() {
+    test_pack();
+    test_find_batch();
+    test_draw_order();
+
+    if (test_failures) {
+        fprintf (stderr, "%zu checks failed\n", test_failures);
+        return EXIT_FAILURE;
+    }
+
+    printf ("all draw key checks passed\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,464 @@
+/**
+ * @file GlyphAtlasTest.c
+ * @date Sun, 18th October 2026
+ * @author Siddharth Mishra (admin@brightprogrammer.in)
+ * @copyright Copyright 2024 Siddharth Mishra
+ * @copyright Copyright 2024 Anvie Labs
+ *
+ * Copyright 2024 Siddharth Mishra, Anvie Labs
+ * 
+ * Redistribution and use in source and binary forms, with or without modification, are permitted 
+ * provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+ *    and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions
+ *    and the following disclaimer in the documentation and/or other materials provided with the
+ *    distribution.
+ * 
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse
+ *    or promote products derived from this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND 
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * */
+
+/**
+ * @b Tests for glyph atlas packing, lookup, eviction and dirty rectangle tracking.
+ *
+ * Every glyph bitmap is filled with a value derived from it's key, so that any
+ * overlap between packed glyphs, or a glyph overwritten while still in use,
+ * shows up as wrong pixels.
+ * */
+
+#include <Anvie/Common.h>
+#include <Anvie/Types.h>
+
+/* crossgui-utils */
+#include <Anvie/CrossGui/Utils/Allocator.h>
+#include <Anvie/CrossGui/Utils/GlyphAtlas.h>
+
+/* libc */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+/* local includes */
+#include "Test.h"
+
+static Size test_failures = 0;
+
+static Uint64 live_allocations() {
+    AllocatorStats stats = {0};
+    allocator_get_stats (ALLOCATOR_TAG_GLYPH_ATLAS, &stats);
+    return stats.live_allocations;
+}
+
+static Uint8 glyph_value (GlyphKey *key) {
+    return 1 + (key->font * 31 + key->glyph * 7 + key->size) % 255;
+}
+
+/**
+ * @b Insert a glyph of given size, with all pixels set to value derived from key.
+ * */
+static GlyphAtlasEntry *insert_glyph (GlyphAtlas *atlas, GlyphKey key, Uint32 w, Uint32 h) {
+    static Uint8 bitmap[64 * 64];
+    memset (bitmap, glyph_value (&key), sizeof (bitmap));
+    return glyph_atlas_insert (atlas, &key, w, h, bitmap, 64);
+}
+
+/**
+ * @b Check that glyph pixels are intact, it's padding is clear and it lies in it's page.
+ * */
+static Bool glyph_is_intact (GlyphAtlas *atlas, GlyphAtlasEntry *entry) {
+    GlyphAtlasRect r = entry->rect;
+    if (!r.width || !r.height) {
+        return entry->page == GLYPH_ATLAS_PAGE_NONE;
+    }
+
+    Uint32 page_top    = entry->page * atlas->page_height;
+    Uint32 page_bottom = page_top + atlas->page_height;
+    if (r.y < page_top + GLYPH_ATLAS_PADDING || r.x < GLYPH_ATLAS_PADDING ||
+        (Uint32)r.y + r.height + GLYPH_ATLAS_PADDING > page_bottom ||
+        (Uint32)r.x + r.width + GLYPH_ATLAS_PADDING > atlas->width) {
+        return False;
+    }
+
+    Uint8 value = glyph_value (&entry->key);
+    for (Int32 y = (Int32)r.y - 1; y <= r.y + r.height; y++) {
+        for (Int32 x = (Int32)r.x - 1; x <= r.x + r.width; x++) {
+            Bool  inside   = x >= r.x && x < r.x + r.width && y >= r.y && y < r.y + r.height;
+            Uint8 expected = inside ? value : 0;
+            if (atlas->pixels[y * atlas->width + x] != expected) {
+                return False;
+            }
+        }
+    }
+
+    return True;
+}
+
+/**
+ * @b Check that every glyph in use can be found by it's key, and is intact.
+ * */
+static Bool all_glyphs_are_intact (GlyphAtlas *atlas) {
+    Uint32 used = 0;
+    for (Size e = 0; e < atlas->entries.count; e++) {
+        GlyphAtlasEntry *entry = atlas->entries.heap + e;
+        if (!entry->is_used) {
+            continue;
+        }
+
+        used++;
+        if (glyph_atlas_find (atlas, &entry->key) != entry || !glyph_is_intact (atlas, entry)) {
+            return False;
+        }
+    }
+
+    return used == atlas->glyph_count;
+}
+
+static void test_packing() {
+    GlyphAtlas atlas;
+    TEST_CHECK (glyph_atlas_init (&atlas, 512, 512, 4), "failed to create atlas\n");
+    TEST_CHECK (atlas.dirty_rects.count == 1, "new atlas must be dirty as a whole\n");
+    glyph_atlas_clear_dirty_rects (&atlas);
+
+    /* fill atlas in a single frame, without eviction */
+    Uint64 rng    = 0x6a09e667f3bcc908ull;
+    Size   area   = 0;
+    Uint32 glyphs = 0;
+    for (;; glyphs++) {
+        Uint32 w = 4 + test_rand_u64 (&rng) % 28;
+        Uint32 h = 8 + test_rand_u64 (&rng) % 24;
+
+        GlyphKey key = {.font = 1, .glyph = glyphs, .size = 16};
+        if (!insert_glyph (&atlas, key, w, h)) {
+            break;
+        }
+        area += (w + 2 * GLYPH_ATLAS_PADDING) * (h + 2 * GLYPH_ATLAS_PADDING);
+    }
+
+    TEST_CHECK (!atlas.evictions, "nothing may be evicted within a single frame\n");
+    TEST_CHECK (glyphs == atlas.glyph_count, "glyph count mismatch\n");
+    TEST_CHECK (all_glyphs_are_intact (&atlas), "packed glyphs overlap or are corrupted\n");
+    TEST_CHECK (
+        area * 100 >= 512 * 512 * 75,
+        "skyline packer used only %zu%% of atlas\n",
+        area * 100 / (512 * 512)
+    );
+    TEST_CHECK (
+        atlas.dirty_rects.count <= GLYPH_ATLAS_DIRTY_RECT_MAX,
+        "too many dirty rects\n"
+    );
+
+    /* blank glyphs take no space, even in a full atlas */
+    GlyphKey         space = {.font = 1, .glyph = 100000, .size = 16};
+    GlyphAtlasEntry *blank = glyph_atlas_insert (&atlas, &space, 0, 0, Null, 0);
+    TEST_CHECK (blank && blank->page == GLYPH_ATLAS_PAGE_NONE, "blank glyph must be cached\n");
+
+    /* same key at different size is a different glyph */
+    GlyphKey other = {.font = 1, .glyph = 0, .size = 17};
+    TEST_CHECK (!glyph_atlas_find (&atlas, &other), "size must be a part of glyph key\n");
+
+    glyph_atlas_deinit (&atlas);
+}
+
+static void test_eviction() {
+    GlyphAtlas atlas;
+    glyph_atlas_init (&atlas, 256, 256, 8);
+    glyph_atlas_clear_dirty_rects (&atlas);
+
+    /* a working set of glyphs is used every frame, along with new glyphs */
+    Uint64 rng        = 0xbb67ae8584caa73bull;
+    Uint32 next_glyph = 1000;
+    Bool   all_ok     = True;
+    for (Uint32 frame = 0; frame < 500; frame++) {
+        glyph_atlas_begin_frame (&atlas);
+
+        for (Uint32 g = 0; g < 20; g++) {
+            GlyphKey key = {.font = 0, .glyph = g, .size = 12};
+            if (!glyph_atlas_find (&atlas, &key)) {
+                all_ok &= !!insert_glyph (&atlas, key, 6 + g % 5, 10);
+            }
+        }
+
+        for (Uint32 g = 0; g < 10; g++) {
+            GlyphKey key = {.font = 2, .glyph = next_glyph++, .size = 12};
+            Uint32   w   = 4 + test_rand_u64 (&rng) % 20;
+            all_ok      &= !!insert_glyph (&atlas, key, w, 4 + test_rand_u64 (&rng) % 26);
+        }
+
+        /* glyphs used in this frame must never be evicted in this frame */
+        for (Uint32 g = 0; g < 20; g++) {
+            GlyphKey         key   = {.font = 0, .glyph = g, .size = 12};
+            GlyphAtlasEntry *entry = glyph_atlas_find (&atlas, &key);
+            all_ok                &= entry && glyph_is_intact (&atlas, entry);
+        }
+
+        if (frame % 50 == 0) {
+            all_ok &= all_glyphs_are_intact (&atlas);
+        }
+
+        glyph_atlas_clear_dirty_rects (&atlas);
+    }
+
+    TEST_CHECK (all_ok, "glyph lost or corrupted while in use\n");
+    TEST_CHECK (atlas.evictions, "atlas must have evicted pages\n");
+    TEST_CHECK (all_glyphs_are_intact (&atlas), "hash table inconsistent after evictions\n");
+    TEST_CHECK (
+        atlas.entries.count <= atlas.glyph_count + atlas.free_entries.count,
+        "leaked glyph entries\n"
+    );
+
+    /* evicted glyphs are gone */
+    Uint32 cached = 0;
+    for (Uint32 g = 1000; g < next_glyph; g++) {
+        cached += !!glyph_atlas_find (&atlas, &(GlyphKey) {.font = 2, .glyph = g, .size = 12});
+    }
+    TEST_CHECK (cached == atlas.glyph_count - 20, "evicted glyphs must not be found\n");
+
+    glyph_atlas_deinit (&atlas);
+}
+
+static void test_pinned_frame() {
+    GlyphAtlas atlas;
+    glyph_atlas_init (&atlas, 128, 128, 2);
+
+    /* all glyphs are used in same frame, so once full, inserts must fail */
+    Uint32 inserted = 0;
+    while (insert_glyph (&atlas, (GlyphKey) {.glyph = inserted}, 30, 30)) {
+        inserted++;
+    }
+    TEST_CHECK (inserted && !atlas.evictions, "atlas must not evict pages in use\n");
+    TEST_CHECK (all_glyphs_are_intact (&atlas), "failed insert corrupted atlas\n");
+
+    /* in next frame, old pages can be evicted to make space */
+    glyph_atlas_begin_frame (&atlas);
+    TEST_CHECK (
+        insert_glyph (&atlas, (GlyphKey) {.glyph = inserted}, 30, 30),
+        "insert must evict an unused page\n"
+    );
+    TEST_CHECK (atlas.evictions == 1, "exactly one page must be evicted\n");
+
+    /* glyph larger than a page never fits */
+    TEST_CHECK (
+        !insert_glyph (&atlas, (GlyphKey) {.glyph = 99999}, 8, 64),
+        "glyph taller than a page must be rejected\n"
+    );
+
+    glyph_atlas_deinit (&atlas);
+}
+
+/**
+ * @b A glyph quad as recorded by a text batch, drawn from atlas every frame until
+ * batch is reset, without it's glyph being looked up again.
+ * */
+typedef struct RetainedGlyph {
+    GlyphKey       key;
+    GlyphAtlasRect rect;
+} RetainedGlyph;
+
+static void test_retained_text() {
+    GlyphAtlas atlas;
+    glyph_atlas_init (&atlas, 256, 128, 8);
+
+    RetainedGlyph      retained[64];
+    Uint32             retained_count = 0;
+    GlyphAtlasPageMask pages          = 0;
+    Uint64             rng            = 0x3c6ef372fe94f82bull;
+    Uint32             next_glyph     = 0;
+    Uint32             failed_inserts = 0;
+    Uint32             overwritten    = 0;
+
+    /* a label drawn once and never reset, glyphs of which are never looked up again */
+    Uint32             label_count = 10;
+    GlyphAtlasPageMask label_pages = 0;
+    for (Uint32 g = 0; g < label_count; g++) {
+        GlyphKey         key   = {.font = 4, .glyph = g, .size = 12};
+        GlyphAtlasEntry *entry = insert_glyph (&atlas, key, 10, 12);
+        retained[g]            = (RetainedGlyph) {.key = key, .rect = entry->rect};
+        label_pages           |= (GlyphAtlasPageMask)1 << entry->page;
+    }
+
+    /* rest of text batch is reset every few frames, and new text is drawn every
+     * frame, so atlas fills up many times over, with label still on screen */
+    for (Uint32 frame = 0; frame < 2000; frame++) {
+        if (!(frame % 3)) {
+            retained_count = label_count;
+            pages          = label_pages;
+        }
+
+        for (Uint32 g = 0; g < 6; g++) {
+            GlyphKey         key   = {.font = 3, .glyph = next_glyph++, .size = 12};
+            Uint32           w     = 4 + test_rand_u64 (&rng) % 16;
+            GlyphAtlasEntry *entry = insert_glyph (&atlas, key, w, 4 + test_rand_u64 (&rng) % 10);
+            if (!entry) {
+                failed_inserts++;
+                continue;
+            }
+
+            retained[retained_count++] = (RetainedGlyph) {.key = key, .rect = entry->rect};
+            pages                     |= (GlyphAtlasPageMask)1 << entry->page;
+        }
+
+        /* pixels under every quad still drawn must still be it's glyph */
+        for (Uint32 r = 0; r < retained_count; r++) {
+            GlyphAtlasRect rect  = retained[r].rect;
+            Uint8          value = glyph_value (&retained[r].key);
+            Bool           is_ok = True;
+            for (Uint32 y = rect.y; y < (Uint32)rect.y + rect.height; y++) {
+                for (Uint32 x = rect.x; x < (Uint32)rect.x + rect.width; x++) {
+                    is_ok = is_ok && atlas.pixels[y * atlas.width + x] == value;
+                }
+            }
+            overwritten += !is_ok;
+        }
+
+        /* display ends the frame, keeping pages of text that's still drawn */
+        glyph_atlas_begin_frame (&atlas);
+        glyph_atlas_keep_pages (&atlas, pages);
+    }
+
+    TEST_CHECK (!failed_inserts, "%u inserts failed once atlas was full\n", failed_inserts);
+    TEST_CHECK (!overwritten, "%u retained glyphs were overwritten\n", overwritten);
+    TEST_CHECK (atlas.evictions > 100, "atlas must have been refilled many times\n");
+    TEST_CHECK (all_glyphs_are_intact (&atlas), "atlas corrupted\n");
+
+    glyph_atlas_deinit (&atlas);
+}
+
+static void test_dirty_rects() {
+    GlyphAtlas atlas;
+    glyph_atlas_init (&atlas, 512, 512, 1);
+    glyph_atlas_clear_dirty_rects (&atlas);
+
+    GlyphAtlasEntry *entry = insert_glyph (&atlas, (GlyphKey) {.glyph = 1}, 10, 12);
+    TEST_CHECK (atlas.dirty_rects.count == 1, "insert must add exactly one dirty rect\n");
+
+    GlyphAtlasRect d = atlas.dirty_rects.heap[0];
+    GlyphAtlasRect r = entry->rect;
+    TEST_CHECK (
+        d.x + GLYPH_ATLAS_PADDING == r.x && d.y + GLYPH_ATLAS_PADDING == r.y &&
+            d.width == r.width + 2 * GLYPH_ATLAS_PADDING &&
+            d.height == r.height + 2 * GLYPH_ATLAS_PADDING,
+        "dirty rect must cover glyph and it's padding\n"
+    );
+
+    /* cache hits change nothing */
+    glyph_atlas_clear_dirty_rects (&atlas);
+    glyph_atlas_find (&atlas, &(GlyphKey) {.glyph = 1});
+    TEST_CHECK (!atlas.dirty_rects.count, "lookup must not dirty atlas\n");
+
+    /* too many rects are merged into a bounding box covering all of them */
+    for (Uint32 g = 2; g < 2 + 2 * GLYPH_ATLAS_DIRTY_RECT_MAX; g++) {
+        insert_glyph (&atlas, (GlyphKey) {.glyph = g}, 8, 8);
+    }
+    TEST_CHECK (
+        atlas.dirty_rects.count <= GLYPH_ATLAS_DIRTY_RECT_MAX,
+        "dirty rects must be merged\n"
+    );
+
+    Bool covered = True;
+    for (Uint32 g = 2; g < 2 + 2 * GLYPH_ATLAS_DIRTY_RECT_MAX; g++) {
+        GlyphAtlasRect gr = glyph_atlas_find (&atlas, &(GlyphKey) {.glyph = g})->rect;
+
+        Bool any = False;
+        for (Size s = 0; s < atlas.dirty_rects.count; s++) {
+            GlyphAtlasRect dr  = atlas.dirty_rects.heap[s];
+            any               |= gr.x >= dr.x && gr.y >= dr.y &&
+                   gr.x + gr.width <= dr.x + dr.width && gr.y + gr.height <= dr.y + dr.height;
+        }
+        covered &= any;
+    }
+    TEST_CHECK (covered, "every changed glyph must be within a dirty rect\n");
+
+    glyph_atlas_deinit (&atlas);
+}
+
+static void test_save_load() {
+    GlyphAtlas atlas;
+    glyph_atlas_init (&atlas, 256, 256, 4);
+
+    for (Uint32 g = 0; g < 100; g++) {
+        GlyphAtlasEntry *entry = insert_glyph (&atlas, (GlyphKey) {.glyph = g}, 4 + g % 13, 9);
+        entry->advance         = g;
+    }
+    glyph_atlas_insert (&atlas, &(GlyphKey) {.glyph = 100}, 0, 0, Null, 0);
+
+    char path[] = "/tmp/glyph_atlas_test_XXXXXX";
+    close (mkstemp (path));
+    TEST_CHECK (glyph_atlas_save (&atlas, path), "failed to save atlas\n");
+
+    GlyphAtlas loaded;
+    glyph_atlas_init (&loaded, 256, 256, 4);
+    glyph_atlas_clear_dirty_rects (&loaded);
+    TEST_CHECK (glyph_atlas_load (&loaded, path), "failed to load atlas\n");
+
+    TEST_CHECK (loaded.glyph_count == atlas.glyph_count, "glyph count changed on load\n");
+    TEST_CHECK (all_glyphs_are_intact (&loaded), "glyphs corrupted on load\n");
+    TEST_CHECK (
+        loaded.dirty_rects.count == 1 && loaded.dirty_rects.heap[0].width == 256,
+        "loaded atlas must be dirty as a whole\n"
+    );
+
+    Bool same = True;
+    for (Uint32 g = 0; g < 100; g++) {
+        GlyphAtlasEntry *a  = glyph_atlas_find (&atlas, &(GlyphKey) {.glyph = g});
+        GlyphAtlasEntry *b  = glyph_atlas_find (&loaded, &(GlyphKey) {.glyph = g});
+        same               &= b && !memcmp (&a->rect, &b->rect, sizeof (a->rect)) &&
+                b->advance == g;
+    }
+    TEST_CHECK (same, "glyphs moved or lost metrics on load\n");
+
+    /* packing continues where saved atlas left off, without overlapping loaded glyphs */
+    for (Uint32 g = 200; g < 260; g++) {
+        insert_glyph (&loaded, (GlyphKey) {.glyph = g}, 11, 9);
+    }
+    TEST_CHECK (all_glyphs_are_intact (&loaded), "glyph packed over a loaded glyph\n");
+
+    /* atlas of a different size can't be loaded into */
+    GlyphAtlas other;
+    glyph_atlas_init (&other, 128, 256, 4);
+    TEST_CHECK (!glyph_atlas_load (&other, path), "atlas of different size must be rejected\n");
+    TEST_CHECK (other.width == 128 && !other.glyph_count, "failed load changed atlas\n");
+
+    /* truncated file is rejected */
+    TEST_CHECK (!truncate (path, 100), "failed to truncate atlas file\n");
+    TEST_CHECK (!glyph_atlas_load (&loaded, path), "truncated file must be rejected\n");
+    TEST_CHECK (all_glyphs_are_intact (&loaded), "failed load changed atlas\n");
+
+    unlink (path);
+    glyph_atlas_deinit (&other);
+    glyph_atlas_deinit (&loaded);
+    glyph_atlas_deinit (&atlas);
+}
+
+int main() {
+    Uint64 allocations = live_allocations();
+
+    test_packing();
+    test_eviction();
+    test_pinned_frame();
+    test_retained_text();
+    test_dirty_rects();
+    test_save_load();
+
+    TEST_CHECK (live_allocations() == allocations, "glyph atlas leaked memory\n");
+
+    if (test_failures) {
+        fprintf (stderr, "%zu checks failed\n", test_failures);
+        return EXIT_FAILURE;
+    }
+
+    printf ("all glyph atlas checks passed\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,267 @@
+/**
+ * @file JobSystemTest.c
+ * @date Sun, 18th October 2026
+ * @author Siddharth Mishra (admin@brightprogrammer.in)
+ * @copyright Copyright 2024 Siddharth Mishra
+ * @copyright Copyright 2024 Anvie Labs
+ *
+ * Copyright 2024 Siddharth Mishra, Anvie Labs
+ * 
+ * Redistribution and use in source and binary forms, with or without modification, are permitted 
+ * provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+ *    and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions
+ *    and the following disclaimer in the documentation and/or other materials provided with the
+ *    distribution.
+ * 
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse
+ *    or promote products derived from this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND 
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * */
+
+/**
+ * @b Tests for job system, every job must run exactly once before a wait on
+ * it's counter returns, whether it's run by owner, stolen, or submitted by
+ * another job.
+ * */
+
+#include <Anvie/Common.h>
+#include <Anvie/Types.h>
+
+/* crossgui-utils */
+#include <Anvie/CrossGui/Utils/JobSystem.h>
+
+/* libc */
+#include <stdio.h>
+#include <stdlib.h>
+
+/* local includes */
+#include "Test.h"
+
+static Size test_failures = 0;
+
+#define JOB_COUNT  1000
+#define TREE_DEPTH 14
+
+typedef struct Job {
+    Uint64    input;
+    Uint64    output;
+    Uint32    runs;
+    pthread_t thread;
+} Job;
+
+static void run_job (void *data) {
+    Job *job = data;
+
+    /* some work, so that jobs overlap */
+    Uint64 x = job->input;
+    for (Uint32 i = 0; i < 1000; i++) {
+        x = x * 6364136223846793005ull + 1442695040888963407ull;
+    }
+
+    job->output = x;
+    job->thread = pthread_self();
+    job->runs++;
+}
+
+static Uint64 expected_output (Uint64 input) {
+    Job job = {.input = input};
+    run_job (&job);
+    return job.output;
+}
+
+/**
+ * @b Node of a binary tree of jobs, each job submits it's two children
+ * and waits on them, so most jobs are submitted and waited on by jobs.
+ * */
+typedef struct TreeJob {
+    JobSystem *jobs;
+    Uint32     depth;
+    Uint64     leaves;
+    Bool       is_ok;
+} TreeJob;
+
+static void run_tree_job (void *data) {
+    TreeJob *job = data;
+
+    if (!job->depth) {
+        job->leaves = 1;
+        job->is_ok  = True;
+        return;
+    }
+
+    TreeJob    children[2] = {0};
+    JobCounter counter     = {0};
+    job->is_ok             = True;
+    for (Uint32 c = 0; c < 2; c++) {
+        children[c] = (TreeJob) {.jobs = job->jobs, .depth = job->depth - 1};
+        job->is_ok &= !!job_system_submit (job->jobs, run_tree_job, children + c, &counter);
+    }
+
+    job->is_ok  = job->is_ok && job_system_wait (job->jobs, &counter);
+    job->is_ok  = job->is_ok && children[0].is_ok && children[1].is_ok;
+    job->leaves = children[0].leaves + children[1].leaves;
+}
+
+#define FOREIGN_THREAD_COUNT 4
+#define FOREIGN_JOB_COUNT    (JOB_SYSTEM_INJECT_CAPACITY / 2)
+
+/**
+ * @b Thread that is not part of job system, like a render thread, submitting
+ * and waiting on it's own jobs. Together they submit more jobs than injection
+ * queue can hold.
+ * */
+typedef struct ForeignThread {
+    JobSystem *jobs;
+    Job        jobs_data[FOREIGN_JOB_COUNT];
+    TreeJob    root;
+    Bool       is_ok;
+} ForeignThread;
+
+static void *submit_from_foreign_thread (void *arg) {
+    ForeignThread *thread  = arg;
+    JobCounter     counter = {0};
+
+    thread->is_ok = True;
+    for (Uint32 j = 0; j < FOREIGN_JOB_COUNT; j++) {
+        Job *job       = thread->jobs_data + j;
+        *job           = (Job) {.input = j};
+        thread->is_ok &= !!job_system_submit (thread->jobs, run_job, job, &counter);
+    }
+    thread->is_ok &= !!job_system_wait (thread->jobs, &counter);
+
+    thread->root   = (TreeJob) {.jobs = thread->jobs, .depth = TREE_DEPTH / 2};
+    thread->is_ok &= !!job_system_submit (thread->jobs, run_tree_job, &thread->root, &counter);
+    thread->is_ok &= !!job_system_wait (thread->jobs, &counter);
+
+    /* only owner can wait on all jobs, it can't know about jobs of other threads */
+    thread->is_ok &= !job_system_wait (thread->jobs, Null);
+
+    return Null;
+}
+
+static void test_batches (Uint32 thread_count, Bool is_main_participating) {
+    JobSystem jobs;
+    TEST_CHECK (
+        job_system_init (&jobs, thread_count, is_main_participating),
+        "failed to create job system\n"
+    );
+    TEST_CHECK (jobs.thread_count >= 1, "job system must have at least one thread\n");
+
+    static Job jobs_data[JOB_COUNT];
+    JobCounter counter = {0};
+
+    /* counter is reused for several batches of different sizes */
+    for (Uint32 batch = 1; batch <= 4; batch++) {
+        Uint32 count = JOB_COUNT / batch;
+        for (Uint32 j = 0; j < count; j++) {
+            jobs_data[j] = (Job) {.input = batch * JOB_COUNT + j};
+            job_system_submit (&jobs, run_job, jobs_data + j, &counter);
+        }
+
+        TEST_CHECK (job_system_wait (&jobs, &counter), "failed to wait for jobs\n");
+
+        Bool all_ok     = True;
+        Bool is_on_main = False;
+        for (Uint32 j = 0; j < count; j++) {
+            all_ok &= jobs_data[j].runs == 1;
+            all_ok &= jobs_data[j].output == expected_output (jobs_data[j].input);
+            is_on_main |= pthread_equal (jobs_data[j].thread, pthread_self());
+        }
+        TEST_CHECK (all_ok, "a job ran more than once, never, or gave wrong output\n");
+        TEST_CHECK (
+            is_main_participating || !is_on_main,
+            "a job ran on thread that does not participate\n"
+        );
+        TEST_CHECK (!atomic_load (&counter.value), "counter must be zero after wait\n");
+    }
+
+    /* waiting with nothing submitted returns right away */
+    TEST_CHECK (job_system_wait (&jobs, Null), "wait on idle job system failed\n");
+
+    /* jobs submitted by jobs, and waited on by jobs */
+    TreeJob root = {.jobs = &jobs, .depth = TREE_DEPTH};
+    job_system_submit (&jobs, run_tree_job, &root, &counter);
+    job_system_wait (&jobs, &counter);
+    TEST_CHECK (
+        root.is_ok && root.leaves == 1u << TREE_DEPTH,
+        "tree of jobs found %zu leaves\n",
+        (Size)root.leaves
+    );
+
+    /* jobs submitted and waited on by threads outside of job system */
+    static ForeignThread foreign[FOREIGN_THREAD_COUNT];
+    pthread_t            threads[FOREIGN_THREAD_COUNT];
+    for (Uint32 t = 0; t < FOREIGN_THREAD_COUNT; t++) {
+        foreign[t].jobs = &jobs;
+        pthread_create (threads + t, Null, submit_from_foreign_thread, foreign + t);
+    }
+
+    Bool all_foreign_ok = True;
+    for (Uint32 t = 0; t < FOREIGN_THREAD_COUNT; t++) {
+        pthread_join (threads[t], Null);
+
+        all_foreign_ok &= foreign[t].is_ok;
+        all_foreign_ok &= foreign[t].root.is_ok;
+        all_foreign_ok &= foreign[t].root.leaves == 1u << (TREE_DEPTH / 2);
+        for (Uint32 j = 0; j < FOREIGN_JOB_COUNT; j++) {
+            Job *job        = foreign[t].jobs_data + j;
+            all_foreign_ok &= job->runs == 1 && job->output == expected_output (job->input);
+        }
+    }
+    TEST_CHECK (all_foreign_ok, "jobs of a foreign thread ran more than once, never, or wrong\n");
+
+    /* more jobs than a deque can hold, rest are run by submitting thread */
+    static Job many[JOB_SYSTEM_DEQUE_CAPACITY * 2];
+    for (Uint32 j = 0; j < ARRAY_SIZE (many); j++) {
+        many[j] = (Job) {.input = j};
+        TEST_CHECK (job_system_submit (&jobs, run_job, many + j, Null), "submit failed\n");
+    }
+    TEST_CHECK (job_system_wait (&jobs, Null), "failed to wait for all jobs\n");
+
+    Bool all_ran = True;
+    for (Uint32 j = 0; j < ARRAY_SIZE (many); j++) {
+        all_ran &= many[j].runs == 1;
+    }
+    TEST_CHECK (all_ran, "a job ran more than once or never, with a full deque\n");
+
+    /* jobs still queued are completed before job system stops */
+    for (Uint32 j = 0; j < 100; j++) {
+        jobs_data[j] = (Job) {.input = j};
+        job_system_submit (&jobs, run_job, jobs_data + j, Null);
+    }
+    TEST_CHECK (job_system_deinit (&jobs), "failed to destroy job system\n");
+
+    all_ran = True;
+    for (Uint32 j = 0; j < 100; j++) {
+        all_ran &= jobs_data[j].runs == 1;
+    }
+    TEST_CHECK (all_ran, "deinit must complete submitted jobs\n");
+}
+
+int main() {
+    test_batches (0, True);
+    test_batches (1, True);
+    test_batches (7, True);
+    test_batches (1, False);
+    test_batches (4, False);
+
+    if (test_failures) {
+        fprintf (stderr, "%zu checks failed\n", test_failures);
+        return EXIT_FAILURE;
+    }
+
+    printf ("all job system checks passed\n");
+    return EXIT_SUCCESS;
+}
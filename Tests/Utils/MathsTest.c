@@ -0,0 +1,638 @@
+/**
+ * @file MathsTest.c
+ * @date Sun, 18th October 2026
+ * @author Siddharth Mishra (admin@brightprogrammer.in)
+ * @copyright Copyright 2024 Siddharth Mishra
+ * @copyright Copyright 2024 Anvie Labs
+ *
+ * Copyright 2024 Siddharth Mishra, Anvie Labs
+ * 
+ * Redistribution and use in source and binary forms, with or without modification, are permitted 
+ * provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+ *    and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions
+ *    and the following disclaimer in the documentation and/or other materials provided with the
+ *    distribution.
+ * 
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse
+ *    or promote products derived from this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND 
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * */
+
+/**
+ * @b Correctness tests for Maths.h, MathsInline.h and batch math kernels.
+ *
+ * Every function is compared against a double precision reference on random
+ * inputs, and maximum error observed is reported in ULPs. Batch kernels are
+ * tested for every instruction set supported by host CPU, and must produce
+ * results bit-identical to scalar kernels.
+ * */
+
+#include <Anvie/Common.h>
+#include <Anvie/Types.h>
+
+/* crossgui-utils */
+#include <Anvie/CrossGui/Utils/Maths.h>
+#include <Anvie/CrossGui/Utils/MathsInline.h>
+
+/* libc */
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* local includes */
+#include "Test.h"
+
+#define SAMPLE_COUNT    4096
+#define BATCH_MAX_COUNT 1024
+
+/* stats of checked and inline variant of a function */
+#define STATS(fname, ulp)                                                                          \
+    {                                                                                              \
+        {.name = fname, .bound = ulp}, {.name = fname "_inline", .bound = ulp }                    \
+    }
+
+static Size   test_failures = 0;
+static Uint64 rng_state     = 0x853c49e6748fea9bull;
+
+/**************************************************************************************************/
+/******************************************* REFERENCES *******************************************/
+/**************************************************************************************************/
+
+/* all matrices here are flat, column major arrays, same as elem[c][r] in Maths.h */
+#define ELEM(m, n, r, c) ((m)[(c) * (n) + (r)])
+
+static void rand_array (Float32 *arr, Size count, Float32 lo, Float32 hi) {
+    for (Size s = 0; s < count; s++) {
+        arr[s] = test_rand_f32 (&rng_state, lo, hi);
+    }
+}
+
+/**
+ * @b Generate a random, well conditioned matrix, so that error of inverse
+ * is dominated by rounding in function being tested and not by conditioning.
+ * */
+static void rand_invertible (Float32 *mat, Size n) {
+    rand_array (mat, n * n, -1.f, 1.f);
+    for (Size s = 0; s < n; s++) {
+        ELEM (mat, n, s, s) += test_rand_u64 (&rng_state) & 1 ? (Float32)n : -(Float32)n;
+    }
+}
+
+static void record_array (
+    TestUlpStat   *stat,
+    const Float32 *got,
+    const Float64 *ref,
+    const Float64 *scale,
+    Size           count
+) {
+    for (Size s = 0; s < count; s++) {
+        test_ulp_record (stat, got[s], ref[s], scale ? scale[s] : 0);
+    }
+}
+
+/**
+ * @b Compute @c res = @c a x @c b where @c a is n x n and @c b is n x cols.
+ * @c scale receives sum of magnitudes of products for each entry.
+ * */
+static void ref_mat_mul (
+    Float64       *res,
+    Float64       *scale,
+    const Float32 *a,
+    const Float32 *b,
+    Size           n,
+    Size           cols
+) {
+    for (Size c = 0; c < cols; c++) {
+        for (Size r = 0; r < n; r++) {
+            Float64 sum = 0, mag = 0;
+            for (Size k = 0; k < n; k++) {
+                Float64 p  = (Float64)ELEM (a, n, r, k) * (Float64)ELEM (b, n, k, c);
+                sum       += p;
+                mag       += fabs (p);
+            }
+            ELEM (res, n, r, c)   = sum;
+            ELEM (scale, n, r, c) = mag;
+        }
+    }
+}
+
+/**
+ * @b Determinant using LU decomposition with partial pivoting.
+ * @c scale receives Hadamard bound (product of column norms) of matrix.
+ * */
+static Float64 ref_mat_det (const Float32 *mat, Size n, Float64 *scale) {
+    Float64 lu[16];
+    Float64 det = 1;
+
+    *scale = 1;
+    for (Size c = 0; c < n; c++) {
+        Float64 norm = 0;
+        for (Size r = 0; r < n; r++) {
+            ELEM (lu, n, r, c)  = ELEM (mat, n, r, c);
+            norm               += ELEM (lu, n, r, c) * ELEM (lu, n, r, c);
+        }
+        *scale *= sqrt (norm);
+    }
+
+    for (Size c = 0; c < n; c++) {
+        Size pivot = c;
+        for (Size r = c + 1; r < n; r++) {
+            if (fabs (ELEM (lu, n, r, c)) > fabs (ELEM (lu, n, pivot, c))) {
+                pivot = r;
+            }
+        }
+
+        if (ELEM (lu, n, pivot, c) == 0) {
+            return 0;
+        }
+
+        if (pivot != c) {
+            for (Size k = 0; k < n; k++) {
+                Float64 t              = ELEM (lu, n, c, k);
+                ELEM (lu, n, c, k)     = ELEM (lu, n, pivot, k);
+                ELEM (lu, n, pivot, k) = t;
+            }
+            det = -det;
+        }
+
+        det *= ELEM (lu, n, c, c);
+        for (Size r = c + 1; r < n; r++) {
+            Float64 f = ELEM (lu, n, r, c) / ELEM (lu, n, c, c);
+            for (Size k = c; k < n; k++) {
+                ELEM (lu, n, r, k) -= f * ELEM (lu, n, c, k);
+            }
+        }
+    }
+
+    return det;
+}
+
+/**
+ * @b Inverse using Gauss-Jordan elimination with partial pivoting.
+ * @c scale receives largest magnitude entry of inverse.
+ * */
+static Bool ref_mat_invert (Float64 *res, Float64 *scale, const Float32 *mat, Size n) {
+    Float64 a[16];
+
+    for (Size c = 0; c < n; c++) {
+        for (Size r = 0; r < n; r++) {
+            ELEM (a, n, r, c)   = ELEM (mat, n, r, c);
+            ELEM (res, n, r, c) = r == c;
+        }
+    }
+
+    for (Size c = 0; c < n; c++) {
+        Size pivot = c;
+        for (Size r = c + 1; r < n; r++) {
+            if (fabs (ELEM (a, n, r, c)) > fabs (ELEM (a, n, pivot, c))) {
+                pivot = r;
+            }
+        }
+
+        if (ELEM (a, n, pivot, c) == 0) {
+            return False;
+        }
+
+        for (Size k = 0; k < n; k++) {
+            Float64 t               = ELEM (a, n, c, k);
+            ELEM (a, n, c, k)       = ELEM (a, n, pivot, k);
+            ELEM (a, n, pivot, k)   = t;
+            t                       = ELEM (res, n, c, k);
+            ELEM (res, n, c, k)     = ELEM (res, n, pivot, k);
+            ELEM (res, n, pivot, k) = t;
+        }
+
+        Float64 inv_pivot = 1 / ELEM (a, n, c, c);
+        for (Size k = 0; k < n; k++) {
+            ELEM (a, n, c, k)   *= inv_pivot;
+            ELEM (res, n, c, k) *= inv_pivot;
+        }
+
+        for (Size r = 0; r < n; r++) {
+            if (r == c) {
+                continue;
+            }
+
+            Float64 f = ELEM (a, n, r, c);
+            for (Size k = 0; k < n; k++) {
+                ELEM (a, n, r, k)   -= f * ELEM (a, n, c, k);
+                ELEM (res, n, r, k) -= f * ELEM (res, n, c, k);
+            }
+        }
+    }
+
+    *scale = 0;
+    for (Size s = 0; s < n * n; s++) {
+        *scale = MAX (*scale, fabs (res[s]));
+    }
+
+    return True;
+}
+
+static void report_all (TestUlpStat (*stats)[2], Size count) {
+    for (Size s = 0; s < count; s++) {
+        for (Size v = 0; v < 2; v++) {
+            TEST_CHECK (test_ulp_report (&stats[s][v]), "%s exceeds bound\n", stats[s][v].name);
+        }
+    }
+}
+
+/**************************************************************************************************/
+/******************************************** VECTORS *********************************************/
+/**************************************************************************************************/
+
+/**
+ * @b Generate test for checked and inline variants of vector methods of given dimension.
+ * Index 0 of each stat pair is for checked method, and index 1 for inline method.
+ * */
+#define GEN_VEC_TEST(n)                                                                            \
+    static void test_vec##n##f() {                                                                 \
+        enum { ADD, SUB, MUL_F32, DOT, NORM, NORMALIZE, OP_MAX };                                  \
+        TestUlpStat stats[OP_MAX][2] = {                                                           \
+            [ADD]       = STATS ("vec" #n "f_add", 1),                                             \
+            [SUB]       = STATS ("vec" #n "f_sub", 1),                                             \
+            [MUL_F32]   = STATS ("vec" #n "f_mul_f32", 1),                                         \
+            [DOT]       = STATS ("vec" #n "f_dot", n),                                             \
+            [NORM]      = STATS ("vec" #n "f_norm", n),                                            \
+            [NORMALIZE] = STATS ("vec" #n "f_normalize", n + 2),                                   \
+        };                                                                                         \
+                                                                                                   \
+        for (Size s = 0; s < SAMPLE_COUNT; s++) {                                                  \
+            Vec##n##f a, b, res;                                                                   \
+            Float32  *fa = (Float32 *)&a, *fb = (Float32 *)&b, *fres = (Float32 *)&res;            \
+            Float32   k  = test_rand_f32 (&rng_state, -4.f, 4.f);                                  \
+            Float64   ref[n], scale[n], dot = 0, dot_scale = 0, norm = 0;                          \
+                                                                                                   \
+            rand_array (fa, n, -100.f, 100.f);                                                     \
+            rand_array (fb, n, -100.f, 100.f);                                                     \
+                                                                                                   \
+            for (Size i = 0; i < n; i++) {                                                         \
+                dot       += (Float64)fa[i] * fb[i];                                               \
+                dot_scale += fabs ((Float64)fa[i] * fb[i]);                                        \
+                norm      += (Float64)fa[i] * fa[i];                                               \
+            }                                                                                      \
+            norm = sqrt (norm);                                                                    \
+                                                                                                   \
+            for (Size i = 0; i < n; i++) {                                                         \
+                ref[i] = (Float64)fa[i] + fb[i];                                                   \
+            }                                                                                      \
+            TEST_CHECK (vec##n##f_add (&res, &a, &b) == &res, "must return res\n");                \
+            record_array (&stats[ADD][0], fres, ref, Null, n);                                     \
+            res = vec##n##f_add_inline (a, b);                                                     \
+            record_array (&stats[ADD][1], fres, ref, Null, n);                                     \
+                                                                                                   \
+            for (Size i = 0; i < n; i++) {                                                         \
+                ref[i] = (Float64)fa[i] - fb[i];                                                   \
+            }                                                                                      \
+            vec##n##f_sub (&res, &a, &b);                                                          \
+            record_array (&stats[SUB][0], fres, ref, Null, n);                                     \
+            res = vec##n##f_sub_inline (a, b);                                                     \
+            record_array (&stats[SUB][1], fres, ref, Null, n);                                     \
+                                                                                                   \
+            for (Size i = 0; i < n; i++) {                                                         \
+                ref[i] = (Float64)fa[i] * k;                                                       \
+            }                                                                                      \
+            vec##n##f_mul_f32 (&res, &a, k);                                                       \
+            record_array (&stats[MUL_F32][0], fres, ref, Null, n);                                 \
+            res = vec##n##f_mul_f32_inline (a, k);                                                 \
+            record_array (&stats[MUL_F32][1], fres, ref, Null, n);                                 \
+                                                                                                   \
+            test_ulp_record (&stats[DOT][0], vec##n##f_dot (&a, &b), dot, dot_scale);              \
+            test_ulp_record (&stats[DOT][1], vec##n##f_dot_inline (a, b), dot, dot_scale);         \
+            test_ulp_record (&stats[NORM][0], vec##n##f_norm (&a), norm, 0);                       \
+            test_ulp_record (&stats[NORM][1], vec##n##f_norm_inline (a), norm, 0);                 \
+                                                                                                   \
+            for (Size i = 0; i < n; i++) {                                                         \
+                ref[i]   = fa[i] / norm;                                                           \
+                scale[i] = 1;                                                                      \
+            }                                                                                      \
+            vec##n##f_normalize (&res, &a);                                                        \
+            record_array (&stats[NORMALIZE][0], fres, ref, scale, n);                              \
+            res = vec##n##f_normalize_inline (a);                                                  \
+            record_array (&stats[NORMALIZE][1], fres, ref, scale, n);                              \
+        }                                                                                          \
+                                                                                                   \
+        report_all (stats, OP_MAX);                                                                \
+    }
+
+GEN_VEC_TEST (2);
+GEN_VEC_TEST (3);
+GEN_VEC_TEST (4);
+
+static void test_vec3f_cross() {
+    TestUlpStat stats[1][2] = {STATS ("vec3f_cross", 2)};
+
+    for (Size s = 0; s < SAMPLE_COUNT; s++) {
+        Vec3f    a, b, res;
+        Float32 *fa = (Float32 *)&a, *fb = (Float32 *)&b, *fres = (Float32 *)&res;
+        rand_array (fa, 3, -100.f, 100.f);
+        rand_array (fb, 3, -100.f, 100.f);
+
+        Float64 ref[3], scale[3];
+        for (Size i = 0; i < 3; i++) {
+            Size    j = (i + 1) % 3, k = (i + 2) % 3;
+            Float64 p = (Float64)fa[j] * fb[k], q = (Float64)fa[k] * fb[j];
+            ref[i]    = p - q;
+            scale[i]  = fabs (p) + fabs (q);
+        }
+
+        TEST_CHECK (vec3f_cross (&res, &a, &b) == &res, "must return res\n");
+        record_array (&stats[0][0], fres, ref, scale, 3);
+        res = vec3f_cross_inline (a, b);
+        record_array (&stats[0][1], fres, ref, scale, 3);
+    }
+
+    report_all (stats, 1);
+}
+
+/**************************************************************************************************/
+/******************************************** MATRICES ********************************************/
+/**************************************************************************************************/
+
+/**
+ * @b Generate test for checked and inline variants of matrix methods of given dimension.
+ * Bounds of det and invert grow with dimension, as these perform more operations per entry.
+ * */
+#define GEN_MAT_TEST(n, det_ulp, invert_ulp)                                                       \
+    static void test_mat##n##f() {                                                                 \
+        enum { ADD, SUB, MUL_F32, MUL, MUL_VEC, TRANSPOSE, DET, INVERT, OP_MAX };                  \
+        TestUlpStat stats[OP_MAX][2] = {                                                           \
+            [ADD]       = STATS ("mat" #n "f_add", 1),                                             \
+            [SUB]       = STATS ("mat" #n "f_sub", 1),                                             \
+            [MUL_F32]   = STATS ("mat" #n "f_mul_f32", 1),                                         \
+            [MUL]       = STATS ("mat" #n "f_mul", n),                                             \
+            [MUL_VEC]   = STATS ("mat" #n "f_mul_vec", n),                                         \
+            [TRANSPOSE] = STATS ("mat" #n "f_transpose", 0),                                       \
+            [DET]       = STATS ("mat" #n "f_det", det_ulp),                                       \
+            [INVERT]    = STATS ("mat" #n "f_invert", invert_ulp),                                 \
+        };                                                                                         \
+                                                                                                   \
+        for (Size s = 0; s < SAMPLE_COUNT; s++) {                                                  \
+            Mat##n##f a, b, res;                                                                   \
+            Vec##n##f v, res_v;                                                                    \
+            Float32  *fa = &a.elem[0][0], *fb = &b.elem[0][0], *fres = &res.elem[0][0];            \
+            Float32  *fv = (Float32 *)&v, *fres_v = (Float32 *)&res_v;                             \
+            Float32   k  = test_rand_f32 (&rng_state, -4.f, 4.f);                                  \
+            Float64   ref[n * n], scale[n * n], det, det_scale;                                    \
+                                                                                                   \
+            rand_invertible (fa, n);                                                               \
+            rand_array (fb, n * n, -100.f, 100.f);                                                 \
+            rand_array (fv, n, -100.f, 100.f);                                                     \
+                                                                                                   \
+            for (Size i = 0; i < n * n; i++) {                                                     \
+                ref[i] = (Float64)fa[i] + fb[i];                                                   \
+            }                                                                                      \
+            TEST_CHECK (mat##n##f_add (&res, &a, &b) == &res, "must return res\n");                \
+            record_array (&stats[ADD][0], fres, ref, Null, n * n);                                 \
+            res = mat##n##f_add_inline (a, b);                                                     \
+            record_array (&stats[ADD][1], fres, ref, Null, n * n);                                 \
+                                                                                                   \
+            for (Size i = 0; i < n * n; i++) {                                                     \
+                ref[i] = (Float64)fa[i] - fb[i];                                                   \
+            }                                                                                      \
+            mat##n##f_sub (&res, &a, &b);                                                          \
+            record_array (&stats[SUB][0], fres, ref, Null, n * n);                                 \
+            res = mat##n##f_sub_inline (a, b);                                                     \
+            record_array (&stats[SUB][1], fres, ref, Null, n * n);                                 \
+                                                                                                   \
+            for (Size i = 0; i < n * n; i++) {                                                     \
+                ref[i] = (Float64)fb[i] * k;                                                       \
+            }                                                                                      \
+            mat##n##f_mul_f32 (&res, &b, k);                                                       \
+            record_array (&stats[MUL_F32][0], fres, ref, Null, n * n);                             \
+            res = mat##n##f_mul_f32_inline (b, k);                                                 \
+            record_array (&stats[MUL_F32][1], fres, ref, Null, n * n);                             \
+                                                                                                   \
+            ref_mat_mul (ref, scale, fa, fb, n, n);                                                \
+            mat##n##f_mul (&res, &a, &b);                                                          \
+            record_array (&stats[MUL][0], fres, ref, scale, n * n);                                \
+            res = mat##n##f_mul_inline (a, b);                                                     \
+            record_array (&stats[MUL][1], fres, ref, scale, n * n);                                \
+                                                                                                   \
+            ref_mat_mul (ref, scale, fb, fv, n, 1);                                                \
+            mat##n##f_mul_vec (&res_v, &b, &v);                                                    \
+            record_array (&stats[MUL_VEC][0], fres_v, ref, scale, n);                              \
+            res_v = mat##n##f_mul_vec_inline (b, v);                                               \
+            record_array (&stats[MUL_VEC][1], fres_v, ref, scale, n);                              \
+                                                                                                   \
+            for (Size c = 0; c < n; c++) {                                                         \
+                for (Size r = 0; r < n; r++) {                                                     \
+                    ELEM (ref, n, r, c) = ELEM (fb, n, c, r);                                      \
+                }                                                                                  \
+            }                                                                                      \
+            mat##n##f_transpose (&res, &b);                                                        \
+            record_array (&stats[TRANSPOSE][0], fres, ref, Null, n * n);                           \
+            res = mat##n##f_transpose_inline (b);                                                  \
+            record_array (&stats[TRANSPOSE][1], fres, ref, Null, n * n);                           \
+                                                                                                   \
+            det = ref_mat_det (fb, n, &det_scale);                                                 \
+            test_ulp_record (&stats[DET][0], mat##n##f_det (&b), det, det_scale);                  \
+            test_ulp_record (&stats[DET][1], mat##n##f_det_inline (b), det, det_scale);            \
+                                                                                                   \
+            TEST_CHECK (ref_mat_invert (ref, &det_scale, fa, n), "reference inverse failed\n");    \
+            for (Size i = 0; i < n * n; i++) {                                                     \
+                scale[i] = det_scale;                                                              \
+            }                                                                                      \
+            TEST_CHECK (mat##n##f_invert (&res, &a) == &res, "must return res\n");                 \
+            record_array (&stats[INVERT][0], fres, ref, scale, n * n);                             \
+            res = mat##n##f_invert_inline (a);                                                     \
+            record_array (&stats[INVERT][1], fres, ref, scale, n * n);                             \
+        }                                                                                          \
+                                                                                                   \
+        /* singular matrix must be rejected instead of producing garbage */                        \
+        Mat##n##f zero = {0}, res;                                                                 \
+        TEST_CHECK (mat##n##f_invert (&res, &zero) == Null, "singular matrix inverted\n");         \
+                                                                                                   \
+        report_all (stats, OP_MAX);                                                                \
+    }
+
+GEN_MAT_TEST (2, 2, 4);
+GEN_MAT_TEST (3, 4, 8);
+GEN_MAT_TEST (4, 8, 16);
+
+/**************************************************************************************************/
+/***************************************** BATCH KERNELS ******************************************/
+/**************************************************************************************************/
+
+/* counts around vector widths, to exercise main loop as well as remainder handling */
+static const Size batch_counts[] = {0, 1, 2, 3, 4, 5, 7, 8, 9, 15, 16, 17, 31, 33, BATCH_MAX_COUNT};
+
+static Vec2f  batch_vec2f[BATCH_MAX_COUNT + 1], batch_vec2f_res[MATHS_ISA_MAX][BATCH_MAX_COUNT + 1];
+static Vec4f  batch_vec4f[BATCH_MAX_COUNT], batch_vec4f_res[MATHS_ISA_MAX][BATCH_MAX_COUNT];
+static Aabb2f batch_boxes[BATCH_MAX_COUNT], batch_boxes_res[MATHS_ISA_MAX][BATCH_MAX_COUNT];
+static Aabb2f batch_union[MATHS_ISA_MAX];
+
+/**
+ * @b Run all batch kernels of given instruction set on shared inputs, and
+ * compare results with reference. Results are stored for cross-isa comparison.
+ * */
+static void test_batch_isa (MathsIsa isa, Mat3f *m3, Mat4f *m4, Aabb2f *clip, Size count) {
+    static Char names[MATHS_ISA_MAX][2][64];
+    static TestUlpStat stats[MATHS_ISA_MAX][2];
+
+    if (!stats[isa][0].name) {
+        snprintf (names[isa][0], 64, "vec2f_transform_batch[%s]", maths_isa_name (isa));
+        snprintf (names[isa][1], 64, "vec4f_transform_batch[%s]", maths_isa_name (isa));
+        stats[isa][0] = (TestUlpStat) {.name = names[isa][0], .bound = 2};
+        stats[isa][1] = (TestUlpStat) {.name = names[isa][1], .bound = 4};
+    }
+
+    /* start vec2f arrays at odd index for odd counts, to test unaligned access */
+    Size   offset = count & 1;
+    Vec2f *v2     = batch_vec2f + offset;
+    Vec2f *res2   = batch_vec2f_res[isa] + offset;
+
+    TEST_CHECK (vec2f_transform_batch (res2, m3, v2, count) == res2, "must return res\n");
+    for (Size s = 0; s < count; s++) {
+        Float64 ref[2], scale[2];
+        for (Size r = 0; r < 2; r++) {
+            Float64 p = (Float64)m3->elem[0][r] * v2[s].x, q = (Float64)m3->elem[1][r] * v2[s].y;
+            ref[r]    = p + q + m3->elem[2][r];
+            scale[r]  = fabs (p) + fabs (q) + fabs (m3->elem[2][r]);
+        }
+        record_array (&stats[isa][0], (Float32 *)(res2 + s), ref, scale, 2);
+    }
+
+    Vec4f *res4 = batch_vec4f_res[isa];
+    TEST_CHECK (vec4f_transform_batch (res4, m4, batch_vec4f, count) == res4, "must return res\n");
+    for (Size s = 0; s < count; s++) {
+        Float64 ref[4], scale[4];
+        ref_mat_mul (ref, scale, &m4->elem[0][0], (Float32 *)(batch_vec4f + s), 4, 1);
+        record_array (&stats[isa][1], (Float32 *)(res4 + s), ref, scale, 4);
+    }
+
+    Aabb2f ref_union = {
+        .min = {.x = INFINITY, .y = INFINITY},
+        .max = {.x = -INFINITY, .y = -INFINITY}
+    };
+    for (Size s = 0; s < count; s++) {
+        ref_union.min.x = MIN (ref_union.min.x, batch_boxes[s].min.x);
+        ref_union.min.y = MIN (ref_union.min.y, batch_boxes[s].min.y);
+        ref_union.max.x = MAX (ref_union.max.x, batch_boxes[s].max.x);
+        ref_union.max.y = MAX (ref_union.max.y, batch_boxes[s].max.y);
+    }
+    TEST_CHECK (aabb2f_union_batch (&batch_union[isa], batch_boxes, count), "union failed\n");
+    TEST_CHECK (
+        !memcmp (&batch_union[isa], &ref_union, sizeof (Aabb2f)),
+        "[%s] union of %zu boxes is wrong\n",
+        maths_isa_name (isa),
+        count
+    );
+
+    Aabb2f *res_boxes = batch_boxes_res[isa];
+    TEST_CHECK (aabb2f_intersect_batch (res_boxes, batch_boxes, clip, count), "clip failed\n");
+    for (Size s = 0; s < count; s++) {
+        Aabb2f b = batch_boxes[s];
+        Aabb2f ref = {
+            .min = {.x = MAX (b.min.x, clip->min.x), .y = MAX (b.min.y, clip->min.y)},
+            .max = {.x = MIN (b.max.x, clip->max.x), .y = MIN (b.max.y, clip->max.y)}
+        };
+        TEST_CHECK (
+            !memcmp (res_boxes + s, &ref, sizeof (Aabb2f)),
+            "[%s] clipped box %zu/%zu is wrong\n",
+            maths_isa_name (isa),
+            s,
+            count
+        );
+    }
+
+    if (count == BATCH_MAX_COUNT) {
+        TEST_CHECK (test_ulp_report (&stats[isa][0]), "%s exceeds bound\n", stats[isa][0].name);
+        TEST_CHECK (test_ulp_report (&stats[isa][1]), "%s exceeds bound\n", stats[isa][1].name);
+    }
+}
+
+static void test_batch() {
+    MathsIsa best = maths_get_isa();
+    printf ("batch kernels dispatched to : %s\n", maths_isa_name (best));
+
+    Mat3f  m3;
+    Mat4f  m4;
+    Aabb2f clip = {
+        .min = {.x = -50.f, .y = -25.f},
+        .max = {.x = 50.f,  .y = 25.f }
+    };
+
+    rand_array (&m3.elem[0][0], 9, -4.f, 4.f);
+    rand_array (&m4.elem[0][0], 16, -4.f, 4.f);
+    rand_array ((Float32 *)batch_vec2f, 2 * ARRAY_SIZE (batch_vec2f), -1000.f, 1000.f);
+    for (Size s = 0; s < BATCH_MAX_COUNT; s++) {
+        rand_array ((Float32 *)(batch_vec4f + s), 4, -1000.f, 1000.f);
+
+        Float32 box[4];
+        rand_array (box, 2, -100.f, 100.f);
+        rand_array (box + 2, 2, 0.f, 50.f);
+        batch_boxes[s] = (Aabb2f) {
+            .min = {.x = box[0],          .y = box[1]         },
+            .max = {.x = box[0] + box[2], .y = box[1] + box[3]}
+        };
+    }
+
+    for (Size c = 0; c < ARRAY_SIZE (batch_counts); c++) {
+        Size count = batch_counts[c];
+
+        for (MathsIsa isa = MATHS_ISA_SCALAR; isa < MATHS_ISA_MAX; isa++) {
+            if (!maths_set_isa (isa)) {
+                continue;
+            }
+
+            test_batch_isa (isa, &m3, &m4, &clip, count);
+
+            /* kernels don't use FMA or reassociate, so all isa must agree bit by bit */
+            Size   offset  = count & 1;
+            Vec2f *res2    = batch_vec2f_res[isa] + offset;
+            Vec2f *scalar2 = batch_vec2f_res[MATHS_ISA_SCALAR] + offset;
+            Vec4f *res4    = batch_vec4f_res[isa];
+            Vec4f *scalar4 = batch_vec4f_res[MATHS_ISA_SCALAR];
+            TEST_CHECK (
+                !memcmp (res2, scalar2, count * sizeof (Vec2f)) &&
+                    !memcmp (res4, scalar4, count * sizeof (Vec4f)),
+                "[%s] transform of %zu vectors differs from scalar\n",
+                maths_isa_name (isa),
+                count
+            );
+        }
+    }
+
+    /* results must be correct even when written over input */
+    maths_set_isa (best);
+    Vec2f in_place[17], out_of_place[17];
+    memcpy (in_place, batch_vec2f, sizeof (in_place));
+    vec2f_transform_batch (out_of_place, &m3, in_place, 17);
+    vec2f_transform_batch (in_place, &m3, in_place, 17);
+    TEST_CHECK (!memcmp (in_place, out_of_place, sizeof (in_place)), "in place result differs\n");
+
+    TEST_CHECK (!maths_set_isa (MATHS_ISA_MAX), "invalid isa must be rejected\n");
+    TEST_CHECK (maths_get_isa() == best, "failed set must not change isa\n");
+}
+
+int main() {
+    test_vec2f();
+    test_vec3f();
+    test_vec4f();
+    test_vec3f_cross();
+    test_mat2f();
+    test_mat3f();
+    test_mat4f();
+    test_batch();
+
+    if (test_failures) {
+        fprintf (stderr, "%zu checks failed\n", test_failures);
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
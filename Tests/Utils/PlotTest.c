@@ -0,0 +1,228 @@
+/**
+ * @file PlotTest.c
+ * @date Sun, 18th October 2026
+ * @author Siddharth Mishra (admin@brightprogrammer.in)
+ * @copyright Copyright 2024 Siddharth Mishra
+ * @copyright Copyright 2024 Anvie Labs
+ *
+ * Copyright 2024 Siddharth Mishra, Anvie Labs
+ * 
+ * Redistribution and use in source and binary forms, with or without modification, are permitted 
+ * provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+ *    and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions
+ *    and the following disclaimer in the documentation and/or other materials provided with the
+ *    distribution.
+ * 
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse
+ *    or promote products derived from this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND 
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * */
+
+/**
+ * @b Tests for level of detail pyramid and decimation of plot series.
+ *
+ * Pyramid is compared against brute force min/max of each bucket, both when
+ * built in one go and when built by many small appends, and decimated output
+ * is checked to keep extremes of visible range within bounded number of points.
+ * */
+
+#include <Anvie/Common.h>
+#include <Anvie/Types.h>
+
+/* crossgui-utils */
+#include <Anvie/CrossGui/Utils/Allocator.h>
+#include <Anvie/CrossGui/Utils/Plot.h>
+
+/* libc */
+#include <float.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* local includes */
+#include "Test.h"
+
+#define SAMPLE_COUNT 100003
+
+static Size test_failures = 0;
+
+static Uint64 live_allocations() {
+    AllocatorStats stats = {0};
+    allocator_get_stats (ALLOCATOR_TAG_PLOT, &stats);
+    return stats.live_allocations;
+}
+
+/**
+ * @b Check every bucket of every level against brute force min/max of it's samples.
+ * Samples must be distinct so order of extremes is well defined.
+ * */
+static Bool pyramid_is_exact (PlotSeries *series, Float32 *samples, Size count) {
+    if (series->samples.count != count) {
+        return False;
+    }
+
+    Size below = count;
+    for (Uint32 level = 0; level < series->level_count; level++) {
+        PlotExtremesVector *vec         = series->levels + level;
+        Size                bucket_size = (Size)2 << level;
+
+        if (vec->count != (below + 1) / 2) {
+            return False;
+        }
+
+        for (Size b = 0; b < vec->count; b++) {
+            Size begin = b * bucket_size;
+            Size end   = MIN (begin + bucket_size, count);
+
+            Size min = begin, max = begin;
+            for (Size s = begin; s < end; s++) {
+                min = samples[s] < samples[min] ? s : min;
+                max = samples[s] > samples[max] ? s : max;
+            }
+
+            PlotExtremes expected =
+                min <= max ? (PlotExtremes) {samples[min], samples[max]} :
+                             (PlotExtremes) {samples[max], samples[min]};
+            PlotExtremes got = vec->heap[b];
+            if (got.first != expected.first || got.second != expected.second) {
+                return False;
+            }
+        }
+
+        below = vec->count;
+    }
+
+    /* last level has a single bucket, unless there is at most one sample */
+    return count > 1 ? series->levels[series->level_count - 1].count == 1 :
+                       !series->level_count;
+}
+
+static void test_pyramid (Float32 *samples) {
+    PlotSeries series;
+    plot_series_init (&series, 0, 1);
+
+    plot_series_append (&series, samples, SAMPLE_COUNT);
+    TEST_CHECK (pyramid_is_exact (&series, samples, SAMPLE_COUNT), "pyramid built at once\n");
+
+    /* incremental appends in chunks of varying size must give same pyramid */
+    plot_series_clear (&series);
+    TEST_CHECK (!series.samples.count && !series.level_count, "clear must empty series\n");
+
+    Uint64 rng = 0x9e3779b97f4a7c15ull;
+    for (Size s = 0; s < SAMPLE_COUNT;) {
+        Size chunk = MIN (1 + test_rand_u64 (&rng) % 97, SAMPLE_COUNT - s);
+        plot_series_append (&series, samples + s, chunk);
+        s += chunk;
+
+        if (s < 64 || !(test_rand_u64 (&rng) % 128)) {
+            TEST_CHECK (pyramid_is_exact (&series, samples, s), "pyramid at %zu samples\n", s);
+        }
+    }
+    TEST_CHECK (pyramid_is_exact (&series, samples, SAMPLE_COUNT), "pyramid built by appends\n");
+
+    plot_series_deinit (&series);
+}
+
+static void test_decimate (Float32 *samples) {
+    PlotSeries series;
+    plot_series_init (&series, -10, 0.5);
+    plot_series_append (&series, samples, SAMPLE_COUNT);
+
+    Vec2f points[PLOT_SERIES_DECIMATE_MAX_POINTS (1000)];
+
+    /* zoomed in, samples are drawn as they are */
+    Size count = plot_series_decimate (&series, 0, 100, 1000, points, ARRAY_SIZE (points));
+    TEST_CHECK (count == 201, "expected raw samples, got %zu points\n", count);
+    for (Size s = 0; s < count; s++) {
+        Float32 x = (Float32)s * 5;
+        TEST_CHECK (fabsf (points[s].x - x) < 1e-3f, "x of point %zu is %f\n", s, points[s].x);
+        TEST_CHECK (points[s].y == samples[20 + s], "y of point %zu is not sample\n", s);
+    }
+
+    /* zoomed out, output is bounded and visible extremes are kept */
+    Uint64 rng = 0x243f6a8885a308d3ull;
+    for (Size t = 0; t < 200; t++) {
+        Uint32  width = 1 + test_rand_u64 (&rng) % 1000;
+        Float64 begin = test_rand_f32 (&rng, -100, SAMPLE_COUNT * 0.5f);
+        Float64 end   = begin + test_rand_f32 (&rng, 1, SAMPLE_COUNT * 0.5f);
+
+        count = plot_series_decimate (&series, begin, end, width, points, ARRAY_SIZE (points));
+        TEST_CHECK (
+            count <= PLOT_SERIES_DECIMATE_MAX_POINTS (width),
+            "too many points : %zu for width %u\n",
+            count,
+            width
+        );
+
+        Float32 got_min = FLT_MAX, got_max = -FLT_MAX;
+        for (Size s = 0; s < count; s++) {
+            got_min = MIN (got_min, points[s].y);
+            got_max = MAX (got_max, points[s].y);
+        }
+
+        /* every sample in visible range must be within drawn extremes */
+        Size    first   = (Size)MAX (0, ceil ((begin + 10) / 0.5));
+        Size    last    = (Size)MIN (SAMPLE_COUNT - 1, floor ((end + 10) / 0.5));
+        Float32 vis_min = FLT_MAX, vis_max = -FLT_MAX;
+        for (Size s = first; s <= last; s++) {
+            vis_min = MIN (vis_min, samples[s]);
+            vis_max = MAX (vis_max, samples[s]);
+        }
+        TEST_CHECK (
+            got_min <= vis_min && got_max >= vis_max,
+            "extremes lost in [%f, %f] at width %u\n",
+            begin,
+            end,
+            width
+        );
+    }
+
+    /* never writes more points than given space */
+    count = plot_series_decimate (&series, 0, SAMPLE_COUNT, 1000, points, 7);
+    TEST_CHECK (count == 7, "must fill exactly available space, got %zu\n", count);
+
+    /* nothing visible */
+    count = plot_series_decimate (&series, -100, -20, 1000, points, ARRAY_SIZE (points));
+    TEST_CHECK (!count, "range before first sample must be empty\n");
+
+    plot_series_deinit (&series);
+}
+
+int main() {
+    Uint64 allocations = live_allocations();
+
+    /* random walk with distinct values, like a typical signal */
+    Float32 *samples = malloc (SAMPLE_COUNT * sizeof (Float32));
+    Uint64   rng     = 0x853c49e6748fea9bull;
+    Float32  value   = 0;
+    for (Size s = 0; s < SAMPLE_COUNT; s++) {
+        value      += test_rand_f32 (&rng, -1, 1) + (Float32)s * 1e-7f;
+        samples[s]  = value;
+    }
+
+    test_pyramid (samples);
+    test_decimate (samples);
+    TEST_CHECK (live_allocations() == allocations, "plot series leaked memory\n");
+
+    free (samples);
+
+    if (test_failures) {
+        fprintf (stderr, "%zu checks failed\n", test_failures);
+        return EXIT_FAILURE;
+    }
+
+    printf ("all plot checks passed\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,187 @@
+/**
+ * @file RadixSortTest.c
+ * @date Sun, 18th October 2026
+ * @author Siddharth Mishra (admin@brightprogrammer.in)
+ * @copyright Copyright 2024 Siddharth Mishra
+ * @copyright Copyright 2024 Anvie Labs
+ *
+ * Copyright 2024 Siddharth Mishra, Anvie Labs
+ * 
+ * Redistribution and use in source and binary forms, with or without modification, are permitted 
+ * provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+ *    and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions
+ *    and the following disclaimer in the documentation and/or other materials provided with the
+ *    distribution.
+ * 
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse
+ *    or promote products derived from this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND 
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * */
+
+/**
+ * @b Tests for radix sort, keys must come out in same order as a stable
+ * comparison sort puts them, with their values.
+ * */
+
+#include <Anvie/Common.h>
+#include <Anvie/Types.h>
+
+/* crossgui-utils */
+#include <Anvie/CrossGui/Utils/RadixSort.h>
+
+/* libc */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* local includes */
+#include "Test.h"
+
+static Size test_failures = 0;
+
+#define KEY_COUNT 100000
+
+typedef struct KeyValue {
+    Uint64 key;
+    Uint32 value;
+} KeyValue;
+
+static Uint64 random_state = 0x853c49e6748fea9bull;
+
+static Uint64 random_u64() {
+    random_state ^= random_state << 13;
+    random_state ^= random_state >> 7;
+    random_state ^= random_state << 17;
+    return random_state;
+}
+
+/* values are indices of keys, so this orders equal keys as a stable sort does */
+static int compare_key_values (const void *a, const void *b) {
+    const KeyValue *x = a;
+    const KeyValue *y = b;
+
+    if (x->key != y->key) {
+        return x->key < y->key ? -1 : 1;
+    }
+    return x->value < y->value ? -1 : x->value > y->value;
+}
+
+/**
+ * @b Sort given keys with and without values, and compare against qsort.
+ * */
+static void check_sort (CString name, Uint64 *keys, Size count) {
+    Uint64   *sorted_keys   = malloc (MAX (count, 1) * sizeof (Uint64));
+    Uint32   *values        = malloc (MAX (count, 1) * sizeof (Uint32));
+    Uint64   *key_scratch   = malloc (MAX (count, 1) * sizeof (Uint64));
+    Uint32   *value_scratch = malloc (MAX (count, 1) * sizeof (Uint32));
+    KeyValue *expected      = malloc (MAX (count, 1) * sizeof (KeyValue));
+
+    for (Size k = 0; k < count; k++) {
+        sorted_keys[k] = keys[k];
+        values[k]      = k;
+        expected[k]    = (KeyValue) {.key = keys[k], .value = k};
+    }
+    qsort (expected, count, sizeof (KeyValue), compare_key_values);
+
+    TEST_CHECK (
+        radix_sort_u64 (sorted_keys, values, key_scratch, value_scratch, count) == sorted_keys,
+        "%s : sort failed\n",
+        name
+    );
+
+    Size mismatches = 0;
+    for (Size k = 0; k < count; k++) {
+        mismatches += sorted_keys[k] != expected[k].key || values[k] != expected[k].value;
+    }
+    TEST_CHECK (!mismatches, "%s : %zu keys out of place\n", name, mismatches);
+
+    /* keys alone */
+    memcpy (sorted_keys, keys, count * sizeof (Uint64));
+    TEST_CHECK (
+        radix_sort_u64 (sorted_keys, Null, key_scratch, Null, count) == sorted_keys,
+        "%s : sort without values failed\n",
+        name
+    );
+
+    mismatches = 0;
+    for (Size k = 0; k < count; k++) {
+        mismatches += sorted_keys[k] != expected[k].key;
+    }
+    TEST_CHECK (!mismatches, "%s : %zu keys out of place without values\n", name, mismatches);
+
+    free (sorted_keys);
+    free (values);
+    free (key_scratch);
+    free (value_scratch);
+    free (expected);
+}
+
+static void test_radix_sort() {
+    Uint64 *keys = malloc (KEY_COUNT * sizeof (Uint64));
+
+    check_sort ("empty", keys, 0);
+
+    keys[0] = 42;
+    check_sort ("single", keys, 1);
+
+    for (Size k = 0; k < KEY_COUNT; k++) {
+        keys[k] = random_u64();
+    }
+    check_sort ("random", keys, KEY_COUNT);
+
+    /* few distinct keys, so stability is what decides order of values */
+    for (Size k = 0; k < KEY_COUNT; k++) {
+        keys[k] = random_u64() % 7;
+    }
+    check_sort ("duplicates", keys, KEY_COUNT);
+
+    /* packed keys, like draw sort keys, use few bytes, and an odd number of passes */
+    for (Size k = 0; k < KEY_COUNT; k++) {
+        keys[k] = ((random_u64() & 1) << 56) | ((random_u64() % 5) << 24) |
+                  (random_u64() & 0xffffff);
+    }
+    check_sort ("packed", keys, KEY_COUNT);
+
+    for (Size k = 0; k < KEY_COUNT; k++) {
+        keys[k] = (Uint64)-1;
+    }
+    check_sort ("equal", keys, KEY_COUNT);
+
+    for (Size k = 0; k < KEY_COUNT; k++) {
+        keys[k] = KEY_COUNT - k;
+    }
+    check_sort ("reversed", keys, KEY_COUNT);
+
+    /* invalid arguments */
+    TEST_CHECK (!radix_sort_u64 (Null, Null, keys, Null, 1), "sort without keys succeeded\n");
+    TEST_CHECK (
+        !radix_sort_u64 (keys, (Uint32 *)keys, keys, Null, 1),
+        "sort of values without scratch succeeded\n"
+    );
+
+    free (keys);
+}
+
+int main() {
+    test_radix_sort();
+
+    if (test_failures) {
+        fprintf (stderr, "%zu checks failed\n", test_failures);
+        return EXIT_FAILURE;
+    }
+
+    printf ("all radix sort checks passed\n");
+    return EXIT_SUCCESS;
+}
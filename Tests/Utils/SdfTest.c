@@ -0,0 +1,214 @@
+/**
+ * @file SdfTest.c
+ * @date Sun, 18th October 2026
+ * @author Siddharth Mishra (admin@brightprogrammer.in)
+ * @copyright Copyright 2024 Siddharth Mishra
+ * @copyright Copyright 2024 Anvie Labs
+ *
+ * Copyright 2024 Siddharth Mishra, Anvie Labs
+ * 
+ * Redistribution and use in source and binary forms, with or without modification, are permitted 
+ * provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+ *    and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions
+ *    and the following disclaimer in the documentation and/or other materials provided with the
+ *    distribution.
+ * 
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse
+ *    or promote products derived from this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND 
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * */
+
+/**
+ * @b Tests for signed distance field generation against brute force distances.
+ * */
+
+#include <Anvie/Common.h>
+#include <Anvie/Types.h>
+
+/* crossgui-utils */
+#include <Anvie/CrossGui/Utils/Allocator.h>
+#include <Anvie/CrossGui/Utils/Sdf.h>
+
+/* libc */
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/* local includes */
+#include "Test.h"
+
+static Size test_failures = 0;
+
+#define SHAPE_SIZE 24
+#define PADDING    4
+#define SPREAD     6.f
+
+/**
+ * @b Random blobby coverage bitmap, a few discs with antialiased edges.
+ * */
+static void make_shape (Uint8 *bitmap, Uint64 *rng) {
+    Float32 cx[3], cy[3], r[3];
+    for (Uint32 d = 0; d < 3; d++) {
+        cx[d] = test_rand_f32 (rng, 4, SHAPE_SIZE - 4);
+        cy[d] = test_rand_f32 (rng, 4, SHAPE_SIZE - 4);
+        r[d]  = test_rand_f32 (rng, 1.5f, 7);
+    }
+
+    for (Uint32 y = 0; y < SHAPE_SIZE; y++) {
+        for (Uint32 x = 0; x < SHAPE_SIZE; x++) {
+            Float32 c = 0;
+            for (Uint32 d = 0; d < 3; d++) {
+                Float32 dist = hypotf (x + 0.5f - cx[d], y + 0.5f - cy[d]);
+                c            = MAX (c, CLAMP (r[d] - dist + 0.5f, 0.f, 1.f));
+            }
+            bitmap[y * SHAPE_SIZE + x] = (Uint8)(c * 255);
+        }
+    }
+}
+
+/**
+ * @b Signed distance of a field pixel computed by looking at every source pixel.
+ * */
+static Float32 brute_force_distance (Uint8 *bitmap, Int32 fx, Int32 fy) {
+    Int32 sx     = fx - PADDING;
+    Int32 sy     = fy - PADDING;
+    Bool  inside = sx >= 0 && sy >= 0 && sx < SHAPE_SIZE && sy < SHAPE_SIZE &&
+                  bitmap[sy * SHAPE_SIZE + sx] >= 128;
+
+    Float32 best = 1e20f;
+    for (Int32 y = -PADDING; y < SHAPE_SIZE + PADDING; y++) {
+        for (Int32 x = -PADDING; x < SHAPE_SIZE + PADDING; x++) {
+            Bool other = x >= 0 && y >= 0 && x < SHAPE_SIZE && y < SHAPE_SIZE &&
+                         bitmap[y * SHAPE_SIZE + x] >= 128;
+            if (other != inside) {
+                best = MIN (best, hypotf (x - sx, y - sy));
+            }
+        }
+    }
+
+    return inside ? -(best - 0.5f) : best - 0.5f;
+}
+
+static void test_exact_distances() {
+    Uint8  bitmap[SHAPE_SIZE * SHAPE_SIZE];
+    Uint32 size = sdf_size (SHAPE_SIZE, 1, PADDING);
+    Uint8 *sdf  = malloc (size * size);
+
+    Uint64 rng        = 0x3c6ef372fe94f82bull;
+    Bool   matches    = True;
+    Bool   edge_holds = True;
+    for (Uint32 shape = 0; shape < 20; shape++) {
+        make_shape (bitmap, &rng);
+        TEST_CHECK (
+            sdf_generate (
+                sdf, size, size, bitmap, SHAPE_SIZE, SHAPE_SIZE, SHAPE_SIZE, 1, PADDING, SPREAD
+            ),
+            "failed to generate field\n"
+        );
+
+        for (Uint32 y = 0; y < size; y++) {
+            for (Uint32 x = 0; x < size; x++) {
+                Float32 expected = brute_force_distance (bitmap, x, y);
+                Float32 encoded  = CLAMP (0.5f - expected / (2 * SPREAD), 0.f, 1.f) * 255.f;
+                matches         &= fabsf (sdf[y * size + x] - encoded) <= 1.f;
+
+                /* thresholding field at half reproduces the shape */
+                Int32 sx     = (Int32)x - PADDING;
+                Int32 sy     = (Int32)y - PADDING;
+                Bool  inside = sx >= 0 && sy >= 0 && sx < SHAPE_SIZE && sy < SHAPE_SIZE &&
+                              bitmap[sy * SHAPE_SIZE + sx] >= 128;
+                edge_holds &= (sdf[y * size + x] > 128) == inside;
+            }
+        }
+    }
+
+    TEST_CHECK (matches, "field differs from brute force distances\n");
+    TEST_CHECK (edge_holds, "field thresholded at half must reproduce shape\n");
+
+    free (sdf);
+}
+
+static void test_downscale() {
+    Uint8  bitmap[SHAPE_SIZE * SHAPE_SIZE];
+    Uint32 size = sdf_size (SHAPE_SIZE, 4, 2);
+    Uint8 *sdf  = malloc (size * size);
+
+    /* a disc rasterized bottom up, at 4x field resolution */
+    for (Uint32 y = 0; y < SHAPE_SIZE; y++) {
+        for (Uint32 x = 0; x < SHAPE_SIZE; x++) {
+            Float32 dist                                  = hypotf (x + 0.5f - 12, y + 0.5f - 12);
+            bitmap[(SHAPE_SIZE - 1 - y) * SHAPE_SIZE + x] = dist < 9 ? 255 : 0;
+        }
+    }
+
+    Uint8 *top_row = bitmap + (SHAPE_SIZE - 1) * SHAPE_SIZE;
+    TEST_CHECK (
+        sdf_generate (sdf, size, size, top_row, SHAPE_SIZE, SHAPE_SIZE, -SHAPE_SIZE, 4, 2, 2),
+        "failed to generate downscaled field\n"
+    );
+
+    /* disc of radius 9 source pixels is a disc of radius 2.25 field pixels, centered at 5 */
+    Bool close = True;
+    for (Uint32 y = 0; y < size; y++) {
+        for (Uint32 x = 0; x < size; x++) {
+            Float32 d       = hypotf (x + 0.5f - 5, y + 0.5f - 5) - 2.25f;
+            Float32 decoded = (0.5f - sdf[y * size + x] / 255.f) * 2 * 2;
+            close          &= fabsf (d) >= 2 || fabsf (decoded - d) < 0.3f;
+        }
+    }
+    TEST_CHECK (close, "downscaled field does not match disc\n");
+
+    /* sizes must match */
+    TEST_CHECK (
+        !sdf_generate (sdf, size + 1, size, top_row, SHAPE_SIZE, SHAPE_SIZE, -SHAPE_SIZE, 4, 2, 2),
+        "field of wrong size must be rejected\n"
+    );
+
+    free (sdf);
+}
+
+static void test_blank() {
+    Uint32 size = sdf_size (0, 4, 3);
+    Uint8  sdf[36];
+
+    TEST_CHECK (size == 6, "blank glyph must get a field of padding only\n");
+    TEST_CHECK (sdf_generate (sdf, size, size, Null, 0, 0, 0, 4, 3, 2), "blank field failed\n");
+
+    Bool empty = True;
+    for (Uint32 i = 0; i < size * size; i++) {
+        empty &= !sdf[i];
+    }
+    TEST_CHECK (empty, "blank field must be outside everywhere\n");
+}
+
+int main() {
+    AllocatorStats before = {0}, after = {0};
+    allocator_get_stats (ALLOCATOR_TAG_GLYPH_ATLAS, &before);
+
+    test_exact_distances();
+    test_downscale();
+    test_blank();
+
+    allocator_get_stats (ALLOCATOR_TAG_GLYPH_ATLAS, &after);
+    TEST_CHECK (after.live_allocations == before.live_allocations, "sdf leaked memory\n");
+
+    if (test_failures) {
+        fprintf (stderr, "%zu checks failed\n", test_failures);
+        return EXIT_FAILURE;
+    }
+
+    printf ("all sdf checks passed\n");
+    return EXIT_SUCCESS;
+}
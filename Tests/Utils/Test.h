@@ -0,0 +1,151 @@
+/**
+ * @file Test.h
+ * @date Sun, 18th October 2026
+ * @author Siddharth Mishra (admin@brightprogrammer.in)
+ * @copyright Copyright 2024 Siddharth Mishra
+ * @copyright Copyright 2024 Anvie Labs
+ *
+ * Copyright 2024 Siddharth Mishra, Anvie Labs
+ * 
+ * Redistribution and use in source and binary forms, with or without modification, are permitted 
+ * provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+ *    and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions
+ *    and the following disclaimer in the documentation and/or other materials provided with the
+ *    distribution.
+ * 
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse
+ *    or promote products derived from this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND 
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * */
+
+/**
+ * @b Minimal helpers shared by unit tests and micro-benchmarks.
+ *
+ * Each test executable defines a @c test_failures counter, checks conditions
+ * using @c TEST_CHECK and exits with non-zero status if any check failed, which
+ * is all ctest needs to know.
+ * */
+
+#ifndef ANVIE_CROSSGUI_TESTS_TEST_H
+#define ANVIE_CROSSGUI_TESTS_TEST_H
+
+#include <Anvie/Common.h>
+#include <Anvie/Types.h>
+
+/* libc */
+#include <math.h>
+#include <stdio.h>
+
+/**
+ * @b Check a condition, report and count a failure if it does not hold.
+ * Expects a @c Size @c test_failures variable in scope.
+ * */
+#define TEST_CHECK(cond, ...)                                                                      \
+    do {                                                                                           \
+        if (!(cond)) {                                                                             \
+            fprintf (stderr, "%s:%d : check '%s' failed : ", __FILE__, __LINE__, #cond);           \
+            fprintf (stderr, __VA_ARGS__);                                                         \
+            test_failures++;                                                                       \
+        }                                                                                          \
+    } while (0)
+
+/**
+ * @b Maximum error seen for a single function, in units in last place.
+ *
+ * Errors are measured against a double precision reference, in ULPs of
+ * @c MAX(|reference|, scale). @c scale is the magnitude of intermediate terms
+ * (eg: sum of |a_i * b_i| for dot product), so functions that legitimately
+ * cancel (dot, cross, det) are not held to relative error bounds they cannot meet.
+ * */
+typedef struct TestUlpStat {
+    CString name;     /**< @b Name of function being tested. */
+    Float64 bound;    /**< @b Maximum allowed error in ULPs. */
+    Float64 max_ulps; /**< @b Maximum error observed so far. */
+    Size    samples;  /**< @b Number of values compared. */
+} TestUlpStat;
+
+/**
+ * @b Size of one ULP of single precision float at magnitude @c x.
+ * */
+static inline Float64 test_ulp (Float64 x) {
+    Float32 f = fabsf ((Float32)x);
+    if (!isfinite (f)) {
+        return INFINITY;
+    }
+
+    return (Float64)nextafterf (f, INFINITY) - (Float64)f;
+}
+
+/**
+ * @b Record error of one computed value against it's reference.
+ *
+ * @param stat Stats of function that computed @c got.
+ * @param got Value computed in single precision.
+ * @param ref Reference value computed in double precision.
+ * @param scale Magnitude of intermediate terms. Zero for correctly rounded ops.
+ * */
+static inline void test_ulp_record (TestUlpStat *stat, Float32 got, Float64 ref, Float64 scale) {
+    Float64 err = fabs ((Float64)got - ref);
+    Float64 ulp = test_ulp (MAX (fabs (ref), scale));
+
+    /* non finite results are an error, unless reference is non-finite as well */
+    Float64 ulps = isfinite (got) ? err / ulp : (isfinite (ref) ? INFINITY : 0);
+    stat->max_ulps = MAX (stat->max_ulps, ulps);
+    stat->samples++;
+}
+
+/**
+ * @b Print observed error of given function.
+ *
+ * @return @c True if maximum error is within bound.
+ * @return @c False otherwise.
+ * */
+static inline Bool test_ulp_report (TestUlpStat *stat) {
+    Bool ok = stat->samples && stat->max_ulps <= stat->bound;
+    printf (
+        "%-32s %8zu samples, max error %10.3f ulp (bound %6.1f) %s\n",
+        stat->name,
+        stat->samples,
+        stat->max_ulps,
+        stat->bound,
+        ok ? "ok" : "FAILED"
+    );
+
+    /* keep report in order with errors printed on stderr */
+    fflush (stdout);
+    return ok;
+}
+
+/**
+ * @b Deterministic xorshift64* generator so failures are reproducible.
+ * */
+static inline Uint64 test_rand_u64 (Uint64 *state) {
+    Uint64 x  = *state;
+    x        ^= x >> 12;
+    x        ^= x << 25;
+    x        ^= x >> 27;
+    *state    = x;
+    return x * 0x2545f4914f6cdd1dull;
+}
+
+/**
+ * @b Random float uniformly distributed in @c [lo, hi).
+ * */
+static inline Float32 test_rand_f32 (Uint64 *state, Float32 lo, Float32 hi) {
+    Float32 unit = (Float32)(test_rand_u64 (state) >> 40) / (Float32)(1ull << 24);
+    return lo + (hi - lo) * unit;
+}
+
+#endif // ANVIE_CROSSGUI_TESTS_TEST_H
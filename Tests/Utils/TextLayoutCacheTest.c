@@ -0,0 +1,223 @@
+/**
+ * @file TextLayoutCacheTest.c
+ * @date Sun, 18th October 2026
+ * @author Siddharth Mishra (admin@brightprogrammer.in)
+ * @copyright Copyright 2024 Siddharth Mishra
+ * @copyright Copyright 2024 Anvie Labs
+ *
+ * Copyright 2024 Siddharth Mishra, Anvie Labs
+ * 
+ * Redistribution and use in source and binary forms, with or without modification, are permitted 
+ * provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+ *    and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions
+ *    and the following disclaimer in the documentation and/or other materials provided with the
+ *    distribution.
+ * 
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse
+ *    or promote products derived from this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND 
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * */
+
+/**
+ * @b Tests for text layout cache lookup and generational eviction.
+ *
+ * Glyphs of every layout are derived from it's key, so that a lookup returning
+ * layout of some other key shows up as wrong glyphs.
+ * */
+
+#include <Anvie/Common.h>
+#include <Anvie/Types.h>
+
+/* crossgui-utils */
+#include <Anvie/CrossGui/Utils/Allocator.h>
+#include <Anvie/CrossGui/Utils/TextLayoutCache.h>
+
+/* libc */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* local includes */
+#include "Test.h"
+
+#define CELL_COUNT 10000
+
+static Size test_failures = 0;
+
+static Uint64 live_allocations() {
+    AllocatorStats stats = {0};
+    allocator_get_stats (ALLOCATOR_TAG_TEXT_LAYOUT, &stats);
+    return stats.live_allocations;
+}
+
+/**
+ * @b Key of text in a cell of a grid, text is stored in given buffer.
+ * */
+static TextLayoutKey cell_key (Char *buffer, Uint32 cell, Uint32 label) {
+    Int32 length = snprintf (buffer, 32, "cell %u label %u", cell, label);
+    return (TextLayoutKey) {.text = buffer, .length = length, .font = 1, .size = 16.f};
+}
+
+/**
+ * @b Lay out text of key as a fake monospace run, one glyph per byte.
+ * */
+static TextLayout *insert_layout (TextLayoutCache *cache, TextLayoutKey *key) {
+    static TextLayoutGlyph glyphs[64];
+    for (Uint32 g = 0; g < key->length; g++) {
+        glyphs[g] = (TextLayoutGlyph) {.glyph = (Uint8)key->text[g], .x = g * key->size, .y = 0};
+    }
+    return text_layout_cache_insert (cache, key, glyphs, key->length);
+}
+
+/**
+ * @b Check that layout holds glyphs derived from given key.
+ * */
+static Bool layout_matches (TextLayout *layout, TextLayoutKey *key) {
+    if (!layout || layout->glyph_count != key->length || layout->font != key->font ||
+        layout->size != key->size || layout->max_width != key->max_width ||
+        layout->flags != key->flags) {
+        return False;
+    }
+
+    for (Uint32 g = 0; g < layout->glyph_count; g++) {
+        if (layout->glyphs[g].glyph != (Uint8)key->text[g] ||
+            layout->glyphs[g].x != g * key->size) {
+            return False;
+        }
+    }
+
+    return True;
+}
+
+static void test_grid_relabel() {
+    TextLayoutCache cache = {0};
+    TEST_CHECK (text_layout_cache_init (&cache, 64 << 20), "failed to init cache\n");
+
+    Char text[32];
+    for (Uint32 c = 0; c < CELL_COUNT; c++) {
+        TextLayoutKey key = cell_key (text, c, 0);
+        if (!text_layout_cache_find (&cache, &key)) {
+            TEST_CHECK (layout_matches (insert_layout (&cache, &key), &key), "insert failed\n");
+        }
+    }
+    TEST_CHECK (cache.misses == CELL_COUNT, "first frame must lay out every cell\n");
+    TEST_CHECK (cache.layout_count == CELL_COUNT, "expected a layout per cell\n");
+
+    /* next frame relabels a single cell */
+    text_layout_cache_begin_frame (&cache);
+    Uint64 misses = cache.misses;
+    for (Uint32 c = 0; c < CELL_COUNT; c++) {
+        TextLayoutKey key    = cell_key (text, c, c == 1234);
+        TextLayout   *layout = text_layout_cache_find (&cache, &key);
+        if (!layout) {
+            layout = insert_layout (&cache, &key);
+        }
+        TEST_CHECK (layout_matches (layout, &key), "wrong layout for cell %u\n", c);
+    }
+    TEST_CHECK (cache.misses - misses == 1, "relabeling one cell must lay out one cell\n");
+
+    /* keys differing only outside text are different layouts */
+    TextLayoutKey key = cell_key (text, 0, 0);
+    TextLayoutKey variants[4];
+    for (Uint32 v = 0; v < 4; v++) {
+        variants[v] = key;
+    }
+    variants[0].font      = 2;
+    variants[1].size      = 17.f;
+    variants[2].max_width = 100.f;
+    variants[3].flags     = 1;
+    for (Uint32 v = 0; v < 4; v++) {
+        TEST_CHECK (!text_layout_cache_find (&cache, variants + v), "variant %u must miss\n", v);
+        TEST_CHECK (
+            layout_matches (insert_layout (&cache, variants + v), variants + v),
+            "failed to insert variant %u\n",
+            v
+        );
+    }
+    TEST_CHECK (
+        layout_matches (text_layout_cache_find (&cache, &key), &key),
+        "variants replaced original layout\n"
+    );
+
+    text_layout_cache_deinit (&cache);
+}
+
+static void test_eviction() {
+    TextLayoutCache cache = {0};
+    TEST_CHECK (text_layout_cache_init (&cache, 16 << 10), "failed to init cache\n");
+
+    /* each frame uses a new set of cells, and cell zero in every frame */
+    Char          text[32];
+    TextLayoutKey pinned = cell_key (text, 0, 0);
+    for (Uint32 frame = 0; frame < 20; frame++) {
+        text_layout_cache_begin_frame (&cache);
+        TEST_CHECK (cache.bytes <= cache.budget, "frame %u started over budget\n", frame);
+
+        pinned = cell_key (text, 0, 0);
+        if (!text_layout_cache_find (&cache, &pinned)) {
+            TEST_CHECK (frame == 0, "layout used every frame was evicted in frame %u\n", frame);
+            insert_layout (&cache, &pinned);
+        }
+
+        for (Uint32 c = 1; c <= 50; c++) {
+            TextLayoutKey key = cell_key (text, frame * 50 + c, 0);
+            insert_layout (&cache, &key);
+        }
+    }
+    TEST_CHECK (cache.evictions, "cache over budget must evict\n");
+
+    /* layouts of latest frames survive, layouts of oldest frames are gone */
+    text_layout_cache_begin_frame (&cache);
+    TextLayoutKey key = cell_key (text, 19 * 50 + 1, 0);
+    TEST_CHECK (layout_matches (text_layout_cache_find (&cache, &key), &key), "newest evicted\n");
+    key = cell_key (text, 1, 0);
+    TEST_CHECK (!text_layout_cache_find (&cache, &key), "oldest layout was not evicted\n");
+
+    /* every remaining layout is still reachable after all the removals */
+    Size found = 0;
+    for (Uint32 c = 0; c <= 20 * 50; c++) {
+        key                = cell_key (text, c, 0);
+        TextLayout *layout = text_layout_cache_find (&cache, &key);
+        if (layout) {
+            TEST_CHECK (layout_matches (layout, &key), "wrong layout for cell %u\n", c);
+            found++;
+        }
+    }
+    TEST_CHECK (
+        found == cache.layout_count,
+        "found %zu of %u layouts\n",
+        found,
+        cache.layout_count
+    );
+
+    text_layout_cache_deinit (&cache);
+}
+
+int main() {
+    Uint64 allocations = live_allocations();
+
+    test_grid_relabel();
+    test_eviction();
+
+    TEST_CHECK (live_allocations() == allocations, "text layout cache leaked memory\n");
+
+    if (test_failures) {
+        fprintf (stderr, "%zu checks failed\n", test_failures);
+        return EXIT_FAILURE;
+    }
+
+    printf ("all text layout cache checks passed\n");
+    return EXIT_SUCCESS;
+}
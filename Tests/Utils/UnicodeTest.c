@@ -0,0 +1,302 @@
+/**
+ * @file UnicodeTest.c
+ * @date Sun, 18th October 2026
+ * @author Siddharth Mishra (admin@brightprogrammer.in)
+ * @copyright Copyright 2024 Siddharth Mishra
+ * @copyright Copyright 2024 Anvie Labs
+ *
+ * Copyright 2024 Siddharth Mishra, Anvie Labs
+ * 
+ * Redistribution and use in source and binary forms, with or without modification, are permitted 
+ * provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+ *    and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions
+ *    and the following disclaimer in the documentation and/or other materials provided with the
+ *    distribution.
+ * 
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse
+ *    or promote products derived from this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND 
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * */
+
+/**
+ * @b Tests for UTF-8 validation and decoding on every supported instruction
+ * set, and for line break opportunities.
+ *
+ * Vector kernels are compared against scalar kernel on random text, built to
+ * hit block boundaries with ASCII runs, multi-byte sequences and garbage.
+ * */
+
+#include <Anvie/Common.h>
+#include <Anvie/Types.h>
+
+/* crossgui-utils */
+#include <Anvie/CrossGui/Utils/Unicode.h>
+
+/* libc */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* local includes */
+#include "Test.h"
+
+#define TEXT_MAX_LENGTH 256
+
+static Size test_failures = 0;
+
+/**
+ * @b Encode a codepoint as UTF-8, without checking it's a valid scalar value.
+ * */
+static Size encode (Uint8 *out, Uint32 codepoint) {
+    if (codepoint < 0x80) {
+        out[0] = codepoint;
+        return 1;
+    } else if (codepoint < 0x800) {
+        out[0] = 0xc0 | (codepoint >> 6);
+        out[1] = 0x80 | (codepoint & 0x3f);
+        return 2;
+    } else if (codepoint < 0x10000) {
+        out[0] = 0xe0 | (codepoint >> 12);
+        out[1] = 0x80 | ((codepoint >> 6) & 0x3f);
+        out[2] = 0x80 | (codepoint & 0x3f);
+        return 3;
+    }
+    out[0] = 0xf0 | (codepoint >> 18);
+    out[1] = 0x80 | ((codepoint >> 12) & 0x3f);
+    out[2] = 0x80 | ((codepoint >> 6) & 0x3f);
+    out[3] = 0x80 | (codepoint & 0x3f);
+    return 4;
+}
+
+/**
+ * @b Fill text with valid UTF-8, mostly ASCII, with some multi-byte sequences.
+ *
+ * @return Length of text in bytes, and codepoints it encodes in @p codepoints.
+ * */
+static Size random_valid_text (Uint64 *rng, Uint8 *text, Uint32 *codepoints, Size *count) {
+    Size length = 0;
+    *count      = 0;
+
+    while (length + 4 <= TEXT_MAX_LENGTH && test_rand_u64 (rng) % 64) {
+        Uint32 codepoint;
+        switch (test_rand_u64 (rng) % 8) {
+            case 0 :
+                codepoint = 0x80 + test_rand_u64 (rng) % (0x800 - 0x80);
+                break;
+            case 1 :
+                codepoint = 0x800 + test_rand_u64 (rng) % (0xd800 - 0x800);
+                break;
+            case 2 :
+                codepoint = 0x10000 + test_rand_u64 (rng) % (0x110000 - 0x10000);
+                break;
+            default :
+                codepoint = test_rand_u64 (rng) % 0x80;
+                break;
+        }
+        length                += encode (text + length, codepoint);
+        codepoints[(*count)++] = codepoint;
+    }
+
+    return length;
+}
+
+/**
+ * @b Corrupt a few bytes of text, or truncate it in middle of a sequence.
+ * */
+static Size corrupt_text (Uint64 *rng, Uint8 *text, Size length) {
+    if (!length) {
+        return length;
+    }
+
+    Size corruptions = 1 + test_rand_u64 (rng) % 3;
+    for (Size c = 0; c < corruptions; c++) {
+        Size pos = test_rand_u64 (rng) % length;
+        switch (test_rand_u64 (rng) % 4) {
+            case 0 :
+                text[pos] = 0x80 + test_rand_u64 (rng) % 0x80; /* continuation or lead */
+                break;
+            case 1 :
+                text[pos] = 0xf5 + test_rand_u64 (rng) % 11; /* never valid */
+                break;
+            case 2 :
+                text[pos] = test_rand_u64 (rng) % 0x80; /* break a sequence */
+                break;
+            default :
+                return pos + 1; /* truncate */
+        }
+    }
+
+    return length;
+}
+
+static void test_known_sequences (MathsIsa isa) {
+    static const struct {
+        CString bytes;
+        Bool    is_valid;
+    } cases[] = {
+        {"", True},
+        {"plain ascii", True},
+        {"\xc3\xa9t\xc3\xa9", True},                 /* été */
+        {"\xe2\x82\xac", True},                      /* U+20AC */
+        {"\xf0\x9f\x98\x80", True},                  /* U+1F600 */
+        {"\xf4\x8f\xbf\xbf", True},                  /* U+10FFFF */
+        {"\xef\xbf\xbd", True},                      /* U+FFFD itself */
+        {"\xc0\xaf", False},                         /* overlong 2 byte */
+        {"\xe0\x80\xaf", False},                     /* overlong 3 byte */
+        {"\xf0\x80\x80\xaf", False},                 /* overlong 4 byte */
+        {"\xed\xa0\x80", False},                     /* surrogate */
+        {"\xf4\x90\x80\x80", False},                 /* above U+10FFFF */
+        {"\xf8\x88\x80\x80\x80", False},             /* 5 byte */
+        {"\x80", False},                             /* lone continuation */
+        {"\xe2\x82", False},                         /* truncated */
+        {"\xe2\x82x", False},                        /* broken */
+        {"\xc3\xa9\xa9", False},                     /* extra continuation */
+        {"0123456789012345678901234567890\xe2", False}, /* truncated at block end */
+    };
+
+    for (Size c = 0; c < sizeof (cases) / sizeof (cases[0]); c++) {
+        Size length = strlen (cases[c].bytes);
+        TEST_CHECK (
+            utf8_validate (cases[c].bytes, length) == cases[c].is_valid,
+            "[%s] case %zu validated wrong\n",
+            maths_isa_name (isa),
+            c
+        );
+    }
+
+    /* each byte of an ill formed sequence becomes a replacement character */
+    Uint32 codepoints[8];
+    Size   count = utf8_decode (codepoints, "a\xe2\x82z\xc3\xa9", 6);
+    TEST_CHECK (count == 5, "[%s] decoded %zu codepoints\n", maths_isa_name (isa), count);
+    TEST_CHECK (
+        codepoints[0] == 'a' && codepoints[1] == 0xfffd && codepoints[2] == 0xfffd &&
+            codepoints[3] == 'z' && codepoints[4] == 0xe9,
+        "[%s] ill formed text decoded wrong\n",
+        maths_isa_name (isa)
+    );
+}
+
+static void test_random_text (MathsIsa isa) {
+    static Uint8  text[TEXT_MAX_LENGTH];
+    static Uint32 expected[TEXT_MAX_LENGTH], decoded[TEXT_MAX_LENGTH];
+
+    Uint64 rng = 0x5eed + isa;
+    for (Size t = 0; t < 20000; t++) {
+        Size count;
+        Size length = random_valid_text (&rng, text, expected, &count);
+
+        TEST_CHECK (
+            utf8_validate ((Char *)text, length),
+            "[%s] valid text rejected\n",
+            maths_isa_name (isa)
+        );
+        Size decoded_count = utf8_decode (decoded, (Char *)text, length);
+        TEST_CHECK (
+            decoded_count == count && !memcmp (decoded, expected, count * sizeof (Uint32)),
+            "[%s] valid text decoded wrong\n",
+            maths_isa_name (isa)
+        );
+
+        /* scalar kernel is the reference for ill formed text */
+        length = corrupt_text (&rng, text, length);
+
+        unicode_set_isa (MATHS_ISA_SCALAR);
+        Bool is_valid = utf8_validate ((Char *)text, length);
+        count         = utf8_decode (expected, (Char *)text, length);
+        unicode_set_isa (isa);
+
+        TEST_CHECK (
+            utf8_validate ((Char *)text, length) == is_valid,
+            "[%s] validation differs from scalar\n",
+            maths_isa_name (isa)
+        );
+        decoded_count = utf8_decode (decoded, (Char *)text, length);
+        TEST_CHECK (
+            decoded_count == count && !memcmp (decoded, expected, count * sizeof (Uint32)),
+            "[%s] decoding differs from scalar\n",
+            maths_isa_name (isa)
+        );
+    }
+}
+
+/**
+ * @b Check break opportunities of given text against a pattern with one
+ * character per codepoint : '.' for none, '/' for allowed, '!' for mandatory.
+ * */
+static void check_breaks (CString text, CString pattern) {
+    Uint32 codepoints[64];
+    Uint8  breaks[64];
+    Char   found[65] = {0};
+
+    Size count = utf8_decode (codepoints, text, strlen (text));
+    line_break_find (breaks, codepoints, count);
+    for (Size c = 0; c < count; c++) {
+        found[c] = breaks[c] == LINE_BREAK_MANDATORY ? '!' :
+                   breaks[c] == LINE_BREAK_ALLOWED   ? '/' :
+                                                       '.';
+    }
+
+    TEST_CHECK (!strcmp (found, pattern), "breaks of \"%s\" are %s\n", text, found);
+}
+
+static void test_line_breaks() {
+    TEST_CHECK (line_break_class ('a') == LINE_BREAK_CLASS_AL, "wrong class of 'a'\n");
+    TEST_CHECK (line_break_class (0x4e2d) == LINE_BREAK_CLASS_ID, "wrong class of U+4E2D\n");
+    TEST_CHECK (line_break_class (0x0301) == LINE_BREAK_CLASS_CM, "wrong class of U+0301\n");
+    TEST_CHECK (line_break_class (0x00a0) == LINE_BREAK_CLASS_GL, "wrong class of U+00A0\n");
+    TEST_CHECK (line_break_class (0x3001) == LINE_BREAK_CLASS_CL, "wrong class of U+3001\n");
+    TEST_CHECK (line_break_class (0x10ffff) == LINE_BREAK_CLASS_AL, "wrong class of U+10FFFF\n");
+
+    check_breaks ("", "");
+    check_breaks ("word", "...!");
+    check_breaks ("two words", ".../....!");
+    check_breaks ("a\nb", ".!!");
+    check_breaks ("a\r\nb", "..!!");
+    check_breaks ("a\rb", ".!!");
+    check_breaks ("  indented", ".........!");
+    check_breaks ("(foo) bar", "...../..!");
+    check_breaks ("stop . now", "....../..!");
+    check_breaks ("well-known", "..../....!");
+    check_breaks ("costs $100 now", "...../..../..!");
+    check_breaks ("a\xc2\xa0" "b", "..!");
+    check_breaks ("e\xcc\x81 x", "../!");
+    check_breaks ("\xe4\xb8\xad\xe6\x96\x87\xe3\x80\x82", "/.!");
+    check_breaks ("a\xe2\x80\x8b" "b", "./!");
+}
+
+int main() {
+    MathsIsa best = unicode_get_isa();
+    printf ("utf-8 kernels dispatched to : %s\n", maths_isa_name (best));
+
+    for (MathsIsa isa = MATHS_ISA_SCALAR; isa < MATHS_ISA_MAX; isa++) {
+        if (!unicode_set_isa (isa)) {
+            continue;
+        }
+
+        test_known_sequences (isa);
+        test_random_text (isa);
+    }
+    unicode_set_isa (best);
+
+    test_line_breaks();
+
+    if (test_failures) {
+        fprintf (stderr, "%zu checks failed\n", test_failures);
+        return EXIT_FAILURE;
+    }
+
+    printf ("all unicode checks passed\n");
+    return EXIT_SUCCESS;
+}
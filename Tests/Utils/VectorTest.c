@@ -0,0 +1,218 @@
+/**
+ * @file VectorTest.c
+ * @date Sun, 18th October 2026
+ * @author Siddharth Mishra (admin@brightprogrammer.in)
+ * @copyright Copyright 2024 Siddharth Mishra
+ * @copyright Copyright 2024 Anvie Labs
+ *
+ * Copyright 2024 Siddharth Mishra, Anvie Labs
+ * 
+ * Redistribution and use in source and binary forms, with or without modification, are permitted 
+ * provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions
+ *    and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions
+ *    and the following disclaimer in the documentation and/or other materials provided with the
+ *    distribution.
+ * 
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse
+ *    or promote products derived from this software without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS” AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND 
+ * FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+ * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * */
+
+/**
+ * @b Tests for typed vectors generated by NEW_VECTOR_TYPE.
+ *
+ * Covers transitions between inline and heap storage, growth policy, zeroing
+ * guarantees and that no heap memory is leaked by any of the methods.
+ * */
+
+#include <Anvie/Common.h>
+#include <Anvie/Types.h>
+
+/* crossgui-utils */
+#include <Anvie/CrossGui/Utils/Allocator.h>
+#include <Anvie/CrossGui/Utils/Vector.h>
+
+/* libc */
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* local includes */
+#include "Test.h"
+
+typedef struct Entry {
+    Uint32  id;
+    Float32 value[3];
+} Entry;
+
+NEW_HEAP_VECTOR_STRUCT (Entry, EntryVector);
+NEW_VECTOR_STRUCT (Entry, InlineEntryVector, 4);
+NEW_VECTOR_TYPE (Entry, EntryVector, entry);
+NEW_VECTOR_TYPE (Entry, InlineEntryVector, inline_entry);
+
+static Size test_failures = 0;
+
+static Entry make_entry (Uint32 id) {
+    return (Entry) {
+        .id    = id,
+        .value = {(Float32)id, (Float32)id * 2, (Float32)id * 3}
+    };
+}
+
+/**
+ * @b Check that entries of given vector are exactly @c 0..count-1 in order.
+ * */
+static Bool entries_are_sequential (Entry *data, Size count) {
+    for (Size s = 0; s < count; s++) {
+        Entry expected = make_entry (s);
+        if (memcmp (data + s, &expected, sizeof (Entry))) {
+            return False;
+        }
+    }
+
+    return True;
+}
+
+static Uint64 live_allocations() {
+    AllocatorStats stats = {0};
+    allocator_get_stats (ALLOCATOR_TAG, &stats);
+    return stats.live_allocations;
+}
+
+static void test_grow_capacity() {
+    TEST_CHECK (vector_grow_capacity (0, 1) == 4, "minimum capacity must be 4\n");
+    TEST_CHECK (vector_grow_capacity (8, 5) == 8, "must not grow if already large enough\n");
+    TEST_CHECK (vector_grow_capacity (4, 5) == 8, "must grow to next power of two\n");
+    TEST_CHECK (vector_grow_capacity (8, 9) == 16, "must grow to next power of two\n");
+    TEST_CHECK (vector_grow_capacity (16, 1000) == 1024, "must jump to required capacity\n");
+    TEST_CHECK (vector_grow_capacity (0, 1024) == 1024, "exact power of two must be kept\n");
+}
+
+static void test_heap_vector() {
+    Uint64      allocations = live_allocations();
+    EntryVector vec         = {0};
+
+    /* zero initialized vector is valid and empty */
+    TEST_CHECK (!entry_vector_at (&vec, 0), "empty vector must have no entries\n");
+    TEST_CHECK (sizeof (vec) == offsetof (EntryVector, heap) + sizeof (vec.heap), "inline data\n");
+
+    /* empty append must not touch memory, even if there's none yet */
+    TEST_CHECK (entry_vector_append (&vec, Null, 0) && !vec.heap, "empty append must succeed\n");
+
+    for (Uint32 s = 0; s < 100; s++) {
+        Entry  e    = make_entry (s);
+        Entry *slot = entry_vector_push (&vec, &e);
+        TEST_CHECK (slot && slot == entry_vector_at (&vec, s), "push must return new slot\n");
+    }
+    TEST_CHECK (vec.count == 100 && vec.capacity == 128, "unexpected growth : %zu\n", vec.capacity);
+    TEST_CHECK (entries_are_sequential (entry_vector_data (&vec), 100), "entries corrupted\n");
+    TEST_CHECK (!entry_vector_at (&vec, 100), "out of bounds access must fail\n");
+
+    /* pushing without entry must zero the slot, even if memory was used before */
+    entry_vector_resize (&vec, 10, False);
+    Entry *zeroed = entry_vector_push (&vec, Null);
+    TEST_CHECK (zeroed && !zeroed->id && !zeroed->value[0], "pushed slot must be zeroed\n");
+
+    /* resize must only zero new entries when asked to */
+    entry_vector_resize (&vec, 5, False);
+    entry_vector_resize (&vec, 64, True);
+    TEST_CHECK (entries_are_sequential (entry_vector_data (&vec), 5), "resize lost entries\n");
+    Entry zero = {0};
+    for (Size s = 5; s < 64; s++) {
+        TEST_CHECK (!memcmp (entry_vector_at (&vec, s), &zero, sizeof (Entry)), "not zeroed\n");
+    }
+
+    /* bulk append crossing capacity must grow only once */
+    Entry bulk[300];
+    for (Uint32 s = 0; s < ARRAY_SIZE (bulk); s++) {
+        bulk[s] = make_entry (s);
+    }
+    entry_vector_clear (&vec);
+    TEST_CHECK (vec.count == 0 && vec.capacity == 128, "clear must keep memory\n");
+    TEST_CHECK (entry_vector_append (&vec, bulk, ARRAY_SIZE (bulk)), "append failed\n");
+    TEST_CHECK (vec.count == 300 && vec.capacity == 512, "unexpected growth : %zu\n", vec.capacity);
+    TEST_CHECK (entries_are_sequential (entry_vector_data (&vec), 300), "append corrupted\n");
+    TEST_CHECK (entry_vector_append (&vec, Null, 0), "empty append must succeed\n");
+
+    TEST_CHECK (entry_vector_shrink_to_fit (&vec), "shrink failed\n");
+    TEST_CHECK (vec.capacity == 300, "shrink must release unused memory\n");
+    TEST_CHECK (entries_are_sequential (entry_vector_data (&vec), 300), "shrink corrupted\n");
+
+    entry_vector_clear (&vec);
+    TEST_CHECK (entry_vector_shrink_to_fit (&vec), "shrink failed\n");
+    TEST_CHECK (!vec.heap && !vec.capacity, "empty vector must not hold memory\n");
+
+    TEST_CHECK (entry_vector_reserve (&vec, 1000), "reserve failed\n");
+    TEST_CHECK (vec.capacity == 1000 && !vec.count, "reserve must be exact\n");
+
+    entry_vector_deinit (&vec);
+    TEST_CHECK (live_allocations() == allocations, "vector leaked memory\n");
+}
+
+static void test_inline_vector() {
+    Uint64            allocations = live_allocations();
+    InlineEntryVector vec;
+
+    TEST_CHECK (inline_entry_vector_init (&vec, 0), "init failed\n");
+    TEST_CHECK (vec.capacity == 4, "inline storage must be usable right away\n");
+
+    for (Uint32 s = 0; s < 4; s++) {
+        inline_entry_vector_push (&vec, &(Entry) {0})->id = s;
+    }
+    TEST_CHECK (!vec.heap, "must not allocate while entries fit inline\n");
+    TEST_CHECK (live_allocations() == allocations, "must not allocate while entries fit inline\n");
+
+    /* vector with inline storage must be relocatable */
+    InlineEntryVector moved;
+    memcpy (&moved, &vec, sizeof (vec));
+    memset (&vec, 0xcd, sizeof (vec));
+    for (Uint32 s = 0; s < 4; s++) {
+        Entry *e = inline_entry_vector_at (&moved, s);
+        TEST_CHECK (e && e->id == s, "moved vector lost entries\n");
+    }
+
+    /* spill over to heap, and come back to inline storage */
+    for (Uint32 s = 0; s < 4; s++) {
+        *inline_entry_vector_at (&moved, s) = make_entry (s);
+    }
+    Entry e = make_entry (4);
+    inline_entry_vector_push (&moved, &e);
+    TEST_CHECK (moved.heap && moved.capacity == 8, "must spill to heap when full\n");
+    TEST_CHECK (entries_are_sequential (moved.heap, 5), "spill lost entries\n");
+
+    inline_entry_vector_resize (&moved, 3, False);
+    TEST_CHECK (inline_entry_vector_shrink_to_fit (&moved), "shrink failed\n");
+    TEST_CHECK (!moved.heap && moved.capacity == 4, "must return to inline storage\n");
+    TEST_CHECK (entries_are_sequential (moved.inline_data, 3), "shrink lost entries\n");
+    TEST_CHECK (live_allocations() == allocations, "heap memory not released\n");
+
+    inline_entry_vector_deinit (&moved);
+    TEST_CHECK (live_allocations() == allocations, "vector leaked memory\n");
+}
+
+int main() {
+    test_grow_capacity();
+    test_heap_vector();
+    test_inline_vector();
+
+    if (test_failures) {
+        fprintf (stderr, "%zu checks failed\n", test_failures);
+        return EXIT_FAILURE;
+    }
+
+    printf ("all vector checks passed\n");
+    return EXIT_SUCCESS;
+}